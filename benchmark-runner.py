@@ -1,9 +1,17 @@
 import logging
 from re import S
+from subprocess import run
 from sys import argv
 from os import path
 import json
 
+# The benchmark executables (in build/) and the flags that are passed on to
+# them, besides the google benchmark flags:
+BENCHMARK_EXECUTABLES = {
+    'runBenchmarks': [],
+    'runFznBenchmarks': ['fzn_dir', 'fzn_rounds', 'fzn_seed'],
+}
+
 class BenchmarkRunner:
     def __init__(self, arguments):
         self.logger = logging.getLogger('BenchmarkRunner')
@@ -39,29 +47,42 @@ class BenchmarkRunner:
         arguments['dirname'] = dirname
         arguments['filename'] = filename
         arguments['extension'] = extension
+        arguments['num_runs'] = num_runs
+
+        if arguments.get('benchmarks') not in BENCHMARK_EXECUTABLES:
+            raise Exception(
+                'benchmarks must be one of ' +
+                ', '.join(BENCHMARK_EXECUTABLES.keys()))
+
+        return arguments
 
     def run_benchmarks(self):
-        run_benchmarks = path.join(
+        executable = path.join(
             path.dirname(path.realpath(__file__)),
             'build',
-            'runBenchmarks'
+            self.arguments['benchmarks']
         )
+        executable_flags = [
+            f'--{flag}={self.arguments[flag]}'
+            for flag in BENCHMARK_EXECUTABLES[self.arguments['benchmarks']]
+            if self.arguments.get(flag, None) is not None
+        ]
 
-        for run in range(1, self.arguments['num_runs'] + 1):
+        for run_index in range(1, self.arguments['num_runs'] + 1):
             filename = path.join(
-              arguments['dirname'],
-              f"{arguments['filename']}-{run}{arguments['extension']}"
+              self.arguments['dirname'],
+              f"{self.arguments['filename']}-{run_index}"
+              f"{self.arguments['extension']}"
+            )
+            run(
+                args=[
+                    executable,
+                    '--benchmark_format=json',
+                    f'--benchmark_out={filename}',
+                    *executable_flags
+                ],
+                check=True
             )
-        process = run(
-            args=[
-                '--benchmark_format=json',
-                f'--benchmark_out={filename}',
-                f'--benchmark_repetitions={num_runs}'
-            ],
-            returncode=0
-        )
-            
-        
 
     def retrieve_json(self):
         json_data = []
@@ -73,7 +94,7 @@ class BenchmarkRunner:
 
     def retrieve_benchmarks(self, json_data):
         benchmark_instances = dict()
-        for tuple in zip(self.arguments.get('input'), json_data):
+        for tuple in zip(self.arguments.get('input', []), json_data):
             benchmark_instances[tuple[0]] = self.parse_json_instance(tuple[1])
         
         return self.merge_benchmark_instances(benchmark_instances)
@@ -237,6 +258,10 @@ if __name__ == "__main__":
         # key: default value
         'num_runs': '10',
         'output': 'benchmark-json/tmp.json',
+        'benchmarks': 'runBenchmarks',
+        'fzn_dir': None,
+        'fzn_rounds': None,
+        'fzn_seed': None,
     }
     
     for f in arguments.keys():
@@ -247,6 +272,4 @@ if __name__ == "__main__":
         arguments[f] = argument
 
     benchmark_runner = BenchmarkRunner(arguments)
-    benchmark_runner.run_benchmarks()
-    benchmark_runner.average()
-    benchmark_runner.save()
\ No newline at end of file
+    benchmark_runner.run_benchmarks()
\ No newline at end of file
@@ -0,0 +1,114 @@
+#include <benchmark/benchmark.h>
+
+#include <iostream>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "../benchmark.hpp"
+#include "atlantis/propagation/invariants/max.hpp"
+#include "atlantis/propagation/invariants/min.hpp"
+#include "atlantis/propagation/solver.hpp"
+
+namespace atlantis::benchmark {
+
+/**
+ * output_min <- min(inputs) and output_max <- max(inputs), where each move
+ * changes a single input. Measures the per-move cost as a function of the
+ * number of inputs.
+ */
+class ArrayMinMax : public ::benchmark::Fixture {
+ public:
+  std::unique_ptr<propagation::Solver> solver;
+  std::vector<propagation::VarViewId> inputs;
+  propagation::VarViewId minOutput{propagation::NULL_ID};
+  propagation::VarViewId maxOutput{propagation::NULL_ID};
+  std::random_device rd;
+  std::mt19937 gen;
+
+  std::uniform_int_distribution<size_t> inputIndexDist;
+  std::uniform_int_distribution<Int> valueDist;
+  size_t numInputs{0};
+
+  void SetUp(const ::benchmark::State& state) override {
+    solver = std::make_unique<propagation::Solver>();
+    numInputs = static_cast<size_t>(state.range(0));
+    const Int ub = static_cast<Int>(numInputs) * 4;
+
+    gen = std::mt19937(rd());
+    valueDist = std::uniform_int_distribution<Int>{0, ub};
+    inputIndexDist = std::uniform_int_distribution<size_t>{0, numInputs - 1};
+
+    solver->open();
+    setSolverMode(*solver, static_cast<int>(state.range(1)));
+
+    inputs.reserve(numInputs);
+    for (size_t i = 0; i < numInputs; ++i) {
+      inputs.emplace_back(solver->makeIntVar(valueDist(gen), 0, ub));
+    }
+    minOutput = solver->makeIntVar(0, 0, ub);
+    solver->makeInvariant<propagation::Min>(
+        *solver, minOutput, std::vector<propagation::VarViewId>(inputs));
+    maxOutput = solver->makeIntVar(0, 0, ub);
+    solver->makeInvariant<propagation::Max>(
+        *solver, maxOutput, std::vector<propagation::VarViewId>(inputs));
+
+    solver->close();
+  }
+
+  void TearDown(const ::benchmark::State&) override { inputs.clear(); }
+};
+
+BENCHMARK_DEFINE_F(ArrayMinMax, probe_single)(::benchmark::State& st) {
+  size_t probes = 0;
+  for ([[maybe_unused]] const auto& _ : st) {
+    solver->beginMove();
+    solver->setValue(inputs[inputIndexDist(gen)], valueDist(gen));
+    solver->endMove();
+
+    solver->beginProbe();
+    solver->query(minOutput);
+    solver->query(maxOutput);
+    solver->endProbe();
+    ++probes;
+  }
+  st.counters["probes_per_second"] = ::benchmark::Counter(
+      static_cast<double>(probes), ::benchmark::Counter::kIsRate);
+}
+
+BENCHMARK_DEFINE_F(ArrayMinMax, commit_single)(::benchmark::State& st) {
+  size_t commits = 0;
+  for ([[maybe_unused]] const auto& _ : st) {
+    solver->beginMove();
+    solver->setValue(inputs[inputIndexDist(gen)], valueDist(gen));
+    solver->endMove();
+
+    solver->beginCommit();
+    solver->query(minOutput);
+    solver->query(maxOutput);
+    solver->endCommit();
+    ++commits;
+  }
+  st.counters["commits_per_second"] = ::benchmark::Counter(
+      static_cast<double>(commits), ::benchmark::Counter::kIsRate);
+}
+
+static void arrayMinMaxArguments(::benchmark::internal::Benchmark* b) {
+  for (Int numInputs = 16; numInputs <= 16384; numInputs *= 4) {
+    for (Int mode = 0; mode <= 3; ++mode) {
+      b->Args({numInputs, mode});
+    }
+#ifndef NDEBUG
+    return;
+#endif
+  }
+}
+
+BENCHMARK_REGISTER_F(ArrayMinMax, probe_single)
+    ->Unit(::benchmark::kMicrosecond)
+    ->Apply(arrayMinMaxArguments);
+BENCHMARK_REGISTER_F(ArrayMinMax, commit_single)
+    ->Unit(::benchmark::kMicrosecond)
+    ->Apply(arrayMinMaxArguments);
+
+}  // namespace atlantis::benchmark
@@ -0,0 +1,129 @@
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "../benchmark.hpp"
+#include "atlantis/propagation/invariants/linear.hpp"
+#include "atlantis/propagation/solver.hpp"
+#include "atlantis/propagation/violationInvariants/allDifferent.hpp"
+
+namespace atlantis::benchmark {
+
+/**
+ * allDifferent(inputs[0] + inputs[1], inputs[1] + inputs[2], ...), where
+ * every move swaps two inputs, is probed, and is then accepted. The move is
+ * accepted either by propagating it again, or by committing the values that
+ * the probe computed.
+ */
+class CommitProbe : public ::benchmark::Fixture {
+ public:
+  std::unique_ptr<propagation::Solver> solver;
+  std::vector<propagation::VarViewId> inputs;
+  std::random_device rd;
+  std::mt19937 gen;
+
+  std::uniform_int_distribution<size_t> inputIndexDist;
+  size_t inputCount{0};
+
+  propagation::VarViewId violation{propagation::NULL_ID};
+
+  void SetUp(const ::benchmark::State& state) override {
+    solver = std::make_unique<propagation::Solver>();
+    inputCount = static_cast<size_t>(state.range(0));
+
+    solver->open();
+    setSolverMode(*solver, static_cast<int>(state.range(1)));
+
+    inputs.reserve(inputCount);
+    for (size_t i = 0; i < inputCount; ++i) {
+      inputs.emplace_back(solver->makeIntVar(
+          static_cast<Int>(i), 0, static_cast<Int>(inputCount) - 1));
+    }
+
+    std::vector<propagation::VarViewId> sums;
+    sums.reserve(inputCount - 1);
+    for (size_t i = 0; i + 1 < inputCount; ++i) {
+      sums.emplace_back(solver->makeIntVar(
+          0, 0, 2 * (static_cast<Int>(inputCount) - 1)));
+      solver->makeInvariant<propagation::Linear>(
+          *solver, sums.back(),
+          std::vector<propagation::VarViewId>{inputs[i], inputs[i + 1]});
+    }
+
+    violation = solver->makeIntVar(0, 0, static_cast<Int>(inputCount));
+    solver->makeViolationInvariant<propagation::AllDifferent>(
+        *solver, violation, std::move(sums));
+
+    solver->close();
+
+    gen = std::mt19937(rd());
+    inputIndexDist = std::uniform_int_distribution<size_t>{0, inputCount - 1};
+  }
+
+  void TearDown(const ::benchmark::State&) override { inputs.clear(); }
+
+  void swap(size_t i, size_t j) {
+    const Int value = solver->committedValue(inputs[i]);
+    solver->beginMove();
+    solver->setValue(inputs[i], solver->committedValue(inputs[j]));
+    solver->setValue(inputs[j], value);
+    solver->endMove();
+  }
+
+  void probeSwap(size_t i, size_t j) {
+    swap(i, j);
+    solver->beginProbe();
+    solver->query(violation);
+    solver->endProbe();
+  }
+};
+
+BENCHMARK_DEFINE_F(CommitProbe, accept_by_propagating)
+(::benchmark::State& st) {
+  size_t accepted = 0;
+  for ([[maybe_unused]] const auto& _ : st) {
+    const size_t i = inputIndexDist(gen);
+    const size_t j = inputIndexDist(gen);
+    probeSwap(i, j);
+
+    swap(i, j);
+    solver->beginCommit();
+    solver->query(violation);
+    solver->endCommit();
+    ++accepted;
+  }
+  st.counters["accepted_per_second"] = ::benchmark::Counter(
+      static_cast<double>(accepted), ::benchmark::Counter::kIsRate);
+}
+
+BENCHMARK_DEFINE_F(CommitProbe, accept_by_committing_probe)
+(::benchmark::State& st) {
+  size_t accepted = 0;
+  for ([[maybe_unused]] const auto& _ : st) {
+    const size_t i = inputIndexDist(gen);
+    const size_t j = inputIndexDist(gen);
+    probeSwap(i, j);
+
+    if (solver->canCommitLastProbe(solver->currentTimestamp())) {
+      solver->commitLastProbe();
+    } else {
+      swap(i, j);
+      solver->beginCommit();
+      solver->query(violation);
+      solver->endCommit();
+    }
+    ++accepted;
+  }
+  st.counters["accepted_per_second"] = ::benchmark::Counter(
+      static_cast<double>(accepted), ::benchmark::Counter::kIsRate);
+}
+
+// Only input-to-output probes (mode 0) can be committed:
+BENCHMARK_REGISTER_F(CommitProbe, accept_by_propagating)
+    ->ArgsProduct({{16, 128, 1024}, {0, 2}});
+BENCHMARK_REGISTER_F(CommitProbe, accept_by_committing_probe)
+    ->ArgsProduct({{16, 128, 1024}, {0, 2}});
+
+}  // namespace atlantis::benchmark
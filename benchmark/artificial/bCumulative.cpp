@@ -0,0 +1,159 @@
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "../benchmark.hpp"
+#include "atlantis/propagation/invariants/linear.hpp"
+#include "atlantis/propagation/solver.hpp"
+#include "atlantis/propagation/views/inIntervalConst.hpp"
+#include "atlantis/propagation/violationInvariants/cumulative.hpp"
+#include "atlantis/propagation/violationInvariants/lessEqual.hpp"
+
+namespace atlantis::benchmark {
+
+/**
+ * A cumulative constraint over n tasks with fixed durations and requirements
+ * and variable starts in [0, horizon), where the horizon is a multiple of n,
+ * either using the Cumulative invariant or the time-based decomposition that
+ * MiniZinc produces when cumulative is not supported natively:
+ *
+ *   forall (t in 0..horizon + maxDuration - 2) (
+ *     sum (i in tasks) (r[i] * (s[i] <= t /\ t < s[i] + d[i])) <= b
+ *   )
+ */
+class Cumulative : public ::benchmark::Fixture {
+ public:
+  std::unique_ptr<propagation::Solver> solver;
+  std::vector<propagation::VarViewId> starts;
+  std::mt19937 gen;
+  std::uniform_int_distribution<size_t> taskDist;
+  std::uniform_int_distribution<Int> startDist;
+  propagation::VarViewId violation{propagation::NULL_ID};
+
+  void SetUp(const ::benchmark::State& state) override {
+    const auto numTasks = static_cast<size_t>(state.range(0));
+    const bool decomposed = state.range(1) != 0;
+    const Int horizon =
+        static_cast<Int>(state.range(3)) * static_cast<Int>(numTasks);
+    const Int maxDuration = 10;
+
+    gen = std::mt19937(numTasks);
+    taskDist = std::uniform_int_distribution<size_t>(0, numTasks - 1);
+    startDist = std::uniform_int_distribution<Int>(0, horizon - 1);
+    std::uniform_int_distribution<Int> durationDist(1, maxDuration);
+    std::uniform_int_distribution<Int> requirementDist(1, 5);
+
+    solver = std::make_unique<propagation::Solver>();
+    solver->open();
+    setSolverMode(*solver, static_cast<int>(state.range(2)));
+
+    starts.clear();
+    std::vector<Int> durations;
+    std::vector<Int> requirements;
+    Int totalRequirement = 0;
+    for (size_t i = 0; i < numTasks; ++i) {
+      starts.emplace_back(solver->makeIntVar(startDist(gen), 0, horizon - 1));
+      durations.emplace_back(durationDist(gen));
+      requirements.emplace_back(requirementDist(gen));
+      totalRequirement += requirements.back();
+    }
+    const Int capacity = totalRequirement / 8;
+
+    if (!decomposed) {
+      std::vector<propagation::VarViewId> durationVars;
+      std::vector<propagation::VarViewId> requirementVars;
+      for (size_t i = 0; i < numTasks; ++i) {
+        durationVars.emplace_back(
+            solver->makeIntVar(durations[i], durations[i], durations[i]));
+        requirementVars.emplace_back(solver->makeIntVar(
+            requirements[i], requirements[i], requirements[i]));
+      }
+      violation = solver->makeIntVar(0, 0, 0);
+      solver->makeViolationInvariant<propagation::Cumulative>(
+          *solver, violation, std::vector<propagation::VarViewId>(starts),
+          std::move(durationVars), std::move(requirementVars),
+          solver->makeIntVar(capacity, capacity, capacity));
+    } else {
+      std::vector<propagation::VarViewId> violations;
+      for (Int t = 0; t < horizon + maxDuration - 1; ++t) {
+        // load(t) = sum(r) - sum(r[i] * (s[i] not in [t - d[i] + 1, t])):
+        std::vector<Int> coeffs;
+        std::vector<propagation::VarViewId> inactive;
+        for (size_t i = 0; i < numTasks; ++i) {
+          coeffs.emplace_back(-requirements[i]);
+          inactive.emplace_back(
+              solver->makeIntView<propagation::InIntervalConst>(
+                  *solver, starts[i], t - durations[i] + 1, t));
+        }
+        const propagation::VarViewId negatedLoad = solver->makeIntVar(0, 0, 0);
+        solver->makeInvariant<propagation::Linear>(
+            *solver, negatedLoad, std::move(coeffs), std::move(inactive));
+        violations.emplace_back(solver->makeIntVar(0, 0, 0));
+        const Int bound = capacity - totalRequirement;
+        solver->makeViolationInvariant<propagation::LessEqual>(
+            *solver, violations.back(), negatedLoad,
+            solver->makeIntVar(bound, bound, bound));
+      }
+      violation = solver->makeIntVar(0, 0, 0);
+      solver->makeInvariant<propagation::Linear>(*solver, violation,
+                                                 std::move(violations));
+    }
+    solver->close();
+  }
+
+  void TearDown(const ::benchmark::State&) override {
+    starts.clear();
+    solver.reset();
+  }
+};
+
+BENCHMARK_DEFINE_F(Cumulative, probe_single_move)(::benchmark::State& st) {
+  size_t probes = 0;
+  for ([[maybe_unused]] const auto& _ : st) {
+    solver->beginMove();
+    solver->setValue(starts[taskDist(gen)], startDist(gen));
+    solver->endMove();
+
+    solver->beginProbe();
+    solver->query(violation);
+    solver->endProbe();
+
+    ++probes;
+  }
+  st.counters["probes_per_second"] = ::benchmark::Counter(
+      static_cast<double>(probes), ::benchmark::Counter::kIsRate);
+  st.counters["vars"] = static_cast<double>(solver->numVars());
+  st.counters["invariants"] = static_cast<double>(solver->numInvariants());
+}
+
+BENCHMARK_DEFINE_F(Cumulative, commit_single_move)(::benchmark::State& st) {
+  size_t commits = 0;
+  for ([[maybe_unused]] const auto& _ : st) {
+    solver->beginMove();
+    solver->setValue(starts[taskDist(gen)], startDist(gen));
+    solver->endMove();
+
+    solver->beginCommit();
+    solver->query(violation);
+    solver->endCommit();
+
+    ++commits;
+  }
+  st.counters["commits_per_second"] = ::benchmark::Counter(
+      static_cast<double>(commits), ::benchmark::Counter::kIsRate);
+}
+
+BENCHMARK_REGISTER_F(Cumulative, probe_single_move)
+    ->ArgsProduct({{16, 64, 256}, {0, 1}, {0, 2}, {4}});
+
+BENCHMARK_REGISTER_F(Cumulative, commit_single_move)
+    ->ArgsProduct({{16, 64, 256}, {0, 1}, {0, 2}, {4}});
+
+// A wide horizon (that the decomposition is too large for), where a move
+// changes the load of only a small part of the profile:
+BENCHMARK_REGISTER_F(Cumulative, commit_single_move)
+    ->ArgsProduct({{16, 256}, {0}, {0, 2}, {4096}});
+
+}  // namespace atlantis::benchmark
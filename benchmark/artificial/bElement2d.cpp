@@ -0,0 +1,87 @@
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "../benchmark.hpp"
+#include "atlantis/propagation/invariants/element2dConst.hpp"
+#include "atlantis/propagation/solver.hpp"
+#include "atlantis/utils/matrix.hpp"
+
+namespace atlantis::benchmark {
+
+/**
+ * output = matrix[row][col], where matrix is an n x n distance matrix (such
+ * as for TSPTW models).
+ */
+class Element2d : public ::benchmark::Fixture {
+ public:
+  std::unique_ptr<propagation::Solver> solver;
+  propagation::Element2dConst* invariant{nullptr};
+  propagation::VarViewId row{propagation::NULL_ID};
+  propagation::VarViewId col{propagation::NULL_ID};
+  propagation::VarViewId output{propagation::NULL_ID};
+  std::random_device rd;
+  std::mt19937 gen;
+
+  std::uniform_int_distribution<Int> indexDist;
+  size_t n{0};
+
+  void SetUp(const ::benchmark::State& state) override {
+    solver = std::make_unique<propagation::Solver>();
+    n = static_cast<size_t>(state.range(0));
+
+    gen = std::mt19937(rd());
+    indexDist = std::uniform_int_distribution<Int>{0, static_cast<Int>(n) - 1};
+    std::uniform_int_distribution<Int> distanceDist{0, 10000};
+
+    solver->open();
+    setSolverMode(*solver, static_cast<int>(state.range(1)));
+
+    Matrix<Int> matrix(n, n, 0);
+    for (size_t i = 0; i < n; ++i) {
+      for (size_t j = 0; j < n; ++j) {
+        matrix(i, j) = distanceDist(gen);
+      }
+    }
+    row = solver->makeIntVar(0, 0, static_cast<Int>(n) - 1);
+    col = solver->makeIntVar(0, 0, static_cast<Int>(n) - 1);
+    output = solver->makeIntVar(0, 0, 10000);
+    invariant = &solver->makeInvariant<propagation::Element2dConst>(
+        *solver, output, row, col, std::move(matrix), 0, 0);
+    solver->close();
+  }
+
+  void TearDown(const ::benchmark::State&) override { invariant = nullptr; }
+};
+
+BENCHMARK_DEFINE_F(Element2d, update_bounds)(::benchmark::State& st) {
+  for ([[maybe_unused]] const auto& _ : st) {
+    invariant->updateBounds(false);
+    ::benchmark::DoNotOptimize(solver->lowerBound(output));
+  }
+}
+
+BENCHMARK_DEFINE_F(Element2d, probe)(::benchmark::State& st) {
+  size_t probes = 0;
+  for ([[maybe_unused]] const auto& _ : st) {
+    solver->beginMove();
+    solver->setValue(row, indexDist(gen));
+    solver->setValue(col, indexDist(gen));
+    solver->endMove();
+
+    solver->beginProbe();
+    solver->query(output);
+    solver->endProbe();
+    ++probes;
+  }
+  st.counters["probes_per_second"] = ::benchmark::Counter(
+      static_cast<double>(probes), ::benchmark::Counter::kIsRate);
+}
+
+BENCHMARK_REGISTER_F(Element2d, update_bounds)
+    ->ArgsProduct({{100, 2000}, {0}});
+BENCHMARK_REGISTER_F(Element2d, probe)->ArgsProduct({{100, 2000}, {0}});
+
+}  // namespace atlantis::benchmark
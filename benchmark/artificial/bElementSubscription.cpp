@@ -0,0 +1,114 @@
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "../benchmark.hpp"
+#include "atlantis/propagation/invariants/elementVar.hpp"
+#include "atlantis/propagation/invariants/linear.hpp"
+#include "atlantis/propagation/solver.hpp"
+
+namespace atlantis::benchmark {
+
+/**
+ * output = sum(varArray[indices[i]] for i in 0..elementCount - 1), where every
+ * element invariant shares the same array. Every move changes the value of a
+ * single array variable, which is the active input of few (if any) of the
+ * elements.
+ */
+class ElementSubscription : public ::benchmark::Fixture {
+ public:
+  std::unique_ptr<propagation::Solver> solver;
+  std::vector<propagation::VarViewId> varArray;
+  std::vector<propagation::VarViewId> indices;
+  propagation::VarViewId output{propagation::NULL_ID};
+  std::random_device rd;
+  std::mt19937 gen;
+
+  std::uniform_int_distribution<size_t> arrayIndexDist;
+  std::uniform_int_distribution<Int> valueDist;
+  size_t arraySize{0};
+  size_t elementCount{0};
+
+  void SetUp(const ::benchmark::State& state) override {
+    solver = std::make_unique<propagation::Solver>();
+    arraySize = static_cast<size_t>(state.range(0));
+    elementCount = static_cast<size_t>(state.range(1));
+
+    gen = std::mt19937(rd());
+    arrayIndexDist = std::uniform_int_distribution<size_t>{0, arraySize - 1};
+    valueDist = std::uniform_int_distribution<Int>{0, 100};
+
+    solver->open();
+    setSolverMode(*solver, static_cast<int>(state.range(2)));
+
+    varArray.reserve(arraySize);
+    for (size_t i = 0; i < arraySize; ++i) {
+      varArray.emplace_back(solver->makeIntVar(valueDist(gen), 0, 100));
+    }
+    std::vector<propagation::VarViewId> elements;
+    elements.reserve(elementCount);
+    indices.reserve(elementCount);
+    for (size_t i = 0; i < elementCount; ++i) {
+      indices.emplace_back(solver->makeIntVar(
+          static_cast<Int>(arrayIndexDist(gen)), 0,
+          static_cast<Int>(arraySize) - 1));
+      elements.emplace_back(solver->makeIntVar(0, 0, 100));
+      solver->makeInvariant<propagation::ElementVar>(
+          *solver, elements.back(), indices.back(),
+          std::vector<propagation::VarViewId>(varArray), 0);
+    }
+    output = solver->makeIntVar(0, 0, 100 * static_cast<Int>(elementCount));
+    solver->makeInvariant<propagation::Linear>(*solver, output,
+                                               std::move(elements));
+    solver->close();
+  }
+
+  void TearDown(const ::benchmark::State&) override {
+    varArray.clear();
+    indices.clear();
+  }
+};
+
+BENCHMARK_DEFINE_F(ElementSubscription, probe_array_var)
+(::benchmark::State& st) {
+  size_t probes = 0;
+  for ([[maybe_unused]] const auto& _ : st) {
+    solver->beginMove();
+    solver->setValue(varArray[arrayIndexDist(gen)], valueDist(gen));
+    solver->endMove();
+
+    solver->beginProbe();
+    solver->query(output);
+    solver->endProbe();
+    ++probes;
+  }
+  st.counters["probes_per_second"] = ::benchmark::Counter(
+      static_cast<double>(probes), ::benchmark::Counter::kIsRate);
+}
+
+BENCHMARK_DEFINE_F(ElementSubscription, probe_index)(::benchmark::State& st) {
+  std::uniform_int_distribution<size_t> elementDist(0, elementCount - 1);
+  size_t probes = 0;
+  for ([[maybe_unused]] const auto& _ : st) {
+    solver->beginMove();
+    solver->setValue(indices[elementDist(gen)],
+                     static_cast<Int>(arrayIndexDist(gen)));
+    solver->endMove();
+
+    solver->beginProbe();
+    solver->query(output);
+    solver->endProbe();
+    ++probes;
+  }
+  st.counters["probes_per_second"] = ::benchmark::Counter(
+      static_cast<double>(probes), ::benchmark::Counter::kIsRate);
+}
+
+BENCHMARK_REGISTER_F(ElementSubscription, probe_array_var)
+    ->ArgsProduct({{100, 1000}, {10, 100}, {0}});
+BENCHMARK_REGISTER_F(ElementSubscription, probe_index)
+    ->ArgsProduct({{100, 1000}, {10, 100}, {0}});
+
+}  // namespace atlantis::benchmark
@@ -0,0 +1,155 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "../benchmark.hpp"
+#include "atlantis/propagation/invariants/linear.hpp"
+#include "atlantis/propagation/solver.hpp"
+#include "atlantis/propagation/views/equalConst.hpp"
+#include "atlantis/propagation/violationInvariants/boolEqual.hpp"
+#include "atlantis/propagation/violationInvariants/inverse.hpp"
+
+namespace atlantis::benchmark {
+
+/**
+ * An inverse constraint over two arrays f and invf of n variables (both
+ * indexed from 0), either using the Inverse invariant or the decomposition
+ * that MiniZinc produces when inverse is not supported natively:
+ *
+ *   forall (i, j in 0..n-1) ((f[i] == j) <-> (invf[j] == i))
+ *
+ * Each move swaps the values of two variables in f and updates invf
+ * accordingly, which is the move of the inverse neighbourhood.
+ */
+class Inverse : public ::benchmark::Fixture {
+ public:
+  std::unique_ptr<propagation::Solver> solver;
+  std::vector<propagation::VarViewId> f;
+  std::vector<propagation::VarViewId> invf;
+  std::mt19937 gen;
+  std::uniform_int_distribution<size_t> indexDist;
+  propagation::VarViewId violation{propagation::NULL_ID};
+
+  void SetUp(const ::benchmark::State& state) override {
+    const auto n = static_cast<size_t>(state.range(0));
+    const bool decomposed = state.range(1) != 0;
+
+    gen = std::mt19937(n);
+    indexDist = std::uniform_int_distribution<size_t>(0, n - 1);
+
+    solver = std::make_unique<propagation::Solver>();
+    solver->open();
+    setSolverMode(*solver, static_cast<int>(state.range(2)));
+
+    std::vector<size_t> permutation(n);
+    std::iota(permutation.begin(), permutation.end(), 0);
+    std::shuffle(permutation.begin(), permutation.end(), gen);
+
+    f.clear();
+    invf.assign(n, propagation::NULL_ID);
+    const Int ub = static_cast<Int>(n) - 1;
+    for (size_t i = 0; i < n; ++i) {
+      f.emplace_back(
+          solver->makeIntVar(static_cast<Int>(permutation[i]), 0, ub));
+    }
+    for (size_t i = 0; i < n; ++i) {
+      invf[permutation[i]] = solver->makeIntVar(static_cast<Int>(i), 0, ub);
+    }
+
+    violation = solver->makeIntVar(0, 0, 0);
+    if (!decomposed) {
+      solver->makeViolationInvariant<propagation::Inverse>(
+          *solver, violation, std::vector<propagation::VarViewId>(f), 0,
+          std::vector<propagation::VarViewId>(invf), 0);
+    } else {
+      std::vector<propagation::VarViewId> violations;
+      for (size_t i = 0; i < n; ++i) {
+        for (size_t j = 0; j < n; ++j) {
+          violations.emplace_back(solver->makeIntVar(0, 0, 0));
+          solver->makeViolationInvariant<propagation::BoolEqual>(
+              *solver, violations.back(),
+              solver->makeIntView<propagation::EqualConst>(
+                  *solver, f[i], static_cast<Int>(j)),
+              solver->makeIntView<propagation::EqualConst>(
+                  *solver, invf[j], static_cast<Int>(i)));
+        }
+      }
+      solver->makeInvariant<propagation::Linear>(*solver, violation,
+                                                 std::move(violations));
+    }
+    solver->close();
+  }
+
+  void TearDown(const ::benchmark::State&) override {
+    f.clear();
+    invf.clear();
+    solver.reset();
+  }
+
+  void swapMove() {
+    const size_t i1 = indexDist(gen);
+    size_t i2 = indexDist(gen);
+    while (i1 == i2 && f.size() > 1) {
+      i2 = indexDist(gen);
+    }
+    const Int j1 = solver->committedValue(f[i1]);
+    const Int j2 = solver->committedValue(f[i2]);
+    solver->setValue(f[i1], j2);
+    solver->setValue(f[i2], j1);
+    solver->setValue(invf[static_cast<size_t>(j1)], static_cast<Int>(i2));
+    solver->setValue(invf[static_cast<size_t>(j2)], static_cast<Int>(i1));
+  }
+};
+
+BENCHMARK_DEFINE_F(Inverse, probe_swap)(::benchmark::State& st) {
+  size_t probes = 0;
+  for ([[maybe_unused]] const auto& _ : st) {
+    solver->beginMove();
+    swapMove();
+    solver->endMove();
+
+    solver->beginProbe();
+    solver->query(violation);
+    solver->endProbe();
+
+    ++probes;
+  }
+  st.counters["probes_per_second"] = ::benchmark::Counter(
+      static_cast<double>(probes), ::benchmark::Counter::kIsRate);
+  st.counters["vars"] = static_cast<double>(solver->numVars());
+  st.counters["invariants"] = static_cast<double>(solver->numInvariants());
+}
+
+BENCHMARK_DEFINE_F(Inverse, commit_swap)(::benchmark::State& st) {
+  size_t commits = 0;
+  for ([[maybe_unused]] const auto& _ : st) {
+    solver->beginMove();
+    swapMove();
+    solver->endMove();
+
+    solver->beginCommit();
+    solver->query(violation);
+    solver->endCommit();
+
+    ++commits;
+  }
+  st.counters["commits_per_second"] = ::benchmark::Counter(
+      static_cast<double>(commits), ::benchmark::Counter::kIsRate);
+}
+
+BENCHMARK_REGISTER_F(Inverse, probe_swap)
+    ->ArgsProduct({{16, 64, 256}, {0, 1}, {0, 2}});
+
+BENCHMARK_REGISTER_F(Inverse, commit_swap)
+    ->ArgsProduct({{16, 64, 256}, {0, 1}, {0, 2}});
+
+// Arrays that the decomposition is too large for, where a swap changes only
+// four of the 2n variables:
+BENCHMARK_REGISTER_F(Inverse, commit_swap)
+    ->ArgsProduct({{1024, 4096}, {0}, {0, 2}});
+
+}  // namespace atlantis::benchmark
@@ -0,0 +1,210 @@
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "../benchmark.hpp"
+#include "atlantis/propagation/invariants/element2dConst.hpp"
+#include "atlantis/propagation/invariants/linear.hpp"
+#include "atlantis/propagation/solver.hpp"
+#include "atlantis/propagation/views/notEqualConst.hpp"
+#include "atlantis/propagation/violationInvariants/regular.hpp"
+
+namespace atlantis::benchmark {
+
+/**
+ * A nurse rostering style model: each nurse has a sequence of shifts (1 = day,
+ * 2 = evening, 3 = night, 4 = off) that must be accepted by an automaton where
+ * a night shift is only followed by a night shift or a day off, and where at
+ * most maxWork consecutive days are worked. The automaton is either checked
+ * using the Regular invariant, or using the decomposition that MiniZinc
+ * produces when regular is not supported natively:
+ *
+ *   q[0] = q0 /\ forall (t in 1..n) (q[t] = d[q[t - 1], x[t]]) /\ q[n] in F
+ *
+ * where the failure state 0 is absorbing.
+ */
+class Regular : public ::benchmark::Fixture {
+ public:
+  static constexpr Int numShifts = 4;
+  static constexpr Int night = 3;
+  static constexpr Int off = 4;
+  static constexpr Int maxWork = 5;
+
+  std::unique_ptr<propagation::Solver> solver;
+  std::vector<std::vector<propagation::VarViewId>> shifts;
+  std::mt19937 gen;
+  std::uniform_int_distribution<size_t> nurseDist;
+  std::uniform_int_distribution<size_t> dayDist;
+  std::uniform_int_distribution<Int> shiftDist;
+  propagation::VarViewId violation{propagation::NULL_ID};
+
+  // The state (k, isNight), where k is the number of consecutive worked
+  // days, is 1 + 2 * k + isNight:
+  static std::vector<Int> transitions() {
+    std::vector<Int> d;
+    for (Int k = 0; k <= maxWork; ++k) {
+      for (Int isNight = 0; isNight <= 1; ++isNight) {
+        for (Int s = 1; s <= numShifts; ++s) {
+          if (s == off) {
+            d.emplace_back(1);
+          } else if (k == maxWork || (isNight == 1 && s != night)) {
+            d.emplace_back(0);
+          } else {
+            d.emplace_back(1 + 2 * (k + 1) + (s == night ? 1 : 0));
+          }
+        }
+      }
+    }
+    return d;
+  }
+
+  void SetUp(const ::benchmark::State& state) override {
+    const size_t numNurses = 10;
+    const auto numDays = static_cast<size_t>(state.range(0));
+    const bool decomposed = state.range(1) != 0;
+    const Int numStates = 2 * (maxWork + 1);
+
+    gen = std::mt19937(numDays);
+    nurseDist = std::uniform_int_distribution<size_t>(0, numNurses - 1);
+    dayDist = std::uniform_int_distribution<size_t>(0, numDays - 1);
+    shiftDist = std::uniform_int_distribution<Int>(1, numShifts);
+
+    solver = std::make_unique<propagation::Solver>();
+    solver->open();
+    setSolverMode(*solver, static_cast<int>(state.range(2)));
+
+    const std::vector<Int> d = transitions();
+    std::vector<Int> acceptingStates;
+    for (Int q = 1; q <= numStates; ++q) {
+      acceptingStates.emplace_back(q);
+    }
+
+    shifts.assign(numNurses, {});
+    std::vector<propagation::VarViewId> violations;
+    for (size_t n = 0; n < numNurses; ++n) {
+      for (size_t t = 0; t < numDays; ++t) {
+        shifts[n].emplace_back(solver->makeIntVar(off, 1, numShifts));
+      }
+      violations.emplace_back(solver->makeIntVar(0, 0, 0));
+      if (!decomposed) {
+        solver->makeViolationInvariant<propagation::Regular>(
+            *solver, violations.back(),
+            std::vector<propagation::VarViewId>(shifts[n]), numStates,
+            numShifts, std::vector<Int>(d), 1, acceptingStates);
+        continue;
+      }
+      // The matrix includes the failure state 0 as its first row:
+      std::vector<std::vector<Int>> matrix(
+          1, std::vector<Int>(static_cast<size_t>(numShifts), 0));
+      for (Int q = 0; q < numStates; ++q) {
+        matrix.emplace_back(d.begin() + q * numShifts,
+                            d.begin() + (q + 1) * numShifts);
+      }
+      propagation::VarViewId prev = solver->makeIntVar(1, 1, 1);
+      for (size_t t = 0; t < numDays; ++t) {
+        const propagation::VarViewId next =
+            solver->makeIntVar(0, 0, numStates);
+        solver->makeInvariant<propagation::Element2dConst>(
+            *solver, next, prev, shifts[n][t],
+            std::vector<std::vector<Int>>(matrix), 0, 1);
+        prev = next;
+      }
+      // Every state except the failure state is accepting:
+      solver->makeInvariant<propagation::Linear>(
+          *solver, violations.back(),
+          std::vector<propagation::VarViewId>{
+              solver->makeIntView<propagation::NotEqualConst>(*solver, prev,
+                                                              0)});
+    }
+    violation = solver->makeIntVar(0, 0, 0);
+    solver->makeInvariant<propagation::Linear>(*solver, violation,
+                                               std::move(violations));
+    solver->close();
+  }
+
+  // Commits a random shift to every day of every nurse:
+  void randomise() {
+    solver->beginMove();
+    for (const auto& nurseShifts : shifts) {
+      for (const propagation::VarViewId& shift : nurseShifts) {
+        solver->setValue(shift, shiftDist(gen));
+      }
+    }
+    solver->endMove();
+    solver->beginCommit();
+    solver->query(violation);
+    solver->endCommit();
+  }
+
+  void TearDown(const ::benchmark::State&) override {
+    shifts.clear();
+    solver.reset();
+  }
+};
+
+BENCHMARK_DEFINE_F(Regular, probe_single_move)(::benchmark::State& st) {
+  size_t probes = 0;
+  for ([[maybe_unused]] const auto& _ : st) {
+    solver->beginMove();
+    solver->setValue(shifts[nurseDist(gen)][dayDist(gen)], shiftDist(gen));
+    solver->endMove();
+
+    solver->beginProbe();
+    solver->query(violation);
+    solver->endProbe();
+
+    ++probes;
+  }
+  st.counters["probes_per_second"] = ::benchmark::Counter(
+      static_cast<double>(probes), ::benchmark::Counter::kIsRate);
+  st.counters["vars"] = static_cast<double>(solver->numVars());
+  st.counters["invariants"] = static_cast<double>(solver->numInvariants());
+}
+
+BENCHMARK_DEFINE_F(Regular, probe_random_roster)(::benchmark::State& st) {
+  randomise();
+  size_t probes = 0;
+  for ([[maybe_unused]] const auto& _ : st) {
+    solver->beginMove();
+    solver->setValue(shifts[nurseDist(gen)][dayDist(gen)], shiftDist(gen));
+    solver->endMove();
+
+    solver->beginProbe();
+    solver->query(violation);
+    solver->endProbe();
+
+    ++probes;
+  }
+  st.counters["probes_per_second"] = ::benchmark::Counter(
+      static_cast<double>(probes), ::benchmark::Counter::kIsRate);
+}
+
+BENCHMARK_DEFINE_F(Regular, commit_single_move)(::benchmark::State& st) {
+  size_t commits = 0;
+  for ([[maybe_unused]] const auto& _ : st) {
+    solver->beginMove();
+    solver->setValue(shifts[nurseDist(gen)][dayDist(gen)], shiftDist(gen));
+    solver->endMove();
+
+    solver->beginCommit();
+    solver->query(violation);
+    solver->endCommit();
+
+    ++commits;
+  }
+  st.counters["commits_per_second"] = ::benchmark::Counter(
+      static_cast<double>(commits), ::benchmark::Counter::kIsRate);
+}
+
+BENCHMARK_REGISTER_F(Regular, probe_single_move)
+    ->ArgsProduct({{14, 28, 112}, {0, 1}, {0, 2}});
+
+BENCHMARK_REGISTER_F(Regular, probe_random_roster)
+    ->ArgsProduct({{14, 28, 112}, {0, 1}, {0, 2}});
+
+BENCHMARK_REGISTER_F(Regular, commit_single_move)
+    ->ArgsProduct({{14, 28, 112}, {0, 1}, {0, 2}});
+
+}  // namespace atlantis::benchmark
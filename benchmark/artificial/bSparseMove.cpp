@@ -0,0 +1,101 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <iostream>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "../benchmark.hpp"
+#include "atlantis/propagation/invariants/linear.hpp"
+#include "atlantis/propagation/solver.hpp"
+
+namespace atlantis::benchmark {
+
+/**
+ * numSums independent sums output_i <- lhs_i + rhs_i, where each move
+ * changes a single input of one of the first few sums. Every move touches
+ * the same (cached) variables regardless of numSums, so the per-move cost
+ * should not grow with the size of the model.
+ */
+class SparseMove : public ::benchmark::Fixture {
+ public:
+  std::unique_ptr<propagation::Solver> solver;
+  std::vector<propagation::VarViewId> inputs;
+  std::vector<propagation::VarViewId> outputs;
+  std::random_device rd;
+  std::mt19937 gen;
+
+  std::uniform_int_distribution<size_t> inputIndexDist;
+  std::uniform_int_distribution<Int> valueDist;
+  size_t numSums{0};
+  static constexpr size_t numMovedSums = 16;
+
+  void SetUp(const ::benchmark::State& state) override {
+    solver = std::make_unique<propagation::Solver>();
+    numSums = static_cast<size_t>(state.range(0));
+
+    gen = std::mt19937(rd());
+    valueDist = std::uniform_int_distribution<Int>{0, 100};
+    inputIndexDist = std::uniform_int_distribution<size_t>{
+        0, 2 * std::min(numSums, numMovedSums) - 1};
+
+    solver->open();
+    setSolverMode(*solver, static_cast<int>(state.range(1)));
+
+    inputs.reserve(2 * numSums);
+    outputs.reserve(numSums);
+    for (size_t i = 0; i < numSums; ++i) {
+      const propagation::VarViewId lhs =
+          solver->makeIntVar(valueDist(gen), 0, 100);
+      const propagation::VarViewId rhs =
+          solver->makeIntVar(valueDist(gen), 0, 100);
+      inputs.emplace_back(lhs);
+      inputs.emplace_back(rhs);
+      outputs.emplace_back(solver->makeIntVar(0, 0, 200));
+      solver->makeInvariant<propagation::Linear>(
+          *solver, outputs.back(), std::vector<propagation::VarViewId>{lhs, rhs});
+    }
+
+    solver->close();
+  }
+
+  void TearDown(const ::benchmark::State&) override {
+    inputs.clear();
+    outputs.clear();
+  }
+};
+
+BENCHMARK_DEFINE_F(SparseMove, probe_single)(::benchmark::State& st) {
+  size_t probes = 0;
+  for ([[maybe_unused]] const auto& _ : st) {
+    const size_t index = inputIndexDist(gen);
+    solver->beginMove();
+    solver->setValue(inputs[index], valueDist(gen));
+    solver->endMove();
+
+    solver->beginProbe();
+    solver->query(outputs[index / 2]);
+    solver->endProbe();
+    ++probes;
+  }
+  st.counters["probes_per_second"] = ::benchmark::Counter(
+      static_cast<double>(probes), ::benchmark::Counter::kIsRate);
+}
+
+static void sparseMoveArguments(::benchmark::internal::Benchmark* b) {
+  for (Int numSums = 1024; numSums <= 524288; numSums *= 8) {
+    for (Int mode = 0; mode <= 3; ++mode) {
+      b->Args({numSums, mode});
+    }
+#ifndef NDEBUG
+    return;
+#endif
+  }
+}
+
+BENCHMARK_REGISTER_F(SparseMove, probe_single)
+    ->Unit(::benchmark::kMicrosecond)
+    ->Apply(sparseMoveArguments);
+
+}  // namespace atlantis::benchmark
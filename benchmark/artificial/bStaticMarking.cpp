@@ -0,0 +1,77 @@
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+#include "../benchmark.hpp"
+#include "atlantis/propagation/invariants/linear.hpp"
+#include "atlantis/propagation/propagation/searchVarAncestors.hpp"
+#include "atlantis/propagation/solver.hpp"
+
+namespace atlantis::benchmark {
+
+/**
+ * A layered model of numLayers layers of n variables, where every variable
+ * of a layer is the sum of a few variables of the previous layer that are
+ * close to it (the first layer is the search variables). Measures the time of
+ * closing the solver, which includes the computation of the search variable
+ * ancestors when OUTPUT_TO_INPUT_STATIC marking is used.
+ */
+static void static_marking_close(::benchmark::State& st) {
+  const auto n = static_cast<size_t>(st.range(0));
+  const auto mode = static_cast<int>(st.range(1));
+  constexpr size_t numLayers = 16;
+  constexpr size_t numInputs = 4;
+  constexpr size_t window = 8;
+
+  size_t numIntervals = 0;
+  size_t memoryUsage = 0;
+  for ([[maybe_unused]] const auto& _ : st) {
+    st.PauseTiming();
+    std::mt19937 gen(n);
+    std::uniform_int_distribution<size_t> offsetDist(0, window - 1);
+    auto solver = std::make_unique<propagation::Solver>();
+    solver->open();
+    setSolverMode(*solver, mode);
+    std::vector<propagation::VarViewId> layer;
+    layer.reserve(n);
+    for (size_t i = 0; i < n; ++i) {
+      layer.emplace_back(solver->makeIntVar(0, 0, 1));
+    }
+    for (size_t l = 1; l < numLayers; ++l) {
+      std::vector<propagation::VarViewId> next;
+      next.reserve(n);
+      for (size_t i = 0; i < n; ++i) {
+        std::vector<propagation::VarViewId> inputs;
+        inputs.reserve(numInputs);
+        for (size_t j = 0; j < numInputs; ++j) {
+          inputs.emplace_back(layer[(i + offsetDist(gen)) % n]);
+        }
+        next.emplace_back(solver->makeIntVar(0, 0, 0));
+        solver->makeInvariant<propagation::Linear>(*solver, next.back(),
+                                                   std::move(inputs));
+      }
+      layer = std::move(next);
+    }
+    st.ResumeTiming();
+
+    solver->close();
+
+    st.PauseTiming();
+    propagation::SearchVarAncestors ancestors;
+    ancestors.build(*solver);
+    numIntervals = ancestors.numIntervals();
+    memoryUsage = ancestors.memoryUsage();
+    solver.reset();
+    st.ResumeTiming();
+  }
+  st.counters["vars"] = static_cast<double>(n * numLayers);
+  st.counters["intervals"] = static_cast<double>(numIntervals);
+  st.counters["ancestor_bytes"] = static_cast<double>(memoryUsage);
+}
+
+BENCHMARK(static_marking_close)
+    ->Unit(::benchmark::kMillisecond)
+    ->ArgsProduct({{1 << 8, 1 << 10, 1 << 12}, {0, 2}});
+
+}  // namespace atlantis::benchmark
@@ -0,0 +1,128 @@
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "../benchmark.hpp"
+#include "atlantis/propagation/invariants/linear.hpp"
+#include "atlantis/propagation/invariants/min.hpp"
+#include "atlantis/propagation/solver.hpp"
+#include "atlantis/propagation/views/inIntervalConst.hpp"
+#include "atlantis/propagation/violationInvariants/table.hpp"
+
+namespace atlantis::benchmark {
+
+/**
+ * A table constraint over numVars variables and numTuples random tuples,
+ * either using the Table invariant or a decomposition with one Linear per
+ * tuple (counting the variables that differ from the tuple) and a Min over
+ * the tuples, which computes the same violation.
+ */
+class Table : public ::benchmark::Fixture {
+ public:
+  std::unique_ptr<propagation::Solver> solver;
+  std::vector<propagation::VarViewId> vars;
+  std::mt19937 gen;
+  std::uniform_int_distribution<size_t> varDist;
+  std::uniform_int_distribution<Int> valueDist;
+  propagation::VarViewId violation{propagation::NULL_ID};
+
+  void SetUp(const ::benchmark::State& state) override {
+    const size_t numVars = 8;
+    const auto numTuples = static_cast<size_t>(state.range(0));
+    const bool decomposed = state.range(1) != 0;
+    const Int numValues = 10;
+
+    gen = std::mt19937(numTuples);
+    varDist = std::uniform_int_distribution<size_t>(0, numVars - 1);
+    valueDist = std::uniform_int_distribution<Int>(0, numValues - 1);
+
+    solver = std::make_unique<propagation::Solver>();
+    solver->open();
+    setSolverMode(*solver, static_cast<int>(state.range(2)));
+
+    vars.clear();
+    for (size_t i = 0; i < numVars; ++i) {
+      vars.emplace_back(solver->makeIntVar(valueDist(gen), 0, numValues - 1));
+    }
+    std::vector<Int> table;
+    table.reserve(numTuples * numVars);
+    for (size_t i = 0; i < numTuples * numVars; ++i) {
+      table.emplace_back(valueDist(gen));
+    }
+
+    violation = solver->makeIntVar(0, 0, 0);
+    if (!decomposed) {
+      solver->makeViolationInvariant<propagation::Table>(
+          *solver, violation, std::vector<propagation::VarViewId>(vars),
+          std::move(table));
+    } else {
+      std::vector<propagation::VarViewId> distances;
+      for (size_t t = 0; t < numTuples; ++t) {
+        std::vector<propagation::VarViewId> differs;
+        for (size_t i = 0; i < numVars; ++i) {
+          const Int value = table[t * numVars + i];
+          differs.emplace_back(
+              solver->makeIntView<propagation::InIntervalConst>(
+                  *solver, vars[i], value, value));
+        }
+        distances.emplace_back(solver->makeIntVar(0, 0, 0));
+        solver->makeInvariant<propagation::Linear>(*solver, distances.back(),
+                                                   std::move(differs));
+      }
+      solver->makeInvariant<propagation::Min>(*solver, violation,
+                                              std::move(distances));
+    }
+    solver->close();
+  }
+
+  void TearDown(const ::benchmark::State&) override {
+    vars.clear();
+    solver.reset();
+  }
+};
+
+BENCHMARK_DEFINE_F(Table, probe_single_move)(::benchmark::State& st) {
+  size_t probes = 0;
+  for ([[maybe_unused]] const auto& _ : st) {
+    solver->beginMove();
+    solver->setValue(vars[varDist(gen)], valueDist(gen));
+    solver->endMove();
+
+    solver->beginProbe();
+    solver->query(violation);
+    solver->endProbe();
+
+    ++probes;
+  }
+  st.counters["probes_per_second"] = ::benchmark::Counter(
+      static_cast<double>(probes), ::benchmark::Counter::kIsRate);
+  st.counters["vars"] = static_cast<double>(solver->numVars());
+  st.counters["invariants"] = static_cast<double>(solver->numInvariants());
+}
+
+BENCHMARK_DEFINE_F(Table, commit_single_move)(::benchmark::State& st) {
+  size_t commits = 0;
+  for ([[maybe_unused]] const auto& _ : st) {
+    solver->beginMove();
+    solver->setValue(vars[varDist(gen)], valueDist(gen));
+    solver->endMove();
+
+    solver->beginCommit();
+    solver->query(violation);
+    solver->endCommit();
+
+    ++commits;
+  }
+  st.counters["commits_per_second"] = ::benchmark::Counter(
+      static_cast<double>(commits), ::benchmark::Counter::kIsRate);
+}
+
+BENCHMARK_REGISTER_F(Table, probe_single_move)
+    ->ArgsProduct({{64, 512, 4096}, {0, 1}, {0, 2}});
+
+BENCHMARK_REGISTER_F(Table, commit_single_move)
+    ->ArgsProduct({{64, 512, 4096}, {0, 1}, {0, 2}});
+
+}  // namespace atlantis::benchmark
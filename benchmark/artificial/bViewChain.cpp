@@ -0,0 +1,121 @@
+#include <benchmark/benchmark.h>
+
+#include <iostream>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "../benchmark.hpp"
+#include "atlantis/propagation/invariants/linear.hpp"
+#include "atlantis/propagation/solver.hpp"
+#include "atlantis/propagation/views/intOffsetView.hpp"
+#include "atlantis/propagation/views/scalarView.hpp"
+
+namespace atlantis::benchmark {
+
+/**
+ * output <- sum(views), where every view is the end of a chain of
+ * chainLength offset and scalar views over its own input. Measures reading
+ * the views directly and the per-move cost of the sum as a function of the
+ * length of the chains.
+ */
+class ViewChain : public ::benchmark::Fixture {
+ public:
+  std::unique_ptr<propagation::Solver> solver;
+  std::vector<propagation::VarViewId> inputs;
+  std::vector<propagation::VarViewId> views;
+  propagation::VarViewId output{propagation::NULL_ID};
+  std::random_device rd;
+  std::mt19937 gen;
+
+  std::uniform_int_distribution<size_t> inputIndexDist;
+  std::uniform_int_distribution<Int> valueDist;
+  static constexpr size_t numInputs = 1024;
+
+  void SetUp(const ::benchmark::State& state) override {
+    solver = std::make_unique<propagation::Solver>();
+    const auto chainLength = static_cast<size_t>(state.range(0));
+
+    gen = std::mt19937(rd());
+    valueDist = std::uniform_int_distribution<Int>{0, 100};
+    inputIndexDist = std::uniform_int_distribution<size_t>{0, numInputs - 1};
+
+    solver->open();
+    setSolverMode(*solver, static_cast<int>(state.range(1)));
+
+    inputs.reserve(numInputs);
+    views.reserve(numInputs);
+    for (size_t i = 0; i < numInputs; ++i) {
+      inputs.emplace_back(solver->makeIntVar(valueDist(gen), 0, 100));
+      propagation::VarViewId view = inputs.back();
+      for (size_t j = 0; j < chainLength; ++j) {
+        view = j % 2 == 0
+                   ? solver->makeIntView<propagation::IntOffsetView>(
+                         *solver, view, 1)
+                   : solver->makeIntView<propagation::ScalarView>(*solver,
+                                                                  view, 2, -1);
+      }
+      views.emplace_back(view);
+    }
+    output = solver->makeIntVar(0, 0, 0);
+    solver->makeInvariant<propagation::Linear>(
+        *solver, output, std::vector<propagation::VarViewId>(views));
+
+    solver->close();
+  }
+
+  void TearDown(const ::benchmark::State&) override {
+    inputs.clear();
+    views.clear();
+  }
+};
+
+BENCHMARK_DEFINE_F(ViewChain, read_all)(::benchmark::State& st) {
+  size_t reads = 0;
+  for ([[maybe_unused]] const auto& _ : st) {
+    Int sum = 0;
+    for (const propagation::VarViewId& view : views) {
+      sum += solver->committedValue(view);
+    }
+    ::benchmark::DoNotOptimize(sum);
+    reads += views.size();
+  }
+  st.counters["reads_per_second"] = ::benchmark::Counter(
+      static_cast<double>(reads), ::benchmark::Counter::kIsRate);
+}
+
+BENCHMARK_DEFINE_F(ViewChain, probe_single)(::benchmark::State& st) {
+  size_t probes = 0;
+  for ([[maybe_unused]] const auto& _ : st) {
+    solver->beginMove();
+    solver->setValue(inputs[inputIndexDist(gen)], valueDist(gen));
+    solver->endMove();
+
+    solver->beginProbe();
+    solver->query(output);
+    solver->endProbe();
+    ++probes;
+  }
+  st.counters["probes_per_second"] = ::benchmark::Counter(
+      static_cast<double>(probes), ::benchmark::Counter::kIsRate);
+}
+
+static void viewChainArguments(::benchmark::internal::Benchmark* b) {
+  for (Int chainLength = 0; chainLength <= 4; ++chainLength) {
+    for (Int mode = 0; mode <= 3; ++mode) {
+      b->Args({chainLength, mode});
+    }
+#ifndef NDEBUG
+    return;
+#endif
+  }
+}
+
+BENCHMARK_REGISTER_F(ViewChain, read_all)
+    ->Unit(::benchmark::kMicrosecond)
+    ->Apply(viewChainArguments);
+BENCHMARK_REGISTER_F(ViewChain, probe_single)
+    ->Unit(::benchmark::kMicrosecond)
+    ->Apply(viewChainArguments);
+
+}  // namespace atlantis::benchmark
@@ -0,0 +1,119 @@
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "../benchmark.hpp"
+#include "atlantis/propagation/invariants/count.hpp"
+#include "atlantis/propagation/solver.hpp"
+#include "atlantis/propagation/utils/valueCounts.hpp"
+#include "atlantis/propagation/violationInvariants/allDifferent.hpp"
+
+namespace atlantis::benchmark {
+
+/**
+ * allDifferent(inputs) and count(inputs, needle), where the inputs have the
+ * domain [0, width - 1]. If the domain is much wider than the number of
+ * inputs (such as for time-indexed models), then the value counts are
+ * sparse. Every move changes the value of a single input.
+ */
+class WideDomain : public ::benchmark::Fixture {
+ public:
+  std::unique_ptr<propagation::Solver> solver;
+  std::vector<propagation::VarViewId> inputs;
+  std::random_device rd;
+  std::mt19937 gen;
+
+  std::uniform_int_distribution<size_t> inputIndexDist;
+  std::uniform_int_distribution<Int> valueDist;
+  size_t inputCount{0};
+  Int width{0};
+
+  propagation::VarViewId violation{propagation::NULL_ID};
+  propagation::VarViewId occurrences{propagation::NULL_ID};
+
+  void SetUp(const ::benchmark::State& state) override {
+    solver = std::make_unique<propagation::Solver>();
+    inputCount = static_cast<size_t>(state.range(0));
+    width = static_cast<Int>(state.range(1));
+
+    gen = std::mt19937(rd());
+    inputIndexDist = std::uniform_int_distribution<size_t>{0, inputCount - 1};
+    valueDist = std::uniform_int_distribution<Int>{0, width - 1};
+
+    solver->open();
+    setSolverMode(*solver, static_cast<int>(state.range(2)));
+
+    inputs.reserve(inputCount);
+    for (size_t i = 0; i < inputCount; ++i) {
+      inputs.emplace_back(solver->makeIntVar(valueDist(gen), 0, width - 1));
+    }
+    const propagation::VarViewId needle =
+        solver->makeIntVar(valueDist(gen), 0, width - 1);
+
+    violation = solver->makeIntVar(0, 0, static_cast<Int>(inputCount));
+    solver->makeViolationInvariant<propagation::AllDifferent>(
+        *solver, violation, std::vector<propagation::VarViewId>(inputs));
+    occurrences = solver->makeIntVar(0, 0, static_cast<Int>(inputCount));
+    solver->makeInvariant<propagation::Count>(
+        *solver, occurrences, needle,
+        std::vector<propagation::VarViewId>(inputs));
+
+    solver->close();
+  }
+
+  void TearDown(const ::benchmark::State&) override { inputs.clear(); }
+
+  void countEntries(::benchmark::State& st) const {
+    // The number of count entries of each invariant:
+    propagation::ValueCounts counts;
+    counts.assign(0, width - 1, inputCount);
+    st.counters["count_entries"] =
+        ::benchmark::Counter(static_cast<double>(counts.numEntries()));
+  }
+};
+
+BENCHMARK_DEFINE_F(WideDomain, probe_single)(::benchmark::State& st) {
+  size_t probes = 0;
+  for ([[maybe_unused]] const auto& _ : st) {
+    solver->beginMove();
+    solver->setValue(inputs[inputIndexDist(gen)], valueDist(gen));
+    solver->endMove();
+
+    solver->beginProbe();
+    solver->query(violation);
+    solver->query(occurrences);
+    solver->endProbe();
+    ++probes;
+  }
+  st.counters["probes_per_second"] = ::benchmark::Counter(
+      static_cast<double>(probes), ::benchmark::Counter::kIsRate);
+  countEntries(st);
+}
+
+BENCHMARK_DEFINE_F(WideDomain, commit_single)(::benchmark::State& st) {
+  size_t commits = 0;
+  for ([[maybe_unused]] const auto& _ : st) {
+    solver->beginMove();
+    solver->setValue(inputs[inputIndexDist(gen)], valueDist(gen));
+    solver->endMove();
+
+    solver->beginCommit();
+    solver->query(violation);
+    solver->query(occurrences);
+    solver->endCommit();
+    ++commits;
+  }
+  st.counters["commits_per_second"] = ::benchmark::Counter(
+      static_cast<double>(commits), ::benchmark::Counter::kIsRate);
+  countEntries(st);
+}
+
+// Dense (width == #inputs) and sparse (width == 10^7) counts:
+BENCHMARK_REGISTER_F(WideDomain, probe_single)
+    ->ArgsProduct({{100, 1000}, {1000, 10000000}, {0}});
+BENCHMARK_REGISTER_F(WideDomain, commit_single)
+    ->ArgsProduct({{100, 1000}, {1000, 10000000}, {0}});
+
+}  // namespace atlantis::benchmark
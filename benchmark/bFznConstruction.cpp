@@ -0,0 +1,43 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+#include "atlantis/invariantgraph/invariantGraph.hpp"
+#include "atlantis/propagation/solver.hpp"
+
+namespace atlantis::benchmark {
+
+/**
+ * Replaces each of n named variable nodes by the next one, which resolves
+ * all identifiers to the last node.
+ */
+static void replace_named_var_nodes(::benchmark::State& st) {
+  const auto n = static_cast<size_t>(st.range(0));
+  std::vector<std::string> identifiers;
+  identifiers.reserve(n);
+  for (size_t i = 0; i < n; ++i) {
+    identifiers.emplace_back("x" + std::to_string(i));
+  }
+  for ([[maybe_unused]] const auto& _ : st) {
+    propagation::Solver solver;
+    invariantgraph::InvariantGraph invariantGraph(solver);
+    std::vector<invariantgraph::VarNodeId> varNodeIds;
+    varNodeIds.reserve(n);
+    for (const std::string& identifier : identifiers) {
+      varNodeIds.emplace_back(invariantGraph.retrieveIntVarNode(
+          SearchDomain(0, 10), identifier));
+    }
+    for (size_t i = 0; i + 1 < n; ++i) {
+      invariantGraph.replaceVarNode(varNodeIds[i], varNodeIds[i + 1]);
+    }
+    ::benchmark::DoNotOptimize(invariantGraph.varNodeId(identifiers.front()));
+  }
+}
+
+BENCHMARK(replace_named_var_nodes)
+    ->Unit(::benchmark::kMillisecond)
+    ->RangeMultiplier(4)
+    ->Range(1 << 10, 1 << 16);
+
+}  // namespace atlantis::benchmark
@@ -193,6 +193,34 @@ BENCHMARK_DEFINE_F(MagicSquare, probe_all_swap)(::benchmark::State& st) {
       static_cast<double>(probes), ::benchmark::Counter::kIsRate);
 }
 
+BENCHMARK_DEFINE_F(MagicSquare, probe_all_swap_batch)
+(::benchmark::State& st) {
+  int probes = 0;
+  for ([[maybe_unused]] const auto& _ : st) {
+    solver->beginProbeBatch();
+    solver->query(totalViolation);
+    for (size_t i = 0; i < static_cast<size_t>(n * n); ++i) {
+      for (size_t j = i + 1; j < static_cast<size_t>(n * n); ++j) {
+        const Int oldI = solver->committedValue(flat[i]);
+        const Int oldJ = solver->committedValue(flat[j]);
+        solver->beginMove();
+        solver->setValue(flat[i], oldJ);
+        solver->setValue(flat[j], oldI);
+        solver->endMove();
+
+        solver->beginProbe();
+        solver->endProbe();
+
+        ++probes;
+        assert(sanity());
+      }
+    }
+    solver->endProbeBatch();
+  }
+  st.counters["probes_per_second"] = ::benchmark::Counter(
+      static_cast<double>(probes), ::benchmark::Counter::kIsRate);
+}
+
 //*
 BENCHMARK_REGISTER_F(MagicSquare, probe_single_swap)
     ->Unit(::benchmark::kMillisecond)
@@ -200,9 +228,22 @@ BENCHMARK_REGISTER_F(MagicSquare, probe_single_swap)
 
 //*/
 
-/*
+// The swap neighbourhood has O(n^4) moves:
+static void allSwapArguments(::benchmark::internal::Benchmark* benchmark) {
+  for (Int n = 4; n <= 16; n *= 2) {
+    for (Int mode = 0; mode <= 3; ++mode) {
+      benchmark->Args({n, mode});
+    }
+#ifndef NDEBUG
+    return;
+#endif
+  }
+}
+
 BENCHMARK_REGISTER_F(MagicSquare, probe_all_swap)
     ->Unit(::benchmark::kMillisecond)
-    ->Apply(defaultArguments);
-//*/
+    ->Apply(allSwapArguments);
+BENCHMARK_REGISTER_F(MagicSquare, probe_all_swap_batch)
+    ->Unit(::benchmark::kMillisecond)
+    ->Apply(allSwapArguments);
 }  // namespace atlantis::benchmark
@@ -14,6 +14,7 @@
 #include "atlantis/propagation/views/intOffsetView.hpp"
 #include "atlantis/propagation/views/lessEqualConst.hpp"
 #include "atlantis/propagation/violationInvariants/lessEqual.hpp"
+#include "atlantis/utils/matrix.hpp"
 #include "benchmark.hpp"
 
 namespace atlantis::benchmark {
@@ -27,7 +28,7 @@ class TSPTWAllDiff : public ::benchmark::Fixture {
   std::vector<propagation::VarViewId> earliestVisitingTime;
   std::vector<propagation::VarViewId> latestVisitingTime;
   std::vector<propagation::VarViewId> departureTime;
-  std::vector<std::vector<Int>> dist;
+  Matrix<Int> dist;
   std::vector<Int> earliestVisit;
   std::vector<Int> latestVisit;
   propagation::VarViewId totalDist{propagation::NULL_ID};
@@ -54,12 +55,10 @@ class TSPTWAllDiff : public ::benchmark::Fixture {
     solver->open();
 
     setSolverMode(*solver, static_cast<int>(state.range(1)));
-    dist.clear();
-
-    for (Int i = 1; i <= n; ++i) {
-      dist.emplace_back();
-      for (int j = 1; j <= n; ++j) {
-        dist.back().push_back(i * j);
+    dist = Matrix<Int>(static_cast<size_t>(n), static_cast<size_t>(n), 0);
+    for (size_t i = 0; i < dist.numRows(); ++i) {
+      for (size_t j = 0; j < dist.numCols(); ++j) {
+        dist(i, j) = static_cast<Int>((i + 1) * (j + 1));
       }
     }
 
@@ -118,7 +117,7 @@ class TSPTWAllDiff : public ::benchmark::Fixture {
       // timeTo[i] = dist[sequence[i - 1]][sequence[i]]
       solver->makeInvariant<propagation::Element2dConst>(
           *solver, timeTo[i], sequence[i - 1], sequence[i],
-          std::vector<std::vector<Int>>(dist), 0, 0);
+          Matrix<Int>(dist), 0, 0);
 
       // arrivalTime[i] = departureTime[i - 1] + timeTo[i];
       solver->makeInvariant<propagation::Plus>(*solver, arrivalTime[i],
@@ -188,7 +187,7 @@ class TSPTWAllDiff : public ::benchmark::Fixture {
       const Int pred = solver->currentValue(sequence.at(i - 1));
       const Int cur = solver->currentValue(sequence.at(i));
 
-      const Int travelTime = dist.at(pred).at(cur);
+      const Int travelTime = dist.at(pred, cur);
       assert(travelTime == solver->currentValue(timeTo.at(i)));
 
       const Int arrival = departure.at(i - 1) + travelTime;
@@ -6,7 +6,8 @@
 #include <utility>
 #include <vector>
 
-#include "atlantis/propagation/propagation/propagationQueue.hpp"
+#include "atlantis/propagation/propagation/propagationBucketQueue.hpp"
+#include "atlantis/propagation/propagation/propagationListQueue.hpp"
 
 namespace atlantis::benchmark {
 
@@ -25,152 +26,171 @@ class PropQueue : public ::benchmark::Fixture {
 
     distribution = std::uniform_int_distribution<>{1, int(queueSize)};
   }
-};
 
-BENCHMARK_DEFINE_F(PropQueue, initVar)(::benchmark::State& st) {
-  size_t inits = 0;
-  for ([[maybe_unused]] const auto& _ : st) {
-    propagation::PropagationQueue queue;
+  template <class Queue>
+  void initVar(::benchmark::State& st) {
+    size_t inits = 0;
+    for ([[maybe_unused]] const auto& _ : st) {
+      Queue queue;
+      for (size_t i = 0; i < queueSize; ++i) {
+        queue.initVar(i, i);
+        ++inits;
+      }
+    }
+    st.counters["inits_per_second"] = ::benchmark::Counter(
+        static_cast<double>(inits), ::benchmark::Counter::kIsRate);
+  }
+
+  template <class Queue>
+  void push(::benchmark::State& st, bool ascending, bool randomPriority) {
+    size_t pushes = 0;
+    for ([[maybe_unused]] const auto& _ : st) {
+      st.PauseTiming();
+      Queue queue;
+      for (size_t i = 0; i < queueSize; ++i) {
+        queue.initVar(i, randomPriority ? distribution(gen) : i);
+      }
+      st.ResumeTiming();
+
+      for (size_t i = 0; i < queueSize; ++i) {
+        queue.push(ascending ? i : queueSize - i - 1);
+        ++pushes;
+      }
+    }
+    st.counters["pushes_per_second"] = ::benchmark::Counter(
+        static_cast<double>(pushes), ::benchmark::Counter::kIsRate);
+  }
+
+  template <class Queue>
+  void pop(::benchmark::State& st, bool ascending, bool randomPriority) {
+    size_t pops = 0;
+    for ([[maybe_unused]] const auto& _ : st) {
+      st.PauseTiming();
+      Queue queue;
+      for (size_t i = 0; i < queueSize; ++i) {
+        queue.initVar(i, randomPriority ? distribution(gen)
+                                        : (ascending ? i : queueSize - i + 1));
+      }
+      for (size_t i = 0; i < queueSize; ++i) {
+        queue.push(i);
+      }
+      st.ResumeTiming();
+
+      while (!queue.empty()) {
+        queue.pop();
+        ++pops;
+      }
+    }
+    st.counters["pops_per_second"] = ::benchmark::Counter(
+        static_cast<double>(pops), ::benchmark::Counter::kIsRate);
+  }
+
+  /**
+   * Mimics propagation: each popped variable pushes a few variables with
+   * strictly larger priority (its listeners).
+   */
+  template <class Queue>
+  void propagate(::benchmark::State& st) {
+    const size_t numListeners = 4;
+    std::vector<std::vector<size_t>> listeners(queueSize);
+    for (size_t i = 0; i + 1 < queueSize; ++i) {
+      for (size_t j = 0; j < numListeners; ++j) {
+        listeners[i].emplace_back(
+            std::uniform_int_distribution<size_t>(i + 1, queueSize - 1)(gen));
+      }
+    }
+    Queue queue;
     for (size_t i = 0; i < queueSize; ++i) {
       queue.initVar(i, i);
-      ++inits;
     }
+    size_t pops = 0;
+    for ([[maybe_unused]] const auto& _ : st) {
+      for (size_t i = 0; i < numListeners; ++i) {
+        queue.push(
+            std::uniform_int_distribution<size_t>(0, queueSize / 16)(gen));
+      }
+      while (!queue.empty()) {
+        const size_t id = queue.pop();
+        ++pops;
+        for (const size_t listener : listeners[id]) {
+          queue.push(listener);
+        }
+      }
+    }
+    st.counters["pops_per_second"] = ::benchmark::Counter(
+        static_cast<double>(pops), ::benchmark::Counter::kIsRate);
   }
-  st.counters["inits_per_second"] = ::benchmark::Counter(
-      static_cast<double>(inits), ::benchmark::Counter::kIsRate);
+};
+
+BENCHMARK_DEFINE_F(PropQueue, list_initVar)(::benchmark::State& st) {
+  initVar<propagation::PropagationListQueue>(st);
 }
 
-BENCHMARK_DEFINE_F(PropQueue, push_min)(::benchmark::State& st) {
-  size_t pushes = 0;
-  for ([[maybe_unused]] const auto& _ : st) {
-    st.PauseTiming();
-    propagation::PropagationQueue queue;
-    for (size_t i = 0; i < queueSize; ++i) {
-      queue.initVar(i, i);
-    }
-    st.ResumeTiming();
+BENCHMARK_DEFINE_F(PropQueue, bucket_initVar)(::benchmark::State& st) {
+  initVar<propagation::PropagationBucketQueue>(st);
+}
 
-    for (size_t i = 0; i < queueSize; ++i) {
-      queue.push(i);
-      ++pushes;
-    }
-  }
-  st.counters["pushes_per_second"] = ::benchmark::Counter(
-      static_cast<double>(pushes), ::benchmark::Counter::kIsRate);
+BENCHMARK_DEFINE_F(PropQueue, list_push_min)(::benchmark::State& st) {
+  push<propagation::PropagationListQueue>(st, true, false);
 }
 
-BENCHMARK_DEFINE_F(PropQueue, push_max)(::benchmark::State& st) {
-  size_t pushes = 0;
-  for ([[maybe_unused]] const auto& _ : st) {
-    st.PauseTiming();
-    propagation::PropagationQueue queue;
-    for (size_t i = 0; i < queueSize; ++i) {
-      queue.initVar(i, i);
-    }
-    st.ResumeTiming();
+BENCHMARK_DEFINE_F(PropQueue, bucket_push_min)(::benchmark::State& st) {
+  push<propagation::PropagationBucketQueue>(st, true, false);
+}
 
-    for (size_t i = queueSize; i > 0; --i) {
-      queue.push(i);
-      ++pushes;
-    }
-  }
-  st.counters["pushes_per_second"] = ::benchmark::Counter(
-      static_cast<double>(pushes), ::benchmark::Counter::kIsRate);
+BENCHMARK_DEFINE_F(PropQueue, list_push_max)(::benchmark::State& st) {
+  push<propagation::PropagationListQueue>(st, false, false);
 }
 
-BENCHMARK_DEFINE_F(PropQueue, push_random)(::benchmark::State& st) {
-  size_t pushes = 0;
-  for ([[maybe_unused]] const auto& _ : st) {
-    st.PauseTiming();
-    propagation::PropagationQueue queue;
-    for (size_t i = 0; i < queueSize; ++i) {
-      queue.initVar(i, distribution(gen));
-    }
-    st.ResumeTiming();
+BENCHMARK_DEFINE_F(PropQueue, bucket_push_max)(::benchmark::State& st) {
+  push<propagation::PropagationBucketQueue>(st, false, false);
+}
 
-    for (size_t i = 0; i < queueSize; ++i) {
-      queue.push(i);
-      ++pushes;
-    }
-  }
-  st.counters["pushes_per_second"] = ::benchmark::Counter(
-      static_cast<double>(pushes), ::benchmark::Counter::kIsRate);
+BENCHMARK_DEFINE_F(PropQueue, list_push_random)(::benchmark::State& st) {
+  push<propagation::PropagationListQueue>(st, true, true);
 }
 
-BENCHMARK_DEFINE_F(PropQueue, pop_min)(::benchmark::State& st) {
-  size_t pops = 0;
-  for ([[maybe_unused]] const auto& _ : st) {
-    st.PauseTiming();
-    propagation::PropagationQueue queue;
-    for (size_t i = 0; i < queueSize; ++i) {
-      queue.initVar(i, i);
-    }
-    for (size_t i = 0; i < queueSize; ++i) {
-      queue.push(i);
-    }
-    st.ResumeTiming();
+BENCHMARK_DEFINE_F(PropQueue, bucket_push_random)(::benchmark::State& st) {
+  push<propagation::PropagationBucketQueue>(st, true, true);
+}
 
-    while (!queue.empty()) {
-      queue.pop();
-      ++pops;
-    }
-  }
-  st.counters["pops_per_second"] = ::benchmark::Counter(
-      static_cast<double>(pops), ::benchmark::Counter::kIsRate);
+BENCHMARK_DEFINE_F(PropQueue, list_pop_min)(::benchmark::State& st) {
+  pop<propagation::PropagationListQueue>(st, true, false);
 }
 
-BENCHMARK_DEFINE_F(PropQueue, pop_max)(::benchmark::State& st) {
-  size_t pops = 0;
-  for ([[maybe_unused]] const auto& _ : st) {
-    st.PauseTiming();
-    propagation::PropagationQueue queue;
-    for (size_t i = 0; i < queueSize; ++i) {
-      queue.initVar(i, queueSize - i + 1);
-    }
-    for (size_t i = 0; i < queueSize; ++i) {
-      queue.push(i);
-    }
-    st.ResumeTiming();
+BENCHMARK_DEFINE_F(PropQueue, bucket_pop_min)(::benchmark::State& st) {
+  pop<propagation::PropagationBucketQueue>(st, true, false);
+}
 
-    while (!queue.empty()) {
-      queue.pop();
-      ++pops;
-    }
-  }
-  st.counters["pops_per_second"] = ::benchmark::Counter(
-      static_cast<double>(pops), ::benchmark::Counter::kIsRate);
+BENCHMARK_DEFINE_F(PropQueue, list_pop_max)(::benchmark::State& st) {
+  pop<propagation::PropagationListQueue>(st, false, false);
 }
 
-BENCHMARK_DEFINE_F(PropQueue, pop_random)(::benchmark::State& st) {
-  size_t pops = 0;
-  for ([[maybe_unused]] const auto& _ : st) {
-    st.PauseTiming();
-    propagation::PropagationQueue queue;
-    for (size_t i = 0; i < queueSize; ++i) {
-      queue.initVar(i, distribution(gen));
-    }
+BENCHMARK_DEFINE_F(PropQueue, bucket_pop_max)(::benchmark::State& st) {
+  pop<propagation::PropagationBucketQueue>(st, false, false);
+}
 
-    for (size_t i = 0; i < queueSize; ++i) {
-      queue.push(i);
-    }
+BENCHMARK_DEFINE_F(PropQueue, list_pop_random)(::benchmark::State& st) {
+  pop<propagation::PropagationListQueue>(st, true, true);
+}
 
-    st.ResumeTiming();
-    while (!queue.empty()) {
-      queue.pop();
-      ++pops;
-    }
-  }
-  st.counters["pops_per_second"] = ::benchmark::Counter(
-      static_cast<double>(pops), ::benchmark::Counter::kIsRate);
+BENCHMARK_DEFINE_F(PropQueue, bucket_pop_random)(::benchmark::State& st) {
+  pop<propagation::PropagationBucketQueue>(st, true, true);
 }
 
-// This benchmark is not a model, but mainly to test the performance
-// of the propagation::PropagationQueue data structure (it typically does not
-// need to be benchmarked)
+BENCHMARK_DEFINE_F(PropQueue, list_propagate)(::benchmark::State& st) {
+  propagate<propagation::PropagationListQueue>(st);
+}
+
+BENCHMARK_DEFINE_F(PropQueue, bucket_propagate)(::benchmark::State& st) {
+  propagate<propagation::PropagationBucketQueue>(st);
+}
+
+// This benchmark is not a model, but compares the linked-list and the bucket
+// implementations of the propagation queue head-to-head.
 
-/*
 static void arguments(::benchmark::internal::Benchmark* b) {
-  for (int i = 5000; i <= 20000; i *= 10) {
+  for (int i = 500; i <= 5000; i *= 10) {
     b->Arg(i);
 #ifndef NDEBUG
     return;
@@ -178,12 +198,21 @@ static void arguments(::benchmark::internal::Benchmark* b) {
   }
 }
 
-BENCHMARK_REGISTER_F(PropQueue, initVar)->Apply(arguments);
-BENCHMARK_REGISTER_F(PropQueue, push_min)->Apply(arguments);
-BENCHMARK_REGISTER_F(PropQueue, push_max)->Apply(arguments);
-BENCHMARK_REGISTER_F(PropQueue, push_random)->Apply(arguments);
-BENCHMARK_REGISTER_F(PropQueue, pop_min)->Apply(arguments);
-BENCHMARK_REGISTER_F(PropQueue, pop_max)->Apply(arguments);
-BENCHMARK_REGISTER_F(PropQueue, pop_random)->Apply(arguments);
-//*/
+BENCHMARK_REGISTER_F(PropQueue, list_initVar)->Apply(arguments);
+BENCHMARK_REGISTER_F(PropQueue, bucket_initVar)->Apply(arguments);
+BENCHMARK_REGISTER_F(PropQueue, list_push_min)->Apply(arguments);
+BENCHMARK_REGISTER_F(PropQueue, bucket_push_min)->Apply(arguments);
+BENCHMARK_REGISTER_F(PropQueue, list_push_max)->Apply(arguments);
+BENCHMARK_REGISTER_F(PropQueue, bucket_push_max)->Apply(arguments);
+BENCHMARK_REGISTER_F(PropQueue, list_push_random)->Apply(arguments);
+BENCHMARK_REGISTER_F(PropQueue, bucket_push_random)->Apply(arguments);
+BENCHMARK_REGISTER_F(PropQueue, list_pop_min)->Apply(arguments);
+BENCHMARK_REGISTER_F(PropQueue, bucket_pop_min)->Apply(arguments);
+BENCHMARK_REGISTER_F(PropQueue, list_pop_max)->Apply(arguments);
+BENCHMARK_REGISTER_F(PropQueue, bucket_pop_max)->Apply(arguments);
+BENCHMARK_REGISTER_F(PropQueue, list_pop_random)->Apply(arguments);
+BENCHMARK_REGISTER_F(PropQueue, bucket_pop_random)->Apply(arguments);
+BENCHMARK_REGISTER_F(PropQueue, list_propagate)->Apply(arguments);
+BENCHMARK_REGISTER_F(PropQueue, bucket_propagate)->Apply(arguments);
+
 }  // namespace atlantis::benchmark
@@ -0,0 +1,225 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fznparser/parser.hpp>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "atlantis/fznBackend.hpp"
+#include "atlantis/fznSearch.hpp"
+#include "atlantis/invariantgraph/fznInvariantGraph.hpp"
+#include "atlantis/logging/logger.hpp"
+#include "atlantis/search/assignment.hpp"
+
+/*
+ * End-to-end benchmarks of the FlatZinc pipeline, with one set of
+ * benchmarks per model:
+ *
+ *   fzn_parse/<model>      parsing the model,
+ *   fzn_construct/<model>  building and constructing the invariant graph,
+ *   fzn_close/<model>      closing the solver,
+ *   fzn_search/<model>     a fixed number of rounds of the annealing search.
+ *
+ * The last three stages are those of FznBackend (see FznSearch), so that
+ * the benchmarks measure what the solver executable runs.
+ *
+ * Usage:
+ *
+ *   runFznBenchmarks [--fzn_dir=<dir>]... [--fzn_rounds=<n>]
+ *                    [--fzn_seed=<seed>] [google benchmark flags]
+ *
+ * where the models are the .fzn files of the given directories (fzn-models/
+ * by default). Use --benchmark_format=json or --benchmark_out=<file> for
+ * machine-readable output.
+ */
+
+namespace atlantis::benchmark {
+
+static constexpr std::uint_fast32_t DEFAULT_SEED = 1234;
+static constexpr UInt DEFAULT_NUM_ROUNDS = 20;
+
+static logging::Logger logger(stderr, logging::Level::LVL_ERROR);
+
+static void fzn_parse(::benchmark::State& st,
+                      const std::filesystem::path& modelFilePath) {
+  size_t numVars = 0;
+  size_t numConstraints = 0;
+  for ([[maybe_unused]] const auto& _ : st) {
+    const fznparser::Model model = fznparser::parseFznFile(modelFilePath);
+    numVars = model.vars().size();
+    numConstraints = model.constraints().size();
+  }
+  st.counters["vars"] = static_cast<double>(numVars);
+  st.counters["constraints"] = static_cast<double>(numConstraints);
+}
+
+static void fzn_construct(::benchmark::State& st,
+                          const std::filesystem::path& modelFilePath) {
+  const fznparser::Model model = fznparser::parseFznFile(modelFilePath);
+  size_t numVars = 0;
+  size_t numInvariants = 0;
+  for ([[maybe_unused]] const auto& _ : st) {
+    const FznSearch fznSearch(model, logger);
+    numVars = fznSearch.solver().numVars();
+    numInvariants = fznSearch.solver().numInvariants();
+  }
+  st.counters["vars"] = static_cast<double>(numVars);
+  st.counters["invariants"] = static_cast<double>(numInvariants);
+}
+
+static void fzn_close(::benchmark::State& st,
+                      const std::filesystem::path& modelFilePath) {
+  const fznparser::Model model = fznparser::parseFznFile(modelFilePath);
+  for ([[maybe_unused]] const auto& _ : st) {
+    st.PauseTiming();
+    auto fznSearch = std::make_unique<FznSearch>(model, logger);
+    st.ResumeTiming();
+
+    fznSearch->close();
+
+    st.PauseTiming();
+    fznSearch.reset();
+    st.ResumeTiming();
+  }
+}
+
+/**
+ * Runs the search of FznBackend (a single worker with the default annealing
+ * schedule) for numRounds rounds, and measures the rounds after the first
+ * tenth of them (at least one), which are a warm-up.
+ */
+static void fzn_search(::benchmark::State& st,
+                       const std::filesystem::path& modelFilePath,
+                       UInt numRounds, std::uint_fast32_t seed) {
+  FznBackend backend(fznparser::parseFznFile(modelFilePath));
+  const std::unique_ptr<FznSearch> fznSearch = backend.setUp(logger);
+  if (!fznSearch->hasSearchVars()) {
+    st.SkipWithError("the model has no search variables");
+    return;
+  }
+
+  const UInt numWarmUpRounds = std::max<UInt>(1, numRounds / 10);
+  std::chrono::steady_clock::time_point warmUpEnd;
+  std::chrono::steady_clock::time_point searchEnd;
+  UInt numMeasuredRounds = 0;
+  uint64_t numProbes = 0;
+  uint64_t numMoves = 0;
+  const auto onRound = [&](UInt round,
+                           const search::RoundStatistics& statistics) {
+    if (round + 1 == numWarmUpRounds) {
+      warmUpEnd = std::chrono::steady_clock::now();
+    } else if (round >= numWarmUpRounds) {
+      ++numMeasuredRounds;
+      numProbes += statistics.attemptedMoves;
+      numMoves += statistics.acceptedMoves;
+      searchEnd = std::chrono::steady_clock::now();
+    }
+  };
+
+  backend.setRandomSeed(seed);
+  backend.setRoundLimit(numRounds, onRound);
+  backend.setOnSolution([](const invariantgraph::FznInvariantGraph&,
+                           const search::Assignment&) {});
+  backend.setOnFinish([](bool) {});
+
+  double seconds = 0;
+  for ([[maybe_unused]] const auto& _ : st) {
+    backend.run(logger, *fznSearch);
+    seconds = std::chrono::duration<double>(searchEnd - warmUpEnd).count();
+    st.SetIterationTime(seconds);
+  }
+  if (numMeasuredRounds == 0) {
+    // The search found an (optimal) solution during the warm-up:
+    st.SkipWithError("the search stopped before the measured rounds");
+    return;
+  }
+
+  // The rates are of the measured rounds only (a rate counter would also
+  // include the warm-up rounds and the initialisation):
+  st.counters["rounds"] = static_cast<double>(numMeasuredRounds);
+  st.counters["moves_per_second"] = static_cast<double>(numMoves) / seconds;
+  st.counters["probes_per_second"] = static_cast<double>(numProbes) / seconds;
+  st.counters["violation"] = static_cast<double>(fznSearch->violation());
+}
+
+static void registerModels(const std::filesystem::path& directory,
+                           UInt numRounds, std::uint_fast32_t seed) {
+  std::vector<std::filesystem::path> modelFilePaths;
+  for (const auto& entry : std::filesystem::directory_iterator(directory)) {
+    if (entry.is_regular_file() && entry.path().extension() == ".fzn") {
+      modelFilePaths.emplace_back(entry.path());
+    }
+  }
+  std::sort(modelFilePaths.begin(), modelFilePaths.end());
+  for (const auto& modelFilePath : modelFilePaths) {
+    const std::string model = modelFilePath.stem().string();
+    ::benchmark::RegisterBenchmark(("fzn_parse/" + model).c_str(), fzn_parse,
+                                   modelFilePath)
+        ->Unit(::benchmark::kMillisecond);
+    ::benchmark::RegisterBenchmark(("fzn_construct/" + model).c_str(),
+                                   fzn_construct, modelFilePath)
+        ->Unit(::benchmark::kMillisecond);
+    ::benchmark::RegisterBenchmark(("fzn_close/" + model).c_str(), fzn_close,
+                                   modelFilePath)
+        ->Unit(::benchmark::kMillisecond);
+    // A single iteration, so that every run makes the same moves:
+    ::benchmark::RegisterBenchmark(("fzn_search/" + model).c_str(),
+                                   fzn_search, modelFilePath, numRounds, seed)
+        ->Unit(::benchmark::kMillisecond)
+        ->Iterations(1)
+        ->UseManualTime();
+  }
+}
+
+/**
+ * @return the value of @p arg if it is of the form <name><value>.
+ */
+static std::optional<std::string_view> flagValue(std::string_view arg,
+                                                 std::string_view name) {
+  if (!arg.starts_with(name)) {
+    return std::nullopt;
+  }
+  return arg.substr(name.size());
+}
+
+}  // namespace atlantis::benchmark
+
+int main(int argc, char** argv) {
+  using atlantis::benchmark::flagValue;
+  ::benchmark::Initialize(&argc, argv);
+
+  std::vector<std::filesystem::path> directories;
+  atlantis::UInt numRounds = atlantis::benchmark::DEFAULT_NUM_ROUNDS;
+  std::uint_fast32_t seed = atlantis::benchmark::DEFAULT_SEED;
+  for (int i = 1; i < argc; ++i) {
+    const std::string_view arg(argv[i]);
+    if (const auto value = flagValue(arg, "--fzn_dir=")) {
+      directories.emplace_back(*value);
+    } else if (const auto value = flagValue(arg, "--fzn_rounds=")) {
+      numRounds = static_cast<atlantis::UInt>(std::stoul(std::string(*value)));
+    } else if (const auto value = flagValue(arg, "--fzn_seed=")) {
+      seed = static_cast<std::uint_fast32_t>(std::stoul(std::string(*value)));
+    } else {
+      std::cerr << "Unrecognised argument: " << arg << '\n';
+      return 1;
+    }
+  }
+  if (directories.empty()) {
+    directories.emplace_back(FZN_DIR);
+  }
+  for (const auto& directory : directories) {
+    atlantis::benchmark::registerModels(directory, numRounds, seed);
+  }
+
+  ::benchmark::RunSpecifiedBenchmarks();
+  ::benchmark::Shutdown();
+  return 0;
+}
@@ -1,19 +1,35 @@
 #pragma once
 
+#include <algorithm>
+#include <cassert>
 #include <cstdint>
 #include <filesystem>
 #include <fznparser/model.hpp>
 #include <iostream>
+#include <memory>
 #include <optional>
+#include <vector>
 
+#include "atlantis/fznSearch.hpp"
 #include "atlantis/invariantgraph/fznInvariantGraph.hpp"
 #include "atlantis/logging/logger.hpp"
 #include "atlantis/search/annealing/annealingScheduleFactory.hpp"
+#include "atlantis/search/annealing/roundLimit.hpp"
 #include "atlantis/search/assignment.hpp"
+#include "atlantis/search/neighbourhoods/neighbourhood.hpp"
+#include "atlantis/search/objective.hpp"
 #include "atlantis/search/searchStatistics.hpp"
+#include "atlantis/search/sharedSearchState.hpp"
 
 namespace atlantis {
 
+enum class SearchStrategy : unsigned char {
+  // Simulated annealing with random moves (see search::SearchProcedure):
+  ANNEALING,
+  // Tabu search over enumerated moves (see search::TabuSearch):
+  TABU
+};
+
 class FznBackend {
  public:
   static void onSolutionDefault(const invariantgraph::FznInvariantGraph&,
@@ -22,34 +38,120 @@ class FznBackend {
 
  private:
   fznparser::Model _model;
-  search::AnnealingScheduleFactory _annealingScheduleFactory;
+  // Worker i uses the annealing schedule of factory (i mod size):
+  std::vector<search::AnnealingScheduleFactory> _annealingScheduleFactories{
+      search::AnnealingScheduleFactory()};
   std::optional<std::chrono::milliseconds> _timelimit;
+  std::optional<UInt> _numRounds;
+  search::RoundLimit::RoundCallback _onRound;
   std::uint_fast32_t _seed;
+  size_t _numThreads{1};
+  SearchStrategy _searchStrategy{SearchStrategy::ANNEALING};
   std::optional<std::filesystem::path> _dotFilePath{};
+  std::optional<std::filesystem::path> _profileFilePath{};
 
   std::function<void(const invariantgraph::FznInvariantGraph&,
                      const search::Assignment&)>
       _onSolution = onSolutionDefault;
   std::function<void(bool)> _onFinish = onFinishDefault;
 
+  /**
+   * Runs one search on @p assignment.
+   *
+   * @param sharedState The state shared with the other workers of a
+   * portfolio search, or nullptr if this is the only worker.
+   */
+  search::SearchStatistics runSearch(
+      logging::Logger& logger,
+      const invariantgraph::FznInvariantGraph& invariantGraph,
+      search::Assignment& assignment,
+      search::neighbourhoods::Neighbourhood& neighbourhood,
+      search::Objective& objective, std::uint_fast32_t seed,
+      const search::AnnealingScheduleFactory& annealingScheduleFactory,
+      const std::function<void(const invariantgraph::FznInvariantGraph&,
+                               const search::Assignment&)>& onSolution,
+      const std::function<void(bool)>& onFinish,
+      search::SharedSearchState* sharedState);
+
+  /**
+   * Runs _numThreads searches in parallel. The first worker searches
+   * @p fznSearch and every other worker its own copy of it.
+   */
+  search::SearchStatistics runPortfolio(logging::Logger& logger,
+                                        FznSearch& fznSearch);
+
+  void writeProfile(logging::Logger& logger,
+                    const invariantgraph::FznInvariantGraph& invariantGraph,
+                    propagation::Solver& solver) const;
+
  public:
   FznBackend(fznparser::Model&& model)
       : _model(std::move(model)), _seed(std::time(nullptr)) {}
 
   FznBackend(logging::Logger& logger, std::filesystem::path&& modelFile);
 
+  /**
+   * Builds what to search for the model, and closes its solver.
+   */
+  std::unique_ptr<FznSearch> setUp(logging::Logger& logger) const;
+
+  /**
+   * Searches @p fznSearch (see setUp) as configured, reporting the solutions
+   * and the end of the search through the callbacks.
+   */
+  search::SearchStatistics run(logging::Logger& logger, FznSearch& fznSearch);
+
+  /**
+   * Sets up and searches the model.
+   */
   search::SearchStatistics solve(logging::Logger& logger);
 
   void setTimelimit(std::optional<std::chrono::milliseconds> timeLimit) {
     _timelimit = timeLimit;
   }
 
+  /**
+   * Stops each worker after @p numRounds annealing rounds (see
+   * search::RoundLimit), so that a search with a given seed is reproducible.
+   * The first worker to reach the limit stops the other workers.
+   *
+   * @param onRound called by each worker at the end of each of its rounds.
+   */
+  void setRoundLimit(UInt numRounds,
+                     search::RoundLimit::RoundCallback onRound = nullptr) {
+    _numRounds = numRounds;
+    _onRound = std::move(onRound);
+  }
+
   void setAnnealingScheduleFactory(search::AnnealingScheduleFactory&& factory) {
-    _annealingScheduleFactory = factory;
+    _annealingScheduleFactories = {std::move(factory)};
+  }
+
+  /**
+   * Sets the annealing schedules of the workers, which are assigned to the
+   * workers in a round-robin fashion.
+   */
+  void setAnnealingScheduleFactories(
+      std::vector<search::AnnealingScheduleFactory>&& factories) {
+    assert(!factories.empty());
+    _annealingScheduleFactories = std::move(factories);
+  }
+
+  /**
+   * Sets the number of workers that search in parallel, each on its own copy
+   * of the solver and with its own seed. The workers share the best objective
+   * bound.
+   */
+  void setNumThreads(size_t numThreads) {
+    _numThreads = std::max(size_t{1}, numThreads);
   }
 
   void setRandomSeed(std::uint_fast32_t seed) { _seed = seed; }
 
+  void setSearchStrategy(SearchStrategy searchStrategy) {
+    _searchStrategy = searchStrategy;
+  }
+
   void setOnSolution(
       std::function<void(const invariantgraph::FznInvariantGraph&,
                          const search::Assignment&)>
@@ -61,6 +163,14 @@ class FznBackend {
     _dotFilePath = std::optional<std::filesystem::path>(std::move(path));
   }
 
+  /**
+   * Enables profiling of the invariants, where the profile (see
+   * propagation::InvariantProfiler) is written to @p path after the search.
+   */
+  void setProfileFilePath(std::filesystem::path&& path) {
+    _profileFilePath = std::optional<std::filesystem::path>(std::move(path));
+  }
+
   void setOnFinish(std::function<void(bool)> onFinish) { _onFinish = onFinish; }
 };
 
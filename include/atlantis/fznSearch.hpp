@@ -0,0 +1,121 @@
+#pragma once
+
+#include <cassert>
+#include <fznparser/model.hpp>
+#include <memory>
+
+#include "atlantis/invariantgraph/fznInvariantGraph.hpp"
+#include "atlantis/logging/logger.hpp"
+#include "atlantis/propagation/solver.hpp"
+#include "atlantis/search/assignment.hpp"
+#include "atlantis/search/neighbourhoods/neighbourhoodCombinator.hpp"
+#include "atlantis/search/objective.hpp"
+
+namespace atlantis {
+
+/**
+ * What FznBackend searches for a FlatZinc model: the solver, the invariant
+ * graph, the neighbourhood, the objective, and the assignment of the first
+ * worker. FznBackend::setUp creates it, and FznBackend::run searches it.
+ * The benchmarks and tests of the whole pipeline take the same two steps, so
+ * they measure the search that the solver executable runs.
+ */
+class FznSearch {
+ private:
+  propagation::Solver _solver;
+  invariantgraph::FznInvariantGraph _invariantGraph;
+  search::neighbourhoods::NeighbourhoodCombinator _neighbourhood;
+  search::Objective _objective;
+  propagation::VarViewId _violation{propagation::NULL_ID};
+  std::unique_ptr<search::Assignment> _assignment;
+  propagation::ObjectiveDirection _objectiveDirection;
+  bool _isSatisfactionProblem;
+  bool _isMinimisationProblem;
+  Int _objectiveOptimalValue{0};
+
+  static search::neighbourhoods::NeighbourhoodCombinator construct(
+      propagation::Solver&, invariantgraph::FznInvariantGraph&,
+      const fznparser::Model&, logging::Logger&, bool enableProfiling);
+
+ public:
+  /**
+   * Builds and constructs the invariant graph of @p model, and registers the
+   * objective. The solver is closed by close().
+   *
+   * @param enableProfiling whether to profile the invariants (see
+   * propagation::Solver::enableProfiling).
+   */
+  FznSearch(const fznparser::Model& model, logging::Logger& logger,
+            bool enableProfiling = false);
+
+  FznSearch(const FznSearch&) = delete;
+  FznSearch& operator=(const FznSearch&) = delete;
+
+  /**
+   * Closes the invariant graph (and thus the solver), and creates the
+   * assignment.
+   */
+  void close();
+
+  /**
+   * @return true if the model has search variables (otherwise, there is
+   * nothing to search).
+   */
+  [[nodiscard]] bool hasSearchVars() const;
+
+  [[nodiscard]] propagation::Solver& solver() noexcept { return _solver; }
+
+  [[nodiscard]] const propagation::Solver& solver() const noexcept {
+    return _solver;
+  }
+
+  [[nodiscard]] const invariantgraph::FznInvariantGraph& invariantGraph()
+      const noexcept {
+    return _invariantGraph;
+  }
+
+  [[nodiscard]] search::neighbourhoods::NeighbourhoodCombinator&
+  neighbourhood() noexcept {
+    return _neighbourhood;
+  }
+
+  [[nodiscard]] search::Objective& objective() noexcept { return _objective; }
+
+  [[nodiscard]] propagation::VarViewId violationVarId() const noexcept {
+    return _violation;
+  }
+
+  /**
+   * @return the assignment, which exists once the solver is closed.
+   */
+  [[nodiscard]] search::Assignment& assignment() noexcept {
+    assert(_assignment != nullptr);
+    return *_assignment;
+  }
+
+  [[nodiscard]] propagation::ObjectiveDirection objectiveDirection()
+      const noexcept {
+    return _objectiveDirection;
+  }
+
+  [[nodiscard]] bool isSatisfactionProblem() const noexcept {
+    return _isSatisfactionProblem;
+  }
+
+  /**
+   * @return the best value that the objective variable can take, or 0 for a
+   * satisfaction problem.
+   */
+  [[nodiscard]] Int objectiveOptimalValue() const noexcept {
+    return _objectiveOptimalValue;
+  }
+
+  /**
+   * @return the committed total violation of the model.
+   */
+  [[nodiscard]] Int violation() {
+    return _solver.committedValue(_violation);
+  }
+};
+
+}  // namespace atlantis
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <fznparser/constraint.hpp>
+#include <fznparser/variables.hpp>
+
+#include "atlantis/invariantgraph/fznInvariantGraph.hpp"
+
+namespace atlantis::invariantgraph::fzn {
+
+bool fzn_cumulative(FznInvariantGraph&,
+                    const std::shared_ptr<fznparser::IntVarArray>& s,
+                    const std::shared_ptr<fznparser::IntVarArray>& d,
+                    const std::shared_ptr<fznparser::IntVarArray>& r,
+                    const fznparser::IntArg& b);
+
+bool fzn_cumulative(FznInvariantGraph&,
+                    const std::shared_ptr<fznparser::IntVarArray>& s,
+                    const std::shared_ptr<fznparser::IntVarArray>& d,
+                    const std::shared_ptr<fznparser::IntVarArray>& r,
+                    const fznparser::IntArg& b,
+                    const fznparser::BoolArg& reified);
+
+bool fzn_cumulative(FznInvariantGraph&, const fznparser::Constraint&);
+
+}  // namespace atlantis::invariantgraph::fzn
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <fznparser/constraint.hpp>
+#include <fznparser/variables.hpp>
+
+#include "atlantis/invariantgraph/fznInvariantGraph.hpp"
+
+namespace atlantis::invariantgraph::fzn {
+
+bool fzn_inverse(FznInvariantGraph&,
+                 const std::shared_ptr<fznparser::IntVarArray>& f,
+                 Int fOffset,
+                 const std::shared_ptr<fznparser::IntVarArray>& invf,
+                 Int invfOffset);
+
+bool fzn_inverse(FznInvariantGraph&,
+                 const std::shared_ptr<fznparser::IntVarArray>& f,
+                 Int fOffset,
+                 const std::shared_ptr<fznparser::IntVarArray>& invf,
+                 Int invfOffset, const fznparser::BoolArg& reified);
+
+bool fzn_inverse(FznInvariantGraph&, const fznparser::Constraint&);
+
+}  // namespace atlantis::invariantgraph::fzn
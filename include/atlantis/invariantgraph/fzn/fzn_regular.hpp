@@ -0,0 +1,23 @@
+#pragma once
+
+#include <fznparser/constraint.hpp>
+#include <fznparser/variables.hpp>
+
+#include "atlantis/invariantgraph/fznInvariantGraph.hpp"
+
+namespace atlantis::invariantgraph::fzn {
+
+bool fzn_regular(FznInvariantGraph&,
+                 const std::shared_ptr<fznparser::IntVarArray>& x, Int Q,
+                 Int S, std::vector<Int>&& d, Int q0,
+                 const fznparser::IntSet& F);
+
+bool fzn_regular(FznInvariantGraph&,
+                 const std::shared_ptr<fznparser::IntVarArray>& x, Int Q,
+                 Int S, std::vector<Int>&& d, Int q0,
+                 const fznparser::IntSet& F,
+                 const fznparser::BoolArg& reified);
+
+bool fzn_regular(FznInvariantGraph&, const fznparser::Constraint&);
+
+}  // namespace atlantis::invariantgraph::fzn
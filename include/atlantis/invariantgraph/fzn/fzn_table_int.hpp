@@ -0,0 +1,20 @@
+#pragma once
+
+#include <fznparser/constraint.hpp>
+#include <fznparser/variables.hpp>
+
+#include "atlantis/invariantgraph/fznInvariantGraph.hpp"
+
+namespace atlantis::invariantgraph::fzn {
+
+bool fzn_table_int(FznInvariantGraph&,
+                   const std::shared_ptr<fznparser::IntVarArray>& x,
+                   std::vector<Int>&& t);
+
+bool fzn_table_int(FznInvariantGraph&,
+                   const std::shared_ptr<fznparser::IntVarArray>& x,
+                   std::vector<Int>&& t, const fznparser::BoolArg& reified);
+
+bool fzn_table_int(FznInvariantGraph&, const fznparser::Constraint&);
+
+}  // namespace atlantis::invariantgraph::fzn
@@ -0,0 +1,33 @@
+#pragma once
+
+#include "atlantis/invariantgraph/implicitConstraintNode.hpp"
+#include "atlantis/invariantgraph/types.hpp"
+#include "atlantis/propagation/solverBase.hpp"
+#include "atlantis/search/neighbourhoods/neighbourhood.hpp"
+#include "atlantis/search/searchVariable.hpp"
+
+namespace atlantis::invariantgraph {
+
+/**
+ * The output variables are f followed by invf.
+ */
+class InverseImplicitNode : public ImplicitConstraintNode {
+ private:
+  size_t _numVars;
+  Int _fOffset;
+  Int _invfOffset;
+
+ public:
+  explicit InverseImplicitNode(IInvariantGraph&, std::vector<VarNodeId>&& f,
+                               Int fOffset, std::vector<VarNodeId>&& invf,
+                               Int invfOffset);
+
+  void init(InvariantNodeId) override;
+
+ protected:
+  std::shared_ptr<search::neighbourhoods::Neighbourhood> createNeighbourhood()
+      override;
+  virtual std::string dotLangIdentifier() const override;
+};
+
+}  // namespace atlantis::invariantgraph
@@ -6,6 +6,7 @@
 
 #include "atlantis/invariantgraph/iInvariantGraph.hpp"
 #include "atlantis/invariantgraph/invariantGraphRoot.hpp"
+#include "atlantis/logging/logger.hpp"
 #include "atlantis/propagation/types.hpp"
 #include "atlantis/search/neighbourhoods/neighbourhoodCombinator.hpp"
 
@@ -16,6 +17,11 @@ class InvariantGraph : public virtual IInvariantGraph {
   propagation::SolverBase& _solver;
   std::vector<VarNode> _varNodes;
   std::unordered_map<std::string, VarNodeId> _namedVarNodeIndices;
+  // _varNodeForwards[i] is the VarNode that VarNode i was replaced by (or i
+  // if it was not replaced), where the VarNodes without an entry were not
+  // replaced. Identifiers are resolved through the forwards, which are
+  // shortcut on lookup:
+  mutable std::vector<VarNodeId> _varNodeForwards;
   std::unordered_map<Int, VarNodeId> _intVarNodeIndices;
   std::array<VarNodeId, 2> _boolVarNodeIndices;
 
@@ -23,6 +29,9 @@ class InvariantGraph : public virtual IInvariantGraph {
   std::vector<std::shared_ptr<IImplicitConstraintNode>>
       _implicitConstraintNodes;
   bool _breakDynamicCycles;
+  // _invariantConstraintNames[i] is the identifier of the constraint that
+  // invariant i in the solver was created for:
+  std::vector<std::string> _invariantConstraintNames;
 
   void populateRootNode();
 
@@ -134,7 +143,8 @@ class InvariantGraph : public virtual IInvariantGraph {
 
   /**
    * @brief replaces the given old VarNode with the new VarNode in
-   * all Invariants.
+   * all Invariants. The identifiers of the old VarNode are thereafter
+   * resolved to the new VarNode.
    */
   void replaceVarNode(VarNodeId oldNodeId, VarNodeId newNodeId) override;
 
@@ -151,6 +161,12 @@ class InvariantGraph : public virtual IInvariantGraph {
 
   void construct() override;
 
+  /**
+   * @brief constructs the invariant graph and logs the time that each pass
+   * of the construction takes (at the debug level).
+   */
+  void construct(logging::Logger&);
+
   void close() override;
 
   void splitMultiDefinedVars();
@@ -166,28 +182,43 @@ class InvariantGraph : public virtual IInvariantGraph {
 
   void writeDotFile(std::ostream&) const;
 
- private:
-  std::unordered_set<VarNodeId> dynamicVarNodeFrontier(
-      VarNodeId node, const std::unordered_set<VarNodeId>& visitedGlobal);
-
-  VarNodeId findCycleUtil(
-      VarNodeId varNodeId, const std::unordered_set<VarNodeId>& visitedGlobal,
-      std::unordered_set<VarNodeId>& visitedLocal,
-      std::unordered_map<VarNodeId, InvariantGraphEdge>& path);
+  /**
+   * @return the identifier of the constraint that each invariant in the
+   * solver was created for (indexed by invariant id), where invariants that
+   * were not created for a constraint have an empty identifier.
+   */
+  [[nodiscard]] const std::vector<std::string>& invariantConstraintNames()
+      const;
 
+ private:
   InvariantGraphEdge findPivotInCycle(
       const std::vector<InvariantGraphEdge>& cycle);
 
   void breakSelfCycles();
 
-  std::vector<VarNodeId> breakCycles(
-      VarNodeId node, std::unordered_set<VarNodeId>& visitedGlobal);
-  VarNodeId breakCycle(const std::vector<InvariantGraphEdge>& cycle);
+  /**
+   * @return the strongly connected components (of size greater than one) of
+   * the graph over the variable nodes, where there is an edge from v to w if
+   * v is an input to an invariant node that defines w.
+   */
+  std::vector<std::vector<VarNodeId>> stronglyConnectedComponents();
+
+  /**
+   * @brief breaks all cycles within the strongly connected component, where
+   * localIndex[v] is the index of v in its component.
+   */
+  void breakCycles(const std::vector<VarNodeId>& component,
+                   const std::vector<size_t>& localIndex);
+  void breakCycle(InvariantNodeId listeningInvNodeId, VarNodeId pivot);
+
+  [[nodiscard]] VarNodeId resolveVarNodeId(VarNodeId) const;
+  [[nodiscard]] VarNodeId namedVarNodeId(const std::string& identifier) const;
 
   void createVars();
   void createImplicitConstraints();
   void createInvariants();
   propagation::VarViewId createViolations();
+  void nameNewInvariants(const std::string& constraintName);
   void sanity(bool);
 };
 
@@ -1,20 +1,21 @@
 #pragma once
 
 #include "atlantis/invariantgraph/invariantNode.hpp"
+#include "atlantis/utils/matrix.hpp"
 
 namespace atlantis::invariantgraph {
 
 class ArrayElement2dNode : public InvariantNode {
  private:
-  std::vector<std::vector<Int>> _parMatrix;
+  Matrix<Int> _parMatrix;
   Int _offset1;
   Int _offset2;
   bool _isIntMatrix;
 
  public:
   ArrayElement2dNode(IInvariantGraph& graph, VarNodeId idx1, VarNodeId idx2,
-                     std::vector<std::vector<Int>>&& parMatrix,
-                     VarNodeId output, Int offset1, Int offset2);
+                     Matrix<Int>&& parMatrix, VarNodeId output, Int offset1,
+                     Int offset2);
 
   ArrayElement2dNode(IInvariantGraph& graph, VarNodeId idx1, VarNodeId idx2,
                      std::vector<std::vector<bool>>&& parMatrix,
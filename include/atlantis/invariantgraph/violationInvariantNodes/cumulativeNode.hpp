@@ -0,0 +1,35 @@
+#pragma once
+
+#include "atlantis/invariantgraph/violationInvariantNode.hpp"
+
+namespace atlantis::invariantgraph {
+
+/**
+ * The static inputs are the starts, the durations, and the requirements of
+ * the tasks followed by the capacity.
+ */
+class CumulativeNode : public ViolationInvariantNode {
+ private:
+  size_t _numTasks;
+  propagation::VarViewId _intermediate{propagation::NULL_ID};
+
+ public:
+  explicit CumulativeNode(IInvariantGraph& graph, std::vector<VarNodeId>&& s,
+                          std::vector<VarNodeId>&& d,
+                          std::vector<VarNodeId>&& r, VarNodeId b,
+                          VarNodeId reified);
+
+  explicit CumulativeNode(IInvariantGraph& graph, std::vector<VarNodeId>&& s,
+                          std::vector<VarNodeId>&& d,
+                          std::vector<VarNodeId>&& r, VarNodeId b,
+                          bool shouldHold = true);
+
+  void init(InvariantNodeId) override;
+
+  void registerOutputVars() override;
+
+  void registerNode() override;
+  virtual std::string dotLangIdentifier() const override;
+};
+
+}  // namespace atlantis::invariantgraph
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "atlantis/invariantgraph/violationInvariantNode.hpp"
+
+namespace atlantis::invariantgraph {
+
+/**
+ * The static input variables are f followed by invf, where the index set of
+ * f starts at fOffset and the index set of invf starts at invfOffset.
+ */
+class InverseNode : public ViolationInvariantNode {
+ private:
+  size_t _numVars;
+  Int _fOffset;
+  Int _invfOffset;
+  propagation::VarViewId _intermediate{propagation::NULL_ID};
+
+  void fixPartners(bool invfToF);
+
+ public:
+  explicit InverseNode(IInvariantGraph& graph, std::vector<VarNodeId>&& f,
+                       Int fOffset, std::vector<VarNodeId>&& invf,
+                       Int invfOffset, VarNodeId r);
+
+  explicit InverseNode(IInvariantGraph& graph, std::vector<VarNodeId>&& f,
+                       Int fOffset, std::vector<VarNodeId>&& invf,
+                       Int invfOffset, bool shouldHold = true);
+
+  void init(InvariantNodeId) override;
+
+  void updateState() override;
+
+  [[nodiscard]] bool canBeMadeImplicit() const override;
+
+  [[nodiscard]] bool makeImplicit() override;
+
+  void registerOutputVars() override;
+
+  void registerNode() override;
+  virtual std::string dotLangIdentifier() const override;
+};
+
+}  // namespace atlantis::invariantgraph
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "atlantis/invariantgraph/violationInvariantNode.hpp"
+
+namespace atlantis::invariantgraph {
+
+/**
+ * The automaton has the states 1..numStates and the symbols 1..numSymbols,
+ * and the transitions are given as a numStates x numSymbols matrix in
+ * row-major order, where 0 is the failure state.
+ */
+class RegularNode : public ViolationInvariantNode {
+ private:
+  Int _numStates;
+  Int _numSymbols;
+  std::vector<Int> _transitions;
+  Int _initialState;
+  std::vector<Int> _acceptingStates;
+  propagation::VarViewId _intermediate{propagation::NULL_ID};
+
+  [[nodiscard]] bool accepts(const std::vector<Int>& sequence) const;
+
+ public:
+  explicit RegularNode(IInvariantGraph& graph, std::vector<VarNodeId>&& x,
+                       Int numStates, Int numSymbols,
+                       std::vector<Int>&& transitions, Int initialState,
+                       std::vector<Int>&& acceptingStates, VarNodeId r);
+
+  explicit RegularNode(IInvariantGraph& graph, std::vector<VarNodeId>&& x,
+                       Int numStates, Int numSymbols,
+                       std::vector<Int>&& transitions, Int initialState,
+                       std::vector<Int>&& acceptingStates,
+                       bool shouldHold = true);
+
+  void init(InvariantNodeId) override;
+
+  void updateState() override;
+
+  void registerOutputVars() override;
+
+  void registerNode() override;
+  virtual std::string dotLangIdentifier() const override;
+};
+
+}  // namespace atlantis::invariantgraph
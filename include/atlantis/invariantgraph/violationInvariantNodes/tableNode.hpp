@@ -0,0 +1,33 @@
+#pragma once
+
+#include "atlantis/invariantgraph/violationInvariantNode.hpp"
+
+namespace atlantis::invariantgraph {
+
+/**
+ * The table is given in row-major order, with one row (of
+ * staticInputVarNodeIds().size() values) per tuple.
+ */
+class TableNode : public ViolationInvariantNode {
+ private:
+  std::vector<Int> _table;
+  propagation::VarViewId _intermediate{propagation::NULL_ID};
+
+ public:
+  explicit TableNode(IInvariantGraph& graph, std::vector<VarNodeId>&& x,
+                     std::vector<Int>&& t, VarNodeId r);
+
+  explicit TableNode(IInvariantGraph& graph, std::vector<VarNodeId>&& x,
+                     std::vector<Int>&& t, bool shouldHold = true);
+
+  void init(InvariantNodeId) override;
+
+  void updateState() override;
+
+  void registerOutputVars() override;
+
+  void registerNode() override;
+  virtual std::string dotLangIdentifier() const override;
+};
+
+}  // namespace atlantis::invariantgraph
@@ -6,7 +6,7 @@
 #include "atlantis/propagation/invariants/invariant.hpp"
 #include "atlantis/propagation/solverBase.hpp"
 #include "atlantis/propagation/types.hpp"
-#include "atlantis/propagation/variables/committableInt.hpp"
+#include "atlantis/propagation/utils/valueCounts.hpp"
 #include "atlantis/types.hpp"
 
 namespace atlantis::propagation {
@@ -21,8 +21,7 @@ class Count : public Invariant {
   VarId _output;
   VarViewId _needle;
   std::vector<VarViewId> _vars;
-  std::vector<CommittableInt> _counts;
-  Int _offset;
+  ValueCounts _counts;
   void increaseCount(Timestamp ts, Int value);
   void decreaseCount(Timestamp ts, Int value);
   signed char count(Timestamp ts, Int value);
@@ -45,35 +44,26 @@ class Count : public Invariant {
 };
 
 inline void Count::increaseCount(Timestamp ts, Int value) {
-  if (value - _offset < 0 ||
-      static_cast<Int>(_counts.size()) <= value - _offset) {
+  if (!_counts.inRange(value)) {
     return;
   }
-  assert(_counts[value - _offset].value(ts) + 1 > 0);
-  assert(_counts[value - _offset].value(ts) + 1 <=
-         static_cast<Int>(_vars.size()));
-  _counts[value - _offset].incValue(ts, 1);
+  assert(_counts.value(ts, value) + 1 > 0);
+  assert(_counts.value(ts, value) + 1 <= static_cast<Int>(_vars.size()));
+  _counts.incValue(ts, value, 1);
 }
 
 inline void Count::decreaseCount(Timestamp ts, Int value) {
-  if (value - _offset < 0 ||
-      static_cast<Int>(_counts.size()) <= value - _offset) {
+  if (!_counts.inRange(value)) {
     return;
   }
-  assert(_counts[value - _offset].value(ts) - 1 >= 0);
-  assert(_counts[value - _offset].value(ts) - 1 <
-         static_cast<Int>(_vars.size()));
-  _counts[value - _offset].incValue(ts, -1);
+  assert(_counts.value(ts, value) - 1 >= 0);
+  assert(_counts.value(ts, value) - 1 < static_cast<Int>(_vars.size()));
+  _counts.incValue(ts, value, -1);
 }
 
 inline signed char Count::count(Timestamp ts, Int value) {
-  if (value - _offset < 0 ||
-      static_cast<Int>(_counts.size()) <= value - _offset) {
-    return 0;
-  }
-  assert(0 <= value - _offset &&
-         static_cast<size_t>(value - _offset) <= _counts.size());
-  return static_cast<signed char>(_counts[value - _offset].value(ts));
+  // The count of a value outside the range is 0:
+  return static_cast<signed char>(_counts.value(ts, value));
 }
 
 }  // namespace atlantis::propagation
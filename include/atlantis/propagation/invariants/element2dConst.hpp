@@ -7,19 +7,25 @@
 #include "atlantis/propagation/solverBase.hpp"
 #include "atlantis/propagation/types.hpp"
 #include "atlantis/types.hpp"
+#include "atlantis/utils/matrix.hpp"
 
 namespace atlantis::propagation {
 
 /**
- * Invariant for output <- varArray[index] where varArray is a vector of
- * VarViewId. NOTE: the index set is 1 based (first element is varArray[1], not
- * varArray[0])
+ * Invariant for output <- matrix[index1][index2] where matrix is a matrix of
+ * integers. NOTE: the index sets are 1 based by default (first element is
+ * matrix[1][1], not matrix[0][0])
  *
  */
 
 class Element2dConst : public Invariant {
  private:
-  std::vector<std::vector<Int>> _matrix;
+  Matrix<Int> _matrix;
+  // The smallest and largest value of each row and of each column:
+  std::vector<Int> _rowMin;
+  std::vector<Int> _rowMax;
+  std::vector<Int> _colMin;
+  std::vector<Int> _colMax;
   std::array<const VarViewId, 2> _indices;
   std::array<const Int, 2> _dimensions;
   std::array<const Int, 2> _offsets;
@@ -40,13 +46,11 @@ class Element2dConst : public Invariant {
 
  public:
   explicit Element2dConst(SolverBase&, VarId output, VarViewId index1,
-                          VarViewId index2,
-                          std::vector<std::vector<Int>>&& matrix,
+                          VarViewId index2, Matrix<Int>&& matrix,
                           Int offset1 = 1, Int offset2 = 1);
 
   explicit Element2dConst(SolverBase&, VarViewId output, VarViewId index1,
-                          VarViewId index2,
-                          std::vector<std::vector<Int>>&& matrix,
+                          VarViewId index2, Matrix<Int>&& matrix,
                           Int offset1 = 1, Int offset2 = 1);
 
   void registerVars() override;
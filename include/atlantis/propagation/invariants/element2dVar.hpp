@@ -7,19 +7,20 @@
 #include "atlantis/propagation/solverBase.hpp"
 #include "atlantis/propagation/types.hpp"
 #include "atlantis/types.hpp"
+#include "atlantis/utils/matrix.hpp"
 
 namespace atlantis::propagation {
 
 /**
- * Invariant for output <- varArray[index] where varArray is a vector of
- * VarViewId. NOTE: the index set is 1 based (first element is varArray[1], not
- * varArray[0])
+ * Invariant for output <- varMatrix[index1][index2] where varMatrix is a
+ * matrix of VarViewId. NOTE: the index sets are 1 based by default (first
+ * element is varMatrix[1][1], not varMatrix[0][0])
  *
  */
 
 class Element2dVar : public Invariant {
  private:
-  std::vector<std::vector<VarViewId>> _varMatrix;
+  Matrix<VarViewId> _varMatrix;
   std::array<const VarViewId, 2> _indices;
   std::array<const Int, 2> _dimensions;
   std::array<const Int, 2> _offsets;
@@ -40,13 +41,11 @@ class Element2dVar : public Invariant {
 
  public:
   explicit Element2dVar(SolverBase&, VarId output, VarViewId index1,
-                        VarViewId index2,
-                        std::vector<std::vector<VarViewId>>&& varMatrix,
+                        VarViewId index2, Matrix<VarViewId>&& varMatrix,
                         Int offset1 = 1, Int offset2 = 1);
 
   explicit Element2dVar(SolverBase&, VarViewId output, VarViewId index1,
-                        VarViewId index2,
-                        std::vector<std::vector<VarViewId>>&& varMatrix,
+                        VarViewId index2, Matrix<VarViewId>&& varMatrix,
                         Int offset1 = 1, Int offset2 = 1);
 
   void registerVars() override;
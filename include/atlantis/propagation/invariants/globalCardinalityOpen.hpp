@@ -1,11 +1,14 @@
 #pragma once
 
+#include <algorithm>
+#include <utility>
 #include <vector>
 
 #include "atlantis/propagation/invariants/invariant.hpp"
 #include "atlantis/propagation/solverBase.hpp"
 #include "atlantis/propagation/types.hpp"
-#include "atlantis/propagation/variables/committableInt.hpp"
+#include "atlantis/propagation/utils/committableArray.hpp"
+#include "atlantis/propagation/utils/valueCounts.hpp"
 #include "atlantis/types.hpp"
 
 namespace atlantis::propagation {
@@ -15,9 +18,14 @@ class GlobalCardinalityOpen : public Invariant {
   std::vector<VarId> _outputs;
   std::vector<VarViewId> _inputs;
   std::vector<Int> _cover;
+  // _coverVarIndex[v - _offset] is the index i with _cover[i] == v (or -1).
+  // If the cover is wide (see ValueCounts::isWide), then _coverVarIndex is
+  // empty and _sortedCover holds the pairs (_cover[i], i) sorted by value:
   std::vector<Int> _coverVarIndex;
-  std::vector<CommittableInt> _counts;
+  std::vector<std::pair<Int, Int>> _sortedCover;
+  CommittableArray _counts;
   Int _offset;
+  [[nodiscard]] Int coverIndex(Int value) const;
   void increaseCount(Timestamp ts, Int value);
   void decreaseCountAndUpdateOutput(Timestamp ts, Int value);
   void increaseCountAndUpdateOutput(Timestamp ts, Int value);
@@ -41,31 +49,39 @@ class GlobalCardinalityOpen : public Invariant {
   void notifyCurrentInputChanged(Timestamp) override;
 };
 
+inline Int GlobalCardinalityOpen::coverIndex(Int value) const {
+  if (_sortedCover.empty()) {
+    return 0 <= value - _offset &&
+                   value - _offset < static_cast<Int>(_coverVarIndex.size())
+               ? _coverVarIndex[value - _offset]
+               : -1;
+  }
+  const auto it = std::lower_bound(
+      _sortedCover.begin(), _sortedCover.end(), value,
+      [](const std::pair<Int, Int>& entry, Int v) { return entry.first < v; });
+  return it != _sortedCover.end() && it->first == value ? it->second : -1;
+}
+
 inline void GlobalCardinalityOpen::increaseCount(Timestamp ts, Int value) {
-  if (0 <= value - _offset &&
-      value - _offset < static_cast<Int>(_coverVarIndex.size()) &&
-      _coverVarIndex[value - _offset] >= 0) {
-    _counts[_coverVarIndex[value - _offset]].incValue(ts, 1);
+  const Int index = coverIndex(value);
+  if (index >= 0) {
+    _counts.incValue(ts, index, 1);
   }
 }
 
 inline void GlobalCardinalityOpen::decreaseCountAndUpdateOutput(Timestamp ts,
                                                                 Int value) {
-  if (0 <= value - _offset &&
-      value - _offset < static_cast<Int>(_coverVarIndex.size()) &&
-      _coverVarIndex[value - _offset] >= 0) {
-    updateValue(ts, _outputs[_coverVarIndex[value - _offset]],
-                _counts[_coverVarIndex[value - _offset]].incValue(ts, -1));
+  const Int index = coverIndex(value);
+  if (index >= 0) {
+    updateValue(ts, _outputs[index], _counts.incValue(ts, index, -1));
   }
 }
 
 inline void GlobalCardinalityOpen::increaseCountAndUpdateOutput(Timestamp ts,
                                                                 Int value) {
-  if (0 <= value - _offset &&
-      value - _offset < static_cast<Int>(_coverVarIndex.size()) &&
-      _coverVarIndex[value - _offset] >= 0) {
-    updateValue(ts, _outputs[_coverVarIndex[value - _offset]],
-                _counts[_coverVarIndex[value - _offset]].incValue(ts, 1));
+  const Int index = coverIndex(value);
+  if (index >= 0) {
+    updateValue(ts, _outputs[index], _counts.incValue(ts, index, 1));
   }
 }
 
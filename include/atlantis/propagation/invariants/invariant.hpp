@@ -13,7 +13,9 @@ class SolverBase;  // Forward declaration
 
 class Invariant {
  protected:
-  SolverBase& _solver;
+  // A pointer rather than a reference so that a copy of the invariant can be
+  // rebound to a copy of the solver:
+  SolverBase* _solver;
 
   std::vector<VarId> _definedVars{};
   // State used for returning next input. Null state is -1 by default
@@ -24,7 +26,7 @@ class Invariant {
   bool _isPostponed{false};
 
   explicit Invariant(SolverBase& solver, Int nullState = -1)
-      : _solver(solver), _state(NULL_TIMESTAMP, nullState) {}
+      : _solver(&solver), _state(NULL_TIMESTAMP, nullState) {}
 
   /**
    * Register to the solver that variable is defined by the invariant.
@@ -58,6 +60,12 @@ class Invariant {
 
   void setId(InvariantId id) { _id = id; }
 
+  /**
+   * Rebinds the invariant to @p solver. Only used when copying a solver,
+   * where the copied invariant must refer to the copied solver.
+   */
+  void rebind(SolverBase& solver) noexcept { _solver = &solver; }
+
   /**
    * Preconditions for initialisation:
    * 1) The invariant has been registered in an solver and has a valid ID.
@@ -12,6 +12,10 @@ namespace atlantis::propagation {
 /**
  * Invariant for output <- sum(coeffs_i * varArray_i)
  *
+ * Inputs that are affine views (see IntView::affineMap) are folded into
+ * their source variables, and inputs with the same source variable are
+ * merged, so that the invariant is notified at most once per source
+ * variable and per timestamp.
  */
 
 class Linear : public Invariant {
@@ -19,6 +23,10 @@ class Linear : public Invariant {
   VarId _output;
   std::vector<Int> _coeffs;
   std::vector<VarViewId> _varArray;
+  // The constant term from the offsets of the folded affine views:
+  Int _offset{0};
+
+  void foldAffineViews();
 
  public:
   explicit Linear(SolverBase&, VarViewId output,
@@ -1,26 +1,27 @@
 #pragma once
 
+#include <functional>
 #include <vector>
 
 #include "atlantis/propagation/invariants/invariant.hpp"
 #include "atlantis/propagation/solverBase.hpp"
 #include "atlantis/propagation/types.hpp"
-#include "atlantis/propagation/utils/priorityList.hpp"
+#include "atlantis/propagation/utils/tournamentTree.hpp"
 
 namespace atlantis::propagation {
 
 /**
  * Invariant for output <- max(varArray)
  *
+ * The input values are maintained in a tournament tree, so notifying and
+ * committing a changed input is O(log n).
  */
 
 class Max : public Invariant {
  private:
   VarId _output;
   std::vector<VarViewId> _varArray;
-  std::vector<std::pair<CommittableInt, CommittableInt>> _linkedList;
-  CommittableInt _listHead;
-  CommittableInt _updatedMax;  // The min value of the probe.
+  TournamentTree<std::greater<Int>> _tree;
   Int _limit;
 
  public:
@@ -1,9 +1,9 @@
 #pragma once
 
-#include <unordered_set>
 #include <vector>
 
 #include "atlantis/exceptions/exceptions.hpp"
+#include "atlantis/propagation/propagation/searchVarAncestors.hpp"
 #include "atlantis/propagation/types.hpp"
 
 namespace atlantis::propagation {
@@ -23,8 +23,12 @@ class OutputToInputExplorer {
   std::vector<Timestamp> _invariantComputedAt;
   std::vector<bool> _invariantIsOnStack;
 
-  std::vector<std::unordered_set<VarId>> _searchVarAncestors;
-  std::vector<bool> _onPropagationPath;
+  SearchVarAncestors _searchVarAncestors;
+  // _onPropagationPath[id] == _propagationPathTimestamp iff id is on the
+  // propagation path of a search variable modified at that timestamp:
+  std::vector<Timestamp> _onPropagationPath;
+  Timestamp _propagationPathTimestamp{NULL_TIMESTAMP};
+  std::vector<VarId> _propagationPathStack;
 
   OutputToInputMarkingMode _outputToInputMarkingMode;
 
@@ -53,7 +57,7 @@ class OutputToInputExplorer {
   bool pushNextInputVar();
 
   void outputToInputStaticMarking();
-  void inputToOutputExplorationMarking();
+  void inputToOutputExplorationMarking(Timestamp);
 
   template <OutputToInputMarkingMode MarkingMode>
   void propagate(Timestamp);
@@ -62,6 +66,11 @@ class OutputToInputExplorer {
   OutputToInputExplorer() = delete;
   OutputToInputExplorer(Solver& solver);
 
+  /**
+   * Copies @p other, where the copy explores @p solver.
+   */
+  OutputToInputExplorer(Solver& solver, const OutputToInputExplorer& other);
+
   void registerVar(VarId);
   void registerInvariant(InvariantId);
   /**
@@ -0,0 +1,133 @@
+#pragma once
+
+#include <bit>
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
+#include "atlantis/propagation/types.hpp"
+
+namespace atlantis::propagation {
+
+/**
+ * Priority queue over variables where the priorities are small dense
+ * integers (the positions of the variables in the propagation graph).
+ *
+ * Every priority has a bucket, implemented as an intrusive stack over the
+ * variable ids, and a bitset keeps track of the non-empty buckets. Pushing
+ * is O(1) and popping is amortised O(1) when, as during propagation, the
+ * priorities of the pushed variables never decrease below the priority of
+ * the most recently popped variable.
+ */
+class PropagationBucketQueue {
+ private:
+  using Word = uint64_t;
+  static constexpr size_t WORD_BITS = sizeof(Word) * 8;
+  // Marks that a variable is not in the queue:
+  static constexpr VarId NOT_QUEUED = ~size_t{0} - 1;
+
+  // _priority[id] is the bucket of variable id:
+  std::vector<size_t> _priority;
+  // _next[id] is the variable after id in the same bucket, NULL_ID if id is
+  // the last variable in its bucket, and NOT_QUEUED if id is not queued:
+  std::vector<VarId> _next;
+  // _bucketHead[p] is the first variable in bucket p or NULL_ID:
+  std::vector<VarId> _bucketHead;
+  // bit p is set iff bucket p is non-empty:
+  std::vector<Word> _nonEmpty;
+  // all words before _minWord in _nonEmpty are zero:
+  size_t _minWord{0};
+  size_t _size{0};
+
+  inline void ensureBucket(size_t priority) {
+    if (priority >= _bucketHead.size()) {
+      _bucketHead.resize(priority + 1, NULL_ID);
+      _nonEmpty.resize((priority / WORD_BITS) + 1, Word{0});
+    }
+  }
+
+  [[nodiscard]] inline size_t minBucket() {
+    assert(_size > 0);
+    while (_nonEmpty[_minWord] == Word{0}) {
+      ++_minWord;
+      assert(_minWord < _nonEmpty.size());
+    }
+    return _minWord * WORD_BITS +
+           static_cast<size_t>(std::countr_zero(_nonEmpty[_minWord]));
+  }
+
+ public:
+  PropagationBucketQueue() = default;
+
+  void init(size_t numVars, size_t) {
+    _priority.clear();
+    _next.clear();
+    _bucketHead.clear();
+    _nonEmpty.clear();
+    _priority.reserve(numVars);
+    _next.reserve(numVars);
+    _minWord = 0;
+    _size = 0;
+  }
+
+  // vars must be initialised in order.
+  void initVar([[maybe_unused]] VarId id, size_t priority) {
+    assert(id == _priority.size());
+    ensureBucket(priority);
+    _priority.emplace_back(priority);
+    _next.emplace_back(NOT_QUEUED);
+  }
+
+  void updatePriority(VarId id, size_t newPriority) {
+    assert(id < _priority.size());
+    // The priority of a queued variable cannot be changed:
+    assert(_next[id] == NOT_QUEUED);
+    ensureBucket(newPriority);
+    _priority[id] = newPriority;
+  }
+
+  [[nodiscard]] inline bool empty() const { return _size == 0; }
+
+  [[nodiscard]] inline size_t size() const { return _size; }
+
+  void push(VarId id) {
+    assert(id < _next.size());
+    if (_next[id] != NOT_QUEUED) {
+      return;  // id is already in the queue
+    }
+    const size_t priority = _priority[id];
+    const size_t word = priority / WORD_BITS;
+    _next[id] = _bucketHead[priority];
+    _bucketHead[priority] = id;
+    _nonEmpty[word] |= (Word{1} << (priority % WORD_BITS));
+    if (_size == 0 || word < _minWord) {
+      _minWord = word;
+    }
+    ++_size;
+  }
+
+  VarId pop() {
+    if (_size == 0) {
+      return NULL_ID;
+    }
+    const size_t priority = minBucket();
+    const VarId id = _bucketHead[priority];
+    assert(id != NULL_ID);
+    _bucketHead[priority] = _next[id];
+    if (_bucketHead[priority] == NULL_ID) {
+      _nonEmpty[priority / WORD_BITS] &= ~(Word{1} << (priority % WORD_BITS));
+    }
+    _next[id] = NOT_QUEUED;
+    --_size;
+    return id;
+  }
+
+  VarId top() {
+    if (_size == 0) {
+      return NULL_ID;
+    }
+    return _bucketHead[minBucket()];
+  }
+};
+
+}  // namespace atlantis::propagation
@@ -14,13 +14,20 @@ class PropagationGraph {
    public:
     InvariantId invariantId;
     LocalId localId;
+    // If the variable is a dynamic input, then the invariant only listens to
+    // it while it is the active input (see Invariant::dynamicInputVar):
+    bool isDynamicInput;
     ListeningInvariantData(const ListeningInvariantData& other) = default;
     ListeningInvariantData(const InvariantId t_invariantId,
-                           const LocalId t_localId)
-        : invariantId(t_invariantId), localId(t_localId) {}
+                           const LocalId t_localId,
+                           const bool t_isDynamicInput = false)
+        : invariantId(t_invariantId),
+          localId(t_localId),
+          isDynamicInput(t_isDynamicInput) {}
     ListeningInvariantData& operator=(ListeningInvariantData&& other) noexcept {
       invariantId = other.invariantId;
       localId = other.localId;
+      isDynamicInput = other.isDynamicInput;
       return *this;
     }
   };
@@ -107,6 +114,11 @@ class PropagationGraph {
  public:
   explicit PropagationGraph(const Store& store, size_t expectedSize = 1000u);
 
+  /**
+   * Copies @p other, where the copy refers to @p store.
+   */
+  PropagationGraph(const Store& store, const PropagationGraph& other);
+
   /**
    * update internal datastructures based on currently registered  variables and
    * invariants.
@@ -212,9 +224,7 @@ class PropagationGraph {
   }
 
   [[nodiscard]] inline VarId dequeuePropagationQueue() {
-    VarId id = _propagationQueue.top();
-    _propagationQueue.pop();
-    return id;
+    return _propagationQueue.pop();
   }
 
   [[nodiscard]] bool hasDynamicCycle() const noexcept {
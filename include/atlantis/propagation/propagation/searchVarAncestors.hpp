@@ -0,0 +1,94 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
+#include "atlantis/propagation/types.hpp"
+
+namespace atlantis::propagation {
+
+// Forward declare Solver
+class Solver;
+
+/**
+ * The search variables that each variable (transitively) depends on.
+ *
+ * The search variables are numbered in increasing VarId order, and the
+ * ancestors of a variable are stored as a sorted list of disjoint intervals
+ * of such numbers. As neighbouring variables tend to be inputs to the same
+ * invariants, the lists are typically short. Variables with the same
+ * ancestors as one of their inputs share the list of that input, and so do
+ * variables that (through dynamic cycles) depend on each other.
+ *
+ * The ancestors of all variables are computed in a single pass over the
+ * strongly connected components of the propagation graph.
+ */
+class SearchVarAncestors {
+ public:
+  struct Interval {
+    // [begin, end) of search variable numbers:
+    uint32_t begin;
+    uint32_t end;
+    bool operator==(const Interval&) const = default;
+  };
+
+ private:
+  struct Range {
+    // [begin, end) of indices into _intervals:
+    size_t begin;
+    size_t end;
+  };
+
+  static constexpr uint32_t NOT_SEARCH_VAR = ~uint32_t{0};
+
+  std::vector<uint32_t> _searchVarNumber;
+  std::vector<Range> _ranges;
+  std::vector<Interval> _intervals;
+
+ public:
+  SearchVarAncestors() = default;
+
+  /**
+   * Computes the ancestors of all variables in the (closed) solver.
+   */
+  void build(const Solver&);
+
+  void clear();
+
+  /**
+   * @return true if the value of @p varId depends on the search variable
+   * @p searchVarId.
+   */
+  [[nodiscard]] inline bool isAncestor(VarId searchVarId, VarId varId) const {
+    assert(searchVarId < _searchVarNumber.size());
+    assert(varId < _ranges.size());
+    const uint32_t number = _searchVarNumber[searchVarId];
+    const Range& range = _ranges[varId];
+    if (number == NOT_SEARCH_VAR || range.begin == range.end) {
+      return false;
+    }
+    if (range.end - range.begin == 1) {
+      const Interval& interval = _intervals[range.begin];
+      return interval.begin <= number && number < interval.end;
+    }
+    // The last interval that begins at or before number:
+    const auto first = _intervals.begin() + range.begin;
+    const auto it = std::upper_bound(
+        first, _intervals.begin() + range.end, number,
+        [](uint32_t n, const Interval& interval) { return n < interval.begin; });
+    return it != first && number < (it - 1)->end;
+  }
+
+  [[nodiscard]] size_t numIntervals() const noexcept {
+    return _intervals.size();
+  }
+
+  /**
+   * @return the number of bytes allocated by the data structure.
+   */
+  [[nodiscard]] size_t memoryUsage() const noexcept;
+};
+
+}  // namespace atlantis::propagation
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <memory>
 #include <unordered_set>
 #include <vector>
 
@@ -8,7 +9,9 @@
 #include "atlantis/propagation/propagation/propagationGraph.hpp"
 #include "atlantis/propagation/solverBase.hpp"
 #include "atlantis/propagation/utils/hashes.hpp"
-#include "atlantis/propagation/variables/intVar.hpp"
+#include "atlantis/propagation/utils/invariantProfiler.hpp"
+#include "atlantis/propagation/utils/sparseIdSet.hpp"
+#include "atlantis/propagation/variables/committableInt.hpp"
 
 namespace atlantis::propagation {
 
@@ -22,14 +25,31 @@ class Solver : public SolverBase {
   PropagationGraph _propGraph;
   OutputToInputExplorer _outputToInputExplorer;
 
-  std::vector<bool> _isEnqueued;
+  // _enqueuedAt[id] == _currentTimestamp iff id has been enqueued during the
+  // current move, which avoids resetting a flag per variable on every move:
+  std::vector<Timestamp> _enqueuedAt;
   std::vector<std::vector<VarId>> _layerQueue{};
   std::vector<size_t> _layerQueueIndex{};
 
-  std::unordered_set<VarId> _modifiedSearchVars;
+  SparseIdSet _modifiedSearchVars;
+
+  // The variables queried for every probe of the current probe batch:
+  bool _isProbingBatch{false};
+  std::vector<VarId> _batchQueriedVars{};
+
+  // The timestamp of the latest probe that can be committed by
+  // commitLastProbe, and the variables that the probe propagated:
+  Timestamp _lastProbeTimestamp{NULL_TIMESTAMP};
+  std::vector<VarId> _probedVars{};
+
+  // nullptr unless profiling is enabled:
+  std::unique_ptr<InvariantProfiler> _profiler{nullptr};
 
   void incCurrentTimestamp();
 
+  [[nodiscard]] inline bool isEnqueued(VarId) const;
+  inline void markEnqueued(VarId);
+
   void closeInvariants();
 
   void clearPropagationQueue();
@@ -41,6 +61,11 @@ class Solver : public SolverBase {
 
   void outputToInputPropagate();
 
+  // The (out-of-line) versions of nextInput and notifyCurrentInputChanged
+  // that are used when profiling is enabled:
+  VarId profiledNextInput(InvariantId);
+  void profiledNotifyCurrentInputChanged(InvariantId);
+
   /**
    * Register that 'from' defines variable 'to'. Throws exception if
    * already defined.
@@ -50,8 +75,20 @@ class Solver : public SolverBase {
    */
   void registerDefinedVar(VarId definedVarId, InvariantId invariantId) final;
 
+  Solver(const Solver&);
+
  public:
   Solver(/* args */);
+  Solver& operator=(const Solver&) = delete;
+
+  /**
+   * Deep-copies the solver, including its variables, invariants, views, and
+   * propagation graph, so that the copy can be used independently of (and
+   * concurrently with) the original without constructing the model again.
+   * @throw SolverOpenException if the solver is open.
+   * @throw SolverStateException if the solver is not idle.
+   */
+  [[nodiscard]] std::unique_ptr<Solver> clone() const;
 
   void open() final;
   void close() final;
@@ -61,6 +98,19 @@ class Solver : public SolverBase {
   OutputToInputMarkingMode outputToInputMarkingMode() const;
   void setOutputToInputMarkingMode(OutputToInputMarkingMode);
 
+  /**
+   * Starts counting the calls the solver makes to each invariant and the
+   * time spent in them. Copies of the solver count their calls separately.
+   */
+  void enableProfiling();
+
+  /**
+   * @return the profiler, or nullptr if profiling is not enabled.
+   */
+  [[nodiscard]] inline InvariantProfiler* profiler() noexcept {
+    return _profiler.get();
+  }
+
   //--------------------- Notification ---------------------
   /***
    * @param id the id of the changed variable
@@ -93,14 +143,55 @@ class Solver : public SolverBase {
   void endProbe();
   void query(VarViewId);
 
+  /**
+   * Begins a batch of probes, during which no moves can be committed.
+   *
+   * The variables queried after beginProbeBatch (and before the first move
+   * of the batch) are queried by every probe of the batch.
+   *
+   * A batch is a convenience, not an optimisation, as the probes share no
+   * work: in input-to-output mode every probe propagates all modified
+   * variables, and in output-to-input mode every probe registers the queried
+   * variables with the explorer, which consumes them while propagating.
+   */
+  void beginProbeBatch();
+  void endProbeBatch();
+
+  /**
+   * Ends the current probe batch after a probe of the batch failed (threw),
+   * discarding the unfinished move or probe. The solver is idle afterwards.
+   */
+  void abortProbeBatch();
+
+  [[nodiscard]] inline bool isProbingBatch() const noexcept {
+    return _isProbingBatch;
+  }
+
   void beginCommit();
   void endCommit();
 
+  /**
+   * @return true if the latest probe was at timestamp @p ts, and no move has
+   * begun since, and the probe propagated every modified variable (which is
+   * the case in input-to-output mode).
+   */
+  [[nodiscard]] inline bool canCommitLastProbe(Timestamp ts) const noexcept {
+    return ts == _lastProbeTimestamp && ts == _currentTimestamp &&
+           _solverState == SolverState::IDLE && !_isProbingBatch;
+  }
+
+  /**
+   * Commits the values that the latest probe computed, which is equivalent
+   * to (but cheaper than) committing the move of the probe, since the move
+   * is not propagated again.
+   */
+  void commitLastProbe();
+
   size_t numVars() const;
   size_t numInvariants() const;
 
   [[nodiscard]] const std::vector<VarId>& searchVars() const;
-  [[nodiscard]] const std::unordered_set<VarId>& modifiedSearchVar() const;
+  [[nodiscard]] const SparseIdSet& modifiedSearchVar() const;
   [[nodiscard]] const std::vector<std::pair<VarId, bool>>& inputVars(
       InvariantId) const;
 
@@ -146,10 +237,20 @@ inline void Solver::incCurrentTimestamp() {
   }
   assert(std::all_of(
       searchVars().begin(), searchVars().end(), [&](const VarId varId) {
-        return !_store.intVar(varId).hasChanged(_currentTimestamp);
+        return !_store.intVarValue(varId).hasChanged(_currentTimestamp);
       }));
 }
 
+inline bool Solver::isEnqueued(VarId id) const {
+  assert(id < _enqueuedAt.size());
+  return _enqueuedAt[id] == _currentTimestamp;
+}
+
+inline void Solver::markEnqueued(VarId id) {
+  assert(id < _enqueuedAt.size());
+  _enqueuedAt[id] = _currentTimestamp;
+}
+
 inline size_t Solver::numVars() const { return _propGraph.numVars(); }
 
 inline size_t Solver::numInvariants() const {
@@ -171,14 +272,21 @@ Solver::listeningInvariantData(VarId id) const {
 }
 
 inline VarId Solver::nextInput(InvariantId invariantId) {
+  if (_profiler != nullptr) [[unlikely]] {
+    return profiledNextInput(invariantId);
+  }
   return sourceId(_store.invariant(invariantId).nextInput(_currentTimestamp));
 }
 inline void Solver::notifyCurrentInputChanged(InvariantId invariantId) {
+  if (_profiler != nullptr) [[unlikely]] {
+    profiledNotifyCurrentInputChanged(invariantId);
+    return;
+  }
   _store.invariant(invariantId).notifyCurrentInputChanged(_currentTimestamp);
 }
 
 inline bool Solver::hasChanged(Timestamp ts, VarId id) const {
-  return _store.constIntVar(id).hasChanged(ts);
+  return _store.constIntVarValue(id).hasChanged(ts);
 }
 
 inline void Solver::setValue(Timestamp ts, VarViewId id, Int val) {
@@ -189,7 +297,7 @@ inline void Solver::setValue(Timestamp ts, VarViewId id, Int val) {
 inline void Solver::setValue(Timestamp ts, VarId id, Int val) {
   assert(_propGraph.isSearchVar(id));
 
-  IntVar& var = _store.intVar(id);
+  CommittableInt& var = _store.intVarValue(id);
   var.setValue(ts, val);
 
   if (_propagationMode == PropagationMode::OUTPUT_TO_INPUT) {
@@ -236,7 +344,7 @@ inline const std::vector<std::pair<VarId, bool>>& Solver::inputVars(
   return _propGraph.inputVars(invariantId);
 }
 
-inline const std::unordered_set<VarId>& Solver::modifiedSearchVar() const {
+inline const SparseIdSet& Solver::modifiedSearchVar() const {
   return _modifiedSearchVars;
 }
 
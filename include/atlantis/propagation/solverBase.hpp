@@ -9,7 +9,6 @@
 
 namespace atlantis::propagation {
 
-class IntVar;
 class IntView;
 class Invariant;
 class ViolationInvariant;
@@ -51,8 +50,15 @@ class SolverBase {
 
   friend class Invariant;
 
+  /**
+   * Copies @p other, where the copied invariants and views are bound to the
+   * new solver.
+   */
+  SolverBase(const SolverBase& other);
+
  public:
   SolverBase(/* args */);
+  SolverBase& operator=(const SolverBase&) = delete;
 
   virtual ~SolverBase() = default;
 
@@ -93,16 +99,16 @@ class SolverBase {
 
   [[nodiscard]] inline Int lowerBound(VarViewId id) const {
     return id.isView() ? _store.constIntView(ViewId(id)).lowerBound()
-                       : _store.constIntVar(VarId(id)).lowerBound();
+                       : _store.intVarLowerBound(VarId(id));
   }
 
   [[nodiscard]] inline Int upperBound(VarViewId id) const {
     return id.isView() ? _store.constIntView(ViewId(id)).upperBound()
-                       : _store.constIntVar(VarId(id)).upperBound();
+                       : _store.intVarUpperBound(VarId(id));
   }
 
   inline void updateBounds(VarId id, Int lb, Int ub, bool widenOnly) {
-    _store.intVar(id).updateBounds(lb, ub, widenOnly);
+    _store.updateIntVarBounds(id, lb, ub, widenOnly);
   }
 
   void commitInvariantIf(Timestamp, InvariantId);
@@ -169,7 +175,7 @@ SolverBase::makeInvariant(Args&&... args) {
     throw SolverClosedException("Cannot make invariant when store is closed.");
   }
   const InvariantId invariantId = _store.createInvariantFromPtr(
-      std::make_unique<T>(std::forward<Args>(args)...));
+      std::make_unique<T>(std::forward<Args>(args)...), invariantCloner<T>());
   registerInvariant(invariantId);
 
   T& invariant = static_cast<T&>(_store.invariant(invariantId));
@@ -187,7 +193,7 @@ SolverBase::makeIntView(Args&&... args) {
   // We don't actually register views as they are invisible to propagation.
 
   const VarViewId viewId = _store.createIntViewFromPtr(
-      std::make_unique<T>(std::forward<Args>(args)...));
+      std::make_unique<T>(std::forward<Args>(args)...), intViewCloner<T>());
   _store.intView(ViewId(viewId)).init(ViewId(viewId));
   return viewId;
 }
@@ -199,7 +205,7 @@ SolverBase::makeViolationInvariant(Args&&... args) {
     throw SolverClosedException("Cannot make invariant when store is closed.");
   }
   const InvariantId violationInvId = _store.createInvariantFromPtr(
-      std::make_unique<T>(std::forward<Args>(args)...));
+      std::make_unique<T>(std::forward<Args>(args)...), invariantCloner<T>());
   T& violationInvariant = static_cast<T&>(_store.invariant(violationInvId));
   // A violation invariant is a type of invariant:
   registerInvariant(violationInvId);
@@ -216,21 +222,38 @@ inline Timestamp SolverBase::currentTimestamp() const {
 }
 
 inline bool SolverBase::hasChanged(Timestamp ts, VarId id) {
-  return _store.intVar(id).hasChanged(ts);
+  return _store.intVarValue(id).hasChanged(ts);
 }
 
 inline Int SolverBase::value(Timestamp ts, VarViewId id) {
-  return id.isView() ? _store.intView(ViewId(id)).value(ts)
-                     : _store.constIntVar(VarId(id)).value(ts);
+  if (id.isVar()) {
+    return _store.constIntVarValue(VarId(id)).value(ts);
+  }
+  // Chains of affine views are evaluated directly from their source:
+  const std::optional<AffineMap>& sourceMap =
+      _store.intViewSourceMap(ViewId(id));
+  return sourceMap.has_value()
+             ? sourceMap->apply(
+                   _store.constIntVarValue(_store.intViewSourceId(ViewId(id)))
+                       .value(ts))
+             : _store.intView(ViewId(id)).value(ts);
 }
 
 inline Int SolverBase::committedValue(VarViewId id) {
-  return id.isView() ? _store.intView(ViewId(id)).committedValue()
-                     : _store.constIntVar(VarId(id)).committedValue();
+  if (id.isVar()) {
+    return _store.constIntVarValue(VarId(id)).committedValue();
+  }
+  const std::optional<AffineMap>& sourceMap =
+      _store.intViewSourceMap(ViewId(id));
+  return sourceMap.has_value()
+             ? sourceMap->apply(
+                   _store.constIntVarValue(_store.intViewSourceId(ViewId(id)))
+                       .committedValue())
+             : _store.intView(ViewId(id)).committedValue();
 }
 
 inline Timestamp SolverBase::tmpTimestamp(VarViewId id) const {
-  return _store.constIntVar(id.isView() ? sourceId(id) : VarId(id))
+  return _store.constIntVarValue(id.isView() ? sourceId(id) : VarId(id))
       .tmpTimestamp();
 }
 
@@ -247,21 +270,21 @@ inline void SolverBase::recompute(Timestamp ts, InvariantId invariantId) {
 }
 
 inline void SolverBase::updateValue(Timestamp ts, VarId id, Int val) {
-  _store.intVar(id).setValue(ts, val);
+  _store.intVarValue(id).setValue(ts, val);
 }
 
 inline void SolverBase::incValue(Timestamp ts, VarId id, Int inc) {
-  _store.intVar(id).incValue(ts, inc);
+  _store.intVarValue(id).incValue(ts, inc);
 }
 
-inline void SolverBase::commit(VarId id) { _store.intVar(id).commit(); }
+inline void SolverBase::commit(VarId id) { _store.intVarValue(id).commit(); }
 
 inline void SolverBase::commitIf(Timestamp ts, VarId id) {
-  _store.intVar(id).commitIf(ts);
+  _store.intVarValue(id).commitIf(ts);
 }
 
 inline void SolverBase::commitValue(VarId id, Int val) {
-  _store.intVar(id).commitValue(val);
+  _store.intVarValue(id).commitValue(val);
 }
 
 inline void SolverBase::commitInvariantIf(Timestamp ts,
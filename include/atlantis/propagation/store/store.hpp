@@ -1,34 +1,96 @@
 #pragma once
 
+#include <cassert>
 #include <memory>
+#include <optional>
+#include <type_traits>
 #include <vector>
 
 #include "atlantis/propagation/invariants/invariant.hpp"
-#include "atlantis/propagation/variables/intVar.hpp"
+#include "atlantis/propagation/variables/committableInt.hpp"
 #include "atlantis/propagation/views/intView.hpp"
 
 namespace atlantis::propagation {
 
+class SolverBase;  // Forward declaration
+
 class Store {
+ public:
+  // Functions that copy an invariant (or view) and rebind the copy to
+  // another solver:
+  using InvariantCloner = std::unique_ptr<Invariant> (*)(const Invariant&,
+                                                          SolverBase&);
+  using IntViewCloner = std::unique_ptr<IntView> (*)(const IntView&,
+                                                      SolverBase&);
+
  private:
-  std::vector<IntVar> _intVars;
+  // The variables are stored column-wise: the values, which are read and
+  // written during propagation, are kept apart from the bounds, which are
+  // only used when the model is built, so that propagation does not pull
+  // the bounds into the cache:
+  std::vector<CommittableInt> _intVarValues;
+  std::vector<Int> _intVarLowerBounds;
+  std::vector<Int> _intVarUpperBounds;
   std::vector<std::unique_ptr<Invariant>> _invariants;
   std::vector<std::unique_ptr<IntView>> _intViews;
   std::vector<VarId> _intViewSourceId;
+  // _intViewSourceMap[i] is the affine map from the source variable of view
+  // i to view i if view i, and every view between it and its source, is
+  // affine in its parent:
+  std::vector<std::optional<AffineMap>> _intViewSourceMap;
+  // _invariantCloners[i] is nullptr if invariant i cannot be copied:
+  std::vector<InvariantCloner> _invariantCloners;
+  std::vector<IntViewCloner> _intViewCloners;
 
  public:
   Store();
 
+  /**
+   * Deep-copies the variables, invariants, and views of @p other, where the
+   * copied invariants and views are bound to @p solver.
+   * @throw SolverStateException if an invariant or view cannot be copied.
+   */
+  Store(const Store& other, SolverBase& solver);
+  Store(const Store&) = delete;
+
   VarViewId createIntVar(Timestamp ts, Int initValue, Int lowerBound,
                          Int upperBound);
 
-  InvariantId createInvariantFromPtr(std::unique_ptr<Invariant>&&);
-
-  VarViewId createIntViewFromPtr(std::unique_ptr<IntView>&&);
-
-  [[nodiscard]] IntVar& intVar(VarId);
-
-  [[nodiscard]] const IntVar& constIntVar(VarId) const;
+  InvariantId createInvariantFromPtr(std::unique_ptr<Invariant>&&,
+                                     InvariantCloner = nullptr);
+
+  VarViewId createIntViewFromPtr(std::unique_ptr<IntView>&&,
+                                 IntViewCloner = nullptr);
+
+  [[nodiscard]] inline CommittableInt& intVarValue(VarId id) {
+    assert(id < _intVarValues.size());
+    return _intVarValues[id];
+  }
+
+  [[nodiscard]] inline const CommittableInt& constIntVarValue(
+      VarId id) const {
+    assert(id < _intVarValues.size());
+    return _intVarValues[id];
+  }
+
+  [[nodiscard]] inline Int intVarLowerBound(VarId id) const {
+    assert(id < _intVarLowerBounds.size());
+    return _intVarLowerBounds[id];
+  }
+
+  [[nodiscard]] inline Int intVarUpperBound(VarId id) const {
+    assert(id < _intVarUpperBounds.size());
+    return _intVarUpperBounds[id];
+  }
+
+  /**
+   * Updates the bounds of variable @p id, where the bounds only are
+   * widened if @p widenOnly is true.
+   * @throw std::out_of_range if the resulting lower bound is greater than
+   * the resulting upper bound.
+   */
+  void updateIntVarBounds(VarId id, Int lowerBound, Int upperBound,
+                          bool widenOnly);
 
   [[nodiscard]] IntView& intView(ViewId);
 
@@ -36,16 +98,20 @@ class Store {
 
   [[nodiscard]] VarId sourceId(VarViewId) const noexcept;
 
-  [[nodiscard]] VarId intViewSourceId(ViewId) const;
+  [[nodiscard]] inline VarId intViewSourceId(ViewId id) const {
+    assert(id < _intViewSourceId.size());
+    return _intViewSourceId[id];
+  }
+
+  [[nodiscard]] inline const std::optional<AffineMap>& intViewSourceMap(
+      ViewId id) const noexcept {
+    return _intViewSourceMap[id];
+  }
 
   [[nodiscard]] Invariant& invariant(InvariantId);
 
   [[nodiscard]] const Invariant& constInvariant(InvariantId) const;
 
-  [[nodiscard]] std::vector<IntVar>::iterator intVarBegin();
-
-  [[nodiscard]] std::vector<IntVar>::iterator intVarEnd();
-
   [[nodiscard]] std::vector<std::unique_ptr<Invariant>>::iterator
   invariantBegin();
 
@@ -59,4 +125,40 @@ class Store {
   [[nodiscard]] VarId dynamicInputVar(Timestamp, InvariantId) const noexcept;
 };
 
+/**
+ * @return a function that copies invariants of type T, or nullptr if T is
+ * not copy constructible.
+ */
+template <class T>
+Store::InvariantCloner invariantCloner() {
+  if constexpr (std::is_copy_constructible_v<T>) {
+    return [](const Invariant& invariant,
+              SolverBase& solver) -> std::unique_ptr<Invariant> {
+      auto copy = std::make_unique<T>(static_cast<const T&>(invariant));
+      copy->rebind(solver);
+      return copy;
+    };
+  } else {
+    return nullptr;
+  }
+}
+
+/**
+ * @return a function that copies views of type T, or nullptr if T is not
+ * copy constructible.
+ */
+template <class T>
+Store::IntViewCloner intViewCloner() {
+  if constexpr (std::is_copy_constructible_v<T>) {
+    return [](const IntView& view,
+              SolverBase& solver) -> std::unique_ptr<IntView> {
+      auto copy = std::make_unique<T>(static_cast<const T&>(view));
+      copy->rebind(solver);
+      return copy;
+    };
+  } else {
+    return nullptr;
+  }
+}
+
 }  // namespace atlantis::propagation
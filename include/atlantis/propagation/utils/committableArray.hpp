@@ -0,0 +1,117 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <vector>
+
+#include "atlantis/propagation/types.hpp"
+#include "atlantis/propagation/variables/committableInt.hpp"
+#include "atlantis/types.hpp"
+
+namespace atlantis::propagation {
+
+/**
+ * An array of committable integers (see CommittableInt) that keeps track of
+ * the indices that were written at the latest timestamp. Committing costs
+ * time linear in the number of such indices instead of in size(), which
+ * matters for arrays that span a domain (such as value counts) where a move
+ * only changes a few entries.
+ */
+class CommittableArray {
+ private:
+  std::vector<CommittableInt> _values;
+  // The indices that have been written at _changedTimestamp and are not
+  // committed yet:
+  std::vector<size_t> _changedIndices;
+  Timestamp _changedTimestamp{NULL_TIMESTAMP};
+
+  inline void markChanged(Timestamp ts, size_t index) {
+    if (_changedTimestamp != ts) {
+      // The uncommitted values of an earlier timestamp are discarded:
+      _changedIndices.clear();
+      _changedTimestamp = ts;
+    }
+    if (_values[index].tmpTimestamp() != ts) {
+      _changedIndices.emplace_back(index);
+    }
+  }
+
+ public:
+  CommittableArray() = default;
+
+  CommittableArray(size_t size, Int value)
+      : _values(size, CommittableInt(NULL_TIMESTAMP, value)) {}
+
+  /**
+   * Replaces the contents with @p size committed entries of @p value.
+   */
+  void assign(size_t size, Int value) {
+    _values.assign(size, CommittableInt(NULL_TIMESTAMP, value));
+    _changedIndices.clear();
+    _changedIndices.reserve(size);
+    _changedTimestamp = NULL_TIMESTAMP;
+  }
+
+  void clear() { assign(0, 0); }
+
+  [[nodiscard]] inline size_t size() const noexcept { return _values.size(); }
+
+  [[nodiscard]] inline bool empty() const noexcept { return _values.empty(); }
+
+  [[nodiscard]] inline Int value(Timestamp ts, size_t index) const noexcept {
+    assert(index < size());
+    return _values[index].value(ts);
+  }
+
+  [[nodiscard]] inline Int committedValue(size_t index) const noexcept {
+    assert(index < size());
+    return _values[index].committedValue();
+  }
+
+  [[nodiscard]] inline bool hasChanged(Timestamp ts,
+                                       size_t index) const noexcept {
+    assert(index < size());
+    return _values[index].hasChanged(ts);
+  }
+
+  inline Int setValue(Timestamp ts, size_t index, Int newValue) {
+    assert(index < size());
+    markChanged(ts, index);
+    return _values[index].setValue(ts, newValue);
+  }
+
+  inline Int incValue(Timestamp ts, size_t index, Int inc) {
+    assert(index < size());
+    markChanged(ts, index);
+    return _values[index].incValue(ts, inc);
+  }
+
+  /**
+   * Sets every entry to @p newValue, only marking the entries whose value
+   * at @p ts is different.
+   */
+  void fill(Timestamp ts, Int newValue) {
+    for (size_t index = 0; index < size(); ++index) {
+      if (value(ts, index) != newValue) {
+        setValue(ts, index, newValue);
+      }
+    }
+  }
+
+  /**
+   * Commits the entries that were written at @p ts.
+   */
+  void commitIf(Timestamp ts) noexcept {
+    if (_changedTimestamp != ts) {
+      return;
+    }
+    for (const size_t index : _changedIndices) {
+      // Resetting the timestamp makes later writes at ts mark the index
+      // again:
+      _values[index] = CommittableInt(NULL_TIMESTAMP, _values[index].value(ts));
+    }
+    _changedIndices.clear();
+  }
+};
+
+}  // namespace atlantis::propagation
@@ -0,0 +1,142 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#define ATLANTIS_PROFILER_RDTSC
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define ATLANTIS_PROFILER_RDTSC
+#else
+#include <chrono>
+#endif
+
+#include "atlantis/propagation/types.hpp"
+
+namespace atlantis::propagation {
+
+class Store;  // Forward declaration
+
+/**
+ * The calls from the solver to an invariant that are profiled, where
+ * NOTIFY covers both notifyInputChanged (input-to-output propagation) and
+ * notifyCurrentInputChanged (output-to-input propagation).
+ */
+enum class InvariantCall : unsigned char {
+  NOTIFY = 0,
+  NEXT_INPUT = 1,
+  RECOMPUTE = 2,
+  COMMIT = 3
+};
+
+/**
+ * Counts, per invariant, the calls the solver makes to the invariant and
+ * the cumulative time spent in them. The time is measured in ticks of the
+ * time stamp counter when available (and of the steady clock otherwise),
+ * which are converted to seconds only when the report is written.
+ */
+class InvariantProfiler {
+ public:
+  static constexpr size_t NUM_CALLS = 4;
+
+  struct Counters {
+    std::array<uint64_t, NUM_CALLS> calls{};
+    std::array<uint64_t, NUM_CALLS> ticks{};
+  };
+
+ private:
+  std::vector<Counters> _counters;
+
+ public:
+  explicit InvariantProfiler(size_t numInvariants = 0)
+      : _counters(numInvariants) {}
+
+  [[nodiscard]] static inline uint64_t now() noexcept {
+#ifdef ATLANTIS_PROFILER_RDTSC
+    return __rdtsc();
+#else
+    return static_cast<uint64_t>(
+        std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+  }
+
+  /**
+   * @return the (estimated) number of ticks of now() per second.
+   */
+  [[nodiscard]] static double ticksPerSecond();
+
+  inline void registerInvariant(InvariantId id) {
+    if (id >= _counters.size()) {
+      _counters.resize(id + 1);
+    }
+  }
+
+  inline void record(InvariantId id, InvariantCall call,
+                     uint64_t startTicks) noexcept {
+    const uint64_t endTicks = now();
+    Counters& counters = _counters[id];
+    ++counters.calls[static_cast<size_t>(call)];
+    counters.ticks[static_cast<size_t>(call)] += endTicks - startTicks;
+  }
+
+  [[nodiscard]] size_t numInvariants() const noexcept {
+    return _counters.size();
+  }
+
+  [[nodiscard]] const Counters& counters(InvariantId id) const {
+    return _counters.at(id);
+  }
+
+  /**
+   * Adds the counters of @p other (typically of a copy of the same solver)
+   * to the counters of this profiler.
+   */
+  void merge(const InvariantProfiler& other);
+
+  /**
+   * Writes the profile as JSON: the calls and seconds per constraint name,
+   * per invariant type, and per invariant, in decreasing order of time.
+   *
+   * @param constraintNames The name of the constraint each invariant was
+   * created for, where invariants that have no (or an empty) name are
+   * reported under "other".
+   */
+  void writeJson(std::ostream&, const Store&,
+                 const std::vector<std::string>& constraintNames) const;
+};
+
+/**
+ * Records a call to an invariant when the scope ends, unless the profiler is
+ * nullptr.
+ */
+class InvariantProfilerScope {
+ private:
+  InvariantProfiler* _profiler;
+  InvariantId _invariantId;
+  InvariantCall _call;
+  uint64_t _startTicks;
+
+ public:
+  inline InvariantProfilerScope(InvariantProfiler* profiler,
+                                InvariantId invariantId, InvariantCall call)
+      : _profiler(profiler),
+        _invariantId(invariantId),
+        _call(call),
+        _startTicks(profiler == nullptr ? 0 : InvariantProfiler::now()) {}
+
+  InvariantProfilerScope(const InvariantProfilerScope&) = delete;
+  InvariantProfilerScope& operator=(const InvariantProfilerScope&) = delete;
+
+  inline ~InvariantProfilerScope() {
+    if (_profiler != nullptr) {
+      _profiler->record(_invariantId, _call, _startTicks);
+    }
+  }
+};
+
+}  // namespace atlantis::propagation
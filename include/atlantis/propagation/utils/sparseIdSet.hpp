@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <vector>
+
+#include "atlantis/propagation/types.hpp"
+
+namespace atlantis::propagation {
+
+/**
+ * A set of ids in [0, capacity()), where insertion, removal, and membership
+ * are constant time and the elements are stored contiguously. Unlike a hash
+ * set, no memory is allocated once the capacity has been reserved.
+ */
+class SparseIdSet {
+ private:
+  std::vector<size_t> _ids;
+  // _positions[id] is the index of id in _ids, or NULL_ID if id is absent:
+  std::vector<size_t> _positions;
+
+ public:
+  SparseIdSet() = default;
+
+  /**
+   * Makes room for the ids in [0, capacity), so that no memory is allocated
+   * by later insertions of such ids.
+   */
+  void reserve(size_t capacity) {
+    if (capacity > _positions.size()) {
+      _positions.resize(capacity, NULL_ID);
+      // Grows geometrically (as _positions does) when ids are reserved one
+      // at a time:
+      _ids.reserve(_positions.capacity());
+    }
+  }
+
+  [[nodiscard]] size_t capacity() const noexcept { return _positions.size(); }
+
+  [[nodiscard]] size_t size() const noexcept { return _ids.size(); }
+
+  [[nodiscard]] bool empty() const noexcept { return _ids.empty(); }
+
+  [[nodiscard]] bool contains(size_t id) const noexcept {
+    return id < _positions.size() && _positions[id] != NULL_ID;
+  }
+
+  void emplace(size_t id) {
+    assert(id < _positions.size());
+    if (_positions[id] == NULL_ID) {
+      _positions[id] = _ids.size();
+      _ids.emplace_back(id);
+    }
+  }
+
+  void erase(size_t id) {
+    assert(id < _positions.size());
+    const size_t position = _positions[id];
+    if (position == NULL_ID) {
+      return;
+    }
+    // Move the last id into the position of the erased one:
+    _ids[position] = _ids.back();
+    _positions[_ids[position]] = position;
+    _ids.pop_back();
+    _positions[id] = NULL_ID;
+  }
+
+  /**
+   * Removes all ids in time linear in size() (and not in capacity()).
+   */
+  void clear() noexcept {
+    for (const size_t id : _ids) {
+      _positions[id] = NULL_ID;
+    }
+    _ids.clear();
+  }
+
+  [[nodiscard]] std::vector<size_t>::const_iterator begin() const noexcept {
+    return _ids.begin();
+  }
+
+  [[nodiscard]] std::vector<size_t>::const_iterator end() const noexcept {
+    return _ids.end();
+  }
+};
+
+}  // namespace atlantis::propagation
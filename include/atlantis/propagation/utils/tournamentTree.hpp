@@ -0,0 +1,145 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <vector>
+
+#include "atlantis/propagation/types.hpp"
+#include "atlantis/propagation/variables/committableInt.hpp"
+#include "atlantis/types.hpp"
+
+namespace atlantis::propagation {
+
+/**
+ * A committable tournament tree over a fixed number of values.
+ *
+ * The tree is stored as an array where node k has the children 2k and 2k+1,
+ * and leaf i is node (numLeaves + i). Each internal node holds the best
+ * (with respect to Compare) value of its children. Changing a value updates
+ * the path from its leaf to the root in O(log n), and committing only visits
+ * the paths of the values that were changed at the committed timestamp.
+ */
+template <class Compare>
+class TournamentTree {
+ private:
+  size_t _size;
+  size_t _numLeaves;
+  std::vector<CommittableInt> _tree;
+  // The leaves that were changed at _changedTimestamp:
+  Timestamp _changedTimestamp{NULL_TIMESTAMP};
+  std::vector<size_t> _changedLeaves;
+  // True iff the whole tree was recomputed at _changedTimestamp:
+  bool _recomputed{false};
+  Compare _cmp{};
+
+  [[nodiscard]] inline Int best(Int a, Int b) const {
+    return _cmp(b, a) ? b : a;
+  }
+
+  inline void registerChange(Timestamp ts) {
+    if (_changedTimestamp != ts) {
+      _changedTimestamp = ts;
+      _changedLeaves.clear();
+      _recomputed = false;
+    }
+  }
+
+ public:
+  /**
+   * @param size the number of values in the tree.
+   * @param neutral the value of unused leaves, that is never better than any
+   * value in the tree.
+   */
+  TournamentTree(size_t size, Int neutral)
+      : _size(size), _numLeaves(1), _changedLeaves() {
+    while (_numLeaves < _size) {
+      _numLeaves *= 2;
+    }
+    _tree.resize(2 * _numLeaves, CommittableInt(NULL_TIMESTAMP, neutral));
+  }
+
+  [[nodiscard]] inline size_t size() const noexcept { return _size; }
+
+  /**
+   * @brief the best value in the tree at timestamp ts.
+   */
+  [[nodiscard]] inline Int top(Timestamp ts) const noexcept {
+    return _tree[1].value(ts);
+  }
+
+  [[nodiscard]] inline Int value(Timestamp ts, size_t index) const noexcept {
+    assert(index < _size);
+    return _tree[_numLeaves + index].value(ts);
+  }
+
+  /**
+   * @brief sets the value at index and updates all its ancestors.
+   */
+  void setValue(Timestamp ts, size_t index, Int newValue) {
+    assert(index < _size);
+    registerChange(ts);
+    size_t node = _numLeaves + index;
+    if (_tree[node].value(ts) == newValue) {
+      return;
+    }
+    _tree[node].setValue(ts, newValue);
+    if (!_recomputed) {
+      _changedLeaves.emplace_back(index);
+    }
+    for (node /= 2; node > 0; node /= 2) {
+      const Int prev = _tree[node].value(ts);
+      const Int cur =
+          best(_tree[2 * node].value(ts), _tree[2 * node + 1].value(ts));
+      if (prev == cur) {
+        // The remaining ancestors are unaffected:
+        break;
+      }
+      _tree[node].setValue(ts, cur);
+    }
+  }
+
+  /**
+   * @brief sets the value at index without updating its ancestors. The tree
+   * must be recomputed before it is queried.
+   */
+  inline void resetValue(Timestamp ts, size_t index, Int newValue) {
+    assert(index < _size);
+    registerChange(ts);
+    _tree[_numLeaves + index].setValue(ts, newValue);
+  }
+
+  /**
+   * @brief recomputes all internal nodes of the tree in O(n).
+   */
+  void recompute(Timestamp ts) {
+    registerChange(ts);
+    _recomputed = true;
+    _changedLeaves.clear();
+    for (size_t node = _numLeaves - 1; node > 0; --node) {
+      _tree[node].setValue(
+          ts, best(_tree[2 * node].value(ts), _tree[2 * node + 1].value(ts)));
+    }
+  }
+
+  void commitIf(Timestamp ts) {
+    if (_changedTimestamp != ts) {
+      return;
+    }
+    if (_recomputed) {
+      for (CommittableInt& node : _tree) {
+        node.commitIf(ts);
+      }
+    } else {
+      for (const size_t index : _changedLeaves) {
+        for (size_t node = _numLeaves + index; node > 0; node /= 2) {
+          _tree[node].commitIf(ts);
+        }
+      }
+    }
+    _changedLeaves.clear();
+    _recomputed = false;
+    _changedTimestamp = NULL_TIMESTAMP;
+  }
+};
+
+}  // namespace atlantis::propagation
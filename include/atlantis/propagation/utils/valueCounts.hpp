@@ -0,0 +1,163 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+#include "atlantis/propagation/types.hpp"
+#include "atlantis/propagation/utils/committableArray.hpp"
+#include "atlantis/propagation/variables/committableInt.hpp"
+#include "atlantis/types.hpp"
+
+namespace atlantis::propagation {
+
+/**
+ * Committable counts of the values in [lowerBound(), upperBound()], where
+ * every value that is not counted has count 0.
+ *
+ * If the range is narrow compared to the number of counted inputs, then the
+ * counts are stored densely (one entry per value). Otherwise they are stored
+ * in an open-addressing hash table that only holds the values that have a
+ * count, so that the memory does not depend on the width of the range.
+ */
+class ValueCounts {
+ public:
+  /**
+   * @return true if a table of @p numKeys keys over the values in
+   * [@p lb, @p ub] should be sparse instead of dense.
+   */
+  [[nodiscard]] static bool isWide(Int lb, Int ub, size_t numKeys) noexcept;
+
+ private:
+  static constexpr Int EMPTY = std::numeric_limits<Int>::min();
+  static constexpr size_t NO_SLOT = std::numeric_limits<size_t>::max();
+
+  struct Slot {
+    Int key;
+    CommittableInt count;
+  };
+
+  Int _lb{0};
+  Int _ub{-1};
+  bool _isSparse{false};
+
+  // The dense counts, where _dense[i] is the count of _lb + i:
+  CommittableArray _dense;
+
+  // The sparse counts (a hash table with linear probing):
+  std::vector<Slot> _slots;
+  size_t _shift{0};
+  size_t _numOccupied{0};
+  // The slots that have been written at _changedTimestamp and are not
+  // committed yet:
+  std::vector<size_t> _changedSlots;
+  Timestamp _changedTimestamp{NULL_TIMESTAMP};
+  // Scratch space for rehash:
+  std::vector<Slot> _liveSlots;
+
+  [[nodiscard]] inline size_t home(Int key) const noexcept {
+    // Fibonacci hashing:
+    return static_cast<size_t>((static_cast<UInt>(key) * 0x9E3779B97F4A7C15) >>
+                               _shift);
+  }
+  [[nodiscard]] inline size_t findSlot(Int key) const noexcept;
+  size_t insertSlot(Timestamp, Int key);
+  void rehash(Timestamp);
+  void resizeSlots(size_t capacity);
+
+ public:
+  ValueCounts() = default;
+
+  /**
+   * Replaces the counts with zero counts of the values in [@p lb, @p ub],
+   * where at most @p numInputs values are counted at a time. The range is
+   * empty if @p ub < @p lb.
+   */
+  void assign(Int lb, Int ub, size_t numInputs);
+
+  [[nodiscard]] inline Int lowerBound() const noexcept { return _lb; }
+  [[nodiscard]] inline Int upperBound() const noexcept { return _ub; }
+
+  [[nodiscard]] inline bool inRange(Int value) const noexcept {
+    return _lb <= value && value <= _ub;
+  }
+
+  [[nodiscard]] inline bool isSparse() const noexcept { return _isSparse; }
+
+  /**
+   * @return the number of allocated entries.
+   */
+  [[nodiscard]] inline size_t numEntries() const noexcept {
+    return _isSparse ? _slots.size() : _dense.size();
+  }
+
+  /**
+   * @return the count of @p value at @p ts, which is 0 if @p value is not
+   * in the range.
+   */
+  [[nodiscard]] inline Int value(Timestamp ts, Int value) const noexcept;
+
+  /**
+   * Increases the count of @p value, which must be in the range, by @p inc.
+   *
+   * @return the new count of @p value.
+   */
+  inline Int incValue(Timestamp ts, Int value, Int inc);
+
+  /**
+   * Sets the count of every value to 0.
+   */
+  void reset(Timestamp);
+
+  /**
+   * Commits the counts that were written at @p ts.
+   */
+  void commitIf(Timestamp);
+};
+
+inline size_t ValueCounts::findSlot(Int key) const noexcept {
+  const size_t mask = _slots.size() - 1;
+  for (size_t i = home(key);; i = (i + 1) & mask) {
+    if (_slots[i].key == key) {
+      return i;
+    }
+    if (_slots[i].key == EMPTY) {
+      return NO_SLOT;
+    }
+  }
+}
+
+inline Int ValueCounts::value(Timestamp ts, Int value) const noexcept {
+  if (!inRange(value)) {
+    return 0;
+  }
+  if (!_isSparse) {
+    return _dense.value(ts, static_cast<size_t>(value - _lb));
+  }
+  const size_t slot = findSlot(value);
+  return slot == NO_SLOT ? 0 : _slots[slot].count.value(ts);
+}
+
+inline Int ValueCounts::incValue(Timestamp ts, Int value, Int inc) {
+  assert(inRange(value));
+  if (!_isSparse) {
+    return _dense.incValue(ts, static_cast<size_t>(value - _lb), inc);
+  }
+  if (_changedTimestamp != ts) {
+    // The uncommitted counts of an earlier timestamp are discarded:
+    _changedSlots.clear();
+    _changedTimestamp = ts;
+  }
+  size_t slot = findSlot(value);
+  if (slot == NO_SLOT) {
+    slot = insertSlot(ts, value);
+  }
+  CommittableInt& count = _slots[slot].count;
+  if (count.tmpTimestamp() != ts) {
+    _changedSlots.emplace_back(slot);
+  }
+  return count.incValue(ts, inc);
+}
+
+}  // namespace atlantis::propagation
@@ -18,6 +18,7 @@ class IntOffsetView : public IntView {
   [[nodiscard]] Int committedValue() override;
   [[nodiscard]] Int lowerBound() const override;
   [[nodiscard]] Int upperBound() const override;
+  [[nodiscard]] std::optional<AffineMap> affineMap() const override;
 };
 
 }  // namespace atlantis::propagation
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <optional>
+
 #include "atlantis/propagation/types.hpp"
 #include "atlantis/propagation/views/view.hpp"
 #include "atlantis/types.hpp"
@@ -8,6 +10,26 @@ namespace atlantis::propagation {
 
 class SolverBase;  // Forward declaration
 
+/**
+ * The affine map x -> factor * x + offset.
+ */
+struct AffineMap {
+  Int factor{1};
+  Int offset{0};
+
+  [[nodiscard]] inline Int apply(Int x) const noexcept {
+    return factor * x + offset;
+  }
+
+  /**
+   * @return the map x -> apply(inner.apply(x)).
+   */
+  [[nodiscard]] inline AffineMap compose(
+      const AffineMap& inner) const noexcept {
+    return AffineMap{factor * inner.factor, factor * inner.offset + offset};
+  }
+};
+
 class IntView : public View {
  protected:
   friend class SolverBase;
@@ -22,6 +44,16 @@ class IntView : public View {
   [[nodiscard]] virtual Int committedValue() = 0;
   [[nodiscard]] virtual Int lowerBound() const = 0;
   [[nodiscard]] virtual Int upperBound() const = 0;
+
+  /**
+   * @return the map from the value of the parent to the value of the view if
+   * the view is affine in its parent, and std::nullopt otherwise. Chains of
+   * affine views are evaluated by the solver as a single map of their source
+   * variable, without calling value.
+   */
+  [[nodiscard]] virtual std::optional<AffineMap> affineMap() const {
+    return std::nullopt;
+  }
 };
 
 }  // namespace atlantis::propagation
@@ -20,6 +20,7 @@ class ScalarView : public IntView {
   [[nodiscard]] Int committedValue() override;
   [[nodiscard]] Int lowerBound() const override;
   [[nodiscard]] Int upperBound() const override;
+  [[nodiscard]] std::optional<AffineMap> affineMap() const override;
 };
 
 }  // namespace atlantis::propagation
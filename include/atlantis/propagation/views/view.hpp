@@ -10,17 +10,24 @@ class SolverBase;
 
 class View : public Var {
  protected:
-  SolverBase& _solver;
+  // A pointer rather than a reference so that a copy of the view can be
+  // rebound to a copy of the solver:
+  SolverBase* _solver;
   VarViewId _parentId;
 
  public:
   explicit View(SolverBase& solver, VarViewId parentId)
-      : Var(NULL_ID), _solver(solver), _parentId(parentId) {}
+      : Var(NULL_ID), _solver(&solver), _parentId(parentId) {}
 
   virtual ~View() = default;
 
   inline void setId(ViewId id) { _id = id; }
 
+  /**
+   * Rebinds the view to @p solver. Only used when copying a solver.
+   */
+  inline void rebind(SolverBase& solver) noexcept { _solver = &solver; }
+
   [[nodiscard]] inline ViewId id() const { return _id; };
 
   [[nodiscard]] inline VarViewId parentId() const { return _parentId; }
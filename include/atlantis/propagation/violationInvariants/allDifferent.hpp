@@ -4,7 +4,7 @@
 
 #include "atlantis/propagation/solverBase.hpp"
 #include "atlantis/propagation/types.hpp"
-#include "atlantis/propagation/variables/committableInt.hpp"
+#include "atlantis/propagation/utils/valueCounts.hpp"
 #include "atlantis/propagation/violationInvariants/violationInvariant.hpp"
 #include "atlantis/types.hpp"
 
@@ -13,8 +13,7 @@ namespace atlantis::propagation {
 class AllDifferent : public ViolationInvariant {
  protected:
   std::vector<VarViewId> _vars;
-  std::vector<CommittableInt> _counts;
-  Int _offset;
+  ValueCounts _counts;
   signed char increaseCount(Timestamp ts, Int value);
   signed char decreaseCount(Timestamp ts, Int value);
 
@@ -36,23 +35,21 @@ class AllDifferent : public ViolationInvariant {
 };
 
 inline signed char AllDifferent::increaseCount(Timestamp ts, Int value) {
-  if (value < _offset || static_cast<Int>(_counts.size()) <= value - _offset) {
+  if (!_counts.inRange(value)) {
     return 0;
   }
-  assert(_counts[value - _offset].value(ts) + 1 >= 0);
-  assert(_counts[value - _offset].value(ts) + 1 <=
-         static_cast<Int>(_vars.size()));
-  return _counts[value - _offset].incValue(ts, 1) >= 2 ? 1 : 0;
+  assert(_counts.value(ts, value) + 1 >= 0);
+  assert(_counts.value(ts, value) + 1 <= static_cast<Int>(_vars.size()));
+  return _counts.incValue(ts, value, 1) >= 2 ? 1 : 0;
 }
 
 inline signed char AllDifferent::decreaseCount(Timestamp ts, Int value) {
-  if (value < _offset || static_cast<Int>(_counts.size()) <= value - _offset) {
+  if (!_counts.inRange(value)) {
     return 0;
   }
-  assert(_counts[value - _offset].value(ts) - 1 >= 0);
-  assert(_counts[value - _offset].value(ts) - 1 <=
-         static_cast<Int>(_vars.size()));
-  return _counts[value - _offset].incValue(ts, -1) >= 1 ? -1 : 0;
+  assert(_counts.value(ts, value) - 1 >= 0);
+  assert(_counts.value(ts, value) - 1 <= static_cast<Int>(_vars.size()));
+  return _counts.incValue(ts, value, -1) >= 1 ? -1 : 0;
 }
 
 }  // namespace atlantis::propagation
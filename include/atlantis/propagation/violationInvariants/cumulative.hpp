@@ -0,0 +1,77 @@
+#pragma once
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "atlantis/propagation/solverBase.hpp"
+#include "atlantis/propagation/types.hpp"
+#include "atlantis/propagation/utils/committableArray.hpp"
+#include "atlantis/propagation/violationInvariants/violationInvariant.hpp"
+#include "atlantis/types.hpp"
+
+namespace atlantis::propagation {
+
+/**
+ * Invariant for the cumulative constraint:
+ *
+ * violation = sum_t max(0, load(t) - capacity)
+ *
+ * where load(t) is the sum of the (non-negative) requirements of the tasks i
+ * with starts[i] <= t < starts[i] + durations[i], and where only the time
+ * points with a positive load are considered.
+ *
+ * The resource profile (the load of every time point of the horizon) is
+ * committable and only the time points that a changed task enters or leaves
+ * are updated, and later committed, so that the cost of a move does not
+ * depend on the length of the horizon.
+ */
+class Cumulative : public ViolationInvariant {
+ protected:
+  std::vector<VarViewId> _starts;
+  std::vector<VarViewId> _durations;
+  std::vector<VarViewId> _requirements;
+  VarViewId _capacity;
+
+  // The load of time point _offset + t:
+  CommittableArray _loads;
+  Int _offset{0};
+
+  // The placement of each task that the loads currently account for:
+  CommittableArray _taskStarts;
+  CommittableArray _taskEnds;
+  CommittableArray _taskRequirements;
+
+  [[nodiscard]] std::pair<Int, Int> horizon() const;
+  [[nodiscard]] static Int overload(Int load, Int capacity) {
+    return load > 0 ? std::max<Int>(0, load - capacity) : 0;
+  }
+  [[nodiscard]] Int computeViolation(Timestamp) const;
+  Int increaseLoad(Timestamp, Int start, Int end, Int delta);
+  void placeTask(Timestamp, size_t task, Int start, Int end, Int requirement);
+  void moveTask(Timestamp, size_t task);
+
+ public:
+  explicit Cumulative(SolverBase&, VarId violationId,
+                      std::vector<VarViewId>&& starts,
+                      std::vector<VarViewId>&& durations,
+                      std::vector<VarViewId>&& requirements,
+                      VarViewId capacity);
+
+  explicit Cumulative(SolverBase&, VarViewId violationId,
+                      std::vector<VarViewId>&& starts,
+                      std::vector<VarViewId>&& durations,
+                      std::vector<VarViewId>&& requirements,
+                      VarViewId capacity);
+
+  void registerVars() override;
+  void updateBounds(bool widenOnly) override;
+  void close(Timestamp) override;
+  void recompute(Timestamp) override;
+  void notifyInputChanged(Timestamp, LocalId) override;
+  void commit(Timestamp) override;
+  VarViewId nextInput(Timestamp) override;
+  void notifyCurrentInputChanged(Timestamp) override;
+};
+
+}  // namespace atlantis::propagation
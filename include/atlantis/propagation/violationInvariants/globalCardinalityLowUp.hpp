@@ -6,6 +6,8 @@
 
 #include "atlantis/propagation/solverBase.hpp"
 #include "atlantis/propagation/types.hpp"
+#include "atlantis/propagation/utils/committableArray.hpp"
+#include "atlantis/propagation/utils/valueCounts.hpp"
 #include "atlantis/propagation/variables/committableInt.hpp"
 #include "atlantis/propagation/violationInvariants/violationInvariant.hpp"
 #include "atlantis/types.hpp"
@@ -15,12 +17,17 @@ namespace atlantis::propagation {
 class GlobalCardinalityLowUp : public ViolationInvariant {
  private:
   std::vector<VarViewId> _vars;
+  // The bounds of each position (see position), where a bound of -1 means
+  // that the count of the values at the position is not restricted:
   std::vector<Int> _lowerBounds;
   std::vector<Int> _upperBounds;
+  // The sorted cover if the cover is wide (see ValueCounts::isWide):
+  std::vector<Int> _sortedCover;
   CommittableInt _shortage;
   CommittableInt _excess;
-  std::vector<CommittableInt> _counts;
+  CommittableArray _counts;
   Int _offset;
+  [[nodiscard]] size_t position(Int value) const;
   signed char increaseCount(Timestamp ts, Int value);
   signed char decreaseCount(Timestamp ts, Int value);
 
@@ -57,14 +64,30 @@ class GlobalCardinalityLowUp : public ViolationInvariant {
   void notifyCurrentInputChanged(Timestamp) override;
 };
 
+/**
+ * @return the position of @p value in _lowerBounds, _upperBounds and _counts.
+ */
+inline size_t GlobalCardinalityLowUp::position(Int value) const {
+  if (_sortedCover.empty()) {
+    // The first and last positions are the values below and above the cover:
+    return static_cast<size_t>(std::max<Int>(
+        0, std::min(Int(_lowerBounds.size()) - 1, value - _offset)));
+  }
+  // Position 0 holds all values that are not in the cover:
+  const auto it =
+      std::lower_bound(_sortedCover.begin(), _sortedCover.end(), value);
+  return it != _sortedCover.end() && *it == value
+             ? static_cast<size_t>(it - _sortedCover.begin()) + 1
+             : 0;
+}
+
 inline signed char GlobalCardinalityLowUp::increaseCount(Timestamp ts,
                                                          Int value) {
-  size_t pos = static_cast<size_t>(std::max<Int>(
-      0, std::min(Int(_lowerBounds.size()) - 1, value - _offset)));
+  const size_t pos = position(value);
   if (_lowerBounds.at(pos) < 0) {
     return 0;
   }
-  Int newCount = _counts.at(pos).incValue(ts, 1);
+  Int newCount = _counts.incValue(ts, pos, 1);
   assert(newCount >= 0);
   assert(newCount <= static_cast<Int>(_vars.size()));
   return newCount > _upperBounds.at(pos)
@@ -74,13 +97,12 @@ inline signed char GlobalCardinalityLowUp::increaseCount(Timestamp ts,
 
 inline signed char GlobalCardinalityLowUp::decreaseCount(Timestamp ts,
                                                          Int value) {
-  size_t pos = static_cast<size_t>(std::max<Int>(
-      0, std::min(Int(_lowerBounds.size()) - 1, value - _offset)));
+  const size_t pos = position(value);
   if (_lowerBounds.at(pos) < 0) {
     return 0;
   }
 
-  Int newCount = _counts.at(pos).incValue(ts, -1);
+  Int newCount = _counts.incValue(ts, pos, -1);
   assert(newCount >= 0);
   assert(newCount <= static_cast<Int>(_vars.size()));
   return newCount < _lowerBounds.at(pos)
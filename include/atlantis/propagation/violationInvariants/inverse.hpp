@@ -0,0 +1,60 @@
+#pragma once
+
+#include <vector>
+
+#include "atlantis/propagation/solverBase.hpp"
+#include "atlantis/propagation/types.hpp"
+#include "atlantis/propagation/utils/committableArray.hpp"
+#include "atlantis/propagation/variables/committableInt.hpp"
+#include "atlantis/propagation/violationInvariants/violationInvariant.hpp"
+#include "atlantis/types.hpp"
+
+namespace atlantis::propagation {
+
+/**
+ * Invariant for the inverse (channelling) constraint over two arrays f and
+ * invf of length n, where the index set of f starts at fOffset and the index
+ * set of invf starts at invfOffset:
+ *
+ * violation = |{i : invf[f[i]] != i}|
+ *
+ * A pair (i, j) is matched if f[i] == j and invf[j] == i. Every variable is
+ * in at most one matched pair, so the violation is n minus the number of
+ * matched pairs. When f[i] changes from a to b, only the pairs (i, a) and
+ * (i, b) can change, and the same holds for invf.
+ */
+class Inverse : public ViolationInvariant {
+ protected:
+  std::vector<VarViewId> _f;
+  Int _fOffset;
+  std::vector<VarViewId> _invf;
+  Int _invfOffset;
+
+  // The values of f followed by the values of invf that the number of matched
+  // pairs currently accounts for:
+  CommittableArray _values;
+  CommittableInt _numMatched;
+
+  [[nodiscard]] bool isMatched(Timestamp, size_t fIndex) const;
+  [[nodiscard]] bool isInvMatched(Timestamp, size_t invfIndex) const;
+
+ public:
+  explicit Inverse(SolverBase&, VarId violationId, std::vector<VarViewId>&& f,
+                   Int fOffset, std::vector<VarViewId>&& invf,
+                   Int invfOffset);
+
+  explicit Inverse(SolverBase&, VarViewId violationId,
+                   std::vector<VarViewId>&& f, Int fOffset,
+                   std::vector<VarViewId>&& invf, Int invfOffset);
+
+  void registerVars() override;
+  void updateBounds(bool widenOnly) override;
+  void close(Timestamp) override;
+  void recompute(Timestamp) override;
+  void notifyInputChanged(Timestamp, LocalId) override;
+  void commit(Timestamp) override;
+  VarViewId nextInput(Timestamp) override;
+  void notifyCurrentInputChanged(Timestamp) override;
+};
+
+}  // namespace atlantis::propagation
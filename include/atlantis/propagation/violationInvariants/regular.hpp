@@ -0,0 +1,145 @@
+#pragma once
+
+#include <vector>
+
+#include "atlantis/propagation/solverBase.hpp"
+#include "atlantis/propagation/types.hpp"
+#include "atlantis/propagation/violationInvariants/violationInvariant.hpp"
+#include "atlantis/types.hpp"
+
+namespace atlantis::propagation {
+
+/**
+ * Invariant for the regular constraint over the sequence vars and a
+ * deterministic finite automaton with the states 1..numStates, the symbols
+ * 1..numSymbols, the transition function transitions (a numStates x
+ * numSymbols matrix in row-major order where 0 is the failure state), the
+ * initial state initialState, and the accepting states acceptingStates:
+ *
+ * violation = the minimum number of variables in vars that must change for
+ *             the automaton to accept vars.
+ *
+ * If the automaton accepts no sequence of length n = vars.size(), then the
+ * violation is max(1, n).
+ *
+ * The minimum is computed by dynamic programming over two tables for the
+ * committed values of vars. Row t of the forward table holds the minimum
+ * number of changes in vars[0..t-1] to reach each state from the initial
+ * state, and row t of the backward table holds the minimum number of changes
+ * in vars[t..n-1] to reach an accepting state from each state. The violation
+ * is the minimum over the states q of forward[t][q] + backward[t][q], for any
+ * t.
+ *
+ * A move that changes a single variable vars[t] is probed by combining the
+ * committed forward row t and backward row t + 1 over the transitions that
+ * read the new value, in O(numStates) regardless of n, together with the
+ * cached minimum over all transitions between the two rows (for when vars[t]
+ * is changed once more). If vars[b..e-1] contain all variables that changed
+ * since the commit, then the violation is computed from the committed
+ * forward row b, the rows b + 1..e recomputed from it in
+ * O(numStates * numSymbols) each, and the committed backward row e. Commit
+ * updates the forward rows after b and the backward rows before e until a
+ * row is unchanged.
+ *
+ * Each row is stored relative to its minimum, so that a change that costs
+ * one more change for every state does not change every later row. The
+ * violation is recovered from the committed violation and the differences
+ * between the minima of consecutive backward rows.
+ */
+class Regular : public ViolationInvariant {
+ protected:
+  std::vector<VarViewId> _vars;
+  size_t _numStates;
+  Int _numSymbols;
+  std::vector<Int> _transitions;
+  Int _initialState;
+  std::vector<bool> _isAccepting;
+  // Any number of changes is less than vars.size() + 1:
+  Int _unreachable;
+
+  // The arcs (s, r) where reading s in q leads to r != 0 (where states are
+  // zero-indexed) are (_arcSymbols[i], _arcTargets[i]) for
+  // _arcBegin[q] <= i < _arcBegin[q + 1]:
+  std::vector<size_t> _arcBegin;
+  std::vector<Int> _arcSymbols;
+  std::vector<size_t> _arcTargets;
+  // The same arcs (q, s) into each state r, as (_inArcSources[i],
+  // _inArcSymbols[i]) for _inArcBegin[r] <= i < _inArcBegin[r + 1]:
+  std::vector<size_t> _inArcBegin;
+  std::vector<Int> _inArcSymbols;
+  std::vector<size_t> _inArcSources;
+  // The committed (vars.size() + 1) x numStates tables in row-major order:
+  std::vector<Int> _forward;
+  std::vector<Int> _backward;
+  // _backwardMinDeltas[t] is the minimum of backward row t minus the minimum
+  // of backward row t + 1:
+  std::vector<Int> _backwardMinDeltas;
+  // _minSums[t] is the minimum of forward[t][q] + backward[t][q], and
+  // _relaxedMins[t] is the minimum of forward[t][q] + backward[t + 1][r]
+  // over the arcs (q, s, r), for the committed tables:
+  std::vector<Int> _minSums;
+  std::vector<Int> _relaxedMins;
+  // The minimum number of changes for the committed values, or _unreachable:
+  Int _committedChanges{0};
+
+  // vars[_probeBegin.._probeEnd-1] contain all variables that changed at
+  // _probeTimestamp, and rows _probeBegin+1.._probeEnd of _probeForward are
+  // the forward rows for their values at _probeTimestamp (row _probeBegin
+  // is the committed one). The rows are only computed if _probeRowsValid,
+  // which is false while a single variable has changed:
+  Timestamp _probeTimestamp{NULL_TIMESTAMP};
+  size_t _probeBegin{0};
+  size_t _probeEnd{0};
+  bool _probeRowsValid{true};
+  std::vector<Int> _probeForward;
+  // _probeOffsets[t] is the minimum of forward row t minus the minimum of
+  // forward row _probeBegin at _probeTimestamp:
+  std::vector<Int> _probeOffsets;
+  Int _probeChanges{0};
+  // Scratch row, to avoid allocating when propagating:
+  std::vector<Int> _row;
+
+  [[nodiscard]] Int* row(std::vector<Int>& table, size_t t) {
+    return table.data() + t * _numStates;
+  }
+  // Writes the forward row after reading value in from to to, relative to
+  // its minimum, and returns the minimum (or _unreachable):
+  Int forwardStep(const Int* from, Int value, Int* to) const;
+  // Writes the backward row before reading value in from to to, relative to
+  // its minimum, and returns the minimum (or _unreachable):
+  Int backwardStep(const Int* from, Int value, Int* to) const;
+  [[nodiscard]] Int minSum(const Int* forward, const Int* backward) const;
+  [[nodiscard]] Int relaxedMin(const Int* forward, const Int* backward) const;
+  // Updates _minSums and _relaxedMins for the rows first..last:
+  void updateMins(size_t first, size_t last);
+  void recomputeTables();
+  void probePosition(Timestamp, size_t position);
+  void propagateProbe(Timestamp, size_t begin, size_t end);
+  void computeProbeRow(Timestamp);
+  // The minimum number of changes when only vars[t] has changed, to value:
+  [[nodiscard]] Int singleChanges(size_t t, Int value) const;
+  [[nodiscard]] Int probeChanges(Timestamp);
+  [[nodiscard]] Int violation(Int changes) const;
+
+ public:
+  explicit Regular(SolverBase&, VarId violationId,
+                   std::vector<VarViewId>&& vars, Int numStates,
+                   Int numSymbols, std::vector<Int>&& transitions,
+                   Int initialState, const std::vector<Int>& acceptingStates);
+
+  explicit Regular(SolverBase&, VarViewId violationId,
+                   std::vector<VarViewId>&& vars, Int numStates,
+                   Int numSymbols, std::vector<Int>&& transitions,
+                   Int initialState, const std::vector<Int>& acceptingStates);
+
+  void registerVars() override;
+  void updateBounds(bool widenOnly) override;
+  void close(Timestamp) override;
+  void recompute(Timestamp) override;
+  void notifyInputChanged(Timestamp, LocalId) override;
+  void commit(Timestamp) override;
+  VarViewId nextInput(Timestamp) override;
+  void notifyCurrentInputChanged(Timestamp) override;
+};
+
+}  // namespace atlantis::propagation
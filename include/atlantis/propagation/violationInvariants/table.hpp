@@ -0,0 +1,71 @@
+#pragma once
+
+#include <vector>
+
+#include "atlantis/propagation/solverBase.hpp"
+#include "atlantis/propagation/types.hpp"
+#include "atlantis/propagation/utils/committableArray.hpp"
+#include "atlantis/propagation/variables/committableInt.hpp"
+#include "atlantis/propagation/violationInvariants/violationInvariant.hpp"
+#include "atlantis/types.hpp"
+
+namespace atlantis::propagation {
+
+/**
+ * Invariant for the table (extensional) constraint:
+ *
+ * violation = min_t |{i : vars[i] != table[t][i]}|
+ *
+ * that is, the Hamming distance from vars to the closest tuple of the table.
+ * The table is given in row-major order with one row per tuple.
+ *
+ * The distance of every tuple is committable. When vars[i] changes from a to
+ * b, only the distances of the tuples that support (i, a) or (i, b) change,
+ * and the number of tuples at each distance gives the minimum distance.
+ * A commit only visits these tuples (found from the variables that changed)
+ * instead of the whole table.
+ */
+class Table : public ViolationInvariant {
+ protected:
+  std::vector<VarViewId> _vars;
+  std::vector<Int> _table;
+  size_t _numTuples;
+
+  // _supports[i][v - _offsets[i]] are the tuples t with table[t][i] == v:
+  std::vector<std::vector<std::vector<size_t>>> _supports;
+  std::vector<Int> _offsets;
+
+  // The value of each variable that the distances currently account for:
+  CommittableArray _values;
+  std::vector<CommittableInt> _distances;
+  // The timestamp of the latest recompute, at which every distance may have
+  // changed:
+  Timestamp _recomputeTimestamp{NULL_TIMESTAMP};
+  // _numTuplesAtDistance[d] is the number of tuples at distance d (there are
+  // only arity + 1 entries, which are all committed):
+  std::vector<CommittableInt> _numTuplesAtDistance;
+
+  [[nodiscard]] const std::vector<size_t>* supports(size_t var,
+                                                    Int value) const;
+  [[nodiscard]] Int minDistance(Timestamp) const;
+  void moveTuple(Timestamp, size_t tuple, Int delta);
+  void commitSupports(Timestamp, size_t var, Int value);
+
+ public:
+  explicit Table(SolverBase&, VarId violationId, std::vector<VarViewId>&& vars,
+                 std::vector<Int>&& table);
+
+  explicit Table(SolverBase&, VarViewId violationId,
+                 std::vector<VarViewId>&& vars, std::vector<Int>&& table);
+
+  void registerVars() override;
+  void updateBounds(bool widenOnly) override;
+  void close(Timestamp) override;
+  void recompute(Timestamp) override;
+  void notifyInputChanged(Timestamp, LocalId) override;
+  void commit(Timestamp) override;
+  VarViewId nextInput(Timestamp) override;
+  void notifyCurrentInputChanged(Timestamp) override;
+};
+
+}  // namespace atlantis::propagation
@@ -59,11 +59,11 @@ class Annealer {
    * Determine whether @p move should be committed to the assignment.
    *
    * @tparam N The size of the move.
-   * @param move The move itself.
+   * @param move The move itself, which is probed (but not copied).
    * @return True if @p move should be committed, false otherwise.
    */
   template <unsigned int N>
-  bool acceptMove(Move<N> move) {
+  bool acceptMove(Move<N>& move) {
     _attemptedMovesPerRound++;
 
     Int moveCost = evaluate(move.probe(_assignment));
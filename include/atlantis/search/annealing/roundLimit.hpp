@@ -0,0 +1,51 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <utility>
+
+#include "atlantis/search/annealing/annealingSchedule.hpp"
+#include "atlantis/search/sharedSearchState.hpp"
+
+namespace atlantis::search {
+
+/**
+ * Executes an inner schedule for a fixed number of rounds, after which the
+ * schedule is frozen and the search is stopped through the shared search
+ * state (which the search controller must share). The amount of search is
+ * then the same for every run with the same seed, unlike when the search is
+ * stopped by a time limit.
+ */
+class RoundLimit : public AnnealingSchedule {
+ public:
+  // Called at the end of each round with the index of the round (counting
+  // from zero) and its statistics:
+  using RoundCallback = std::function<void(UInt, const RoundStatistics&)>;
+
+ private:
+  std::unique_ptr<AnnealingSchedule> _schedule;
+  UInt _numRounds;
+  SharedSearchState& _sharedState;
+  RoundCallback _onRound;
+
+  UInt _round{0};
+
+ public:
+  RoundLimit(std::unique_ptr<AnnealingSchedule> schedule, UInt numRounds,
+             SharedSearchState& sharedState, RoundCallback onRound = nullptr)
+      : _schedule(std::move(schedule)),
+        _numRounds(numRounds),
+        _sharedState(sharedState),
+        _onRound(std::move(onRound)) {}
+
+  /**
+   * Starts the inner schedule. The rounds of every start count towards the
+   * limit.
+   */
+  void start(double initialTemperature) override;
+  void nextRound(const RoundStatistics& statistics) override;
+  double temperature() override;
+  bool frozen() override;
+};
+
+}  // namespace atlantis::search
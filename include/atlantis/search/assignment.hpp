@@ -82,14 +82,94 @@ class Assignment {
     move(modificationFunc);
 
     _solver.beginProbe();
-    _solver.query(_objective);
-    _solver.query(_violation);
+    if (!_solver.isProbingBatch()) {
+      _solver.query(_objective);
+      _solver.query(_violation);
+    }
     _solver.endProbe();
 
     return {_solver.currentValue(_violation), _solver.currentValue(_objective),
             _objectiveDirection};
   }
 
+  /**
+   * @return The timestamp of the latest probe, which identifies the probe
+   * for commitProbe.
+   */
+  [[nodiscard]] propagation::Timestamp probeTimestamp() const noexcept {
+    return _solver.currentTimestamp();
+  }
+
+  /**
+   * Commit the modifications of the probe at @p probeTimestamp by committing
+   * the values that the probe computed, instead of propagating the
+   * modifications again. This is only possible if the probe is the latest
+   * probe and the solver propagated every modified variable during it.
+   *
+   * @param probeTimestamp The timestamp of the probe (see probeTimestamp).
+   * @return True if the probe was committed, false otherwise, in which case
+   * the assignment is unchanged.
+   */
+  bool commitProbe(propagation::Timestamp probeTimestamp) {
+    if (!_solver.canCommitLastProbe(probeTimestamp)) {
+      return false;
+    }
+    _solver.commitLastProbe();
+    return true;
+  }
+
+  /**
+   * Probe the cost of each move in a sequence of moves. This is a
+   * convenience wrapper, not an optimisation: it costs the same as probing
+   * the moves one by one (see propagation::Solver::beginProbeBatch), but
+   * queries the objective and the violation once, and leaves the solver idle
+   * if a probe throws. For example:
+   *
+   *     std::vector<Move<2>> swaps = ...;
+   *     std::vector<Cost> costs = assignment.probeBatch(swaps);
+   *
+   * @param moves The moves to probe, which must provide
+   * probe(const Assignment&).
+   * @return The cost of each move, in the same order as @p moves.
+   */
+  template <typename MoveType>
+  std::vector<Cost> probeBatch(std::vector<MoveType>& moves) const {
+    std::vector<Cost> costs;
+    probeBatch(moves, costs);
+    return costs;
+  }
+
+  /**
+   * Probe the cost of each move in a sequence of moves, like
+   * probeBatch(moves), but write the costs into @p costs. The buffer keeps
+   * its capacity between calls, so a caller that probes a batch per
+   * iteration does not allocate once the buffer is large enough.
+   *
+   * @param moves The moves to probe, which must provide
+   * probe(const Assignment&).
+   * @param costs Replaced by the cost of each move, in the same order as
+   * @p moves.
+   */
+  template <typename MoveType>
+  void probeBatch(std::vector<MoveType>& moves,
+                  std::vector<Cost>& costs) const {
+    costs.clear();
+    costs.reserve(moves.size());
+
+    _solver.beginProbeBatch();
+    _solver.query(_objective);
+    _solver.query(_violation);
+    try {
+      for (MoveType& move : moves) {
+        costs.emplace_back(move.probe(*this));
+      }
+    } catch (...) {
+      _solver.abortProbeBatch();
+      throw;
+    }
+    _solver.endProbeBatch();
+  }
+
   /**
    * Get the value of a variable in the current assignment.
    *
@@ -1,5 +1,9 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <cassert>
+
 #include "atlantis/propagation/types.hpp"
 #include "atlantis/search/assignment.hpp"
 #include "atlantis/search/cost.hpp"
@@ -27,6 +31,7 @@ class Move {
           modifier.set(_vars[i], _values[i]);
         }
       });
+      _probeTimestamp = assignment.probeTimestamp();
 
       _probed = true;
     }
@@ -35,11 +40,16 @@ class Move {
   }
 
   /**
-   * Commit this move on the given assignment.
+   * Commit this move on the given assignment. If this move was the latest
+   * probe, then the values computed by the probe are committed instead of
+   * propagating the move again.
    *
    * @param assignment The assignment to change.
    */
   void commit(Assignment& assignment) {
+    if (_probed && assignment.commitProbe(_probeTimestamp)) {
+      return;
+    }
     assignment.assign([&](auto& modifier) {
       for (auto i = 0u; i < N; i++) {
         modifier.set(_vars[i], _values[i]);
@@ -52,6 +62,88 @@ class Move {
   std::array<Int, N> _values;
 
   Cost _cost{0, 0, propagation::ObjectiveDirection::NONE};
+  propagation::Timestamp _probeTimestamp{propagation::NULL_TIMESTAMP};
+  bool _probed{false};
+};
+
+/**
+ * A move of at most MAX_SIZE variables, where the number of variables is only
+ * known at run time. This allows a neighbourhood to enumerate moves of
+ * different sizes into a single collection (see
+ * neighbourhoods::Neighbourhood::enumerateMoves).
+ */
+class CandidateMove {
+ public:
+  static constexpr size_t MAX_SIZE = 4;
+
+  template <size_t N>
+  CandidateMove(const std::array<propagation::VarViewId, N>& vars,
+                const std::array<Int, N>& values)
+      : _size(N) {
+    static_assert(N <= MAX_SIZE);
+    std::copy(vars.begin(), vars.end(), _vars.begin());
+    std::copy(values.begin(), values.end(), _values.begin());
+  }
+
+  [[nodiscard]] size_t size() const noexcept { return _size; }
+
+  [[nodiscard]] propagation::VarViewId var(size_t i) const {
+    assert(i < _size);
+    return _vars[i];
+  }
+
+  [[nodiscard]] Int value(size_t i) const {
+    assert(i < _size);
+    return _values[i];
+  }
+
+  /**
+   * Probe the cost of this move on the given assignment. Will only probe the
+   * assignment once.
+   *
+   * @param assignment The assignment to probe on.
+   * @return The cost of the assignment if this move were committed.
+   */
+  const Cost& probe(const Assignment& assignment) {
+    if (!_probed) {
+      _cost = assignment.probe([&](auto& modifier) {
+        for (size_t i = 0; i < _size; i++) {
+          modifier.set(_vars[i], _values[i]);
+        }
+      });
+      _probeTimestamp = assignment.probeTimestamp();
+
+      _probed = true;
+    }
+
+    return _cost;
+  }
+
+  /**
+   * Commit this move on the given assignment (see Move::commit).
+   *
+   * @param assignment The assignment to change.
+   */
+  void commit(Assignment& assignment) const {
+    if (_probed && assignment.commitProbe(_probeTimestamp)) {
+      return;
+    }
+    assignment.assign([&](auto& modifier) {
+      for (size_t i = 0; i < _size; i++) {
+        modifier.set(_vars[i], _values[i]);
+      }
+    });
+  }
+
+ private:
+  std::array<propagation::VarViewId, MAX_SIZE> _vars{
+      propagation::NULL_ID, propagation::NULL_ID, propagation::NULL_ID,
+      propagation::NULL_ID};
+  std::array<Int, MAX_SIZE> _values{};
+  size_t _size;
+
+  Cost _cost{0, 0, propagation::ObjectiveDirection::NONE};
+  propagation::Timestamp _probeTimestamp{propagation::NULL_TIMESTAMP};
   bool _probed{false};
 };
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cassert>
+#include <memory>
 
 #include "atlantis/search/neighbourhoods/neighbourhood.hpp"
 #include "atlantis/search/randomProvider.hpp"
@@ -24,12 +25,10 @@ class AllDifferentNonUniformNeighbourhood : public Neighbourhood {
   std::vector<std::vector<Int>> _domains;
   // inDomain[i][j] = the domain of _vars[i] contains value j + _offset
   std::vector<std::vector<bool>> _inDomain;
-  const propagation::SolverBase& _solver;
 
  public:
   AllDifferentNonUniformNeighbourhood(std::vector<search::SearchVar>&& vars,
-                                      Int domainLb, Int domainUb,
-                                      const propagation::SolverBase& solver);
+                                      Int domainLb, Int domainUb);
 
   void initialise(RandomProvider& random,
                   AssignmentModifier& modifications) override;
@@ -39,6 +38,10 @@ class AllDifferentNonUniformNeighbourhood : public Neighbourhood {
   [[nodiscard]] const std::vector<SearchVar>& coveredVars() const override {
     return _vars;
   }
+
+  [[nodiscard]] std::shared_ptr<Neighbourhood> clone() const override {
+    return std::make_shared<AllDifferentNonUniformNeighbourhood>(*this);
+  }
   [[nodiscard]] bool canSwap(const Assignment& assignment, size_t var1Index,
                              size_t val2Index) const noexcept;
   bool swapValues(Assignment& assignment, Annealer& annealer, size_t var1Index,
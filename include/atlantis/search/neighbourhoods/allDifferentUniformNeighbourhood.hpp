@@ -1,5 +1,7 @@
 #pragma once
 
+#include <memory>
+
 #include "atlantis/search/neighbourhoods/neighbourhood.hpp"
 #include "atlantis/search/randomProvider.hpp"
 #include "atlantis/search/searchVariable.hpp"
@@ -12,6 +14,7 @@ class AllDifferentUniformNeighbourhood : public Neighbourhood {
   std::vector<search::SearchVar> _vars;
   std::vector<Int> _domain;
   bool _hasFreeValues;
+  std::vector<size_t> _varIndices;
 
  private:
   bool swapValues(RandomProvider& random, Assignment& assignment,
@@ -30,9 +33,19 @@ class AllDifferentUniformNeighbourhood : public Neighbourhood {
   bool randomMove(RandomProvider& random, Assignment& assignment,
                   Annealer& annealer) override;
 
+  bool enumerateMoves(RandomProvider& random, const Assignment& assignment,
+                      size_t maxVars,
+                      std::vector<CandidateMove>& moves) override;
+
+  void commitMove(const CandidateMove& move, Assignment& assignment) override;
+
   [[nodiscard]] const std::vector<SearchVar>& coveredVars() const override {
     return _vars;
   }
+
+  [[nodiscard]] std::shared_ptr<Neighbourhood> clone() const override {
+    return std::make_shared<AllDifferentUniformNeighbourhood>(*this);
+  }
 };
 
 }  // namespace atlantis::search::neighbourhoods
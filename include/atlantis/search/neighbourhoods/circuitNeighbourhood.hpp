@@ -1,5 +1,7 @@
 #pragma once
 
+#include <memory>
+
 #include "atlantis/search/neighbourhoods/neighbourhood.hpp"
 #include "atlantis/search/randomProvider.hpp"
 #include "atlantis/search/searchVariable.hpp"
@@ -11,6 +13,7 @@ class CircuitNeighbourhood : public Neighbourhood {
  private:
   std::vector<search::SearchVar> _vars;
   Int _offset;
+  std::vector<size_t> _varIndices;
 
  public:
   explicit CircuitNeighbourhood(std::vector<search::SearchVar>&&, Int offset);
@@ -19,11 +22,18 @@ class CircuitNeighbourhood : public Neighbourhood {
                   AssignmentModifier& modifications) override;
   bool randomMove(RandomProvider& random, Assignment& assignment,
                   Annealer& annealer) override;
+  bool enumerateMoves(RandomProvider& random, const Assignment& assignment,
+                      size_t maxVars,
+                      std::vector<CandidateMove>& moves) override;
 
   [[nodiscard]] const std::vector<SearchVar>& coveredVars() const override {
     return _vars;
   }
 
+  [[nodiscard]] std::shared_ptr<Neighbourhood> clone() const override {
+    return std::make_shared<CircuitNeighbourhood>(*this);
+  }
+
  private:
   [[nodiscard]] Int idx2Node(size_t nodeIdx) noexcept;
   [[nodiscard]] size_t node2Idx(Int node) noexcept;
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <memory>
+
 #include "atlantis/search/neighbourhoods/neighbourhood.hpp"
 #include "atlantis/search/randomProvider.hpp"
 #include "atlantis/search/searchVariable.hpp"
@@ -26,6 +28,10 @@ class IntLinEqNeighbourhood : public Neighbourhood {
   [[nodiscard]] const std::vector<SearchVar>& coveredVars() const override {
     return _vars;
   }
+
+  [[nodiscard]] std::shared_ptr<Neighbourhood> clone() const override {
+    return std::make_shared<IntLinEqNeighbourhood>(*this);
+  }
 };
 
 }  // namespace atlantis::search::neighbourhoods
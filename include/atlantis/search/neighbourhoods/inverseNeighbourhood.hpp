@@ -0,0 +1,52 @@
+#pragma once
+
+#include <memory>
+
+#include "atlantis/search/neighbourhoods/neighbourhood.hpp"
+#include "atlantis/search/randomProvider.hpp"
+#include "atlantis/search/searchVariable.hpp"
+#include "atlantis/types.hpp"
+
+namespace atlantis::search::neighbourhoods {
+
+/**
+ * Neighbourhood for the inverse constraint over f and invf, where the index
+ * set of f starts at fOffset and the index set of invf starts at invfOffset.
+ * The variables are given as f followed by invf.
+ *
+ * The initial assignment is a random permutation where invf is the inverse of
+ * f, and each move swaps the values of two variables in f and the values of
+ * the two corresponding variables in invf, so the constraint always holds.
+ */
+class InverseNeighbourhood : public Neighbourhood {
+ private:
+  std::vector<search::SearchVar> _vars;
+  size_t _numVars;
+  Int _fOffset;
+  Int _invfOffset;
+  // The indices of the variables in f that are not fixed:
+  std::vector<size_t> _freeIndices;
+
+ public:
+  explicit InverseNeighbourhood(std::vector<search::SearchVar>&&, Int fOffset,
+                                Int invfOffset);
+
+  void initialise(RandomProvider& random,
+                  AssignmentModifier& modifications) override;
+  bool randomMove(RandomProvider& random, Assignment& assignment,
+                  Annealer& annealer) override;
+
+  [[nodiscard]] const std::vector<SearchVar>& coveredVars() const override {
+    return _vars;
+  }
+
+  [[nodiscard]] std::shared_ptr<Neighbourhood> clone() const override {
+    return std::make_shared<InverseNeighbourhood>(*this);
+  }
+
+ private:
+  [[nodiscard]] const SearchVar& f(size_t index) const noexcept;
+  [[nodiscard]] const SearchVar& invf(size_t index) const noexcept;
+};
+
+}  // namespace atlantis::search::neighbourhoods
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <algorithm>
+#include <memory>
 #include <vector>
 
 #include "atlantis/search/annealer.hpp"
@@ -35,12 +37,68 @@ class Neighbourhood {
   virtual bool randomMove(RandomProvider& random, Assignment& assignment,
                           Annealer& annealer) = 0;
 
+  /**
+   * Append the moves of this neighbourhood that change at least one of (at
+   * most) @p maxVars randomly selected variables to @p moves, without probing
+   * them. If the domain of a selected variable is large, then only a random
+   * subset of its values is considered.
+   *
+   * @param random The source of randomness.
+   * @param assignment The assignment to move on.
+   * @param maxVars The maximum number of variables to select.
+   * @param moves The collection to append the moves to.
+   * @return False if this neighbourhood cannot enumerate its moves, in which
+   * case randomMove must be used instead, true otherwise.
+   */
+  virtual bool enumerateMoves(RandomProvider&, const Assignment&,
+                              size_t /* maxVars */,
+                              std::vector<CandidateMove>& /* moves */) {
+    return false;
+  }
+
+  /**
+   * Commit @p move, which was appended by the latest call to enumerateMoves,
+   * on @p assignment.
+   *
+   * @param move The move to commit.
+   * @param assignment The assignment to change.
+   */
+  virtual void commitMove(const CandidateMove& move, Assignment& assignment) {
+    move.commit(assignment);
+  }
+
   /**
    * @return The search variables covered by this neighbourhood.
    */
   [[nodiscard]] virtual const std::vector<SearchVar>& coveredVars() const = 0;
 
+  /**
+   * @return A copy of this neighbourhood that shares no state with it, so
+   * that the copy can be used by another worker (on a copy of the solver).
+   */
+  [[nodiscard]] virtual std::shared_ptr<Neighbourhood> clone() const = 0;
+
  protected:
+  // The maximum number of values of a variable that enumerateMoves considers:
+  static constexpr size_t MAX_ENUMERATED_VALUES = 32;
+
+  /**
+   * Moves (at most) @p count randomly selected elements of @p indices to its
+   * front.
+   *
+   * @return The number of selected elements.
+   */
+  static size_t selectIndices(RandomProvider& random,
+                              std::vector<size_t>& indices, size_t count) {
+    const size_t numSelected = std::min(count, indices.size());
+    for (size_t i = 0; i < numSelected; ++i) {
+      std::swap(indices[i], indices[static_cast<size_t>(random.intInRange(
+                                static_cast<Int>(i),
+                                static_cast<Int>(indices.size()) - 1))]);
+    }
+    return numSelected;
+  }
+
   template <unsigned int N>
   bool maybeCommit(Move<N> move, Assignment& assignment, Annealer& annealer) {
     try {
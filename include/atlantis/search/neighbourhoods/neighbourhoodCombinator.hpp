@@ -14,6 +14,8 @@ class NeighbourhoodCombinator : public Neighbourhood {
   std::vector<std::shared_ptr<Neighbourhood>> _neighbourhoods;
   std::vector<SearchVar> _vars;
   std::discrete_distribution<size_t> _neighbourhoodDistribution;
+  // The neighbourhood that enumerated the latest moves:
+  size_t _enumeratingIndex{0};
 
  public:
   explicit NeighbourhoodCombinator(
@@ -23,11 +25,17 @@ class NeighbourhoodCombinator : public Neighbourhood {
                   AssignmentModifier& modifications) override;
   bool randomMove(RandomProvider& random, Assignment& assignment,
                   Annealer& annealer) override;
+  bool enumerateMoves(RandomProvider& random, const Assignment& assignment,
+                      size_t maxVars,
+                      std::vector<CandidateMove>& moves) override;
+  void commitMove(const CandidateMove& move, Assignment& assignment) override;
 
   [[nodiscard]] const std::vector<SearchVar>& coveredVars() const override {
     return _vars;
   }
 
+  [[nodiscard]] std::shared_ptr<Neighbourhood> clone() const override;
+
   void printNeighbourhood(logging::Logger&);
 
  private:
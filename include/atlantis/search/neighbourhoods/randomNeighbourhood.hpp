@@ -1,5 +1,6 @@
 #pragma once
 
+#include <memory>
 #include <vector>
 
 #include "atlantis/search/assignment.hpp"
@@ -12,6 +13,7 @@ namespace atlantis::search::neighbourhoods {
 class RandomNeighbourhood : public Neighbourhood {
  private:
   std::vector<SearchVar> _vars;
+  std::vector<size_t> _varIndices;
 
  public:
   RandomNeighbourhood(std::vector<SearchVar>&& vars);
@@ -22,9 +24,17 @@ class RandomNeighbourhood : public Neighbourhood {
   bool randomMove(RandomProvider& random, Assignment& assignment,
                   Annealer& annealer) override;
 
+  bool enumerateMoves(RandomProvider& random, const Assignment& assignment,
+                      size_t maxVars,
+                      std::vector<CandidateMove>& moves) override;
+
   [[nodiscard]] const std::vector<SearchVar>& coveredVars() const override {
     return _vars;
   }
+
+  [[nodiscard]] std::shared_ptr<Neighbourhood> clone() const override {
+    return std::make_shared<RandomNeighbourhood>(*this);
+  }
 };
 
 }  // namespace atlantis::search::neighbourhoods
@@ -6,11 +6,19 @@
 #include "atlantis/propagation/invariants/linear.hpp"
 #include "atlantis/propagation/solver.hpp"
 #include "atlantis/propagation/types.hpp"
+#include "atlantis/search/sharedSearchState.hpp"
 #include "atlantis/types.hpp"
 #include "atlantis/utils/variant.hpp"
 
 namespace atlantis::search {
 
+/**
+ * @return the direction in which the objective of a problem of type
+ * @p problemType is optimised (NONE for satisfaction problems).
+ */
+propagation::ObjectiveDirection objectiveDirection(
+    fznparser::ProblemType problemType);
+
 class Objective {
  private:
   propagation::Solver& _solver;
@@ -20,20 +28,39 @@ class Objective {
   std::optional<propagation::VarViewId> _objective{};
   std::optional<propagation::VarId> _violation{};
 
+  SharedSearchState* _sharedState{nullptr};
+
  public:
   Objective(propagation::Solver& solver, fznparser::ProblemType problemType);
 
+  /**
+   * Copies @p other to @p solver, which must be a copy of the solver of
+   * @p other.
+   */
+  Objective(propagation::Solver& solver, const Objective& other);
+
   propagation::VarViewId registerNode(
       propagation::VarViewId totalViolationVarId,
       propagation::VarViewId objectiveVarId);
 
   void tighten();
 
+  /**
+   * Shares the objective bound with the objectives of other workers: tighten
+   * publishes the bound to @p sharedState, and adoptSharedBound tightens the
+   * bound to the bound published by any worker.
+   */
+  void share(SharedSearchState& sharedState) { _sharedState = &sharedState; }
+
+  void adoptSharedBound();
+
   [[nodiscard]] std::optional<propagation::VarViewId> bound() const noexcept {
     return _bound;
   }
 
  private:
+  void setBound(Int newBound);
+
   template <typename F>
   propagation::VarViewId registerOptimisation(
       propagation::VarViewId constraintViolation,
@@ -66,7 +66,7 @@ class RandomProvider {
   void seed(std::int_fast32_t seed) { _gen.seed(seed); }
 
   template <typename Value, typename Distribution>
-  Value fromDistribution(Distribution d) {
+  Value fromDistribution(Distribution& d) {
     return d(_gen);
   }
 };
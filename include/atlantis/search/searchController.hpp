@@ -6,6 +6,7 @@
 #include <vector>
 
 #include "atlantis/search/assignment.hpp"
+#include "atlantis/search/sharedSearchState.hpp"
 
 namespace atlantis::search {
 
@@ -19,6 +20,7 @@ class SearchController {
   bool _isSatisfactionProblem;
   bool _started{false};
   Int _foundSolution{false};
+  SharedSearchState* _sharedState{nullptr};
 
  public:
   template <typename Rep, typename Period>
@@ -37,6 +39,12 @@ class SearchController {
                 : std::nullopt),
         _isSatisfactionProblem(isSatisfactionProblem) {}
 
+  /**
+   * Makes the controller stop when any worker sharing @p sharedState is done,
+   * and stop all those workers when this controller is done.
+   */
+  void share(SharedSearchState& sharedState) { _sharedState = &sharedState; }
+
   bool shouldRun(const Assignment&);
   void onSolution(const Assignment&);
   void onFinish() const;
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <algorithm>
+#include <cstdint>
+#include <memory>
 #include <ostream>
 #include <string>
 #include <string_view>
@@ -26,6 +29,8 @@ class CounterStatistic : public Statistic {
   explicit CounterStatistic(std::string name) : _name(std::move(name)) {}
 
   void increment() { _count++; }
+  void increment(uint64_t count) { _count += count; }
+  [[nodiscard]] uint64_t count() const noexcept { return _count; }
   std::string_view name() const noexcept override { return _name; }
   std::string value() const noexcept override { return std::to_string(_count); }
 };
@@ -49,6 +54,29 @@ class SearchStatistics {
     }
   }
 
+  /**
+   * Adds the counters of @p other to the counters with the same name, and
+   * appends the statistics of @p other that have no counterpart.
+   */
+  void merge(SearchStatistics&& other) {
+    for (auto& statistic : other._statistics) {
+      auto* counter = dynamic_cast<CounterStatistic*>(statistic.get());
+      auto it = std::find_if(
+          _statistics.begin(), _statistics.end(), [&](const auto& existing) {
+            return existing->name() == statistic->name();
+          });
+      auto* existingCounter =
+          it == _statistics.end()
+              ? nullptr
+              : dynamic_cast<CounterStatistic*>(it->get());
+      if (counter != nullptr && existingCounter != nullptr) {
+        existingCounter->increment(counter->count());
+      } else {
+        _statistics.push_back(std::move(statistic));
+      }
+    }
+  }
+
   const_iterator begin() { return _statistics.begin(); }
   const_iterator end() { return _statistics.end(); }
 };
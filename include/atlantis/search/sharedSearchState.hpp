@@ -0,0 +1,79 @@
+#pragma once
+
+#include <atomic>
+#include <limits>
+
+#include "atlantis/propagation/types.hpp"
+#include "atlantis/types.hpp"
+
+namespace atlantis::search {
+
+/**
+ * The state that is shared between the workers of a parallel (portfolio)
+ * search: the tightest objective bound found by any of the workers, whether
+ * any worker has found a solution, and whether the workers should stop.
+ */
+class SharedSearchState {
+ private:
+  propagation::ObjectiveDirection _direction;
+  std::atomic<Int> _objectiveBound;
+  std::atomic<bool> _foundSolution{false};
+  std::atomic<bool> _stopped{false};
+
+  [[nodiscard]] inline bool isTighter(Int bound, Int other) const noexcept {
+    return _direction == propagation::ObjectiveDirection::MAXIMIZE
+               ? bound > other
+               : bound < other;
+  }
+
+ public:
+  explicit SharedSearchState(propagation::ObjectiveDirection direction)
+      : _direction(direction),
+        _objectiveBound(direction == propagation::ObjectiveDirection::MAXIMIZE
+                            ? std::numeric_limits<Int>::min()
+                            : std::numeric_limits<Int>::max()) {}
+
+  [[nodiscard]] inline Int objectiveBound() const noexcept {
+    return _objectiveBound.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * @return true iff the shared objective bound is tighter than @p bound.
+   */
+  [[nodiscard]] inline bool isTighterThan(Int bound) const noexcept {
+    return isTighter(objectiveBound(), bound);
+  }
+
+  /**
+   * Tightens the shared objective bound to @p bound, unless the shared bound
+   * already is at least as tight.
+   *
+   * @return The tightest of @p bound and the shared objective bound.
+   */
+  Int tightenObjectiveBound(Int bound) noexcept {
+    Int current = objectiveBound();
+    while (isTighter(bound, current) &&
+           !_objectiveBound.compare_exchange_weak(current, bound,
+                                                  std::memory_order_relaxed)) {
+    }
+    return isTighter(bound, current) ? bound : current;
+  }
+
+  inline void registerSolution() noexcept {
+    _foundSolution.store(true, std::memory_order_relaxed);
+  }
+
+  [[nodiscard]] inline bool foundSolution() const noexcept {
+    return _foundSolution.load(std::memory_order_relaxed);
+  }
+
+  inline void stop() noexcept {
+    _stopped.store(true, std::memory_order_relaxed);
+  }
+
+  [[nodiscard]] inline bool stopped() const noexcept {
+    return _stopped.load(std::memory_order_relaxed);
+  }
+};
+
+}  // namespace atlantis::search
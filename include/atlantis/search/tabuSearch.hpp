@@ -0,0 +1,101 @@
+#pragma once
+
+#include <functional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "atlantis/logging/logger.hpp"
+#include "atlantis/search/annealer.hpp"
+#include "atlantis/search/move.hpp"
+#include "atlantis/search/neighbourhoods/neighbourhood.hpp"
+#include "atlantis/search/objective.hpp"
+#include "atlantis/search/randomProvider.hpp"
+#include "atlantis/search/searchController.hpp"
+#include "atlantis/search/searchStatistics.hpp"
+
+namespace atlantis::search {
+
+/**
+ * Tabu search, which in each iteration probes the moves of the neighbourhood
+ * that change one of a few randomly selected variables (see
+ * neighbourhoods::Neighbourhood::enumerateMoves) in a single batch, and
+ * commits the best of them that is not tabu.
+ *
+ * When a move changes a variable from a value a, assigning a to the variable
+ * is tabu for the next tenure iterations, unless doing so results in a lower
+ * cost than the lowest cost so far (aspiration). The pairs that are no
+ * longer tabu are dropped whenever a move is committed more than tenure
+ * iterations after they were last dropped, so the tabu list only holds the
+ * pairs of the latest 2 * tenure + 1 iterations. The assignment is
+ * reinitialised when the lowest cost has not decreased for maxStagnation
+ * iterations.
+ */
+class TabuSearch {
+ public:
+  static constexpr size_t DEFAULT_TENURE = 10;
+  static constexpr size_t DEFAULT_VARS_PER_ITERATION = 8;
+
+  /**
+   * @param tenure The number of iterations for which a (variable, value)
+   * pair is tabu.
+   * @param varsPerIteration The number of variables whose moves are probed
+   * in each iteration.
+   * @param maxStagnation The number of iterations without improvement after
+   * which the assignment is reinitialised, where 0 means ten times the number
+   * of search variables (but at least 1000).
+   */
+  TabuSearch(RandomProvider& random, Assignment& assignment,
+             neighbourhoods::Neighbourhood& neighbourhood, Objective objective,
+             size_t tenure = DEFAULT_TENURE,
+             size_t varsPerIteration = DEFAULT_VARS_PER_ITERATION,
+             size_t maxStagnation = 0);
+
+  /**
+   * @param annealer Decides whether to accept the moves of neighbourhoods
+   * that cannot enumerate their moves, which fall back to randomMove.
+   */
+  SearchStatistics run(SearchController& controller, Annealer& annealer,
+                       logging::Logger& logger);
+
+ protected:
+  struct TabuKeyHash {
+    size_t operator()(const std::pair<size_t, Int>& key) const noexcept {
+      return std::hash<size_t>{}(key.first) * 31 + std::hash<Int>{}(key.second);
+    }
+  };
+
+  RandomProvider& _random;
+  Assignment& _assignment;
+  neighbourhoods::Neighbourhood& _neighbourhood;
+  Objective _objective;
+  size_t _tenure;
+  size_t _varsPerIteration;
+  size_t _maxStagnation;
+
+  // _tabuUntil[(var, value)] is the first iteration at which assigning value
+  // to var is no longer tabu:
+  std::unordered_map<std::pair<size_t, Int>, size_t, TabuKeyHash> _tabuUntil;
+  // The iteration at or after which the expired pairs are dropped next:
+  size_t _nextDropIteration{0};
+  std::vector<CandidateMove> _moves;
+  // _costs[i] is the probed cost of _moves[i]:
+  std::vector<Cost> _costs;
+
+  [[nodiscard]] bool isTabu(const CandidateMove&, size_t iteration) const;
+
+  /**
+   * Drops the (variable, value) pairs that are no longer tabu at
+   * @p iteration.
+   */
+  void dropExpired(size_t iteration);
+
+  /**
+   * Commits the best non-tabu (or aspirated) move of _moves.
+   *
+   * @return True if a move was committed, false otherwise.
+   */
+  bool commitBestMove(size_t iteration, Int lowestCost);
+};
+
+}  // namespace atlantis::search
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace atlantis {
+
+/**
+ * A dense matrix that stores its entries contiguously in row-major order,
+ * where the entry (row, col) is at position row * numCols() + col.
+ */
+template <class T>
+class Matrix {
+ private:
+  std::vector<T> _data;
+  size_t _numRows{0};
+  size_t _numCols{0};
+
+ public:
+  Matrix() = default;
+
+  /**
+   * @param data the entries in row-major order.
+   */
+  Matrix(size_t numRows, size_t numCols, std::vector<T>&& data)
+      : _data(std::move(data)), _numRows(numRows), _numCols(numCols) {
+    if (_data.size() != numRows * numCols) {
+      throw std::invalid_argument(
+          "Matrix: expected " + std::to_string(numRows * numCols) +
+          " entries but got " + std::to_string(_data.size()));
+    }
+  }
+
+  Matrix(size_t numRows, size_t numCols, const T& value)
+      : _data(numRows * numCols, value),
+        _numRows(numRows),
+        _numCols(numCols) {}
+
+  /**
+   * Copies a matrix given as a vector of rows of equal length. The
+   * conversion is implicit so that nested vectors can be passed wherever a
+   * matrix is expected.
+   */
+  Matrix(const std::vector<std::vector<T>>& rows)
+      : _numRows(rows.size()),
+        _numCols(rows.empty() ? 0 : rows.front().size()) {
+    _data.reserve(_numRows * _numCols);
+    for (const std::vector<T>& row : rows) {
+      if (row.size() != _numCols) {
+        throw std::invalid_argument("Matrix: rows of different lengths");
+      }
+      _data.insert(_data.end(), row.begin(), row.end());
+    }
+  }
+
+  [[nodiscard]] inline size_t numRows() const noexcept { return _numRows; }
+  [[nodiscard]] inline size_t numCols() const noexcept { return _numCols; }
+  [[nodiscard]] inline size_t size() const noexcept { return _data.size(); }
+  [[nodiscard]] inline bool empty() const noexcept { return _data.empty(); }
+
+  [[nodiscard]] inline const T& operator()(size_t row,
+                                           size_t col) const noexcept {
+    assert(row < _numRows && col < _numCols);
+    return _data[row * _numCols + col];
+  }
+
+  [[nodiscard]] inline T& operator()(size_t row, size_t col) noexcept {
+    assert(row < _numRows && col < _numCols);
+    return _data[row * _numCols + col];
+  }
+
+  /**
+   * @throws std::out_of_range if (@p row, @p col) is not an entry.
+   */
+  [[nodiscard]] const T& at(size_t row, size_t col) const {
+    if (row >= _numRows || col >= _numCols) {
+      throw std::out_of_range("Matrix: (" + std::to_string(row) + ", " +
+                              std::to_string(col) + ") is out of range");
+    }
+    return _data[row * _numCols + col];
+  }
+
+  [[nodiscard]] inline std::span<const T> row(
+      size_t rowIndex) const noexcept {
+    assert(rowIndex < _numRows);
+    return {_data.data() + rowIndex * _numCols, _numCols};
+  }
+
+  /**
+   * @return the entries in row-major order.
+   */
+  [[nodiscard]] inline const std::vector<T>& data() const noexcept {
+    return _data;
+  }
+
+  void clear() {
+    _data.clear();
+    _numRows = 0;
+    _numCols = 0;
+  }
+};
+
+}  // namespace atlantis
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace atlantis {
+
+/**
+ * Finds the strongly connected components of a directed graph over the
+ * nodes 0, ..., numNodes - 1 using Tarjan's algorithm, where the recursion is
+ * replaced by an explicit stack so that long paths cannot overflow the call
+ * stack.
+ *
+ * @param forEachSuccessor called as forEachSuccessor(v, visit), which must
+ * call visit(w) for every edge (v, w). It is called once per node.
+ * @return the strongly connected components in reverse topological order: if
+ * there is an edge from a node in component i to a node in component j, then
+ * j <= i.
+ */
+template <class ForEachSuccessor>
+std::vector<std::vector<size_t>> stronglyConnectedComponents(
+    size_t numNodes, ForEachSuccessor&& forEachSuccessor) {
+  constexpr size_t UNVISITED = ~size_t{0};
+  // The successors of the nodes on the call stack, where the successors of
+  // callStack[k].node are successors[callStack[k].begin] up to the begin of
+  // the frame above (or the end):
+  struct Frame {
+    size_t node;
+    size_t begin;
+    size_t next;
+  };
+  std::vector<size_t> index(numNodes, UNVISITED);
+  std::vector<size_t> lowLink(numNodes, 0);
+  std::vector<bool> onStack(numNodes, false);
+  std::vector<size_t> stack;
+  std::vector<size_t> successors;
+  std::vector<Frame> callStack;
+  std::vector<std::vector<size_t>> components;
+  size_t nextIndex = 0;
+
+  const auto visit = [&](const size_t v) {
+    index[v] = nextIndex;
+    lowLink[v] = nextIndex;
+    ++nextIndex;
+    stack.emplace_back(v);
+    onStack[v] = true;
+    callStack.emplace_back(Frame{v, successors.size(), successors.size()});
+    forEachSuccessor(v, [&](const size_t w) { successors.emplace_back(w); });
+  };
+
+  for (size_t root = 0; root < numNodes; ++root) {
+    if (index[root] != UNVISITED) {
+      continue;
+    }
+    visit(root);
+    while (!callStack.empty()) {
+      Frame& frame = callStack.back();
+      const size_t cur = frame.node;
+      if (frame.next < successors.size()) {
+        const size_t successor = successors[frame.next++];
+        if (index[successor] == UNVISITED) {
+          visit(successor);
+        } else if (onStack[successor]) {
+          lowLink[cur] = std::min(lowLink[cur], index[successor]);
+        }
+        continue;
+      }
+      successors.resize(frame.begin);
+      callStack.pop_back();
+      if (!callStack.empty()) {
+        const size_t parent = callStack.back().node;
+        lowLink[parent] = std::min(lowLink[parent], lowLink[cur]);
+      }
+      if (lowLink[cur] != index[cur]) {
+        continue;
+      }
+      // cur is the root of a component, which consists of the nodes on the
+      // stack from cur and up:
+      size_t first = stack.size() - 1;
+      while (stack[first] != cur) {
+        --first;
+      }
+      for (size_t i = first; i < stack.size(); ++i) {
+        onStack[stack[i]] = false;
+      }
+      components.emplace_back(stack.begin() + first, stack.end());
+      stack.resize(first);
+    }
+  }
+  return components;
+}
+
+}  // namespace atlantis
@@ -1,12 +1,19 @@
 #include "atlantis/fznBackend.hpp"
 
+#include <exception>
+#include <fstream>
 #include <fznparser/parser.hpp>
+#include <memory>
+#include <mutex>
+#include <thread>
 #include <utility>
+#include <vector>
 
 #include "atlantis/invariantgraph/fznInvariantGraph.hpp"
 #include "atlantis/search/assignment.hpp"
 #include "atlantis/search/objective.hpp"
 #include "atlantis/search/searchProcedure.hpp"
+#include "atlantis/search/tabuSearch.hpp"
 #include "atlantis/utils/fznOutput.hpp"
 
 namespace atlantis {
@@ -115,86 +122,225 @@ FznBackend::FznBackend(logging::Logger& logger,
             return m;
           })) {}
 
-static propagation::ObjectiveDirection getObjectiveDirection(
-    fznparser::ProblemType problemType) {
-  switch (problemType) {
-    case fznparser::ProblemType::MINIMIZE:
-      return propagation::ObjectiveDirection::MINIMIZE;
-    case fznparser::ProblemType::MAXIMIZE:
-      return propagation::ObjectiveDirection::MAXIMIZE;
-    case fznparser::ProblemType::SATISFY:
-    default:
-      return propagation::ObjectiveDirection::NONE;
-  }
-}
-
-search::SearchStatistics FznBackend::solve(logging::Logger& logger) {
-  fznparser::ProblemType problemType = _model.solveType().problemType();
-
-  propagation::Solver solver;
-
-  // TODO: we should improve the initialisation in order to avoid the need for
-  // breaking the dynamic cycles
-  invariantgraph::FznInvariantGraph invariantGraph(solver, true);
-  logger.timedProcedure("building invariant graph",
-                        [&] { invariantGraph.build(_model); });
-
-  invariantGraph.construct();
+std::unique_ptr<FznSearch> FznBackend::setUp(logging::Logger& logger) const {
+  auto fznSearch = std::make_unique<FznSearch>(_model, logger,
+                                               _profileFilePath.has_value());
   if (_dotFilePath.has_value()) {
     std::ofstream dotFile;
     dotFile.open(*_dotFilePath);
     if (dotFile) {
-      invariantGraph.writeDotFile(dotFile);
+      fznSearch->invariantGraph().writeDotFile(dotFile);
     }
     dotFile.close();
   }
-  auto neighbourhood = invariantGraph.neighbourhood();
+  fznSearch->neighbourhood().printNeighbourhood(logger);
+  fznSearch->close();
+  return fznSearch;
+}
 
-  neighbourhood.printNeighbourhood(logger);
+search::SearchStatistics FznBackend::run(logging::Logger& logger,
+                                         FznSearch& fznSearch) {
+  if (!fznSearch.hasSearchVars()) {
+    _onSolution(fznSearch.invariantGraph(), fznSearch.assignment());
+    _onFinish(true);
+    return search::SearchStatistics{};
+  }
 
-  search::Objective searchObjective(solver, problemType);
+  search::SearchStatistics statistics =
+      _numThreads > 1
+          ? runPortfolio(logger, fznSearch)
+          : runSearch(logger, fznSearch.invariantGraph(),
+                      fznSearch.assignment(), fznSearch.neighbourhood(),
+                      fznSearch.objective(), _seed,
+                      _annealingScheduleFactories.front(), _onSolution,
+                      _onFinish, nullptr);
+  if (_profileFilePath.has_value()) {
+    writeProfile(logger, fznSearch.invariantGraph(), fznSearch.solver());
+  }
+  return statistics;
+}
 
-  auto violation = searchObjective.registerNode(
-      invariantGraph.totalViolationVarId(), invariantGraph.objectiveVarId());
+search::SearchStatistics FznBackend::solve(logging::Logger& logger) {
+  const std::unique_ptr<FznSearch> fznSearch = setUp(logger);
+  return run(logger, *fznSearch);
+}
 
-  invariantGraph.close();
+void FznBackend::writeProfile(
+    logging::Logger& logger,
+    const invariantgraph::FznInvariantGraph& invariantGraph,
+    propagation::Solver& solver) const {
+  assert(_profileFilePath.has_value() && solver.profiler() != nullptr);
+  std::ofstream profileFile(*_profileFilePath);
+  if (!profileFile) {
+    logger.warn("Could not open profile file {}.", _profileFilePath->string());
+    return;
+  }
+  solver.profiler()->writeJson(profileFile, solver.store(),
+                               invariantGraph.invariantConstraintNames());
+}
 
-  const Int objectiveOptimalValue =
-      _model.isSatisfactionProblem()
-          ? 0
-          : (_model.isMinimisationProblem()
-                 ? invariantGraph.objectiveVarNode().lowerBound()
-                 : invariantGraph.objectiveVarNode().upperBound());
+search::SearchStatistics FznBackend::runPortfolio(logging::Logger& logger,
+                                                  FznSearch& fznSearch) {
+  const invariantgraph::FznInvariantGraph& invariantGraph =
+      fznSearch.invariantGraph();
+  propagation::Solver& solver = fznSearch.solver();
+  const propagation::ObjectiveDirection direction =
+      fznSearch.objectiveDirection();
+  search::SharedSearchState sharedState(direction);
+
+  // The solvers are copied before any worker starts, as the first worker
+  // searches on (and thus modifies) the original solver:
+  std::vector<std::unique_ptr<propagation::Solver>> solvers;
+  std::vector<std::unique_ptr<search::Assignment>> assignments;
+  std::vector<std::shared_ptr<search::neighbourhoods::Neighbourhood>>
+      neighbourhoods;
+  std::vector<std::unique_ptr<search::Objective>> objectives;
+  logger.timedProcedure("copying solvers", [&] {
+    for (size_t i = 1; i < _numThreads; ++i) {
+      solvers.emplace_back(solver.clone());
+      assignments.emplace_back(std::make_unique<search::Assignment>(
+          *solvers.back(), fznSearch.violationVarId(),
+          invariantGraph.objectiveVarId(), direction,
+          fznSearch.objectiveOptimalValue()));
+      neighbourhoods.emplace_back(fznSearch.neighbourhood().clone());
+      objectives.emplace_back(std::make_unique<search::Objective>(
+          *solvers.back(), fznSearch.objective()));
+    }
+  });
+
+  // Solutions are reported one at a time, and only if they improve on the
+  // solutions that have already been reported:
+  std::mutex solutionMutex;
+  bool reportedSolution = false;
+  Int reportedObjective = 0;
+  const std::function<void(const invariantgraph::FznInvariantGraph&,
+                           const search::Assignment&)>
+      onSolution = [&](const invariantgraph::FznInvariantGraph& graph,
+                       const search::Assignment& workerAssignment) {
+        std::lock_guard<std::mutex> lock(solutionMutex);
+        const Int objectiveValue =
+            direction == propagation::ObjectiveDirection::NONE
+                ? 0
+                : workerAssignment.value(graph.objectiveVarId());
+        if (reportedSolution &&
+            (direction == propagation::ObjectiveDirection::NONE ||
+             (direction == propagation::ObjectiveDirection::MINIMIZE
+                  ? objectiveValue >= reportedObjective
+                  : objectiveValue <= reportedObjective))) {
+          return;
+        }
+        reportedSolution = true;
+        reportedObjective = objectiveValue;
+        _onSolution(graph, workerAssignment);
+      };
+  const std::function<void(bool)> onFinish = [](bool) {};
+
+  std::vector<logging::Logger> loggers(_numThreads, logger);
+  std::vector<search::SearchStatistics> statistics(_numThreads);
+  std::vector<std::exception_ptr> errors(_numThreads);
+  std::vector<std::thread> workers;
+  workers.reserve(_numThreads);
+
+  for (size_t i = 0; i < _numThreads; ++i) {
+    workers.emplace_back([&, i] {
+      try {
+        const auto seed = _seed + static_cast<std::uint_fast32_t>(i);
+        loggers[i].debug("Worker {} uses seed {}.", i, seed);
+        statistics[i] = runSearch(
+            loggers[i], invariantGraph,
+            i == 0 ? fznSearch.assignment() : *assignments[i - 1],
+            i == 0 ? fznSearch.neighbourhood() : *neighbourhoods[i - 1],
+            i == 0 ? fznSearch.objective() : *objectives[i - 1], seed,
+            _annealingScheduleFactories[i % _annealingScheduleFactories.size()],
+            onSolution, onFinish, &sharedState);
+      } catch (...) {
+        errors[i] = std::current_exception();
+        sharedState.stop();
+      }
+    });
+  }
+  for (std::thread& worker : workers) {
+    worker.join();
+  }
+  for (const std::exception_ptr& error : errors) {
+    if (error) {
+      std::rethrow_exception(error);
+    }
+  }
 
-  search::Assignment assignment(
-      solver, violation, invariantGraph.objectiveVarId(),
-      getObjectiveDirection(problemType), objectiveOptimalValue);
+  _onFinish(sharedState.foundSolution());
 
-  if (neighbourhood.coveredVars().empty()) {
-    _onSolution(invariantGraph, assignment);
-    _onFinish(true);
-    return search::SearchStatistics{};
+  if (solver.profiler() != nullptr) {
+    for (const auto& workerSolver : solvers) {
+      solver.profiler()->merge(*workerSolver->profiler());
+    }
   }
 
-  logger.debug("Using seed {}.", _seed);
-  search::RandomProvider random(_seed);
+  search::SearchStatistics total;
+  for (search::SearchStatistics& workerStatistics : statistics) {
+    total.merge(std::move(workerStatistics));
+  }
+  return total;
+}
 
-  search::SearchProcedure search(random, assignment, neighbourhood,
-                                 searchObjective);
+search::SearchStatistics FznBackend::runSearch(
+    logging::Logger& logger,
+    const invariantgraph::FznInvariantGraph& invariantGraph,
+    search::Assignment& assignment,
+    search::neighbourhoods::Neighbourhood& neighbourhood,
+    search::Objective& objective, std::uint_fast32_t seed,
+    const search::AnnealingScheduleFactory& annealingScheduleFactory,
+    const std::function<void(const invariantgraph::FznInvariantGraph&,
+                             const search::Assignment&)>& onSolution,
+    const std::function<void(bool)>& onFinish,
+    search::SharedSearchState* sharedState) {
+  logger.debug("Using seed {}.", seed);
+  search::RandomProvider random(seed);
+
+  if (sharedState != nullptr) {
+    objective.share(*sharedState);
+  }
 
-  std::function<void(const search::Assignment&)> onSolution =
-      [&](const search::Assignment& assignment) {
-        _onSolution(invariantGraph, assignment);
+  std::function<void(const search::Assignment&)> onAssignmentSolution =
+      [&](const search::Assignment& solution) {
+        onSolution(invariantGraph, solution);
       };
-  std::function<void(bool)> onFinish = [&](bool hadSol) { _onFinish(hadSol); };
-
-  search::SearchController searchController(_model.isSatisfactionProblem(),
-                                            std::move(onSolution),
-                                            std::move(onFinish), _timelimit);
+  std::function<void(bool)> onSearchFinish = [&](bool hadSol) {
+    onFinish(hadSol);
+  };
+
+  search::SearchController searchController(
+      _model.isSatisfactionProblem(), std::move(onAssignmentSolution),
+      std::move(onSearchFinish), _timelimit);
+
+  // The round limit stops the search through a shared search state, which a
+  // single worker otherwise does without:
+  std::optional<search::SharedSearchState> roundLimitState;
+  if (_numRounds.has_value() && sharedState == nullptr) {
+    roundLimitState.emplace(
+        search::objectiveDirection(_model.solveType().problemType()));
+    sharedState = &*roundLimitState;
+  }
+  if (sharedState != nullptr) {
+    searchController.share(*sharedState);
+  }
 
-  auto schedule = _annealingScheduleFactory.create();
+  std::unique_ptr<search::AnnealingSchedule> schedule =
+      annealingScheduleFactory.create();
+  if (_numRounds.has_value()) {
+    schedule = std::make_unique<search::RoundLimit>(
+        std::move(schedule), *_numRounds, *sharedState, _onRound);
+  }
   search::Annealer annealer(assignment, random, *schedule);
 
+  if (_searchStrategy == SearchStrategy::TABU) {
+    search::TabuSearch search(random, assignment, neighbourhood, objective);
+    return logger.timedFunction<search::SearchStatistics>("search", [&] {
+      return search.run(searchController, annealer, logger);
+    });
+  }
+
+  search::SearchProcedure search(random, assignment, neighbourhood, objective);
   return logger.timedFunction<search::SearchStatistics>(
       "search", [&] { return search.run(searchController, annealer, logger); });
 }
@@ -0,0 +1,56 @@
+#include "atlantis/fznSearch.hpp"
+
+namespace atlantis {
+
+search::neighbourhoods::NeighbourhoodCombinator FznSearch::construct(
+    propagation::Solver& solver,
+    invariantgraph::FznInvariantGraph& invariantGraph,
+    const fznparser::Model& model, logging::Logger& logger,
+    bool enableProfiling) {
+  if (enableProfiling) {
+    solver.enableProfiling();
+  }
+  logger.timedProcedure("building invariant graph",
+                        [&] { invariantGraph.build(model); });
+  logger.timedProcedure("constructing invariant graph",
+                        [&] { invariantGraph.construct(logger); });
+  return invariantGraph.neighbourhood();
+}
+
+// TODO: we should improve the initialisation in order to avoid the need for
+// breaking the dynamic cycles
+FznSearch::FznSearch(const fznparser::Model& model, logging::Logger& logger,
+                     bool enableProfiling)
+    : _solver(),
+      _invariantGraph(_solver, true),
+      _neighbourhood(construct(_solver, _invariantGraph, model, logger,
+                               enableProfiling)),
+      _objective(_solver, model.solveType().problemType()),
+      _objectiveDirection(
+          search::objectiveDirection(model.solveType().problemType())),
+      _isSatisfactionProblem(model.isSatisfactionProblem()),
+      _isMinimisationProblem(model.isMinimisationProblem()) {
+  _violation = _objective.registerNode(_invariantGraph.totalViolationVarId(),
+                                       _invariantGraph.objectiveVarId());
+}
+
+void FznSearch::close() {
+  assert(_assignment == nullptr);
+  _invariantGraph.close();
+
+  _objectiveOptimalValue =
+      _isSatisfactionProblem
+          ? 0
+          : (_isMinimisationProblem
+                 ? _invariantGraph.objectiveVarNode().lowerBound()
+                 : _invariantGraph.objectiveVarNode().upperBound());
+  _assignment = std::make_unique<search::Assignment>(
+      _solver, _violation, _invariantGraph.objectiveVarId(),
+      _objectiveDirection, _objectiveOptimalValue);
+}
+
+bool FznSearch::hasSearchVars() const {
+  return !_neighbourhood.coveredVars().empty();
+}
+
+}  // namespace atlantis
@@ -35,16 +35,11 @@ bool array_int_element2d(FznInvariantGraph& graph,
 
   const size_t numCols = parVector.size() / static_cast<size_t>(numRows);
 
-  std::vector<std::vector<Int>> parMatrix(numRows, std::vector<Int>(numCols));
-  for (Int i = 0; i < numRows; ++i) {
-    for (size_t j = 0; j < numCols; ++j) {
-      parMatrix.at(i).at(j) = parVector.at(i * numCols + j);
-    }
-  }
-
+  // The array is already in row-major order:
   graph.addInvariantNode(std::make_shared<ArrayElement2dNode>(
       graph, graph.retrieveVarNode(idx1), graph.retrieveVarNode(idx2),
-      std::move(parMatrix), graph.retrieveVarNode(output), offset1, offset2));
+      Matrix<Int>(static_cast<size_t>(numRows), numCols, std::move(parVector)),
+      graph.retrieveVarNode(output), offset1, offset2));
   return true;
 }
 
@@ -0,0 +1,76 @@
+#include "atlantis/invariantgraph/fzn/fzn_cumulative.hpp"
+
+#include "../parseHelper.hpp"
+#include "./fznHelper.hpp"
+#include "atlantis/invariantgraph/violationInvariantNodes/cumulativeNode.hpp"
+
+namespace atlantis::invariantgraph::fzn {
+
+static void verifyNumTasks(const std::shared_ptr<fznparser::IntVarArray>& s,
+                           const std::shared_ptr<fznparser::IntVarArray>& d,
+                           const std::shared_ptr<fznparser::IntVarArray>& r) {
+  if (s->size() != d->size() || s->size() != r->size()) {
+    throw FznArgumentException(
+        "Constraint fzn_cumulative the start, duration, and requirement "
+        "arrays must have the same length.");
+  }
+}
+
+bool fzn_cumulative(FznInvariantGraph& graph,
+                    const std::shared_ptr<fznparser::IntVarArray>& s,
+                    const std::shared_ptr<fznparser::IntVarArray>& d,
+                    const std::shared_ptr<fznparser::IntVarArray>& r,
+                    const fznparser::IntArg& b) {
+  verifyNumTasks(s, d, r);
+  graph.addInvariantNode(std::make_shared<CumulativeNode>(
+      graph, graph.retrieveVarNodes(s), graph.retrieveVarNodes(d),
+      graph.retrieveVarNodes(r), graph.retrieveVarNode(b)));
+  return true;
+}
+
+bool fzn_cumulative(FznInvariantGraph& graph,
+                    const std::shared_ptr<fznparser::IntVarArray>& s,
+                    const std::shared_ptr<fznparser::IntVarArray>& d,
+                    const std::shared_ptr<fznparser::IntVarArray>& r,
+                    const fznparser::IntArg& b,
+                    const fznparser::BoolArg& reified) {
+  verifyNumTasks(s, d, r);
+  graph.addInvariantNode(std::make_shared<CumulativeNode>(
+      graph, graph.retrieveVarNodes(s), graph.retrieveVarNodes(d),
+      graph.retrieveVarNodes(r), graph.retrieveVarNode(b),
+      graph.retrieveVarNode(reified)));
+  return true;
+}
+
+bool fzn_cumulative(FznInvariantGraph& graph,
+                    const fznparser::Constraint& constraint) {
+  if (constraint.identifier() != "fzn_cumulative" &&
+      constraint.identifier() != "fzn_cumulative_reif") {
+    return false;
+  }
+
+  const bool isReified = constraintIdentifierIsReified(constraint);
+  verifyNumArguments(constraint, isReified ? 5 : 4);
+  FZN_CONSTRAINT_ARRAY_TYPE_CHECK(constraint, 0, fznparser::IntVarArray, true)
+  FZN_CONSTRAINT_ARRAY_TYPE_CHECK(constraint, 1, fznparser::IntVarArray, true)
+  FZN_CONSTRAINT_ARRAY_TYPE_CHECK(constraint, 2, fznparser::IntVarArray, true)
+  FZN_CONSTRAINT_TYPE_CHECK(constraint, 3, fznparser::IntArg, true)
+
+  if (!isReified) {
+    return fzn_cumulative(
+        graph,
+        getArgArray<fznparser::IntVarArray>(constraint.arguments().at(0)),
+        getArgArray<fznparser::IntVarArray>(constraint.arguments().at(1)),
+        getArgArray<fznparser::IntVarArray>(constraint.arguments().at(2)),
+        std::get<fznparser::IntArg>(constraint.arguments().at(3)));
+  }
+  FZN_CONSTRAINT_TYPE_CHECK(constraint, 4, fznparser::BoolArg, true)
+  return fzn_cumulative(
+      graph, getArgArray<fznparser::IntVarArray>(constraint.arguments().at(0)),
+      getArgArray<fznparser::IntVarArray>(constraint.arguments().at(1)),
+      getArgArray<fznparser::IntVarArray>(constraint.arguments().at(2)),
+      std::get<fznparser::IntArg>(constraint.arguments().at(3)),
+      std::get<fznparser::BoolArg>(constraint.arguments().at(4)));
+}
+
+}  // namespace atlantis::invariantgraph::fzn
@@ -0,0 +1,87 @@
+#include "atlantis/invariantgraph/fzn/fzn_inverse.hpp"
+
+#include "../parseHelper.hpp"
+#include "./fznHelper.hpp"
+#include "atlantis/invariantgraph/violationInvariantNodes/inverseNode.hpp"
+
+namespace atlantis::invariantgraph::fzn {
+
+static void verifyInverseSize(
+    const std::shared_ptr<fznparser::IntVarArray>& f,
+    const std::shared_ptr<fznparser::IntVarArray>& invf) {
+  if (f->size() != invf->size()) {
+    throw FznArgumentException(
+        "Constraint fzn_inverse the arrays must have the same length (" +
+        std::to_string(f->size()) + " != " + std::to_string(invf->size()) +
+        ")");
+  }
+}
+
+bool fzn_inverse(FznInvariantGraph& graph,
+                 const std::shared_ptr<fznparser::IntVarArray>& f,
+                 Int fOffset,
+                 const std::shared_ptr<fznparser::IntVarArray>& invf,
+                 Int invfOffset) {
+  verifyInverseSize(f, invf);
+  graph.addInvariantNode(std::make_shared<InverseNode>(
+      graph, graph.retrieveVarNodes(f), fOffset, graph.retrieveVarNodes(invf),
+      invfOffset));
+  return true;
+}
+
+bool fzn_inverse(FznInvariantGraph& graph,
+                 const std::shared_ptr<fznparser::IntVarArray>& f,
+                 Int fOffset,
+                 const std::shared_ptr<fznparser::IntVarArray>& invf,
+                 Int invfOffset, const fznparser::BoolArg& reified) {
+  verifyInverseSize(f, invf);
+  graph.addInvariantNode(std::make_shared<InverseNode>(
+      graph, graph.retrieveVarNodes(f), fOffset, graph.retrieveVarNodes(invf),
+      invfOffset, graph.retrieveVarNode(reified)));
+  return true;
+}
+
+bool fzn_inverse(FznInvariantGraph& graph,
+                 const fznparser::Constraint& constraint) {
+  if (constraint.identifier() != "fzn_inverse" &&
+      constraint.identifier() != "fzn_inverse_reif" &&
+      constraint.identifier() != "fzn_inverse_offsets" &&
+      constraint.identifier() != "fzn_inverse_offsets_reif") {
+    return false;
+  }
+
+  const bool isReified = constraintIdentifierIsReified(constraint);
+  const bool hasOffsets =
+      constraint.identifier() == "fzn_inverse_offsets" ||
+      constraint.identifier() == "fzn_inverse_offsets_reif";
+  // fzn_inverse(f, invf) and fzn_inverse_offsets(f, fOffset, invf, invfOffset)
+  // where the arrays of fzn_inverse are indexed from 1:
+  const size_t invfIndex = hasOffsets ? 2 : 1;
+  verifyNumArguments(constraint, (hasOffsets ? 4 : 2) + (isReified ? 1 : 0));
+  FZN_CONSTRAINT_ARRAY_TYPE_CHECK(constraint, 0, fznparser::IntVarArray, true)
+  FZN_CONSTRAINT_ARRAY_TYPE_CHECK(constraint, invfIndex,
+                                  fznparser::IntVarArray, true)
+  Int fOffset = 1;
+  Int invfOffset = 1;
+  if (hasOffsets) {
+    FZN_CONSTRAINT_TYPE_CHECK(constraint, 1, fznparser::IntArg, false)
+    FZN_CONSTRAINT_TYPE_CHECK(constraint, 3, fznparser::IntArg, false)
+    fOffset =
+        std::get<fznparser::IntArg>(constraint.arguments().at(1)).toParameter();
+    invfOffset =
+        std::get<fznparser::IntArg>(constraint.arguments().at(3)).toParameter();
+  }
+  auto f = getArgArray<fznparser::IntVarArray>(constraint.arguments().at(0));
+  auto invf =
+      getArgArray<fznparser::IntVarArray>(constraint.arguments().at(invfIndex));
+  if (!isReified) {
+    return fzn_inverse(graph, f, fOffset, invf, invfOffset);
+  }
+  const size_t reifiedIndex = invfIndex + (hasOffsets ? 2 : 1);
+  FZN_CONSTRAINT_TYPE_CHECK(constraint, reifiedIndex, fznparser::BoolArg, true)
+  return fzn_inverse(
+      graph, f, fOffset, invf, invfOffset,
+      std::get<fznparser::BoolArg>(constraint.arguments().at(reifiedIndex)));
+}
+
+}  // namespace atlantis::invariantgraph::fzn
@@ -0,0 +1,91 @@
+#include "atlantis/invariantgraph/fzn/fzn_regular.hpp"
+
+#include "../parseHelper.hpp"
+#include "./fznHelper.hpp"
+#include "atlantis/invariantgraph/violationInvariantNodes/regularNode.hpp"
+
+namespace atlantis::invariantgraph::fzn {
+
+static void verifyTransitionSize(Int Q, Int S, const std::vector<Int>& d) {
+  if (Q < 0 || S < 0 || static_cast<Int>(d.size()) != Q * S) {
+    throw FznArgumentException(
+        "Constraint fzn_regular the transition table must have Q * S "
+        "elements (" +
+        std::to_string(d.size()) + " != " + std::to_string(Q) + " * " +
+        std::to_string(S) + ")");
+  }
+}
+
+static std::vector<Int> toVector(const fznparser::IntSet& set) {
+  if (!set.isInterval()) {
+    return std::vector<Int>{set.elements()};
+  }
+  std::vector<Int> elements;
+  for (Int i = set.lowerBound(); i <= set.upperBound(); ++i) {
+    elements.emplace_back(i);
+  }
+  return elements;
+}
+
+bool fzn_regular(FznInvariantGraph& graph,
+                 const std::shared_ptr<fznparser::IntVarArray>& x, Int Q,
+                 Int S, std::vector<Int>&& d, Int q0,
+                 const fznparser::IntSet& F) {
+  verifyTransitionSize(Q, S, d);
+  graph.addInvariantNode(std::make_shared<RegularNode>(
+      graph, graph.retrieveVarNodes(x), Q, S, std::move(d), q0, toVector(F)));
+  return true;
+}
+
+bool fzn_regular(FznInvariantGraph& graph,
+                 const std::shared_ptr<fznparser::IntVarArray>& x, Int Q,
+                 Int S, std::vector<Int>&& d, Int q0,
+                 const fznparser::IntSet& F,
+                 const fznparser::BoolArg& reified) {
+  verifyTransitionSize(Q, S, d);
+  graph.addInvariantNode(std::make_shared<RegularNode>(
+      graph, graph.retrieveVarNodes(x), Q, S, std::move(d), q0, toVector(F),
+      graph.retrieveVarNode(reified)));
+  return true;
+}
+
+bool fzn_regular(FznInvariantGraph& graph,
+                 const fznparser::Constraint& constraint) {
+  if (constraint.identifier() != "fzn_regular" &&
+      constraint.identifier() != "fzn_regular_reif") {
+    return false;
+  }
+
+  const bool isReified = constraintIdentifierIsReified(constraint);
+  verifyNumArguments(constraint, isReified ? 7 : 6);
+  FZN_CONSTRAINT_ARRAY_TYPE_CHECK(constraint, 0, fznparser::IntVarArray, true)
+  FZN_CONSTRAINT_TYPE_CHECK(constraint, 1, fznparser::IntArg, false)
+  FZN_CONSTRAINT_TYPE_CHECK(constraint, 2, fznparser::IntArg, false)
+  FZN_CONSTRAINT_ARRAY_TYPE_CHECK(constraint, 3, fznparser::IntVarArray, false)
+  FZN_CONSTRAINT_TYPE_CHECK(constraint, 4, fznparser::IntArg, false)
+  FZN_CONSTRAINT_TYPE_CHECK(constraint, 5, fznparser::IntSetArg, false)
+
+  const auto x =
+      getArgArray<fznparser::IntVarArray>(constraint.arguments().at(0));
+  const Int Q =
+      std::get<fznparser::IntArg>(constraint.arguments().at(1)).toParameter();
+  const Int S =
+      std::get<fznparser::IntArg>(constraint.arguments().at(2)).toParameter();
+  std::vector<Int> d =
+      getArgArray<fznparser::IntVarArray>(constraint.arguments().at(3))
+          ->toParVector();
+  const Int q0 =
+      std::get<fznparser::IntArg>(constraint.arguments().at(4)).toParameter();
+  const fznparser::IntSet& F =
+      std::get<fznparser::IntSetArg>(constraint.arguments().at(5))
+          .toParameter();
+  if (!isReified) {
+    return fzn_regular(graph, x, Q, S, std::move(d), q0, F);
+  }
+  FZN_CONSTRAINT_TYPE_CHECK(constraint, 6, fznparser::BoolArg, true)
+  return fzn_regular(
+      graph, x, Q, S, std::move(d), q0, F,
+      std::get<fznparser::BoolArg>(constraint.arguments().at(6)));
+}
+
+}  // namespace atlantis::invariantgraph::fzn
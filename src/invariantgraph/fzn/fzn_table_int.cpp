@@ -0,0 +1,63 @@
+#include "atlantis/invariantgraph/fzn/fzn_table_int.hpp"
+
+#include "../parseHelper.hpp"
+#include "./fznHelper.hpp"
+#include "atlantis/invariantgraph/violationInvariantNodes/tableNode.hpp"
+
+namespace atlantis::invariantgraph::fzn {
+
+static void verifyTableSize(const std::shared_ptr<fznparser::IntVarArray>& x,
+                            const std::vector<Int>& t) {
+  if (x->size() == 0 ? !t.empty() : t.size() % x->size() != 0) {
+    throw FznArgumentException(
+        "Constraint fzn_table_int the number of elements in the table must be "
+        "a multiple of the number of variables.");
+  }
+}
+
+bool fzn_table_int(FznInvariantGraph& graph,
+                   const std::shared_ptr<fznparser::IntVarArray>& x,
+                   std::vector<Int>&& t) {
+  verifyTableSize(x, t);
+  graph.addInvariantNode(std::make_shared<TableNode>(
+      graph, graph.retrieveVarNodes(x), std::move(t)));
+  return true;
+}
+
+bool fzn_table_int(FznInvariantGraph& graph,
+                   const std::shared_ptr<fznparser::IntVarArray>& x,
+                   std::vector<Int>&& t, const fznparser::BoolArg& reified) {
+  verifyTableSize(x, t);
+  graph.addInvariantNode(std::make_shared<TableNode>(
+      graph, graph.retrieveVarNodes(x), std::move(t),
+      graph.retrieveVarNode(reified)));
+  return true;
+}
+
+bool fzn_table_int(FznInvariantGraph& graph,
+                   const fznparser::Constraint& constraint) {
+  if (constraint.identifier() != "fzn_table_int" &&
+      constraint.identifier() != "fzn_table_int_reif") {
+    return false;
+  }
+
+  const bool isReified = constraintIdentifierIsReified(constraint);
+  verifyNumArguments(constraint, isReified ? 3 : 2);
+  FZN_CONSTRAINT_ARRAY_TYPE_CHECK(constraint, 0, fznparser::IntVarArray, true)
+  FZN_CONSTRAINT_ARRAY_TYPE_CHECK(constraint, 1, fznparser::IntVarArray, false)
+  std::vector<Int> t =
+      getArgArray<fznparser::IntVarArray>(constraint.arguments().at(1))
+          ->toParVector();
+  if (!isReified) {
+    return fzn_table_int(
+        graph,
+        getArgArray<fznparser::IntVarArray>(constraint.arguments().at(0)),
+        std::move(t));
+  }
+  FZN_CONSTRAINT_TYPE_CHECK(constraint, 2, fznparser::BoolArg, true)
+  return fzn_table_int(
+      graph, getArgArray<fznparser::IntVarArray>(constraint.arguments().at(0)),
+      std::move(t), std::get<fznparser::BoolArg>(constraint.arguments().at(2)));
+}
+
+}  // namespace atlantis::invariantgraph::fzn
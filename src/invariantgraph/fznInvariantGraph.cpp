@@ -36,10 +36,14 @@
 #include "atlantis/invariantgraph/fzn/fzn_count_leq.hpp"
 #include "atlantis/invariantgraph/fzn/fzn_count_lt.hpp"
 #include "atlantis/invariantgraph/fzn/fzn_count_neq.hpp"
+#include "atlantis/invariantgraph/fzn/fzn_cumulative.hpp"
 #include "atlantis/invariantgraph/fzn/fzn_global_cardinality.hpp"
 #include "atlantis/invariantgraph/fzn/fzn_global_cardinality_closed.hpp"
 #include "atlantis/invariantgraph/fzn/fzn_global_cardinality_low_up.hpp"
 #include "atlantis/invariantgraph/fzn/fzn_global_cardinality_low_up_closed.hpp"
+#include "atlantis/invariantgraph/fzn/fzn_inverse.hpp"
+#include "atlantis/invariantgraph/fzn/fzn_regular.hpp"
+#include "atlantis/invariantgraph/fzn/fzn_table_int.hpp"
 #include "atlantis/invariantgraph/fzn/int_abs.hpp"
 #include "atlantis/invariantgraph/fzn/int_div.hpp"
 #include "atlantis/invariantgraph/fzn/int_eq.hpp"
@@ -460,10 +464,14 @@ bool FznInvariantGraph::makeViolationInvariantNode(
   MAKE_VIOLATION_INVARIANT(fzn::fzn_count_leq)
   MAKE_VIOLATION_INVARIANT(fzn::fzn_count_lt)
   MAKE_VIOLATION_INVARIANT(fzn::fzn_count_neq)
+  MAKE_VIOLATION_INVARIANT(fzn::fzn_cumulative)
   MAKE_VIOLATION_INVARIANT(fzn::fzn_global_cardinality)
   MAKE_VIOLATION_INVARIANT(fzn::fzn_global_cardinality_closed)
   MAKE_VIOLATION_INVARIANT(fzn::fzn_global_cardinality_low_up)
   MAKE_VIOLATION_INVARIANT(fzn::fzn_global_cardinality_low_up_closed)
+  MAKE_VIOLATION_INVARIANT(fzn::fzn_inverse)
+  MAKE_VIOLATION_INVARIANT(fzn::fzn_regular)
+  MAKE_VIOLATION_INVARIANT(fzn::fzn_table_int)
   MAKE_VIOLATION_INVARIANT(fzn::int_eq)
   MAKE_VIOLATION_INVARIANT(fzn::int_le)
   MAKE_VIOLATION_INVARIANT(fzn::int_lin_eq)
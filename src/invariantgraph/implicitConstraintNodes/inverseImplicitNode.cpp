@@ -0,0 +1,79 @@
+#include "atlantis/invariantgraph/implicitConstraintNodes/inverseImplicitNode.hpp"
+
+#include "../parseHelper.hpp"
+#include "atlantis/invariantgraph/iInvariantGraph.hpp"
+#include "atlantis/search/neighbourhoods/inverseNeighbourhood.hpp"
+
+namespace atlantis::invariantgraph {
+
+InverseImplicitNode::InverseImplicitNode(IInvariantGraph& graph,
+                                         std::vector<VarNodeId>&& f,
+                                         Int fOffset,
+                                         std::vector<VarNodeId>&& invf,
+                                         Int invfOffset)
+    : ImplicitConstraintNode(graph, concat(f, invf)),
+      _numVars(f.size()),
+      _fOffset(fOffset),
+      _invfOffset(invfOffset) {
+  assert(f.size() == invf.size());
+}
+
+void InverseImplicitNode::init(InvariantNodeId id) {
+  ImplicitConstraintNode::init(id);
+  assert(outputVarNodeIds().size() == 2 * _numVars);
+  assert(
+      std::all_of(outputVarNodeIds().begin(), outputVarNodeIds().end(),
+                  [&](const VarNodeId vId) {
+                    return invariantGraphConst().varNodeConst(vId).isIntVar();
+                  }));
+}
+
+std::shared_ptr<search::neighbourhoods::Neighbourhood>
+InverseImplicitNode::createNeighbourhood() {
+  // The values that the free variables of f (respectively invf) can take are
+  // the indices of the free variables of invf (respectively f):
+  std::vector<Int> freeFValues;
+  std::vector<Int> freeInvfValues;
+  for (size_t k = 0; k < _numVars; ++k) {
+    if (!invariantGraphConst().varNodeConst(outputVarNodeIds()[k]).isFixed()) {
+      freeInvfValues.emplace_back(static_cast<Int>(k) + _fOffset);
+    }
+    if (!invariantGraphConst()
+             .varNodeConst(outputVarNodeIds()[_numVars + k])
+             .isFixed()) {
+      freeFValues.emplace_back(static_cast<Int>(k) + _invfOffset);
+    }
+  }
+
+  std::vector<search::SearchVar> searchVars;
+  searchVars.reserve(outputVarNodeIds().size());
+  for (size_t i = 0; i < outputVarNodeIds().size(); ++i) {
+    auto& varNode = invariantGraph().varNode(outputVarNodeIds()[i]);
+    assert(varNode.varId() != propagation::NULL_ID);
+    if (varNode.constDomain().isFixed()) {
+      const Int val = varNode.constDomain().lowerBound();
+      searchVars.emplace_back(varNode.varId(), SearchDomain{val, val});
+      varNode.setDomainType(VarNode::DomainType::NONE);
+      continue;
+    }
+    const bool isF = i < _numVars;
+    const Int lb = isF ? _invfOffset : _fOffset;
+    searchVars.emplace_back(
+        varNode.varId(),
+        SearchDomain{lb, lb + static_cast<Int>(_numVars) - 1});
+
+    const std::vector<Int>& freeValues = isF ? freeFValues : freeInvfValues;
+    const bool enforceDomain =
+        std::any_of(freeValues.begin(), freeValues.end(), [&](const Int val) {
+          return !varNode.constDomain().contains(val);
+        });
+    varNode.setDomainType(enforceDomain ? VarNode::DomainType::DOMAIN
+                                        : VarNode::DomainType::NONE);
+  }
+  return std::make_shared<search::neighbourhoods::InverseNeighbourhood>(
+      std::move(searchVars), _fOffset, _invfOffset);
+}
+
+std::string InverseImplicitNode::dotLangIdentifier() const { return "inverse"; }
+
+}  // namespace atlantis::invariantgraph
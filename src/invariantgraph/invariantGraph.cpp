@@ -1,6 +1,7 @@
 #include "atlantis/invariantgraph/invariantGraph.hpp"
 
 #include <deque>
+#include <numeric>
 #include <queue>
 #include <stack>
 #include <unordered_map>
@@ -13,6 +14,7 @@
 #include "atlantis/invariantgraph/violationInvariantNodes/intAllEqualNode.hpp"
 #include "atlantis/propagation/invariants/linear.hpp"
 #include "atlantis/utils/fznAst.hpp"
+#include "atlantis/utils/stronglyConnectedComponents.hpp"
 
 namespace atlantis::invariantgraph {
 
@@ -26,6 +28,7 @@ InvariantGraph::InvariantGraph(propagation::SolverBase& solver,
       _varNodes{VarNode{VarNodeId{0}, false, SearchDomain({1})},
                 VarNode{VarNodeId{1}, false, SearchDomain({0})}},
       _namedVarNodeIndices(),
+      _varNodeForwards(),
       _intVarNodeIndices(),
       _boolVarNodeIndices{VarNodeId{0}, VarNodeId{1}},
       _invariantNodes(),
@@ -71,7 +74,7 @@ VarNodeId InvariantGraph::retrieveBoolVarNode(const std::string& identifier,
     return nId;
   }
   assert(!varNode(identifier).isIntVar());
-  return _namedVarNodeIndices.at(identifier);
+  return namedVarNodeId(identifier);
 }
 
 VarNodeId InvariantGraph::retrieveBoolVarNode(VarNode::DomainType domainType) {
@@ -138,7 +141,7 @@ VarNodeId InvariantGraph::retrieveIntVarNode(const std::string& identifier) {
     throw std::invalid_argument("Variable " + identifier +
                                 " is not an integer variable");
   }
-  return _namedVarNodeIndices.at(identifier);
+  return namedVarNodeId(identifier);
 }
 
 VarNodeId InvariantGraph::retrieveIntVarNode(Int i,
@@ -147,7 +150,7 @@ VarNodeId InvariantGraph::retrieveIntVarNode(Int i,
   if (!containsVarNode(identifier)) {
     _namedVarNodeIndices.emplace(identifier, inputVarNodeId);
   }
-  return _namedVarNodeIndices.at(identifier);
+  return namedVarNodeId(identifier);
 }
 
 VarNodeId InvariantGraph::retrieveIntVarNode(SearchDomain&& domain,
@@ -180,8 +183,8 @@ VarNodeId InvariantGraph::retrieveIntVarNode(SearchDomain&& domain,
 
 VarNode& InvariantGraph::varNode(const std::string& identifier) {
   assert(_namedVarNodeIndices.contains(identifier));
-  assert(size_t(_namedVarNodeIndices.at(identifier)) < _varNodes.size());
-  return _varNodes.at(size_t(_namedVarNodeIndices.at(identifier)));
+  assert(namedVarNodeId(identifier) < _varNodes.size());
+  return _varNodes.at(namedVarNodeId(identifier));
 }
 
 VarNode& InvariantGraph::varNode(VarNodeId id) {
@@ -263,8 +266,8 @@ void InvariantGraph::replaceFixedVars() {
 const VarNode& InvariantGraph::varNodeConst(
     const std::string& identifier) const {
   assert(_namedVarNodeIndices.contains(identifier));
-  assert(size_t(_namedVarNodeIndices.at(identifier)) < _varNodes.size());
-  return _varNodes.at(size_t(_namedVarNodeIndices.at(identifier)));
+  assert(namedVarNodeId(identifier) < _varNodes.size());
+  return _varNodes.at(namedVarNodeId(identifier));
 }
 
 const VarNode& InvariantGraph::varNodeConst(VarNodeId id) const {
@@ -276,7 +279,7 @@ VarNodeId InvariantGraph::varNodeId(const std::string& identifier) const {
   if (!containsVarNode(identifier)) {
     return VarNodeId{NULL_NODE_ID};
   }
-  return _namedVarNodeIndices.at(identifier);
+  return namedVarNodeId(identifier);
 }
 
 VarNodeId InvariantGraph::varNodeId(bool val) const {
@@ -295,7 +298,7 @@ VarNodeId InvariantGraph::varNodeId(Int val) const {
 
 propagation::VarViewId InvariantGraph::varId(
     const std::string& identifier) const {
-  return _varNodes.at(size_t(_namedVarNodeIndices.at(identifier))).varId();
+  return _varNodes.at(namedVarNodeId(identifier)).varId();
 }
 
 propagation::VarViewId InvariantGraph::varId(VarNodeId id) const {
@@ -425,11 +428,36 @@ void InvariantGraph::replaceVarNode(VarNodeId oldNodeId, VarNodeId newNodeId) {
       }
     }
   }
-  for (auto& [identifier, id] : _namedVarNodeIndices) {
-    if (id == oldNodeId) {
-      id = newNodeId;
+  // Forward the old node to the new node, instead of rewriting the
+  // identifiers of the old node:
+  if (_varNodeForwards.size() < _varNodes.size()) {
+    const size_t oldSize = _varNodeForwards.size();
+    _varNodeForwards.resize(_varNodes.size());
+    std::iota(_varNodeForwards.begin() + oldSize, _varNodeForwards.end(),
+              oldSize);
+  }
+  if (resolveVarNodeId(newNodeId) == oldNodeId) {
+    // The new node was (directly or indirectly) replaced by the old node:
+    _varNodeForwards[newNodeId] = newNodeId;
+  }
+  _varNodeForwards[oldNodeId] = newNodeId;
+}
+
+VarNodeId InvariantGraph::resolveVarNodeId(VarNodeId id) const {
+  // Follow the forwards, where every other forward on the way is shortcut
+  // (path halving):
+  while (id < _varNodeForwards.size() && _varNodeForwards[id] != id) {
+    const VarNodeId next = _varNodeForwards[id];
+    if (next < _varNodeForwards.size()) {
+      _varNodeForwards[id] = _varNodeForwards[next];
     }
+    id = _varNodeForwards[id];
   }
+  return id;
+}
+
+VarNodeId InvariantGraph::namedVarNodeId(const std::string& identifier) const {
+  return resolveVarNodeId(_namedVarNodeIndices.at(identifier));
 }
 
 InvariantNodeId InvariantGraph::addImplicitConstraintNode(
@@ -623,7 +651,7 @@ InvariantGraphEdge InvariantGraph::findPivotInCycle(
     if (!vNode.isIntVar() || vNode.constDomain().size() < minDomainSize) {
       minDomainSize = !vNode.isIntVar() ? 2 : vNode.constDomain().size();
       pivot = vNode.varNodeId();
-      const size_t listeningInvIndex = i + 1 % cycle.size();
+      const size_t listeningInvIndex = (i + 1) % cycle.size();
       listeningInvNodeId = cycle[listeningInvIndex].invariantNodeId;
       assert(
           std::any_of(
@@ -643,146 +671,115 @@ InvariantGraphEdge InvariantGraph::findPivotInCycle(
   return InvariantGraphEdge{listeningInvNodeId, pivot};
 }
 
-VarNodeId InvariantGraph::breakCycle(
-    const std::vector<InvariantGraphEdge>& cycle) {
-  // Each edge (v, i) is from a variable v to an invariant that v is a static
-  // input variable to
-  const auto [listeningInvariant, pivot] = findPivotInCycle(cycle);
-
+void InvariantGraph::breakCycle(InvariantNodeId listeningInvNodeId,
+                                VarNodeId pivot) {
   assert(pivot != NULL_NODE_ID);
-  assert(listeningInvariant != NULL_NODE_ID);
+  assert(listeningInvNodeId != NULL_NODE_ID);
 
   // Dont create a VarNode& reference to pivot, since the _varNodes vector is
   // modified, this reference could be invalidated!
   assert(!varNodeConst(pivot).isFixed());
 
-  VarNode& newInputNode =
-      _varNodes.emplace_back(nextVarNodeId(), varNodeConst(pivot).isIntVar(),
-                             SearchDomain(varNodeConst(pivot).lowerBound(),
-                                          varNodeConst(pivot).upperBound()),
-                             VarNode::DomainType::NONE);
-
-  invariantNode(listeningInvariant)
-      .replaceStaticInputVarNode(pivot, newInputNode.varNodeId());
+  const VarNodeId newInputVarNodeId =
+      _varNodes
+          .emplace_back(nextVarNodeId(), varNodeConst(pivot).isIntVar(),
+                        SearchDomain(varNodeConst(pivot).lowerBound(),
+                                     varNodeConst(pivot).upperBound()),
+                        VarNode::DomainType::NONE)
+          .varNodeId();
+
+  IInvariantNode& listeningInvNode = invariantNode(listeningInvNodeId);
+  // The pivot is a dynamic input if the cycle is dynamic:
+  if (std::any_of(listeningInvNode.staticInputVarNodeIds().begin(),
+                  listeningInvNode.staticInputVarNodeIds().end(),
+                  [&](const VarNodeId vId) { return vId == pivot; })) {
+    listeningInvNode.replaceStaticInputVarNode(pivot, newInputVarNodeId);
+  } else {
+    listeningInvNode.replaceDynamicInputVarNode(pivot, newInputVarNodeId);
+  }
   if (varNodeConst(pivot).isIntVar()) {
     addInvariantNode(std::make_shared<IntAllEqualNode>(
-        *this, pivot, newInputNode.varNodeId(), true, true));
+        *this, pivot, newInputVarNodeId, true, true));
   } else {
     addInvariantNode(std::make_shared<BoolAllEqualNode>(
-        *this, pivot, newInputNode.varNodeId(), true, true));
+        *this, pivot, newInputVarNodeId, true, true));
   }
-  root().addSearchVarNode(newInputNode.varNodeId());
-  return newInputNode.varNodeId();
+  root().addSearchVarNode(newInputVarNodeId);
 }
 
-std::unordered_set<VarNodeId> InvariantGraph::dynamicVarNodeFrontier(
-    const VarNodeId node, const std::unordered_set<VarNodeId>& visitedGlobal) {
-  std::unordered_set<VarNodeId> visitedLocal;
-  std::unordered_set<VarNodeId> visitedDynamic;
-  std::queue<VarNodeId> q;
-  q.push(node);
-  visitedLocal.emplace(node);
-  while (!q.empty()) {
-    const auto cur = q.front();
-    q.pop();
-    // Add unvisited dynamic neighbours to set of visited dynamic variable
-    // nodes:
-    for (const auto& dynamicInvNodeId : varNode(cur).dynamicInputTo()) {
-      for (const auto& outputVarId :
-           invariantNode(dynamicInvNodeId).outputVarNodeIds()) {
-        if (!visitedGlobal.contains(outputVarId) &&
-            !visitedDynamic.contains(outputVarId)) {
-          visitedDynamic.emplace(outputVarId);
-        }
-      }
-    }
-    // add unvisited static neighbours to queue:
-    for (const auto& staticInvNodeId : varNode(cur).staticInputTo()) {
-      for (const auto& outputVarId :
-           invariantNode(staticInvNodeId).outputVarNodeIds()) {
-        if (!visitedLocal.contains(outputVarId)) {
-          visitedLocal.emplace(outputVarId);
-          q.push(outputVarId);
+namespace {
+
+/**
+ * Iterates over the edges (i, w) out of a variable node v, where v is an
+ * input to the invariant node i and w is an output of i.
+ *
+ * The iterator only holds indices (and not references), as the invariant
+ * graph is modified when cycles are broken.
+ */
+class SuccessorIterator {
+ private:
+  VarNodeId _varNodeId;
+  size_t _numInputKinds;
+  size_t _inputKind{0};
+  size_t _listeningIndex{0};
+  size_t _outputIndex{0};
+
+ public:
+  SuccessorIterator(VarNodeId varNodeId, bool includeDynamicInputs)
+      : _varNodeId(varNodeId), _numInputKinds(includeDynamicInputs ? 2 : 1) {}
+
+  [[nodiscard]] VarNodeId varNodeId() const noexcept { return _varNodeId; }
+
+  void reset() noexcept {
+    _inputKind = 0;
+    _listeningIndex = 0;
+    _outputIndex = 0;
+  }
+
+  /**
+   * @return the next edge, where the variable node of the edge is
+   * NULL_NODE_ID if there are no more edges.
+   */
+  InvariantGraphEdge next(InvariantGraph& graph) {
+    for (; _inputKind < _numInputKinds; ++_inputKind, _listeningIndex = 0) {
+      const std::vector<InvariantNodeId>& listeningInvNodeIds =
+          _inputKind == 0 ? graph.varNode(_varNodeId).staticInputTo()
+                          : graph.varNode(_varNodeId).dynamicInputTo();
+      for (; _listeningIndex < listeningInvNodeIds.size();
+           ++_listeningIndex, _outputIndex = 0) {
+        const InvariantNodeId invNodeId = listeningInvNodeIds[_listeningIndex];
+        const std::vector<VarNodeId>& outputVarNodeIds =
+            graph.invariantNode(invNodeId).outputVarNodeIds();
+        if (_outputIndex < outputVarNodeIds.size()) {
+          return InvariantGraphEdge{invNodeId,
+                                    outputVarNodeIds[_outputIndex++]};
         }
       }
     }
-  }
-  return visitedDynamic;
-}
-
-VarNodeId InvariantGraph::findCycleUtil(
-    const VarNodeId varNodeId,
-    const std::unordered_set<VarNodeId>& visitedGlobal,
-    std::unordered_set<VarNodeId>& visitedLocal,
-    std::unordered_map<VarNodeId, InvariantGraphEdge>& path) {
-  assert(!path.contains(varNodeId));
-  // The path here is a map (x, (i, y)), where the variable x is a static input
-  // to invariant i and y is an output variable of i.
-  // Note therefore that each InvariantGraphEdge is from an invariant i to a
-  // variable y that i defines.
-  if (visitedGlobal.contains(varNodeId)) {
-    assert(!path.contains(varNodeId));
-    return VarNodeId{NULL_NODE_ID};
-  }
-
-  if (visitedLocal.contains(varNodeId)) {
-    // this variable is part of a cycle, return the root node of the cycle:
-    assert(path.contains(varNodeId));
-    return path.at(varNodeId).varNodeId;
-  }
-
-  visitedLocal.emplace(varNodeId);
-  // iterate over all invariants that the variable is a static input to:
-  // TODO: we now also break dynamic cycles. this should be fixed by having a
-  // better implicit constraint/neighbourhood initialisation process when
-  // closing the propagation _solver.
-  for (size_t i = 0; i < (_breakDynamicCycles ? 2 : 1); ++i) {
-    for (const InvariantNodeId& listeningInvNodeId :
-         i == 0 ? varNode(varNodeId).staticInputTo()
-                : varNode(varNodeId).dynamicInputTo()) {
-      // iterate over all variables that the invariant defines:
-      for (const VarNodeId definedVarId :
-           invariantNode(listeningInvNodeId).outputVarNodeIds()) {
-        if (path.contains(definedVarId)) {
-          assert(visitedLocal.contains(definedVarId));
-          // this is the first variable that is in the cycle
-          // add the last edge to the path (each edge is from a defining
-          // invariant i to a variable i defines):
-          auto iter = path.find(varNodeId);
-          if (iter == path.end()) {
-            path.emplace(varNodeId,
-                         InvariantGraphEdge{listeningInvNodeId, definedVarId});
-          } else {
-            iter->second.invariantNodeId = listeningInvNodeId;
-            iter->second.varNodeId = definedVarId;
-          }
-          // return the root node of the cycle:
-          return definedVarId;
-        } else if (!visitedGlobal.contains(definedVarId) &&
-                   !visitedLocal.contains(definedVarId)) {
-          // we have not visited this variable yet, add it to the path:
-          // each edge is from a defining invariant i to a variable i defines:
-          auto iter = path.find(varNodeId);
-          if (iter == path.end()) {
-            path.emplace(varNodeId,
-                         InvariantGraphEdge{listeningInvNodeId, definedVarId});
-          } else {
-            iter->second.invariantNodeId = listeningInvNodeId;
-            iter->second.varNodeId = definedVarId;
-          }
-          const VarNodeId cycleRoot =
-              findCycleUtil(definedVarId, visitedGlobal, visitedLocal, path);
-          if (cycleRoot != NULL_NODE_ID) {
-            return cycleRoot;
-          }
-        }
-      }
-    }
-  }
-  // this variable is not part of a cycle, remove it from the path and return
-  // null:
-  path.erase(varNodeId);
-  return VarNodeId{NULL_NODE_ID};
+    return InvariantGraphEdge{InvariantNodeId(NULL_NODE_ID), NULL_NODE_ID};
+  }
+};
+
+}  // namespace
+
+std::vector<std::vector<VarNodeId>>
+InvariantGraph::stronglyConnectedComponents() {
+  std::vector<std::vector<VarNodeId>> components =
+      atlantis::stronglyConnectedComponents(
+          _varNodes.size(), [&](const VarNodeId vId, auto&& visit) {
+            SuccessorIterator successors(vId, _breakDynamicCycles);
+            for (VarNodeId wId = successors.next(*this).varNodeId;
+                 wId != NULL_NODE_ID;
+                 wId = successors.next(*this).varNodeId) {
+              visit(wId);
+            }
+          });
+  // Components of size 1 contain no cycles (self-cycles are broken in
+  // advance):
+  std::erase_if(components, [](const std::vector<VarNodeId>& component) {
+    return component.size() <= 1;
+  });
+  return components;
 }
 
 void InvariantGraph::breakSelfCycles() {
@@ -836,142 +833,90 @@ void InvariantGraph::breakSelfCycles() {
   }
 }
 
-std::vector<VarNodeId> InvariantGraph::breakCycles(
-    VarNodeId node, std::unordered_set<VarNodeId>& visitedGlobal) {
-  std::unordered_map<VarNodeId, InvariantGraphEdge> path;
-  // The path here is a map (x, (i, y)), where the variable x is a static input
-  // to invariant i and y is an output variable of i.
-  // Note therefore that each InvariantGraphEdge is from an invariant i to a
-  // variable y that i defines.
-  std::unordered_set<VarNodeId> visitedLocal;
-  VarNodeId cycleRoot;
-  std::vector<VarNodeId> newSearchNodes;
-  do {
-    path.clear();
-    visitedLocal.clear();
-    cycleRoot = findCycleUtil(node, visitedGlobal, visitedLocal, path);
-    assert(std::all_of(path.begin(), path.end(), [&](const auto& pair) {
-      const VarNode& inputVar = varNodeConst(pair.first);
-      IInvariantNode& inv = invariantNode(pair.second.invariantNodeId);
-      const VarNode& outputVar = varNodeConst(pair.second.varNodeId);
-
-      const bool isStaticInput = std::any_of(
-          inputVar.staticInputTo().begin(), inputVar.staticInputTo().end(),
-          [&](const InvariantNodeId& invNodeId) {
-            return invNodeId == inv.id();
-          });
-      const bool isDynamicInput =
-          _breakDynamicCycles &&
-          std::any_of(inputVar.dynamicInputTo().begin(),
-                      inputVar.dynamicInputTo().end(),
-                      [&](const InvariantNodeId& invNodeId) {
-                        return invNodeId == inv.id();
-                      });
-      const bool isOutput = std::any_of(outputVar.definingNodes().begin(),
-                                        outputVar.definingNodes().end(),
-                                        [&](const InvariantNodeId& invNodeId) {
-                                          return invNodeId == inv.id();
-                                        });
-      const bool hasStaticInput = std::any_of(
-          inv.staticInputVarNodeIds().begin(),
-          inv.staticInputVarNodeIds().end(), [&](const VarNodeId varNodeId) {
-            return varNodeId == inputVar.varNodeId();
-          });
-      const bool hasDynamicInput =
-          _breakDynamicCycles &&
-          std::any_of(inv.dynamicInputVarNodeIds().begin(),
-                      inv.dynamicInputVarNodeIds().end(),
-                      [&](const VarNodeId varNodeId) {
-                        return varNodeId == inputVar.varNodeId();
-                      });
-      const bool hasOutput = std::any_of(
-          inv.outputVarNodeIds().begin(), inv.outputVarNodeIds().end(),
-          [&](const VarNodeId varNodeId) {
-            return varNodeId == outputVar.varNodeId();
-          });
-      assert(isStaticInput || isDynamicInput);
-      assert(isOutput);
-      assert(hasStaticInput || hasDynamicInput);
-      assert(hasOutput);
-
-      assert(isStaticInput == hasStaticInput);
-      assert(isDynamicInput == hasDynamicInput);
-
-      return (isStaticInput || isDynamicInput) && isOutput &&
-             (hasStaticInput || hasDynamicInput) && hasOutput;
-    }));
-
-    if (cycleRoot != NULL_NODE_ID) {
-      // Each edge (i, v) in cycle is from a defining invariant i to the
-      // variable v that i defines:
-      std::vector<InvariantGraphEdge> cycle;
-      VarNodeId cur = cycleRoot;
-      while (cycle.empty() || cur != cycleRoot) {
-        assert(path.contains(cur));
-        cycle.emplace_back(InvariantGraphEdge{path.at(cur)});
-        cur = path.at(cur).varNodeId;
+void InvariantGraph::breakCycles(const std::vector<VarNodeId>& component,
+                                 const std::vector<size_t>& localIndex) {
+  // Depth-first search within the component, where each cycle is broken as
+  // soon as it is found. The search then backtracks to the pivot of the
+  // cycle (whose edge out of the cycle was removed) and continues from
+  // there, instead of restarting from scratch.
+  constexpr size_t NOT_ON_PATH = ~size_t{0};
+  const auto isMember = [&](const VarNodeId vId) {
+    assert(vId < localIndex.size());
+    return localIndex[vId] < component.size() &&
+           component[localIndex[vId]] == vId;
+  };
+  // pathIndex[localIndex[v]] is the position of v on the path:
+  std::vector<size_t> pathIndex(component.size(), NOT_ON_PATH);
+  std::vector<bool> done(component.size(), false);
+  std::vector<SuccessorIterator> path;
+  // pathEdges[k] is the edge (i, v) from the invariant node i that path[k] is
+  // an input to, to the variable v = path[k + 1] that i defines:
+  std::vector<InvariantGraphEdge> pathEdges;
+
+  for (const VarNodeId rootId : component) {
+    if (done[localIndex[rootId]]) {
+      continue;
+    }
+    pathIndex[localIndex[rootId]] = 0;
+    path.emplace_back(rootId, _breakDynamicCycles);
+    while (!path.empty()) {
+      const InvariantGraphEdge edge = path.back().next(*this);
+      if (edge.varNodeId == NULL_NODE_ID) {
+        const size_t i = localIndex[path.back().varNodeId()];
+        pathIndex[i] = NOT_ON_PATH;
+        done[i] = true;
+        path.pop_back();
+        if (!pathEdges.empty()) {
+          pathEdges.pop_back();
+        }
+        continue;
+      }
+      if (!isMember(edge.varNodeId) || done[localIndex[edge.varNodeId]]) {
+        continue;
+      }
+      const size_t start = pathIndex[localIndex[edge.varNodeId]];
+      if (start == NOT_ON_PATH) {
+        pathIndex[localIndex[edge.varNodeId]] = path.size();
+        pathEdges.emplace_back(edge);
+        path.emplace_back(edge.varNodeId, _breakDynamicCycles);
+        continue;
       }
-      assert(path.contains(cur));
-      newSearchNodes.emplace_back(breakCycle(cycle));
-      assert(newSearchNodes.back() != NULL_NODE_ID);
+      // The edge closes the cycle path[start], ..., path.back(), where each
+      // edge (i, v) in cycle is from a defining invariant i to the variable v
+      // that i defines:
+      assert(start + 1 < path.size());
+      std::vector<InvariantGraphEdge> cycle(pathEdges.begin() + start,
+                                            pathEdges.end());
+      cycle.emplace_back(edge);
+      const auto [listeningInvNodeId, pivot] = findPivotInCycle(cycle);
+      breakCycle(listeningInvNodeId, pivot);
+
+      const size_t pivotIndex = pathIndex[localIndex[pivot]];
+      assert(start <= pivotIndex && pivotIndex < path.size());
+      while (path.size() > pivotIndex + 1) {
+        pathIndex[localIndex[path.back().varNodeId()]] = NOT_ON_PATH;
+        path.pop_back();
+        pathEdges.pop_back();
+      }
+      // The pivot is no longer an input to the listening invariant node,
+      // which shifts the edges out of the pivot:
+      path.back().reset();
     }
-  } while (cycleRoot != NULL_NODE_ID);
-
-  // add the visited nodes to the global set of visited nodes
-  for (const auto& visitedNodeId : visitedLocal) {
-    assert(!visitedGlobal.contains(visitedNodeId));
-    visitedGlobal.emplace(visitedNodeId);
   }
-  return newSearchNodes;
 }
 
 void InvariantGraph::breakCycles() {
-  std::unordered_set<VarNodeId> visitedGlobal;
-  std::queue<VarNodeId> searchNodeIds;
-
-  for (auto const& implicitConstraint : _implicitConstraintNodes) {
-    for (const auto& searchVarId : implicitConstraint->outputVarNodeIds()) {
-      searchNodeIds.emplace(searchVarId);
-    }
-  }
-
-  for (const VarNode& vNode : _varNodes) {
-    if (vNode.definingNodes().empty() &&
-        (!vNode.staticInputTo().empty() || !vNode.dynamicInputTo().empty())) {
-      assert(vNode.isFixed());
-      assert((vNode.isIntVar() &&
-              varNodeId(vNode.lowerBound()) == vNode.varNodeId()) ||
-             (!vNode.isIntVar() &&
-              varNodeId(vNode.inDomain(bool{true})) == vNode.varNodeId()));
-      searchNodeIds.emplace(vNode.varNodeId());
+  const std::vector<std::vector<VarNodeId>> components =
+      stronglyConnectedComponents();
+  // localIndex[v] is the index of v in its component:
+  std::vector<size_t> localIndex(_varNodes.size(), NULL_NODE_ID);
+  for (const auto& component : components) {
+    for (size_t i = 0; i < component.size(); ++i) {
+      localIndex[component[i]] = i;
     }
   }
-
-  while (!searchNodeIds.empty()) {
-    std::vector<VarNodeId> visitedSearchNodes;
-    while (!searchNodeIds.empty()) {
-      VarNodeId searchNodeId = searchNodeIds.front();
-      searchNodeIds.pop();
-      visitedSearchNodes.emplace_back(searchNodeId);
-      for (auto newSearchNodeId : breakCycles(searchNodeId, visitedGlobal)) {
-        searchNodeIds.emplace(newSearchNodeId);
-        assert(varNode(newSearchNodeId).outputOf() == root().id());
-      }
-    }
-    // If some part of the invariant graph is unreachable if not traversing
-    // dynamic inputs of dynamic invariants, then add those dynamic inputs to
-    // the set of search nodes:
-    std::unordered_set<VarNodeId> dynamicSearchNodeIds;
-    for (auto searchNodeId : visitedSearchNodes) {
-      for (auto dynamicVarNodeId :
-           dynamicVarNodeFrontier(searchNodeId, visitedGlobal)) {
-        assert(!visitedGlobal.contains(dynamicVarNodeId));
-        if (!dynamicSearchNodeIds.contains(dynamicVarNodeId)) {
-          searchNodeIds.emplace(dynamicVarNodeId);
-          dynamicSearchNodeIds.emplace(dynamicVarNodeId);
-        }
-      }
-    }
+  for (const auto& component : components) {
+    breakCycles(component, localIndex);
   }
 }
 
@@ -1114,6 +1059,7 @@ void InvariantGraph::createImplicitConstraints() {
                            return varId(varNodeId) != propagation::NULL_ID;
                          }));
       implicitConstraintNode->registerNode();
+      nameNewInvariants(implicitConstraintNode->dotLangIdentifier());
     }
   }
 }
@@ -1127,6 +1073,7 @@ void InvariantGraph::createInvariants() {
                            return varId(varNodeId) != propagation::NULL_ID;
                          }));
       invariantNode->registerNode();
+      nameNewInvariants(invariantNode->dotLangIdentifier());
     }
   }
 }
@@ -1149,6 +1096,7 @@ propagation::VarViewId InvariantGraph::createViolations() {
       }
     }
   }
+  nameNewInvariants("domain");
   if (violations.empty()) {
     return propagation::NULL_ID;
   }
@@ -1158,29 +1106,59 @@ propagation::VarViewId InvariantGraph::createViolations() {
   const propagation::VarViewId totalViolation = _solver.makeIntVar(0, 0, 0);
   _solver.makeInvariant<propagation::Linear>(_solver, totalViolation,
                                              std::move(violations));
+  nameNewInvariants("total_violation");
   return totalViolation;
 }
 
+void InvariantGraph::nameNewInvariants(const std::string& constraintName) {
+  _invariantConstraintNames.resize(_solver.store().numInvariants(),
+                                   constraintName);
+}
+
+const std::vector<std::string>& InvariantGraph::invariantConstraintNames()
+    const {
+  return _invariantConstraintNames;
+}
+
 void InvariantGraph::construct() {
+  logging::Logger logger(stderr, logging::Level::LVL_ERROR);
+  construct(logger);
+}
+
+void InvariantGraph::construct(logging::Logger& logger) {
+  using logging::Level;
   sanity(false);
-  replaceInvariantNodes();
+  logger.timedProcedure(Level::LVL_DEBUG, "replacing invariant nodes",
+                        [&] { replaceInvariantNodes(); });
   sanity(false);
-  replaceFixedVars();
+  logger.timedProcedure(Level::LVL_DEBUG, "replacing fixed variables",
+                        [&] { replaceFixedVars(); });
   sanity(false);
-  populateRootNode();
+  logger.timedProcedure(Level::LVL_DEBUG, "populating the root node",
+                        [&] { populateRootNode(); });
   sanity(false);
-  splitMultiDefinedVars();
+  logger.timedProcedure(Level::LVL_DEBUG, "splitting multi-defined variables",
+                        [&] { splitMultiDefinedVars(); });
   sanity(true);
-  breakSelfCycles();
+  logger.timedProcedure(Level::LVL_DEBUG, "breaking self-cycles",
+                        [&] { breakSelfCycles(); });
   sanity(true);
-  breakCycles();
+  logger.timedProcedure(Level::LVL_DEBUG, "breaking cycles",
+                        [&] { breakCycles(); });
   sanity(true);
   _solver.open();
-  createVars();
-  createImplicitConstraints();
-  createInvariants();
-  _solver.computeBounds();
-  _totalViolationVarId = createViolations();
+  logger.timedProcedure(Level::LVL_DEBUG, "creating variables", [&] {
+    createVars();
+    nameNewInvariants("");
+  });
+  logger.timedProcedure(Level::LVL_DEBUG, "creating implicit constraints",
+                        [&] { createImplicitConstraints(); });
+  logger.timedProcedure(Level::LVL_DEBUG, "creating invariants",
+                        [&] { createInvariants(); });
+  logger.timedProcedure(Level::LVL_DEBUG, "computing bounds",
+                        [&] { _solver.computeBounds(); });
+  logger.timedProcedure(Level::LVL_DEBUG, "creating violations",
+                        [&] { _totalViolationVarId = createViolations(); });
   if (_totalViolationVarId == propagation::NULL_ID ||
       _objectiveVarNodeId == NULL_NODE_ID) {
     auto& trueBoolVarNode = varNode(varNodeId(true));
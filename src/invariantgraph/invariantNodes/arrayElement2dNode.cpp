@@ -6,15 +6,13 @@
 
 namespace atlantis::invariantgraph {
 
-static std::vector<std::vector<Int>> toIntMatrix(
-    std::vector<std::vector<bool>>&& boolMatrix) {
-  std::vector<std::vector<Int>> intMatrix;
-  intMatrix.reserve(boolMatrix.size());
-  for (auto& row : boolMatrix) {
-    intMatrix.emplace_back();
-    intMatrix.back().reserve(row.size());
-    for (bool par : row) {
-      intMatrix.back().emplace_back(par ? 0 : 1);
+static Matrix<Int> toIntMatrix(std::vector<std::vector<bool>>&& boolMatrix) {
+  Matrix<Int> intMatrix(boolMatrix.size(),
+                        boolMatrix.empty() ? 0 : boolMatrix.front().size(), 0);
+  for (size_t r = 0; r < intMatrix.numRows(); ++r) {
+    assert(boolMatrix[r].size() == intMatrix.numCols());
+    for (size_t c = 0; c < intMatrix.numCols(); ++c) {
+      intMatrix(r, c) = boolMatrix[r][c] ? 0 : 1;
     }
   }
   return intMatrix;
@@ -22,8 +20,7 @@ static std::vector<std::vector<Int>> toIntMatrix(
 
 ArrayElement2dNode::ArrayElement2dNode(
     IInvariantGraph& graph, VarNodeId idx1, VarNodeId idx2,
-    std::vector<std::vector<Int>>&& parMatrix, VarNodeId output, Int offset1,
-    Int offset2)
+    Matrix<Int>&& parMatrix, VarNodeId output, Int offset1, Int offset2)
     : InvariantNode(graph, {output}, {idx1, idx2}),
       _parMatrix(std::move(parMatrix)),
       _offset1(offset1),
@@ -52,12 +49,13 @@ void ArrayElement2dNode::updateState() {
   const auto& idx2Node = invariantGraphConst().varNodeConst(idx2());
   if (idx1Node.isFixed() && idx2Node.isFixed()) {
     auto& outputNode = invariantGraph().varNode(outputVarNodeIds().front());
+    const Int par = _parMatrix.at(
+        static_cast<size_t>(idx1Node.lowerBound() - _offset1),
+        static_cast<size_t>(idx2Node.lowerBound() - _offset2));
     if (outputNode.isIntVar()) {
-      outputNode.fixToValue(_parMatrix.at(idx1Node.lowerBound() - _offset1)
-                                .at(idx2Node.lowerBound() - _offset2));
+      outputNode.fixToValue(par);
     } else {
-      outputNode.fixToValue(_parMatrix.at(idx1Node.lowerBound() - _offset1)
-                                .at(idx2Node.lowerBound() - _offset2) == 0);
+      outputNode.fixToValue(par == 0);
     }
     setState(InvariantNodeState::SUBSUMED);
   }
@@ -77,10 +75,11 @@ bool ArrayElement2dNode::replace() {
     const Int rowIndex =
         invariantGraph().varNode(idx1()).lowerBound() - _offset1;
     assert(rowIndex >= 0);
-    assert(rowIndex < static_cast<Int>(_parMatrix.size()));
+    assert(rowIndex < static_cast<Int>(_parMatrix.numRows()));
+    const auto row = _parMatrix.row(static_cast<size_t>(rowIndex));
 
     invariantGraph().addInvariantNode(std::make_shared<ArrayElementNode>(
-        invariantGraph(), std::move(_parMatrix.at(rowIndex)), idx2(),
+        invariantGraph(), std::vector<Int>(row.begin(), row.end()), idx2(),
         outputVarNodeIds().front(), _offset2, _isIntMatrix));
     _parMatrix.clear();
     return true;
@@ -88,10 +87,10 @@ bool ArrayElement2dNode::replace() {
   std::vector<Int> parMatrixRow;
   const Int colIndex = invariantGraph().varNode(idx2()).lowerBound() - _offset2;
   assert(colIndex >= 0);
-  assert(colIndex < static_cast<Int>(_parMatrix.front().size()));
-  parMatrixRow.reserve(_parMatrix.size());
-  for (const std::vector<Int>& row : _parMatrix) {
-    parMatrixRow.emplace_back(row.at(colIndex));
+  assert(colIndex < static_cast<Int>(_parMatrix.numCols()));
+  parMatrixRow.reserve(_parMatrix.numRows());
+  for (size_t r = 0; r < _parMatrix.numRows(); ++r) {
+    parMatrixRow.emplace_back(_parMatrix(r, static_cast<size_t>(colIndex)));
   }
   _parMatrix.clear();
   invariantGraph().addInvariantNode(std::make_shared<ArrayElementNode>(
@@ -122,7 +121,7 @@ void ArrayElement2dNode::registerNode() {
   solver().makeInvariant<propagation::Element2dConst>(
       solver(), invariantGraph().varId(outputVarNodeIds().front()),
       invariantGraph().varId(idx1()), invariantGraph().varId(idx2()),
-      std::vector<std::vector<Int>>(_parMatrix), _offset1, _offset2);
+      Matrix<Int>(_parMatrix), _offset1, _offset2);
 }
 
 std::string ArrayElement2dNode::dotLangIdentifier() const {
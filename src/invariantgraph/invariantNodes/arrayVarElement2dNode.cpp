@@ -56,9 +56,8 @@ VarNodeId ArrayVarElement2dNode::at(Int row, Int col) {
   const size_t r = static_cast<size_t>(row - _offset1);
   assert(r < _numRows);
   const size_t c = static_cast<size_t>(col - _offset2);
-  assert(col >= 0);
-  const size_t pos = r * _numRows + c;
-  return dynamicInputVarNodeIds().at(pos);
+  assert(c < numCols());
+  return dynamicInputVarNodeIds().at(r * numCols() + c);
 }
 
 void ArrayVarElement2dNode::updateState() {
@@ -86,8 +85,8 @@ void ArrayVarElement2dNode::updateState() {
       const size_t r = static_cast<size_t>(row - _offset1);
       assert(r < _numRows);
       const size_t c = static_cast<size_t>(col - _offset2);
-      assert(col >= 0);
-      const size_t pos = r * _numRows + c;
+      assert(c < numCols());
+      const size_t pos = r * numCols() + c;
       if (invariantGraph()
               .varNodeConst(_dynamicInputVarNodeIds.at(pos))
               .isFixed()) {
@@ -156,41 +155,36 @@ bool ArrayVarElement2dNode::replace() {
     const VarNodeId input = at(idx1Node.lowerBound(), idx2Node.lowerBound());
     invariantGraph().replaceVarNode(outputVarNodeIds().front(), input);
   } else if (idx1Node.isFixed()) {
-    std::vector<VarNodeId> column;
-    column.reserve(_numRows);
-    for (Int i = 0; i < static_cast<Int>(_numRows); ++i) {
-      column.emplace_back(at(idx1Node.lowerBound(), i + _offset2));
+    // The row is fixed, so the output is an element of the row:
+    std::vector<VarNodeId> row;
+    row.reserve(numCols());
+    for (Int i = 0; i < static_cast<Int>(numCols()); ++i) {
+      row.emplace_back(at(idx1Node.lowerBound(), i + _offset2));
     }
     invariantGraph().addInvariantNode(std::make_shared<ArrayVarElementNode>(
-        invariantGraph(), idx2(), std::move(column), outputVarNodeIds().front(),
+        invariantGraph(), idx2(), std::move(row), outputVarNodeIds().front(),
         _offset2));
   } else {
     assert(idx2Node.isFixed());
-    const Int numCols = dynamicInputVarNodeIds().size() / _numRows;
-    std::vector<VarNodeId> row;
-    row.reserve(numCols);
-    for (Int i = 0; i < numCols; ++i) {
-      row.emplace_back(at(i + _offset1, idx2Node.lowerBound()));
+    // The column is fixed, so the output is an element of the column:
+    std::vector<VarNodeId> column;
+    column.reserve(_numRows);
+    for (Int i = 0; i < static_cast<Int>(_numRows); ++i) {
+      column.emplace_back(at(i + _offset1, idx2Node.lowerBound()));
     }
     invariantGraph().addInvariantNode(std::make_shared<ArrayVarElementNode>(
-        invariantGraph(), idx1(), std::move(row), outputVarNodeIds().front(),
-        _offset1));
+        invariantGraph(), idx1(), std::move(column),
+        outputVarNodeIds().front(), _offset1));
   }
   return true;
 }
 
 void ArrayVarElement2dNode::registerNode() {
-  const size_t numCols = dynamicInputVarNodeIds().size() / _numRows;
-  std::vector<std::vector<propagation::VarViewId>> varMatrix(
-      _numRows, std::vector<propagation::VarViewId>{});
-  for (size_t i = 0; i < _numRows; ++i) {
-    varMatrix.at(i).reserve(numCols);
-    for (size_t j = 0; j < numCols; ++j) {
-      varMatrix.at(i).emplace_back(
-          invariantGraph()
-              .varNode(dynamicInputVarNodeIds().at(i * numCols + j))
-              .varId());
-    }
+  // The dynamic inputs are already in row-major order:
+  std::vector<propagation::VarViewId> varIds;
+  varIds.reserve(dynamicInputVarNodeIds().size());
+  for (const VarNodeId nodeId : dynamicInputVarNodeIds()) {
+    varIds.emplace_back(invariantGraph().varNode(nodeId).varId());
   }
 
   assert(invariantGraph().varId(outputVarNodeIds().front()) !=
@@ -199,7 +193,10 @@ void ArrayVarElement2dNode::registerNode() {
   solver().makeInvariant<propagation::Element2dVar>(
       solver(), invariantGraph().varId(outputVarNodeIds().front()),
       invariantGraph().varId(idx1()), invariantGraph().varId(idx2()),
-      std::move(varMatrix), _offset1, _offset2);
+      Matrix<propagation::VarViewId>(
+          _numRows, dynamicInputVarNodeIds().size() / _numRows,
+          std::move(varIds)),
+      _offset1, _offset2);
 }
 
 std::string ArrayVarElement2dNode::dotLangIdentifier() const {
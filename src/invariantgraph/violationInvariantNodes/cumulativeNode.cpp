@@ -0,0 +1,86 @@
+#include "atlantis/invariantgraph/violationInvariantNodes/cumulativeNode.hpp"
+
+#include <utility>
+
+#include "../parseHelper.hpp"
+#include "atlantis/propagation/views/notEqualConst.hpp"
+#include "atlantis/propagation/violationInvariants/cumulative.hpp"
+
+namespace atlantis::invariantgraph {
+
+CumulativeNode::CumulativeNode(IInvariantGraph& graph,
+                               std::vector<VarNodeId>&& s,
+                               std::vector<VarNodeId>&& d,
+                               std::vector<VarNodeId>&& r, VarNodeId b,
+                               VarNodeId reified)
+    : ViolationInvariantNode(graph, append(concat(concat(s, d), r), b),
+                             reified),
+      _numTasks(s.size()) {
+  assert(s.size() == d.size() && s.size() == r.size());
+}
+
+CumulativeNode::CumulativeNode(IInvariantGraph& graph,
+                               std::vector<VarNodeId>&& s,
+                               std::vector<VarNodeId>&& d,
+                               std::vector<VarNodeId>&& r, VarNodeId b,
+                               bool shouldHold)
+    : ViolationInvariantNode(graph, append(concat(concat(s, d), r), b),
+                             shouldHold),
+      _numTasks(s.size()) {
+  assert(s.size() == d.size() && s.size() == r.size());
+}
+
+void CumulativeNode::init(InvariantNodeId id) {
+  ViolationInvariantNode::init(id);
+  assert(
+      !isReified() ||
+      !invariantGraphConst().varNodeConst(reifiedViolationNodeId()).isIntVar());
+  assert(staticInputVarNodeIds().size() == 3 * _numTasks + 1);
+  assert(
+      std::all_of(staticInputVarNodeIds().begin(),
+                  staticInputVarNodeIds().end(), [&](const VarNodeId vId) {
+                    return invariantGraphConst().varNodeConst(vId).isIntVar();
+                  }));
+}
+
+void CumulativeNode::registerOutputVars() {
+  if (violationVarId() == propagation::NULL_ID) {
+    if (!shouldHold()) {
+      _intermediate = solver().makeIntVar(0, 0, 0);
+      setViolationVarId(solver().makeIntView<propagation::NotEqualConst>(
+          solver(), _intermediate, 0));
+    } else {
+      registerViolation();
+    }
+  }
+  assert(std::all_of(outputVarNodeIds().begin(), outputVarNodeIds().end(),
+                     [&](const VarNodeId vId) {
+                       return invariantGraphConst().varNodeConst(vId).varId() !=
+                              propagation::NULL_ID;
+                     }));
+}
+
+void CumulativeNode::registerNode() {
+  assert(violationVarId() != propagation::NULL_ID);
+  assert(shouldHold() || _intermediate != propagation::NULL_ID);
+  assert(shouldHold() ? violationVarId().isVar() : _intermediate.isVar());
+
+  const auto inputVarIds = [&](size_t first) {
+    std::vector<propagation::VarViewId> varIds;
+    varIds.reserve(_numTasks);
+    std::transform(staticInputVarNodeIds().begin() + first,
+                   staticInputVarNodeIds().begin() + first + _numTasks,
+                   std::back_inserter(varIds),
+                   [&](const auto& id) { return invariantGraph().varId(id); });
+    return varIds;
+  };
+
+  solver().makeInvariant<propagation::Cumulative>(
+      solver(), shouldHold() ? violationVarId() : _intermediate,
+      inputVarIds(0), inputVarIds(_numTasks), inputVarIds(2 * _numTasks),
+      invariantGraph().varId(staticInputVarNodeIds().back()));
+}
+
+std::string CumulativeNode::dotLangIdentifier() const { return "cumulative"; }
+
+}  // namespace atlantis::invariantgraph
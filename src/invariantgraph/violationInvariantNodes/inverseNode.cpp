@@ -0,0 +1,165 @@
+#include "atlantis/invariantgraph/violationInvariantNodes/inverseNode.hpp"
+
+#include <unordered_set>
+#include <utility>
+
+#include "../parseHelper.hpp"
+#include "atlantis/invariantgraph/implicitConstraintNodes/inverseImplicitNode.hpp"
+#include "atlantis/propagation/views/notEqualConst.hpp"
+#include "atlantis/propagation/violationInvariants/inverse.hpp"
+
+namespace atlantis::invariantgraph {
+
+InverseNode::InverseNode(IInvariantGraph& graph, std::vector<VarNodeId>&& f,
+                         Int fOffset, std::vector<VarNodeId>&& invf,
+                         Int invfOffset, VarNodeId r)
+    : ViolationInvariantNode(graph, concat(f, invf), r),
+      _numVars(f.size()),
+      _fOffset(fOffset),
+      _invfOffset(invfOffset) {
+  assert(f.size() == invf.size());
+}
+
+InverseNode::InverseNode(IInvariantGraph& graph, std::vector<VarNodeId>&& f,
+                         Int fOffset, std::vector<VarNodeId>&& invf,
+                         Int invfOffset, bool shouldHold)
+    : ViolationInvariantNode(graph, concat(f, invf), shouldHold),
+      _numVars(f.size()),
+      _fOffset(fOffset),
+      _invfOffset(invfOffset) {
+  assert(f.size() == invf.size());
+}
+
+void InverseNode::init(InvariantNodeId id) {
+  ViolationInvariantNode::init(id);
+  assert(
+      !isReified() ||
+      !invariantGraphConst().varNodeConst(reifiedViolationNodeId()).isIntVar());
+  assert(staticInputVarNodeIds().size() == 2 * _numVars);
+  assert(
+      std::all_of(staticInputVarNodeIds().begin(),
+                  staticInputVarNodeIds().end(), [&](const VarNodeId vId) {
+                    return invariantGraphConst().varNodeConst(vId).isIntVar();
+                  }));
+}
+
+void InverseNode::fixPartners(bool invfToF) {
+  // The variables are x and their partners are y, where x[k] == v implies
+  // y[v] == k:
+  const size_t xFirst = invfToF ? _numVars : 0;
+  const size_t yFirst = invfToF ? 0 : _numVars;
+  const Int xOffset = invfToF ? _invfOffset : _fOffset;
+  const Int yOffset = invfToF ? _fOffset : _invfOffset;
+  for (size_t k = 0; k < _numVars; ++k) {
+    const VarNode& x =
+        invariantGraphConst().varNodeConst(staticInputVarNodeIds()[xFirst + k]);
+    if (!x.isFixed()) {
+      continue;
+    }
+    const Int index = x.lowerBound() - yOffset;
+    if (index < 0 || static_cast<Int>(_numVars) <= index) {
+      throw InconsistencyException(
+          "InverseNode::updateState value is not in the index set");
+    }
+    VarNode& y = invariantGraph().varNode(
+        staticInputVarNodeIds()[yFirst + static_cast<size_t>(index)]);
+    const Int value = static_cast<Int>(k) + xOffset;
+    if (!y.inDomain(value)) {
+      throw InconsistencyException(
+          "InverseNode::updateState constraint is violated");
+    }
+    y.fixToValue(value);
+  }
+}
+
+void InverseNode::updateState() {
+  ViolationInvariantNode::updateState();
+  if (isReified() || !shouldHold()) {
+    return;
+  }
+  // f[i] == j <-> invf[j] == i, so fixing a variable fixes its partner:
+  fixPartners(false);
+  fixPartners(true);
+  if (std::all_of(staticInputVarNodeIds().begin(),
+                  staticInputVarNodeIds().end(), [&](const VarNodeId vId) {
+                    return invariantGraphConst().varNodeConst(vId).isFixed();
+                  })) {
+    setState(InvariantNodeState::SUBSUMED);
+  }
+}
+
+bool InverseNode::canBeMadeImplicit() const {
+  if (state() != InvariantNodeState::ACTIVE || isReified() || !shouldHold()) {
+    return false;
+  }
+  // The neighbourhood assigns each free variable exactly once:
+  std::unordered_set<VarNodeId> freeVarNodeIds;
+  for (const VarNodeId& nId : staticInputVarNodeIds()) {
+    const VarNode& varNode = invariantGraphConst().varNodeConst(nId);
+    if (varNode.isFixed()) {
+      continue;
+    }
+    if (!varNode.definingNodes().empty() ||
+        !freeVarNodeIds.emplace(nId).second) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool InverseNode::makeImplicit() {
+  if (!canBeMadeImplicit()) {
+    return false;
+  }
+  invariantGraph().addImplicitConstraintNode(
+      std::make_shared<InverseImplicitNode>(
+          invariantGraph(),
+          std::vector<VarNodeId>(staticInputVarNodeIds().begin(),
+                                 staticInputVarNodeIds().begin() + _numVars),
+          _fOffset,
+          std::vector<VarNodeId>(staticInputVarNodeIds().begin() + _numVars,
+                                 staticInputVarNodeIds().end()),
+          _invfOffset));
+  return true;
+}
+
+void InverseNode::registerOutputVars() {
+  if (violationVarId() == propagation::NULL_ID) {
+    if (!shouldHold()) {
+      _intermediate = solver().makeIntVar(0, 0, 0);
+      setViolationVarId(solver().makeIntView<propagation::NotEqualConst>(
+          solver(), _intermediate, 0));
+    } else {
+      registerViolation();
+    }
+  }
+  assert(std::all_of(outputVarNodeIds().begin(), outputVarNodeIds().end(),
+                     [&](const VarNodeId vId) {
+                       return invariantGraphConst().varNodeConst(vId).varId() !=
+                              propagation::NULL_ID;
+                     }));
+}
+
+void InverseNode::registerNode() {
+  assert(violationVarId() != propagation::NULL_ID);
+  assert(shouldHold() || _intermediate != propagation::NULL_ID);
+  assert(shouldHold() ? violationVarId().isVar() : _intermediate.isVar());
+
+  const auto inputVarIds = [&](size_t first) {
+    std::vector<propagation::VarViewId> varIds;
+    varIds.reserve(_numVars);
+    std::transform(staticInputVarNodeIds().begin() + first,
+                   staticInputVarNodeIds().begin() + first + _numVars,
+                   std::back_inserter(varIds),
+                   [&](const auto& id) { return invariantGraph().varId(id); });
+    return varIds;
+  };
+
+  solver().makeViolationInvariant<propagation::Inverse>(
+      solver(), shouldHold() ? violationVarId() : _intermediate,
+      inputVarIds(0), _fOffset, inputVarIds(_numVars), _invfOffset);
+}
+
+std::string InverseNode::dotLangIdentifier() const { return "inverse"; }
+
+}  // namespace atlantis::invariantgraph
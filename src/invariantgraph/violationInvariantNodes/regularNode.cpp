@@ -0,0 +1,121 @@
+#include "atlantis/invariantgraph/violationInvariantNodes/regularNode.hpp"
+
+#include <utility>
+
+#include "../parseHelper.hpp"
+#include "atlantis/propagation/views/notEqualConst.hpp"
+#include "atlantis/propagation/violationInvariants/regular.hpp"
+
+namespace atlantis::invariantgraph {
+
+RegularNode::RegularNode(IInvariantGraph& graph, std::vector<VarNodeId>&& x,
+                         Int numStates, Int numSymbols,
+                         std::vector<Int>&& transitions, Int initialState,
+                         std::vector<Int>&& acceptingStates, VarNodeId r)
+    : ViolationInvariantNode(graph, std::move(x), r),
+      _numStates(numStates),
+      _numSymbols(numSymbols),
+      _transitions(std::move(transitions)),
+      _initialState(initialState),
+      _acceptingStates(std::move(acceptingStates)) {}
+
+RegularNode::RegularNode(IInvariantGraph& graph, std::vector<VarNodeId>&& x,
+                         Int numStates, Int numSymbols,
+                         std::vector<Int>&& transitions, Int initialState,
+                         std::vector<Int>&& acceptingStates, bool shouldHold)
+    : ViolationInvariantNode(graph, std::move(x), shouldHold),
+      _numStates(numStates),
+      _numSymbols(numSymbols),
+      _transitions(std::move(transitions)),
+      _initialState(initialState),
+      _acceptingStates(std::move(acceptingStates)) {}
+
+void RegularNode::init(InvariantNodeId id) {
+  ViolationInvariantNode::init(id);
+  assert(
+      !isReified() ||
+      !invariantGraphConst().varNodeConst(reifiedViolationNodeId()).isIntVar());
+  assert(
+      std::all_of(staticInputVarNodeIds().begin(),
+                  staticInputVarNodeIds().end(), [&](const VarNodeId vId) {
+                    return invariantGraphConst().varNodeConst(vId).isIntVar();
+                  }));
+  assert(static_cast<Int>(_transitions.size()) == _numStates * _numSymbols);
+}
+
+bool RegularNode::accepts(const std::vector<Int>& sequence) const {
+  Int state = _initialState;
+  for (const Int symbol : sequence) {
+    if (state < 1 || _numStates < state || symbol < 1 ||
+        _numSymbols < symbol) {
+      return false;
+    }
+    state = _transitions.at(
+        static_cast<size_t>((state - 1) * _numSymbols + symbol - 1));
+  }
+  return std::find(_acceptingStates.begin(), _acceptingStates.end(), state) !=
+         _acceptingStates.end();
+}
+
+void RegularNode::updateState() {
+  ViolationInvariantNode::updateState();
+  if (!std::all_of(staticInputVarNodeIds().begin(),
+                   staticInputVarNodeIds().end(), [&](const VarNodeId vId) {
+                     return invariantGraphConst().varNodeConst(vId).isFixed();
+                   })) {
+    return;
+  }
+  // All variables are fixed, so simulate the automaton:
+  std::vector<Int> sequence;
+  sequence.reserve(staticInputVarNodeIds().size());
+  for (const VarNodeId& vId : staticInputVarNodeIds()) {
+    sequence.emplace_back(invariantGraphConst().varNodeConst(vId).lowerBound());
+  }
+  const bool isSatisfied = accepts(sequence);
+  if (isReified()) {
+    fixReified(isSatisfied);
+  } else if (shouldHold() != isSatisfied) {
+    throw InconsistencyException(
+        "RegularNode::updateState constraint is violated");
+  }
+  setState(InvariantNodeState::SUBSUMED);
+}
+
+void RegularNode::registerOutputVars() {
+  if (violationVarId() == propagation::NULL_ID) {
+    if (!shouldHold()) {
+      _intermediate = solver().makeIntVar(0, 0, 0);
+      setViolationVarId(solver().makeIntView<propagation::NotEqualConst>(
+          solver(), _intermediate, 0));
+    } else {
+      registerViolation();
+    }
+  }
+  assert(std::all_of(outputVarNodeIds().begin(), outputVarNodeIds().end(),
+                     [&](const VarNodeId vId) {
+                       return invariantGraphConst().varNodeConst(vId).varId() !=
+                              propagation::NULL_ID;
+                     }));
+}
+
+void RegularNode::registerNode() {
+  assert(violationVarId() != propagation::NULL_ID);
+  assert(shouldHold() || _intermediate != propagation::NULL_ID);
+  assert(shouldHold() ? violationVarId().isVar() : _intermediate.isVar());
+
+  std::vector<propagation::VarViewId> inputVarIds;
+  inputVarIds.reserve(staticInputVarNodeIds().size());
+  std::transform(staticInputVarNodeIds().begin(), staticInputVarNodeIds().end(),
+                 std::back_inserter(inputVarIds),
+                 [&](const auto& id) { return invariantGraph().varId(id); });
+
+  solver().makeViolationInvariant<propagation::Regular>(
+      solver(), shouldHold() ? violationVarId() : _intermediate,
+      std::move(inputVarIds), _numStates, _numSymbols,
+      std::vector<Int>(_transitions), _initialState,
+      _acceptingStates);
+}
+
+std::string RegularNode::dotLangIdentifier() const { return "regular"; }
+
+}  // namespace atlantis::invariantgraph
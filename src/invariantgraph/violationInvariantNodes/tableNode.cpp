@@ -0,0 +1,130 @@
+#include "atlantis/invariantgraph/violationInvariantNodes/tableNode.hpp"
+
+#include <unordered_set>
+#include <utility>
+
+#include "../parseHelper.hpp"
+#include "atlantis/propagation/views/notEqualConst.hpp"
+#include "atlantis/propagation/violationInvariants/table.hpp"
+
+namespace atlantis::invariantgraph {
+
+TableNode::TableNode(IInvariantGraph& graph, std::vector<VarNodeId>&& x,
+                     std::vector<Int>&& t, VarNodeId r)
+    : ViolationInvariantNode(graph, std::move(x), r), _table(std::move(t)) {}
+
+TableNode::TableNode(IInvariantGraph& graph, std::vector<VarNodeId>&& x,
+                     std::vector<Int>&& t, bool shouldHold)
+    : ViolationInvariantNode(graph, std::move(x), shouldHold),
+      _table(std::move(t)) {}
+
+void TableNode::init(InvariantNodeId id) {
+  ViolationInvariantNode::init(id);
+  assert(
+      !isReified() ||
+      !invariantGraphConst().varNodeConst(reifiedViolationNodeId()).isIntVar());
+  assert(
+      std::all_of(staticInputVarNodeIds().begin(),
+                  staticInputVarNodeIds().end(), [&](const VarNodeId vId) {
+                    return invariantGraphConst().varNodeConst(vId).isIntVar();
+                  }));
+  assert(staticInputVarNodeIds().empty() ||
+         _table.size() % staticInputVarNodeIds().size() == 0);
+}
+
+void TableNode::updateState() {
+  ViolationInvariantNode::updateState();
+  const size_t arity = staticInputVarNodeIds().size();
+  if (arity == 0) {
+    return;
+  }
+  const size_t numTuples = _table.size() / arity;
+
+  // The columns of the fixed variables, which are removed:
+  std::vector<bool> isFixedColumn(arity, false);
+  std::unordered_set<VarNodeId> fixedVarNodeIds;
+  for (size_t i = 0; i < arity; ++i) {
+    const VarNodeId varNodeId = staticInputVarNodeIds().at(i);
+    if (invariantGraphConst().varNodeConst(varNodeId).isFixed()) {
+      isFixedColumn.at(i) = true;
+      fixedVarNodeIds.emplace(varNodeId);
+    }
+  }
+
+  // Only keep the tuples that can be satisfied, that is, the tuples where
+  // each value is in the domain of its variable:
+  std::vector<Int> table;
+  table.reserve(_table.size());
+  size_t numSupportedTuples = 0;
+  for (size_t t = 0; t < numTuples; ++t) {
+    bool isSupported = true;
+    for (size_t i = 0; i < arity && isSupported; ++i) {
+      isSupported = invariantGraphConst()
+                        .varNodeConst(staticInputVarNodeIds().at(i))
+                        .inDomain(_table.at(t * arity + i));
+    }
+    if (!isSupported) {
+      continue;
+    }
+    ++numSupportedTuples;
+    for (size_t i = 0; i < arity; ++i) {
+      if (!isFixedColumn.at(i)) {
+        table.emplace_back(_table.at(t * arity + i));
+      }
+    }
+  }
+  _table = std::move(table);
+  for (const VarNodeId& varNodeId : fixedVarNodeIds) {
+    removeStaticInputVarNode(varNodeId);
+  }
+
+  if (numSupportedTuples == 0 || staticInputVarNodeIds().empty()) {
+    // Either no tuple can be satisfied, or all variables are fixed to the
+    // values of a tuple:
+    const bool isSatisfied = numSupportedTuples > 0;
+    if (isReified()) {
+      fixReified(isSatisfied);
+    } else if (shouldHold() != isSatisfied) {
+      throw InconsistencyException(
+          "TableNode::updateState constraint is violated");
+    }
+    setState(InvariantNodeState::SUBSUMED);
+  }
+}
+
+void TableNode::registerOutputVars() {
+  if (violationVarId() == propagation::NULL_ID) {
+    if (!shouldHold()) {
+      _intermediate = solver().makeIntVar(0, 0, 0);
+      setViolationVarId(solver().makeIntView<propagation::NotEqualConst>(
+          solver(), _intermediate, 0));
+    } else {
+      registerViolation();
+    }
+  }
+  assert(std::all_of(outputVarNodeIds().begin(), outputVarNodeIds().end(),
+                     [&](const VarNodeId vId) {
+                       return invariantGraphConst().varNodeConst(vId).varId() !=
+                              propagation::NULL_ID;
+                     }));
+}
+
+void TableNode::registerNode() {
+  assert(violationVarId() != propagation::NULL_ID);
+  assert(shouldHold() || _intermediate != propagation::NULL_ID);
+  assert(shouldHold() ? violationVarId().isVar() : _intermediate.isVar());
+
+  std::vector<propagation::VarViewId> inputVarIds;
+  inputVarIds.reserve(staticInputVarNodeIds().size());
+  std::transform(staticInputVarNodeIds().begin(), staticInputVarNodeIds().end(),
+                 std::back_inserter(inputVarIds),
+                 [&](const auto& id) { return invariantGraph().varId(id); });
+
+  solver().makeViolationInvariant<propagation::Table>(
+      solver(), shouldHold() ? violationVarId() : _intermediate,
+      std::move(inputVarIds), std::vector<Int>(_table));
+}
+
+std::string TableNode::dotLangIdentifier() const { return "table"; }
+
+}  // namespace atlantis::invariantgraph
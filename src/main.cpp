@@ -2,6 +2,9 @@
 #include <cxxopts.hpp>
 #include <filesystem>
 #include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
 
 #include "atlantis/fznBackend.hpp"
 #include "atlantis/search/annealing/annealingScheduleFactory.hpp"
@@ -41,10 +44,20 @@ int main(int argc, char* argv[]) {
         "The seed to use for the random number generator. If this is negative, the current system time is chosen as the seed.",
         cxxopts::value<long>()->default_value("-1")
       )
+      (
+        "p,threads",
+        "The number of workers that search in parallel, each with its own seed.",
+        cxxopts::value<size_t>()->default_value("1")
+      )
+      (
+        "search",
+        "The search procedure: annealing (simulated annealing with random moves) or tabu (tabu search over enumerated moves).",
+        cxxopts::value<std::string>()->default_value("annealing")
+      )
       (
         "annealing-schedule",
-        "A file path to the annealing schedule definition.",
-        cxxopts::value<std::filesystem::path>()
+        "A file path to the annealing schedule definition. When several (comma separated) paths are given, they are assigned to the workers in turn.",
+        cxxopts::value<std::vector<std::filesystem::path>>()
       )
       (
         "log-level",
@@ -55,6 +68,10 @@ int main(int argc, char* argv[]) {
         "dot-file", "A file path where a dot file format of the invariant graph is to be saved.",
         cxxopts::value<std::filesystem::path>()
       )
+      (
+        "profile", "A file path where a JSON profile of the time spent in the invariants of each constraint is to be saved.",
+        cxxopts::value<std::filesystem::path>()
+      )
       ("help", "Print help");
 
     options.add_options("Positional")
@@ -91,10 +108,22 @@ int main(int argc, char* argv[]) {
           std::chrono::milliseconds(result["time-limit"].as<long>())});
     }
 
-    if (result.count("annealing-schedule") == 1) {
-      backend.setAnnealingScheduleFactory(
-          atlantis::search::AnnealingScheduleFactory(
-              result["annealing-schedule"].as<std::filesystem::path>()));
+    backend.setNumThreads(result["threads"].as<size_t>());
+
+    const auto search = result["search"].as<std::string>();
+    if (search == "tabu") {
+      backend.setSearchStrategy(atlantis::SearchStrategy::TABU);
+    } else if (search != "annealing") {
+      throw std::invalid_argument("Unknown search procedure: " + search);
+    }
+
+    if (result.count("annealing-schedule") >= 1) {
+      std::vector<atlantis::search::AnnealingScheduleFactory> factories;
+      for (const auto& path : result["annealing-schedule"]
+                            .as<std::vector<std::filesystem::path>>()) {
+        factories.emplace_back(path);
+      }
+      backend.setAnnealingScheduleFactories(std::move(factories));
     }
 
     if (result.count("dot-file") == 1) {
@@ -102,6 +131,11 @@ int main(int argc, char* argv[]) {
       backend.setDotFilePath(std::move(dotFilePath));
     }
 
+    if (result.count("profile") == 1) {
+      auto profileFilePath = result["profile"].as<std::filesystem::path>();
+      backend.setProfileFilePath(std::move(profileFilePath));
+    }
+
     auto statistics = backend.solve(logger);
 
     // Don't log to std::cout, since that would interfere with MiniZinc.
@@ -16,15 +16,15 @@ void AbsDiff::registerVars() {
   assert(_id != NULL_ID);
 
   registerDefinedVar(_output);
-  _solver.registerInvariantInput(_id, _x, 0, false);
-  _solver.registerInvariantInput(_id, _y, 0, false);
+  _solver->registerInvariantInput(_id, _x, 0, false);
+  _solver->registerInvariantInput(_id, _y, 0, false);
 }
 
 void AbsDiff::updateBounds(bool widenOnly) {
-  const Int xLb = _solver.lowerBound(_x);
-  const Int xUb = _solver.upperBound(_x);
-  const Int yLb = _solver.lowerBound(_y);
-  const Int yUb = _solver.upperBound(_y);
+  const Int xLb = _solver->lowerBound(_x);
+  const Int xUb = _solver->upperBound(_x);
+  const Int yLb = _solver->lowerBound(_y);
+  const Int yUb = _solver->upperBound(_y);
 
   const Int lb = xLb <= yUb && yLb <= xUb
                      ? 0
@@ -33,12 +33,12 @@ void AbsDiff::updateBounds(bool widenOnly) {
   const Int ub = std::max(std::max(std::abs(xLb - yLb), std::abs(xLb - yUb)),
                           std::max(std::abs(xUb - yLb), std::abs(xUb - yUb)));
 
-  _solver.updateBounds(_output, lb, ub, widenOnly);
+  _solver->updateBounds(_output, lb, ub, widenOnly);
 }
 
 void AbsDiff::recompute(Timestamp ts) {
   updateValue(ts, _output,
-              std::abs(_solver.value(ts, _x) - _solver.value(ts, _y)));
+              std::abs(_solver->value(ts, _x) - _solver->value(ts, _y)));
 }
 
 void AbsDiff::notifyInputChanged(Timestamp ts, LocalId) { recompute(ts); }
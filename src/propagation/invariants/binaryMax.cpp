@@ -15,20 +15,20 @@ BinaryMax::BinaryMax(SolverBase& solver, VarViewId output, VarViewId x,
 
 void BinaryMax::registerVars() {
   assert(_id != NULL_ID);
-  _solver.registerInvariantInput(_id, _x, 0, false);
-  _solver.registerInvariantInput(_id, _y, 0, false);
+  _solver->registerInvariantInput(_id, _x, 0, false);
+  _solver->registerInvariantInput(_id, _y, 0, false);
   registerDefinedVar(_output);
 }
 
 void BinaryMax::updateBounds(bool widenOnly) {
-  _solver.updateBounds(
-      _output, std::max(_solver.lowerBound(_x), _solver.lowerBound(_y)),
-      std::max(_solver.upperBound(_x), _solver.upperBound(_y)), widenOnly);
+  _solver->updateBounds(
+      _output, std::max(_solver->lowerBound(_x), _solver->lowerBound(_y)),
+      std::max(_solver->upperBound(_x), _solver->upperBound(_y)), widenOnly);
 }
 
 void BinaryMax::recompute(Timestamp ts) {
   updateValue(ts, _output,
-              std::max(_solver.value(ts, _x), _solver.value(ts, _y)));
+              std::max(_solver->value(ts, _x), _solver->value(ts, _y)));
 }
 
 VarViewId BinaryMax::nextInput(Timestamp ts) {
@@ -15,20 +15,20 @@ BinaryMin::BinaryMin(SolverBase& solver, VarViewId output, VarViewId x,
 
 void BinaryMin::registerVars() {
   assert(_id != NULL_ID);
-  _solver.registerInvariantInput(_id, _x, 0, false);
-  _solver.registerInvariantInput(_id, _y, 0, false);
+  _solver->registerInvariantInput(_id, _x, 0, false);
+  _solver->registerInvariantInput(_id, _y, 0, false);
   registerDefinedVar(_output);
 }
 
 void BinaryMin::updateBounds(bool widenOnly) {
-  _solver.updateBounds(
-      _output, std::min(_solver.lowerBound(_x), _solver.lowerBound(_y)),
-      std::min(_solver.upperBound(_x), _solver.upperBound(_y)), widenOnly);
+  _solver->updateBounds(
+      _output, std::min(_solver->lowerBound(_x), _solver->lowerBound(_y)),
+      std::min(_solver->upperBound(_x), _solver->upperBound(_y)), widenOnly);
 }
 
 void BinaryMin::recompute(Timestamp ts) {
   updateValue(ts, _output,
-              std::min(_solver.value(ts, _x), _solver.value(ts, _y)));
+              std::min(_solver->value(ts, _x), _solver->value(ts, _y)));
 }
 
 VarViewId BinaryMin::nextInput(Timestamp ts) {
@@ -1,7 +1,5 @@
 #include "atlantis/propagation/invariants/boolAnd.hpp"
 
-#include "atlantis/propagation/variables/intVar.hpp"
-
 namespace atlantis::propagation {
 
 /**
@@ -22,20 +20,20 @@ BoolAnd::BoolAnd(SolverBase& solver, VarViewId output, VarViewId x, VarViewId y)
 
 void BoolAnd::registerVars() {
   assert(_id != NULL_ID);
-  _solver.registerInvariantInput(_id, _x, LocalId(0), false);
-  _solver.registerInvariantInput(_id, _y, LocalId(0), false);
+  _solver->registerInvariantInput(_id, _x, LocalId(0), false);
+  _solver->registerInvariantInput(_id, _y, LocalId(0), false);
   registerDefinedVar(_output);
 }
 
 void BoolAnd::updateBounds(bool widenOnly) {
-  _solver.updateBounds(
-      _output, std::max(_solver.lowerBound(_x), _solver.lowerBound(_y)),
-      std::max(_solver.upperBound(_x), _solver.upperBound(_y)), widenOnly);
+  _solver->updateBounds(
+      _output, std::max(_solver->lowerBound(_x), _solver->lowerBound(_y)),
+      std::max(_solver->upperBound(_x), _solver->upperBound(_y)), widenOnly);
 }
 
 void BoolAnd::recompute(Timestamp ts) {
   updateValue(ts, _output,
-              std::max(_solver.value(ts, _x), _solver.value(ts, _y)));
+              std::max(_solver->value(ts, _x), _solver->value(ts, _y)));
 }
 
 void BoolAnd::notifyInputChanged(Timestamp ts, LocalId) { recompute(ts); }
@@ -39,7 +39,7 @@ void BoolLinear::registerVars() {
   assert(_id != NULL_ID);
 
   for (size_t i = 0; i < _violArray.size(); ++i) {
-    _solver.registerInvariantInput(_id, _violArray[i], i, false);
+    _solver->registerInvariantInput(_id, _violArray[i], i, false);
   }
   registerDefinedVar(_output);
 }
@@ -50,8 +50,8 @@ void BoolLinear::updateBounds(bool widenOnly) {
   Int lb = 0;
   Int ub = 0;
   for (size_t i = 0; i < _violArray.size(); ++i) {
-    const Int violLb = _solver.lowerBound(_violArray[i]);
-    const Int violUb = _solver.upperBound(_violArray[i]);
+    const Int violLb = _solver->lowerBound(_violArray[i]);
+    const Int violUb = _solver->upperBound(_violArray[i]);
     // violation != 0 <=> false
     const Int boolLb = static_cast<Int>(violLb == 0 && violUb == 0);
     // violation == 0 <=> true
@@ -63,22 +63,24 @@ void BoolLinear::updateBounds(bool widenOnly) {
     lb += _coeffs[i] * (_coeffs[i] < 0 ? boolUb : boolLb);
     ub += _coeffs[i] * (_coeffs[i] < 0 ? boolLb : boolUb);
   }
-  _solver.updateBounds(_output, lb, ub, widenOnly);
+  _solver->updateBounds(_output, lb, ub, widenOnly);
 }
 
 void BoolLinear::recompute(Timestamp ts) {
   Int sum = 0;
   for (size_t i = 0; i < _violArray.size(); ++i) {
-    sum += _coeffs[i] * static_cast<Int>(_solver.value(ts, _violArray[i]) == 0);
+    sum +=
+        _coeffs[i] * static_cast<Int>(_solver->value(ts, _violArray[i]) == 0);
   }
   updateValue(ts, _output, sum);
 }
 
 void BoolLinear::notifyInputChanged(Timestamp ts, LocalId id) {
   assert(id < _violArray.size());
-  const Int newValue = static_cast<Int>(_solver.value(ts, _violArray[id]) == 0);
+  const Int newValue =
+      static_cast<Int>(_solver->value(ts, _violArray[id]) == 0);
   const Int committedValue =
-      static_cast<Int>(_solver.committedValue(_violArray[id]) == 0);
+      static_cast<Int>(_solver->committedValue(_violArray[id]) == 0);
   if (newValue == committedValue) {
     return;
   }
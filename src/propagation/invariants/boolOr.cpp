@@ -1,7 +1,5 @@
 #include "atlantis/propagation/invariants/boolOr.hpp"
 
-#include "atlantis/propagation/variables/intVar.hpp"
-
 namespace atlantis::propagation {
 
 /**
@@ -22,20 +20,20 @@ BoolOr::BoolOr(SolverBase& solver, VarViewId output, VarViewId x, VarViewId y)
 
 void BoolOr::registerVars() {
   assert(_id != NULL_ID);
-  _solver.registerInvariantInput(_id, _x, LocalId(0), false);
-  _solver.registerInvariantInput(_id, _y, LocalId(0), false);
+  _solver->registerInvariantInput(_id, _x, LocalId(0), false);
+  _solver->registerInvariantInput(_id, _y, LocalId(0), false);
   registerDefinedVar(_output);
 }
 
 void BoolOr::updateBounds(bool widenOnly) {
-  _solver.updateBounds(
-      _output, std::min(_solver.lowerBound(_x), _solver.lowerBound(_y)),
-      std::min(_solver.upperBound(_x), _solver.upperBound(_y)), widenOnly);
+  _solver->updateBounds(
+      _output, std::min(_solver->lowerBound(_x), _solver->lowerBound(_y)),
+      std::min(_solver->upperBound(_x), _solver->upperBound(_y)), widenOnly);
 }
 
 void BoolOr::recompute(Timestamp ts) {
   updateValue(ts, _output,
-              std::min(_solver.value(ts, _x), _solver.value(ts, _y)));
+              std::min(_solver->value(ts, _x), _solver->value(ts, _y)));
 }
 
 void BoolOr::notifyInputChanged(Timestamp ts, LocalId) { recompute(ts); }
@@ -3,8 +3,6 @@
 #include <algorithm>
 #include <functional>
 
-#include "atlantis/propagation/variables/intVar.hpp"
-
 namespace atlantis::propagation {
 
 /**
@@ -25,18 +23,18 @@ BoolXor::BoolXor(SolverBase& solver, VarViewId output, VarViewId x, VarViewId y)
 
 void BoolXor::registerVars() {
   assert(_id != NULL_ID);
-  _solver.registerInvariantInput(_id, _x, LocalId(0), false);
-  _solver.registerInvariantInput(_id, _y, LocalId(0), false);
+  _solver->registerInvariantInput(_id, _x, LocalId(0), false);
+  _solver->registerInvariantInput(_id, _y, LocalId(0), false);
   registerDefinedVar(_output);
 }
 
 void BoolXor::updateBounds(bool widenOnly) {
   Int lb = 0;
   Int ub = 1;
-  const bool xIsZero = _solver.upperBound(_x) == 0;
-  const bool xIsOne = _solver.lowerBound(_x) > 0;
-  const bool yIsZero = _solver.upperBound(_y) == 0;
-  const bool yIsOne = _solver.lowerBound(_y) > 0;
+  const bool xIsZero = _solver->upperBound(_x) == 0;
+  const bool xIsOne = _solver->lowerBound(_x) > 0;
+  const bool yIsZero = _solver->upperBound(_y) == 0;
+  const bool yIsOne = _solver->lowerBound(_y) > 0;
   if ((xIsZero || xIsOne) && (yIsZero || yIsOne)) {
     if (xIsZero == yIsZero || xIsOne == yIsOne) {
       lb = 1;
@@ -44,13 +42,13 @@ void BoolXor::updateBounds(bool widenOnly) {
       ub = 0;
     }
   }
-  _solver.updateBounds(_output, lb, ub, widenOnly);
+  _solver->updateBounds(_output, lb, ub, widenOnly);
 }
 
 void BoolXor::recompute(Timestamp ts) {
   updateValue(ts, _output,
-              static_cast<Int>((_solver.value(ts, _x) != 0) ==
-                               (_solver.value(ts, _y) != 0)));
+              static_cast<Int>((_solver->value(ts, _x) != 0) ==
+                               (_solver->value(ts, _y) != 0)));
 }
 
 void BoolXor::notifyInputChanged(Timestamp ts, LocalId) { recompute(ts); }
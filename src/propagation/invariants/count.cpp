@@ -11,8 +11,7 @@ Count::Count(SolverBase& solver, VarId output, VarViewId needle,
       _output(output),
       _needle(needle),
       _vars(std::move(varArray)),
-      _counts(),
-      _offset(0) {}
+      _counts() {}
 
 Count::Count(SolverBase& solver, VarViewId output, VarViewId needle,
              std::vector<VarViewId>&& varArray)
@@ -23,60 +22,56 @@ Count::Count(SolverBase& solver, VarViewId output, VarViewId needle,
 void Count::registerVars() {
   assert(_id != NULL_ID);
   for (size_t i = 0; i < _vars.size(); ++i) {
-    _solver.registerInvariantInput(_id, _vars[i], i, false);
+    _solver->registerInvariantInput(_id, _vars[i], i, false);
   }
-  _solver.registerInvariantInput(_id, _needle, _vars.size(), false);
+  _solver->registerInvariantInput(_id, _needle, _vars.size(), false);
   registerDefinedVar(_output);
 }
 
 void Count::updateBounds(bool widenOnly) {
-  _solver.updateBounds(_output, 0, static_cast<Int>(_vars.size()), widenOnly);
+  _solver->updateBounds(_output, 0, static_cast<Int>(_vars.size()), widenOnly);
 }
 
-void Count::close(Timestamp ts) {
+void Count::close(Timestamp) {
   Int lb = std::numeric_limits<Int>::max();
   Int ub = std::numeric_limits<Int>::min();
 
   for (const auto& var : _vars) {
-    lb = std::min(lb, _solver.lowerBound(var));
-    ub = std::max(ub, _solver.upperBound(var));
+    lb = std::min(lb, _solver->lowerBound(var));
+    ub = std::max(ub, _solver->upperBound(var));
   }
   assert(ub >= lb);
-  lb = std::max(lb, _solver.lowerBound(_needle));
-  ub = std::max(ub, _solver.lowerBound(_needle));
+  lb = std::max(lb, _solver->lowerBound(_needle));
+  ub = std::max(ub, _solver->lowerBound(_needle));
 
-  _counts.resize(static_cast<unsigned long>(ub - lb + 1),
-                 CommittableInt(ts, 0));
-  _offset = lb;
+  _counts.assign(lb, ub, _vars.size());
 }
 
 void Count::recompute(Timestamp ts) {
-  for (CommittableInt& c : _counts) {
-    c.setValue(ts, 0);
-  }
+  _counts.reset(ts);
 
   updateValue(ts, _output, 0);
 
   for (const auto& var : _vars) {
-    increaseCount(ts, _solver.value(ts, var));
+    increaseCount(ts, _solver->value(ts, var));
   }
-  updateValue(ts, _output, count(ts, _solver.value(ts, _needle)));
+  updateValue(ts, _output, count(ts, _solver->value(ts, _needle)));
 }
 
 void Count::notifyInputChanged(Timestamp ts, LocalId id) {
   if (id == _vars.size()) {
-    updateValue(ts, _output, count(ts, _solver.value(ts, _needle)));
+    updateValue(ts, _output, count(ts, _solver->value(ts, _needle)));
     return;
   }
   assert(id < _vars.size());
-  const Int newValue = _solver.value(ts, _vars[id]);
-  const Int committedValue = _solver.committedValue(_vars[id]);
+  const Int newValue = _solver->value(ts, _vars[id]);
+  const Int committedValue = _solver->committedValue(_vars[id]);
   if (newValue == committedValue) {
     return;
   }
   decreaseCount(ts, committedValue);
   increaseCount(ts, newValue);
-  updateValue(ts, _output, count(ts, _solver.value(ts, _needle)));
+  updateValue(ts, _output, count(ts, _solver->value(ts, _needle)));
 }
 
 VarViewId Count::nextInput(Timestamp ts) {
@@ -97,8 +92,6 @@ void Count::notifyCurrentInputChanged(Timestamp ts) {
 void Count::commit(Timestamp ts) {
   Invariant::commit(ts);
 
-  for (CommittableInt& committableInt : _counts) {
-    committableInt.commitIf(ts);
-  }
+  _counts.commitIf(ts);
 }
 }  // namespace atlantis::propagation
@@ -24,19 +24,19 @@ void CountConst::registerVars() {
   assert(_id != NULL_ID);
 
   for (size_t i = 0; i < _vars.size(); ++i) {
-    _solver.registerInvariantInput(_id, _vars[i], i, false);
+    _solver->registerInvariantInput(_id, _vars[i], i, false);
   }
   registerDefinedVar(_output);
 }
 
 void CountConst::updateBounds(bool widenOnly) {
-  _solver.updateBounds(_output, 0, static_cast<Int>(_vars.size()), widenOnly);
+  _solver->updateBounds(_output, 0, static_cast<Int>(_vars.size()), widenOnly);
 }
 
 void CountConst::recompute(Timestamp ts) {
   Int count = 0;
   for (const auto& var : _vars) {
-    count += static_cast<Int>(_solver.value(ts, var) == _needle);
+    count += static_cast<Int>(_solver->value(ts, var) == _needle);
   }
   updateValue(ts, _output, count);
 }
@@ -44,9 +44,9 @@ void CountConst::recompute(Timestamp ts) {
 void CountConst::notifyInputChanged(Timestamp ts, LocalId id) {
   assert(id < _vars.size());
   const Int newValue =
-      static_cast<Int>(_solver.value(ts, _vars[id]) == _needle);
+      static_cast<Int>(_solver->value(ts, _vars[id]) == _needle);
   const Int committedValue =
-      static_cast<Int>(_solver.committedValue(_vars[id]) == _needle);
+      static_cast<Int>(_solver->committedValue(_vars[id]) == _needle);
   if (newValue == committedValue) {
     return;
   }
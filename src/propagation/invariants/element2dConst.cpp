@@ -6,28 +6,33 @@
 
 namespace atlantis::propagation {
 
-static inline Int numCols(const std::vector<std::vector<Int>>& matrix) {
-  assert(std::all_of(matrix.begin(), matrix.end(), [&](const auto& col) {
-    return col.size() == matrix.front().size();
-  }));
-  return matrix.empty() ? 0 : static_cast<Int>(matrix.front().size());
-}
-
 Element2dConst::Element2dConst(SolverBase& solver, VarId output,
                                VarViewId index1, VarViewId index2,
-                               std::vector<std::vector<Int>>&& matrix,
-                               Int offset1, Int offset2)
+                               Matrix<Int>&& matrix, Int offset1, Int offset2)
     : Invariant(solver),
       _matrix(std::move(matrix)),
+      _rowMin(_matrix.numRows(), std::numeric_limits<Int>::max()),
+      _rowMax(_matrix.numRows(), std::numeric_limits<Int>::min()),
+      _colMin(_matrix.numCols(), std::numeric_limits<Int>::max()),
+      _colMax(_matrix.numCols(), std::numeric_limits<Int>::min()),
       _indices{index1, index2},
-      _dimensions{static_cast<Int>(_matrix.size()), numCols(_matrix)},
+      _dimensions{static_cast<Int>(_matrix.numRows()),
+                  static_cast<Int>(_matrix.numCols())},
       _offsets{offset1, offset2},
-      _output(output) {}
+      _output(output) {
+  for (size_t r = 0; r < _matrix.numRows(); ++r) {
+    for (size_t c = 0; c < _matrix.numCols(); ++c) {
+      _rowMin[r] = std::min(_rowMin[r], _matrix(r, c));
+      _rowMax[r] = std::max(_rowMax[r], _matrix(r, c));
+      _colMin[c] = std::min(_colMin[c], _matrix(r, c));
+      _colMax[c] = std::max(_colMax[c], _matrix(r, c));
+    }
+  }
+}
 
 Element2dConst::Element2dConst(SolverBase& solver, VarViewId output,
                                VarViewId index1, VarViewId index2,
-                               std::vector<std::vector<Int>>&& matrix,
-                               Int offset1, Int offset2)
+                               Matrix<Int>&& matrix, Int offset1, Int offset2)
     : Element2dConst(solver, VarId(output), index1, index2, std::move(matrix),
                      offset1, offset2) {
   assert(output.isVar());
@@ -35,8 +40,8 @@ Element2dConst::Element2dConst(SolverBase& solver, VarViewId output,
 
 void Element2dConst::registerVars() {
   assert(_id != NULL_ID);
-  _solver.registerInvariantInput(_id, _indices[0], LocalId{0}, false);
-  _solver.registerInvariantInput(_id, _indices[1], LocalId{1}, false);
+  _solver->registerInvariantInput(_id, _indices[0], LocalId{0}, false);
+  _solver->registerInvariantInput(_id, _indices[1], LocalId{1}, false);
   registerDefinedVar(_output);
 }
 
@@ -47,37 +52,55 @@ void Element2dConst::updateBounds(bool widenOnly) {
   std::array<Int, 2> iLb{0, 0};
   std::array<Int, 2> iUb{0, 0};
   for (size_t i = 0; i < 2; ++i) {
-    iLb[i] = std::max<Int>(_offsets[i], _solver.lowerBound(_indices[i]));
+    iLb[i] = std::max<Int>(_offsets[i], _solver->lowerBound(_indices[i]));
     iUb[i] = std::min<Int>(_dimensions[i] - 1 + _offsets[i],
-                           _solver.upperBound(_indices[i]));
+                           _solver->upperBound(_indices[i]));
     if (iLb[i] > iUb[i]) {
       iLb[i] = _offsets[i];
       iUb[i] = _dimensions[i] - 1 + _offsets[i];
     }
   }
 
-  for (Int i1 = iLb[0]; i1 <= iUb[0]; ++i1) {
-    assert(_offsets[0] <= i1);
-    assert(i1 - _offsets[0] < _dimensions[0]);
-    for (Int i2 = iLb[1]; i2 <= iUb[1]; ++i2) {
-      assert(_offsets[1] <= i2);
-      assert(i2 - _offsets[1] < _dimensions[1]);
-      lb = std::min(lb, _matrix[safeIndex1(i1)][safeIndex2(i2)]);
-      ub = std::max(ub, _matrix[safeIndex1(i1)][safeIndex2(i2)]);
+  if (_matrix.empty()) {
+    _solver->updateBounds(_output, lb, ub, widenOnly);
+    return;
+  }
+  const size_t r0 = safeIndex1(iLb[0]);
+  const size_t r1 = safeIndex1(iUb[0]);
+  const size_t c0 = safeIndex2(iLb[1]);
+  const size_t c1 = safeIndex2(iUb[1]);
+  if (c0 == 0 && c1 + 1 == _matrix.numCols()) {
+    // Every column can be selected:
+    for (size_t r = r0; r <= r1; ++r) {
+      lb = std::min(lb, _rowMin[r]);
+      ub = std::max(ub, _rowMax[r]);
+    }
+  } else if (r0 == 0 && r1 + 1 == _matrix.numRows()) {
+    // Every row can be selected:
+    for (size_t c = c0; c <= c1; ++c) {
+      lb = std::min(lb, _colMin[c]);
+      ub = std::max(ub, _colMax[c]);
+    }
+  } else {
+    for (size_t r = r0; r <= r1; ++r) {
+      const auto row = _matrix.row(r).subspan(c0, c1 - c0 + 1);
+      const auto [rowLb, rowUb] = std::minmax_element(row.begin(), row.end());
+      lb = std::min(lb, *rowLb);
+      ub = std::max(ub, *rowUb);
     }
   }
-  _solver.updateBounds(_output, lb, ub, widenOnly);
+  _solver->updateBounds(_output, lb, ub, widenOnly);
 }
 
 void Element2dConst::recompute(Timestamp ts) {
-  assert(safeIndex1(_solver.value(ts, _indices[0])) <
+  assert(safeIndex1(_solver->value(ts, _indices[0])) <
          static_cast<size_t>(_dimensions[0]));
-  assert(safeIndex2(_solver.value(ts, _indices[1])) <
+  assert(safeIndex2(_solver->value(ts, _indices[1])) <
          static_cast<size_t>(_dimensions[1]));
 
   updateValue(ts, _output,
-              _matrix[safeIndex1(_solver.value(ts, _indices[0]))]
-                     [safeIndex2(_solver.value(ts, _indices[1]))]);
+              _matrix(safeIndex1(_solver->value(ts, _indices[0])),
+                      safeIndex2(_solver->value(ts, _indices[1]))));
 }
 
 void Element2dConst::notifyInputChanged(Timestamp ts, LocalId) {
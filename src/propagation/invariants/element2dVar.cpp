@@ -6,29 +6,21 @@
 
 namespace atlantis::propagation {
 
-static inline Int numCols(
-    const std::vector<std::vector<VarViewId>>& varMatrix) {
-  assert(std::all_of(varMatrix.begin(), varMatrix.end(), [&](const auto& col) {
-    return col.size() == varMatrix.front().size();
-  }));
-  return varMatrix.empty() ? 0 : static_cast<Int>(varMatrix.front().size());
-}
-
 Element2dVar::Element2dVar(SolverBase& solver, VarId output, VarViewId index1,
-                           VarViewId index2,
-                           std::vector<std::vector<VarViewId>>&& varMatrix,
+                           VarViewId index2, Matrix<VarViewId>&& varMatrix,
                            Int offset1, Int offset2)
     : Invariant(solver),
       _varMatrix(std::move(varMatrix)),
       _indices{index1, index2},
-      _dimensions{static_cast<Int>(_varMatrix.size()), numCols(_varMatrix)},
+      _dimensions{static_cast<Int>(_varMatrix.numRows()),
+                  static_cast<Int>(_varMatrix.numCols())},
       _offsets{offset1, offset2},
       _output(output) {}
 
 Element2dVar::Element2dVar(SolverBase& solver, VarViewId output,
                            VarViewId index1, VarViewId index2,
-                           std::vector<std::vector<VarViewId>>&& varMatrix,
-                           Int offset1, Int offset2)
+                           Matrix<VarViewId>&& varMatrix, Int offset1,
+                           Int offset2)
     : Element2dVar(solver, VarId(output), index1, index2, std::move(varMatrix),
                    offset1, offset2) {
   assert(output.isVar());
@@ -36,12 +28,10 @@ Element2dVar::Element2dVar(SolverBase& solver, VarViewId output,
 
 void Element2dVar::registerVars() {
   assert(_id != NULL_ID);
-  _solver.registerInvariantInput(_id, _indices[0], LocalId(0), false);
-  _solver.registerInvariantInput(_id, _indices[1], LocalId(0), false);
-  for (const auto& varRow : _varMatrix) {
-    for (const VarViewId& input : varRow) {
-      _solver.registerInvariantInput(_id, input, LocalId(0), true);
-    }
+  _solver->registerInvariantInput(_id, _indices[0], LocalId(0), false);
+  _solver->registerInvariantInput(_id, _indices[1], LocalId(0), false);
+  for (const VarViewId& input : _varMatrix.data()) {
+    _solver->registerInvariantInput(_id, input, LocalId(0), true);
   }
   registerDefinedVar(_output);
 }
@@ -53,10 +43,10 @@ void Element2dVar::updateBounds(bool widenOnly) {
   std::array<Int, 2> iLb{0, 0};
   std::array<Int, 2> iUb{0, 0};
   for (size_t i = 0; i < 2; ++i) {
-    iLb[i] = std::max<Int>(_offsets[i], _solver.lowerBound(_indices[i]));
+    iLb[i] = std::max<Int>(_offsets[i], _solver->lowerBound(_indices[i]));
     iUb[i] = std::min<Int>(_dimensions[i] - 1 + _offsets[i],
-                           _solver.upperBound(_indices[i]));
-    if (iLb > iUb) {
+                           _solver->upperBound(_indices[i]));
+    if (iLb[i] > iUb[i]) {
       iLb[i] = _offsets[i];
       iUb[i] = _dimensions[i] - 1 + _offsets[i];
     }
@@ -65,32 +55,31 @@ void Element2dVar::updateBounds(bool widenOnly) {
   for (Int i1 = iLb[0]; i1 <= iUb[0]; ++i1) {
     assert(_offsets[0] <= i1);
     assert(i1 - _offsets[0] < _dimensions[0]);
+    const auto row = _varMatrix.row(safeIndex1(i1));
     for (Int i2 = iLb[1]; i2 <= iUb[1]; ++i2) {
       assert(_offsets[1] <= i2);
       assert(i2 - _offsets[1] < _dimensions[1]);
-      lb = std::min(
-          lb, _solver.lowerBound(_varMatrix[safeIndex1(i1)][safeIndex2(i2)]));
-      ub = std::max(
-          ub, _solver.upperBound(_varMatrix[safeIndex1(i1)][safeIndex2(i2)]));
+      lb = std::min(lb, _solver->lowerBound(row[safeIndex2(i2)]));
+      ub = std::max(ub, _solver->upperBound(row[safeIndex2(i2)]));
     }
   }
-  _solver.updateBounds(_output, lb, ub, widenOnly);
+  _solver->updateBounds(_output, lb, ub, widenOnly);
 }
 
 VarViewId Element2dVar::dynamicInputVar(Timestamp ts) const noexcept {
-  return _varMatrix[safeIndex1(_solver.value(ts, _indices[0]))]
-                   [safeIndex2(_solver.value(ts, _indices[1]))];
+  return _varMatrix(safeIndex1(_solver->value(ts, _indices[0])),
+                    safeIndex2(_solver->value(ts, _indices[1])));
 }
 
 void Element2dVar::recompute(Timestamp ts) {
-  assert(safeIndex1(_solver.value(ts, _indices[0])) <
+  assert(safeIndex1(_solver->value(ts, _indices[0])) <
          static_cast<size_t>(_dimensions[0]));
-  assert(safeIndex2(_solver.value(ts, _indices[1])) <
+  assert(safeIndex2(_solver->value(ts, _indices[1])) <
          static_cast<size_t>(_dimensions[1]));
   updateValue(ts, _output,
-              _solver.value(
-                  ts, _varMatrix[safeIndex1(_solver.value(ts, _indices[0]))]
-                                [safeIndex2(_solver.value(ts, _indices[1]))]));
+              _solver->value(
+                  ts, _varMatrix(safeIndex1(_solver->value(ts, _indices[0])),
+                                 safeIndex2(_solver->value(ts, _indices[1])))));
 }
 
 void Element2dVar::notifyInputChanged(Timestamp ts, LocalId) { recompute(ts); }
@@ -102,12 +91,12 @@ VarViewId Element2dVar::nextInput(Timestamp ts) {
     case 1:
       return _indices[1];
     case 2: {
-      assert(safeIndex1(_solver.value(ts, _indices[0])) <
+      assert(safeIndex1(_solver->value(ts, _indices[0])) <
              static_cast<size_t>(_dimensions[0]));
-      assert(safeIndex2(_solver.value(ts, _indices[1])) <
+      assert(safeIndex2(_solver->value(ts, _indices[1])) <
              static_cast<size_t>(_dimensions[1]));
-      return _varMatrix[safeIndex1(_solver.value(ts, _indices[0]))]
-                       [safeIndex2(_solver.value(ts, _indices[1]))];
+      return _varMatrix(safeIndex1(_solver->value(ts, _indices[0])),
+                        safeIndex2(_solver->value(ts, _indices[1])));
     }
     default:
       return NULL_ID;  // Done
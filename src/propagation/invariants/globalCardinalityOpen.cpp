@@ -4,8 +4,6 @@
 #include <cassert>
 #include <vector>
 
-#include "atlantis/propagation/variables/intVar.hpp"
-
 namespace atlantis::propagation {
 
 inline bool all_in_range(Int start, Int stop,
@@ -39,6 +37,7 @@ GlobalCardinalityOpen::GlobalCardinalityOpen(SolverBase& solver,
       _inputs(std::move(inputs)),
       _cover(std::move(cover)),
       _coverVarIndex(),
+      _sortedCover(),
       _counts(),
       _offset(0) {
   assert(_cover.size() == _outputs.size());
@@ -59,7 +58,7 @@ GlobalCardinalityOpen::GlobalCardinalityOpen(SolverBase& solver,
 void GlobalCardinalityOpen::registerVars() {
   assert(_id != NULL_ID);
   for (size_t i = 0; i < _inputs.size(); ++i) {
-    _solver.registerInvariantInput(_id, _inputs[i], LocalId(i), false);
+    _solver->registerInvariantInput(_id, _inputs[i], LocalId(i), false);
   }
   for (const VarId output : _outputs) {
     registerDefinedVar(output);
@@ -68,44 +67,51 @@ void GlobalCardinalityOpen::registerVars() {
 
 void GlobalCardinalityOpen::updateBounds(bool widenOnly) {
   for (const VarId output : _outputs) {
-    _solver.updateBounds(output, 0, static_cast<Int>(_inputs.size()),
-                         widenOnly);
+    _solver->updateBounds(output, 0, static_cast<Int>(_inputs.size()),
+                          widenOnly);
   }
 }
 
-void GlobalCardinalityOpen::close(Timestamp timestamp) {
+void GlobalCardinalityOpen::close(Timestamp) {
   const auto [lb, ub] = std::minmax_element(_cover.begin(), _cover.end());
   _offset = *lb;
-  _coverVarIndex.resize(*ub - *lb + 1, -1);
-  for (Int i = 0; i < static_cast<Int>(_cover.size()); ++i) {
-    assert(0 <= _cover[i] - _offset);
-    assert(_cover[i] - _offset < static_cast<Int>(_coverVarIndex.size()));
-    _coverVarIndex[_cover[i] - _offset] = i;
+  _coverVarIndex.clear();
+  _sortedCover.clear();
+  if (ValueCounts::isWide(*lb, *ub, _cover.size())) {
+    _sortedCover.reserve(_cover.size());
+    for (Int i = 0; i < static_cast<Int>(_cover.size()); ++i) {
+      _sortedCover.emplace_back(_cover[i], i);
+    }
+    std::sort(_sortedCover.begin(), _sortedCover.end());
+  } else {
+    _coverVarIndex.resize(*ub - *lb + 1, -1);
+    for (Int i = 0; i < static_cast<Int>(_cover.size()); ++i) {
+      assert(0 <= _cover[i] - _offset);
+      assert(_cover[i] - _offset < static_cast<Int>(_coverVarIndex.size()));
+      _coverVarIndex[_cover[i] - _offset] = i;
+    }
   }
-  _counts.resize(_outputs.size(), CommittableInt(timestamp, 0));
+  _counts.assign(_outputs.size(), 0);
 }
 
 void GlobalCardinalityOpen::recompute(Timestamp timestamp) {
-  for (CommittableInt& c : _counts) {
-    c.setValue(timestamp, 0);
-  }
+  _counts.fill(timestamp, 0);
 
   for (const auto& var : _inputs) {
-    increaseCount(timestamp, _solver.value(timestamp, var));
+    increaseCount(timestamp, _solver->value(timestamp, var));
   }
 
   for (size_t i = 0; i < _outputs.size(); ++i) {
-    assert(0 <= _cover[i] - _offset &&
-           _cover[i] - _offset < static_cast<Int>(_coverVarIndex.size()));
-    updateValue(timestamp, _outputs[i], _counts[i].value(timestamp));
+    assert(coverIndex(_cover[i]) == static_cast<Int>(i));
+    updateValue(timestamp, _outputs[i], _counts.value(timestamp, i));
   }
 }
 
 void GlobalCardinalityOpen::notifyInputChanged(Timestamp timestamp,
                                                LocalId localId) {
   assert(localId < _inputs.size());
-  const Int newValue = _solver.value(timestamp, _inputs[localId]);
-  const Int committedValue = _solver.committedValue(_inputs[localId]);
+  const Int newValue = _solver->value(timestamp, _inputs[localId]);
+  const Int committedValue = _solver->committedValue(_inputs[localId]);
   if (newValue == committedValue) {
     return;
   }
@@ -130,8 +136,6 @@ void GlobalCardinalityOpen::notifyCurrentInputChanged(Timestamp timestamp) {
 void GlobalCardinalityOpen::commit(Timestamp timestamp) {
   Invariant::commit(timestamp);
 
-  for (CommittableInt& CommittableInt : _counts) {
-    CommittableInt.commitIf(timestamp);
-  }
+  _counts.commitIf(timestamp);
 }
 }  // namespace atlantis::propagation
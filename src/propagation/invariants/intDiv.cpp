@@ -21,16 +21,16 @@ IntDiv::IntDiv(SolverBase& solver, VarViewId output, VarViewId numerator,
 
 void IntDiv::registerVars() {
   assert(_id != NULL_ID);
-  _solver.registerInvariantInput(_id, _numerator, 0, false);
-  _solver.registerInvariantInput(_id, _denominator, 0, false);
+  _solver->registerInvariantInput(_id, _numerator, 0, false);
+  _solver->registerInvariantInput(_id, _denominator, 0, false);
   registerDefinedVar(_output);
 }
 
 void IntDiv::updateBounds(bool widenOnly) {
-  const Int nomLb = _solver.lowerBound(_numerator);
-  const Int nomUb = _solver.upperBound(_numerator);
-  const Int denLb = _solver.lowerBound(_denominator);
-  const Int denUb = _solver.upperBound(_denominator);
+  const Int nomLb = _solver->lowerBound(_numerator);
+  const Int nomUb = _solver->upperBound(_numerator);
+  const Int denLb = _solver->lowerBound(_denominator);
+  const Int denUb = _solver->upperBound(_denominator);
 
   assert(denLb != 0 || denUb != 0);
 
@@ -58,14 +58,14 @@ void IntDiv::updateBounds(bool widenOnly) {
     outUb = std::max(outUb, std::max(nomLb / d, nomUb / d));
   }
 
-  _solver.updateBounds(_output, outLb, outUb, widenOnly);
+  _solver->updateBounds(_output, outLb, outUb, widenOnly);
 }
 
 void IntDiv::close(Timestamp) {
   assert(_id != NULL_ID);
 
-  const Int denLb = _solver.lowerBound(_denominator);
-  const Int denUb = _solver.upperBound(_denominator);
+  const Int denLb = _solver->lowerBound(_denominator);
+  const Int denUb = _solver->upperBound(_denominator);
 
   assert(denLb != 0 || denUb != 0);
   _zeroReplacement = (denLb < 0 && denUb <= 0) ? -1 : 1;
@@ -73,9 +73,9 @@ void IntDiv::close(Timestamp) {
 
 void IntDiv::recompute(Timestamp ts) {
   assert(_zeroReplacement != 0);
-  const Int denominator = _solver.value(ts, _denominator);
+  const Int denominator = _solver->value(ts, _denominator);
   updateValue(ts, _output,
-              _solver.value(ts, _numerator) /
+              _solver->value(ts, _numerator) /
                   (denominator != 0 ? denominator : _zeroReplacement));
 }
 
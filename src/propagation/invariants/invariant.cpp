@@ -10,14 +10,14 @@ void Invariant::registerDefinedVar(VarId id) {
   } else {
     _definedVars.push_back(id);
   }
-  _solver.registerDefinedVar(id, _id);
+  _solver->registerDefinedVar(id, _id);
 }
 
 void Invariant::updateValue(Timestamp ts, VarId id, Int val) {
-  _solver.updateValue(ts, id, val);
+  _solver->updateValue(ts, id, val);
 }
 
 void Invariant::incValue(Timestamp ts, VarId id, Int val) {
-  _solver.incValue(ts, id, val);
+  _solver->incValue(ts, id, val);
 }
 }  // namespace atlantis::propagation
@@ -1,7 +1,11 @@
 #include "atlantis/propagation/invariants/linear.hpp"
 
+#include <algorithm>
+#include <unordered_map>
 #include <utility>
 
+#include "atlantis/propagation/store/store.hpp"
+
 namespace atlantis::propagation {
 
 Linear::Linear(SolverBase& solver, VarId output, std::vector<Int>&& coeffs,
@@ -9,7 +13,9 @@ Linear::Linear(SolverBase& solver, VarId output, std::vector<Int>&& coeffs,
     : Invariant(solver),
       _output(output),
       _coeffs(std::move(coeffs)),
-      _varArray(std::move(varArray)) {}
+      _varArray(std::move(varArray)) {
+  foldAffineViews();
+}
 
 Linear::Linear(SolverBase& solver, VarViewId output, std::vector<Int>&& coeffs,
                std::vector<VarViewId>&& varArray)
@@ -28,13 +34,52 @@ Linear::Linear(SolverBase& solver, VarViewId output,
   assert(output.isVar());
 }
 
+void Linear::foldAffineViews() {
+  const Store& store = _solver->store();
+  if (std::none_of(_varArray.begin(), _varArray.end(),
+                   [&](const VarViewId input) {
+                     return input.isView() &&
+                            store.intViewSourceMap(ViewId(input)).has_value();
+                   })) {
+    return;
+  }
+  // The (new) local id of each source variable:
+  std::unordered_map<size_t, size_t> localIds;
+  size_t numInputs = 0;
+  for (size_t i = 0; i < _varArray.size(); ++i) {
+    VarViewId input = _varArray[i];
+    Int coeff = _coeffs[i];
+    if (input.isView()) {
+      const std::optional<AffineMap>& sourceMap =
+          store.intViewSourceMap(ViewId(input));
+      if (sourceMap.has_value()) {
+        _offset += coeff * sourceMap->offset;
+        coeff *= sourceMap->factor;
+        input = VarViewId(store.intViewSourceId(ViewId(input)), false);
+      }
+    }
+    if (input.isVar()) {
+      const auto [it, inserted] = localIds.emplace(size_t(input), numInputs);
+      if (!inserted) {
+        _coeffs[it->second] += coeff;
+        continue;
+      }
+    }
+    _varArray[numInputs] = input;
+    _coeffs[numInputs] = coeff;
+    ++numInputs;
+  }
+  _varArray.erase(_varArray.begin() + numInputs, _varArray.end());
+  _coeffs.erase(_coeffs.begin() + numInputs, _coeffs.end());
+}
+
 void Linear::registerVars() {
   // precondition: this invariant must be registered with the solver before it
   // is initialised.
   assert(_id != NULL_ID);
 
   for (size_t i = 0; i < _varArray.size(); ++i) {
-    _solver.registerInvariantInput(_id, _varArray[i], i, false);
+    _solver->registerInvariantInput(_id, _varArray[i], i, false);
   }
   registerDefinedVar(_output);
 }
@@ -42,21 +87,21 @@ void Linear::registerVars() {
 void Linear::updateBounds(bool widenOnly) {
   // precondition: this invariant must be registered with the solver before it
   // is initialised.
-  Int sumLb = 0;
-  Int sumUb = 0;
+  Int sumLb = _offset;
+  Int sumUb = _offset;
   for (size_t i = 0; i < _varArray.size(); ++i) {
-    const Int v1 = _coeffs[i] * _solver.lowerBound(_varArray[i]);
-    const Int v2 = _coeffs[i] * _solver.upperBound(_varArray[i]);
+    const Int v1 = _coeffs[i] * _solver->lowerBound(_varArray[i]);
+    const Int v2 = _coeffs[i] * _solver->upperBound(_varArray[i]);
     sumLb += std::min(v1, v2);
     sumUb += std::max(v1, v2);
   }
-  _solver.updateBounds(_output, sumLb, sumUb, widenOnly);
+  _solver->updateBounds(_output, sumLb, sumUb, widenOnly);
 }
 
 void Linear::recompute(Timestamp ts) {
-  Int sum = 0;
+  Int sum = _offset;
   for (size_t i = 0; i < _varArray.size(); ++i) {
-    sum += _coeffs[i] * _solver.value(ts, _varArray[i]);
+    sum += _coeffs[i] * _solver->value(ts, _varArray[i]);
   }
   updateValue(ts, _output, sum);
 }
@@ -64,8 +109,8 @@ void Linear::recompute(Timestamp ts) {
 void Linear::notifyInputChanged(Timestamp ts, LocalId id) {
   assert(id < _varArray.size());
   incValue(ts, _output,
-           (_solver.value(ts, _varArray[id]) -
-            _solver.committedValue(_varArray[id])) *
+           (_solver->value(ts, _varArray[id]) -
+            _solver->committedValue(_varArray[id])) *
                _coeffs[id]);
 }
 
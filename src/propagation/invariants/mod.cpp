@@ -19,26 +19,26 @@ Mod::Mod(SolverBase& solver, VarViewId output, VarViewId numerator,
 
 void Mod::registerVars() {
   assert(_id != NULL_ID);
-  _solver.registerInvariantInput(_id, _numerator, 0, false);
-  _solver.registerInvariantInput(_id, _denominator, 0, false);
+  _solver->registerInvariantInput(_id, _numerator, 0, false);
+  _solver->registerInvariantInput(_id, _denominator, 0, false);
   registerDefinedVar(_output);
 }
 
 void Mod::updateBounds(bool widenOnly) {
-  _solver.updateBounds(
-      _output, std::min(Int(0), _solver.lowerBound(_numerator)),
-      std::max(Int(0), _solver.upperBound(_numerator)), widenOnly);
+  _solver->updateBounds(
+      _output, std::min(Int(0), _solver->lowerBound(_numerator)),
+      std::max(Int(0), _solver->upperBound(_numerator)), widenOnly);
 }
 
 void Mod::close(Timestamp) {
-  assert(_solver.lowerBound(_denominator) != 0 ||
-         _solver.upperBound(_denominator) != 0);
+  assert(_solver->lowerBound(_denominator) != 0 ||
+         _solver->upperBound(_denominator) != 0);
 }
 
 void Mod::recompute(Timestamp ts) {
-  const Int denominator = _solver.value(ts, _denominator);
+  const Int denominator = _solver->value(ts, _denominator);
   updateValue(ts, _output,
-              _solver.value(ts, _numerator) %
+              _solver->value(ts, _numerator) %
                   std::abs(denominator != 0 ? denominator : 1));
 }
 
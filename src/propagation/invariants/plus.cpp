@@ -14,19 +14,20 @@ Plus::Plus(SolverBase& solver, VarViewId output, VarViewId x, VarViewId y)
 
 void Plus::registerVars() {
   assert(_id != NULL_ID);
-  _solver.registerInvariantInput(_id, _x, 0, false);
-  _solver.registerInvariantInput(_id, _y, 0, false);
+  _solver->registerInvariantInput(_id, _x, 0, false);
+  _solver->registerInvariantInput(_id, _y, 0, false);
   registerDefinedVar(_output);
 }
 
 void Plus::updateBounds(bool widenOnly) {
-  _solver.updateBounds(_output, _solver.lowerBound(_x) + _solver.lowerBound(_y),
-                       _solver.upperBound(_x) + _solver.upperBound(_y),
-                       widenOnly);
+  _solver->updateBounds(_output,
+                        _solver->lowerBound(_x) + _solver->lowerBound(_y),
+                        _solver->upperBound(_x) + _solver->upperBound(_y),
+                        widenOnly);
 }
 
 void Plus::recompute(Timestamp ts) {
-  updateValue(ts, _output, _solver.value(ts, _x) + _solver.value(ts, _y));
+  updateValue(ts, _output, _solver->value(ts, _x) + _solver->value(ts, _y));
 }
 
 VarViewId Plus::nextInput(Timestamp ts) {
@@ -20,17 +20,17 @@ Pow::Pow(SolverBase& solver, VarViewId output, VarViewId base,
 void Pow::registerVars() {
   assert(_id != NULL_ID);
 
-  _solver.registerInvariantInput(_id, _base, 0, false);
-  _solver.registerInvariantInput(_id, _exponent, 0, false);
+  _solver->registerInvariantInput(_id, _base, 0, false);
+  _solver->registerInvariantInput(_id, _exponent, 0, false);
   registerDefinedVar(_output);
 }
 
 void Pow::updateBounds(bool widenOnly) {
-  const Int baseLb = _solver.lowerBound(_base);
-  const Int baseUb = _solver.upperBound(_base);
+  const Int baseLb = _solver->lowerBound(_base);
+  const Int baseUb = _solver->upperBound(_base);
 
-  const Int expLb = _solver.lowerBound(_exponent);
-  const Int expUb = _solver.upperBound(_exponent);
+  const Int expLb = _solver->lowerBound(_exponent);
+  const Int expUb = _solver->upperBound(_exponent);
 
   Int outLb = std::numeric_limits<Int>::max();
   Int outUb = std::numeric_limits<Int>::min();
@@ -80,12 +80,12 @@ void Pow::updateBounds(bool widenOnly) {
     outUb = std::max(outUb, pow(baseLb, expUb - (expUb % 2 == 1)));
   }
 
-  _solver.updateBounds(_output, outLb, outUb, widenOnly);
+  _solver->updateBounds(_output, outLb, outUb, widenOnly);
 }
 
 void Pow::recompute(Timestamp ts) {
-  const Int baseVal = _solver.value(ts, _base);
-  const Int expVal = _solver.value(ts, _exponent);
+  const Int baseVal = _solver->value(ts, _base);
+  const Int expVal = _solver->value(ts, _exponent);
   updateValue(ts, _output,
               pow_zero_replacement(baseVal, expVal, _zeroReplacement));
 }
@@ -15,24 +15,24 @@ Times::Times(SolverBase& solver, VarViewId output, VarViewId x, VarViewId y)
 
 void Times::registerVars() {
   assert(_id != NULL_ID);
-  _solver.registerInvariantInput(_id, _x, 0, false);
-  _solver.registerInvariantInput(_id, _y, 0, false);
+  _solver->registerInvariantInput(_id, _x, 0, false);
+  _solver->registerInvariantInput(_id, _y, 0, false);
   registerDefinedVar(_output);
 }
 
 void Times::updateBounds(bool widenOnly) {
-  const Int xLb = _solver.lowerBound(_x);
-  const Int xUb = _solver.upperBound(_x);
-  const Int yLb = _solver.lowerBound(_y);
-  const Int yUb = _solver.upperBound(_y);
+  const Int xLb = _solver->lowerBound(_x);
+  const Int xUb = _solver->upperBound(_x);
+  const Int yLb = _solver->lowerBound(_y);
+  const Int yUb = _solver->upperBound(_y);
   const std::array<const Int, 4> vals{xLb * yLb, xLb * yUb, xUb * yLb,
                                       xUb * yUb};
   const auto [lb, ub] = std::minmax_element(vals.begin(), vals.end());
-  _solver.updateBounds(_output, *lb, *ub, widenOnly);
+  _solver->updateBounds(_output, *lb, *ub, widenOnly);
 }
 
 void Times::recompute(Timestamp ts) {
-  updateValue(ts, _output, _solver.value(ts, _x) * _solver.value(ts, _y));
+  updateValue(ts, _output, _solver->value(ts, _x) * _solver->value(ts, _y));
 }
 
 VarViewId Times::nextInput(Timestamp ts) {
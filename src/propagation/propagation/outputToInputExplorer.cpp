@@ -16,72 +16,56 @@ OutputToInputExplorer::OutputToInputExplorer(Solver& e)
       _invariantIsOnStack(),
       _searchVarAncestors(),
       _onPropagationPath(),
+      _propagationPathStack(),
       _outputToInputMarkingMode(OutputToInputMarkingMode::NONE) {}
 
-void OutputToInputExplorer::outputToInputStaticMarking() {
-  std::vector<bool> varVisited(_solver.numVars());
-
-  for (size_t idx = 0;
-       idx < std::min(_searchVarAncestors.size(), _solver.numVars()); ++idx) {
-    _searchVarAncestors[idx].clear();
-  }
-
-  _searchVarAncestors.resize(_solver.numVars());
-  assert(std::all_of(
-      _searchVarAncestors.begin(), _searchVarAncestors.end(),
-      [&](const std::unordered_set<VarId> anc) { return anc.empty(); }));
-
-  for (const VarId searchVar : _solver.searchVars()) {
-    std::fill(varVisited.begin(), varVisited.end(), false);
-    std::vector<VarId> stack;
-    stack.reserve(_solver.numVars());
-
-    stack.emplace_back(searchVar);
-    varVisited[searchVar] = true;
-
-    while (!stack.empty()) {
-      const VarId id = stack.back();
-      stack.pop_back();
-      _searchVarAncestors[id].emplace(searchVar);
+OutputToInputExplorer::OutputToInputExplorer(Solver& e,
+                                             const OutputToInputExplorer& other)
+    : _solver(e),
+      _varStack(other._varStack),
+      _varStackIdx(other._varStackIdx),
+      _invariantStack(other._invariantStack),
+      _invariantStackIdx(other._invariantStackIdx),
+      _varComputedAt(other._varComputedAt),
+      _invariantComputedAt(other._invariantComputedAt),
+      _invariantIsOnStack(other._invariantIsOnStack),
+      _searchVarAncestors(other._searchVarAncestors),
+      _onPropagationPath(other._onPropagationPath),
+      _propagationPathTimestamp(other._propagationPathTimestamp),
+      _propagationPathStack(other._propagationPathStack),
+      _outputToInputMarkingMode(other._outputToInputMarkingMode) {}
 
-      for (const PropagationGraph::ListeningInvariantData& invariantData :
-           _solver.listeningInvariantData(id)) {
-        for (const VarId outputVar :
-             _solver.varsDefinedBy(invariantData.invariantId)) {
-          if (!varVisited[outputVar]) {
-            varVisited[outputVar] = true;
-            stack.push_back(outputVar);
-          }
-        }
-      }
-    }
-  }
+void OutputToInputExplorer::outputToInputStaticMarking() {
+  _searchVarAncestors.build(_solver);
 }
 
-void OutputToInputExplorer::inputToOutputExplorationMarking() {
-  std::vector<VarId> stack;
-  stack.reserve(_solver.numVars());
-
-  _onPropagationPath.assign(_solver.numVars(), false);
+void OutputToInputExplorer::inputToOutputExplorationMarking(Timestamp ts) {
+  // The marks of earlier timestamps are implicitly cleared:
+  _propagationPathTimestamp = ts;
+  _onPropagationPath.resize(_solver.numVars(), NULL_TIMESTAMP);
+  assert(_propagationPathStack.empty());
 
   for (const VarId modifiedDecisionVar : _solver.modifiedSearchVar()) {
     assert(modifiedDecisionVar < _onPropagationPath.size());
-    assert(!_onPropagationPath.at(modifiedDecisionVar));
+    if (_onPropagationPath[modifiedDecisionVar] == ts) {
+      // Already marked by an earlier exploration at this timestamp:
+      continue;
+    }
 
-    stack.emplace_back(modifiedDecisionVar);
-    _onPropagationPath[modifiedDecisionVar] = true;
+    _propagationPathStack.emplace_back(modifiedDecisionVar);
+    _onPropagationPath[modifiedDecisionVar] = ts;
 
-    while (!stack.empty()) {
-      const VarId id = stack.back();
-      stack.pop_back();
+    while (!_propagationPathStack.empty()) {
+      const VarId id = _propagationPathStack.back();
+      _propagationPathStack.pop_back();
       for (const PropagationGraph::ListeningInvariantData& invariantData :
            _solver.listeningInvariantData(id)) {
         for (const VarId outputVar :
              _solver.varsDefinedBy(invariantData.invariantId)) {
           assert(outputVar < _onPropagationPath.size());
-          if (!_onPropagationPath[outputVar]) {
-            _onPropagationPath[outputVar] = true;
-            stack.emplace_back(outputVar);
+          if (_onPropagationPath[outputVar] != ts) {
+            _onPropagationPath[outputVar] = ts;
+            _propagationPathStack.emplace_back(outputVar);
           }
         }
       }
@@ -104,6 +88,7 @@ void OutputToInputExplorer::close() {
                 OutputToInputMarkingMode::INPUT_TO_OUTPUT_EXPLORATION) {
     _onPropagationPath.clear();
   }
+  _propagationPathTimestamp = NULL_TIMESTAMP;
   if constexpr (MarkingMode ==
                 OutputToInputMarkingMode::OUTPUT_TO_INPUT_STATIC) {
     outputToInputStaticMarking();
@@ -115,7 +100,7 @@ void OutputToInputExplorer::propagate(Timestamp ts) {
     propagate<OutputToInputMarkingMode::NONE>(ts);
   } else if (_outputToInputMarkingMode ==
              OutputToInputMarkingMode::INPUT_TO_OUTPUT_EXPLORATION) {
-    inputToOutputExplorationMarking();
+    inputToOutputExplorationMarking(ts);
     propagate<OutputToInputMarkingMode::INPUT_TO_OUTPUT_EXPLORATION>(ts);
   } else if (_outputToInputMarkingMode ==
              OutputToInputMarkingMode::OUTPUT_TO_INPUT_STATIC) {
@@ -133,15 +118,14 @@ template <OutputToInputMarkingMode MarkingMode>
 bool OutputToInputExplorer::isMarked(VarId id) {
   if constexpr (MarkingMode ==
                 OutputToInputMarkingMode::OUTPUT_TO_INPUT_STATIC) {
-    assert(id < _searchVarAncestors.size());
     return std::any_of(_solver.modifiedSearchVar().begin(),
-                       _solver.modifiedSearchVar().end(), [&](size_t ancestor) {
-                         return _searchVarAncestors[id].contains(ancestor);
+                       _solver.modifiedSearchVar().end(), [&](VarId ancestor) {
+                         return _searchVarAncestors.isAncestor(ancestor, id);
                        });
   } else if constexpr (MarkingMode ==
                        OutputToInputMarkingMode::INPUT_TO_OUTPUT_EXPLORATION) {
     assert(id < _onPropagationPath.size());
-    return _onPropagationPath[id];
+    return _onPropagationPath[id] == _propagationPathTimestamp;
   } else {
     // We should check this with constant expressions
     assert(false);
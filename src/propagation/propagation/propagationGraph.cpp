@@ -39,6 +39,28 @@ PropagationGraph::PropagationGraph(const Store& store, size_t expectedSize)
   _varPosition.reserve(expectedSize);
 }
 
+PropagationGraph::PropagationGraph(const Store& store,
+                                   const PropagationGraph& other)
+    : _isEvaluationVar(other._isEvaluationVar),
+      _isSearchVar(other._isSearchVar),
+      _searchVars(other._searchVars),
+      _evaluationVars(other._evaluationVars),
+      _store(store),
+      _definingInvariant(other._definingInvariant),
+      _varsDefinedByInvariant(other._varsDefinedByInvariant),
+      _inputVars(other._inputVars),
+      _isDynamicInvariant(other._isDynamicInvariant),
+      _listeningInvariantData(other._listeningInvariantData),
+      _varsInLayer(other._varsInLayer),
+      _varLayerIndex(other._varLayerIndex),
+      _varPosition(other._varPosition),
+      _layerPositionOffset(other._layerPositionOffset),
+      _layerHasDynamicCycle(other._layerHasDynamicCycle),
+      _hasDynamicCycle(other._hasDynamicCycle),
+      _numInvariants(other._numInvariants),
+      _numVars(other._numVars),
+      _propagationQueue(other._propagationQueue) {}
+
 void PropagationGraph::registerInvariant(
     [[maybe_unused]] InvariantId invariantId) {
   // Everything must be registered in sequence.
@@ -78,7 +100,8 @@ void PropagationGraph::registerInvariantInput(InvariantId invariantId,
       _isDynamicInvariant[invariantId] || isDynamicInput;
 
   assert(varId < _listeningInvariantData.size());
-  _listeningInvariantData[varId].emplace_back(invariantId, localId);
+  _listeningInvariantData[varId].emplace_back(invariantId, localId,
+                                              isDynamicInput);
 
   assert(invariantId < _inputVars.size());
   _inputVars[invariantId].emplace_back(varId, isDynamicInput);
@@ -0,0 +1,151 @@
+#include "atlantis/propagation/propagation/searchVarAncestors.hpp"
+
+#include "atlantis/propagation/solver.hpp"
+#include "atlantis/utils/stronglyConnectedComponents.hpp"
+
+namespace atlantis::propagation {
+
+namespace {
+
+using Intervals = std::vector<SearchVarAncestors::Interval>;
+
+/**
+ * @return the union of the sorted and disjoint intervals in a and b.
+ */
+Intervals merge(const Intervals& a, const Intervals& b) {
+  Intervals result;
+  result.reserve(a.size() + b.size());
+  size_t i = 0;
+  size_t j = 0;
+  while (i < a.size() || j < b.size()) {
+    const SearchVarAncestors::Interval& next =
+        j == b.size() || (i < a.size() && a[i].begin <= b[j].begin) ? a[i++]
+                                                                    : b[j++];
+    if (!result.empty() && next.begin <= result.back().end) {
+      result.back().end = std::max(result.back().end, next.end);
+    } else {
+      result.emplace_back(next);
+    }
+  }
+  return result;
+}
+
+/**
+ * Calls visit(w) for each variable w that is defined by an invariant that
+ * variable v is an input to.
+ */
+template <class Visit>
+void forEachSuccessor(const Solver& solver, const VarId v, Visit&& visit) {
+  for (const auto& listening : solver.listeningInvariantData(v)) {
+    for (const VarId w : solver.varsDefinedBy(listening.invariantId)) {
+      visit(w);
+    }
+  }
+}
+
+}  // namespace
+
+void SearchVarAncestors::build(const Solver& solver) {
+  clear();
+  const size_t numVars = solver.numVars();
+
+  std::vector<VarId> searchVars(solver.searchVars());
+  std::sort(searchVars.begin(), searchVars.end());
+  _searchVarNumber.assign(numVars, NOT_SEARCH_VAR);
+  for (size_t i = 0; i < searchVars.size(); ++i) {
+    _searchVarNumber[searchVars[i]] = static_cast<uint32_t>(i);
+  }
+
+  // The components in topological order, where componentOf[v] is the index
+  // of the component of v:
+  std::vector<std::vector<VarId>> components = stronglyConnectedComponents(
+      numVars, [&](const VarId v, auto&& visit) {
+        forEachSuccessor(solver, v, visit);
+      });
+  std::reverse(components.begin(), components.end());
+  std::vector<size_t> componentOf(numVars, NULL_ID);
+  for (size_t c = 0; c < components.size(); ++c) {
+    for (const VarId id : components[c]) {
+      componentOf[id] = c;
+    }
+  }
+
+  // The ancestors that are propagated to each component from its
+  // predecessors, where pendingRange[c] is the range of the (already stored)
+  // ancestors of a predecessor if the pending ancestors are equal to them:
+  std::vector<Intervals> pending(components.size());
+  std::vector<Range> pendingRange(components.size(), Range{NULL_ID, NULL_ID});
+  std::vector<Range> componentRange(components.size());
+
+  for (size_t c = 0; c < components.size(); ++c) {
+    Intervals ancestors = std::move(pending[c]);
+    Range range = pendingRange[c];
+    std::vector<uint32_t> numbers;
+    for (const VarId id : components[c]) {
+      if (_searchVarNumber[id] != NOT_SEARCH_VAR) {
+        numbers.emplace_back(_searchVarNumber[id]);
+      }
+    }
+    if (!numbers.empty()) {
+      std::sort(numbers.begin(), numbers.end());
+      Intervals own;
+      for (const uint32_t number : numbers) {
+        if (!own.empty() && own.back().end == number) {
+          ++own.back().end;
+        } else {
+          own.emplace_back(Interval{number, number + 1});
+        }
+      }
+      ancestors = merge(ancestors, own);
+      range.begin = NULL_ID;
+    }
+    if (range.begin == NULL_ID) {
+      range.begin = _intervals.size();
+      _intervals.insert(_intervals.end(), ancestors.begin(), ancestors.end());
+      range.end = _intervals.size();
+    }
+    componentRange[c] = range;
+
+    for (const VarId id : components[c]) {
+      forEachSuccessor(solver, id, [&](const VarId successor) {
+        const size_t s = componentOf[successor];
+        if (s == c) {
+          return;
+        }
+        if (pending[s].empty() && pendingRange[s].begin == NULL_ID) {
+          pending[s] = ancestors;
+          pendingRange[s] = range;
+        } else if (pendingRange[s].begin != range.begin) {
+          Intervals merged = merge(pending[s], ancestors);
+          if (merged == ancestors) {
+            // The ancestors of c subsume those pending for s:
+            pending[s] = std::move(merged);
+            pendingRange[s] = range;
+          } else if (merged != pending[s]) {
+            pending[s] = std::move(merged);
+            pendingRange[s].begin = NULL_ID;
+          }
+        }
+      });
+    }
+  }
+
+  _ranges.resize(numVars);
+  for (VarId id = 0; id < numVars; ++id) {
+    _ranges[id] = componentRange[componentOf[id]];
+  }
+}
+
+void SearchVarAncestors::clear() {
+  _searchVarNumber.clear();
+  _ranges.clear();
+  _intervals.clear();
+}
+
+size_t SearchVarAncestors::memoryUsage() const noexcept {
+  return _searchVarNumber.capacity() * sizeof(uint32_t) +
+         _ranges.capacity() * sizeof(Range) +
+         _intervals.capacity() * sizeof(Interval);
+}
+
+}  // namespace atlantis::propagation
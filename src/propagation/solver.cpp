@@ -1,5 +1,6 @@
 #include "atlantis/propagation/solver.hpp"
 
+#include <algorithm>
 #include <deque>
 #include <iostream>
 #include <queue>
@@ -11,9 +12,36 @@ Solver::Solver()
     : _propagationMode(PropagationMode::INPUT_TO_OUTPUT),
       _propGraph(_store),
       _outputToInputExplorer(*this),
-      _isEnqueued(),
+      _enqueuedAt(),
       _modifiedSearchVars() {}
 
+Solver::Solver(const Solver& other)
+    : SolverBase(other),
+      _propagationMode(other._propagationMode),
+      _numVars(other._numVars),
+      _propGraph(_store, other._propGraph),
+      _outputToInputExplorer(*this, other._outputToInputExplorer),
+      _enqueuedAt(other._enqueuedAt),
+      _layerQueue(other._layerQueue),
+      _layerQueueIndex(other._layerQueueIndex),
+      _modifiedSearchVars(other._modifiedSearchVars),
+      _profiler(other._profiler == nullptr
+                    ? nullptr
+                    : std::make_unique<InvariantProfiler>(
+                          other._profiler->numInvariants())) {
+  _probedVars.reserve(other._probedVars.capacity());
+}
+
+std::unique_ptr<Solver> Solver::clone() const {
+  if (_isOpen) {
+    throw SolverOpenException("Cannot copy an open solver.");
+  }
+  if (_solverState != SolverState::IDLE || _isProbingBatch) {
+    throw SolverStateException("Solver must be idle when copied.");
+  }
+  return std::unique_ptr<Solver>(new Solver(*this));
+}
+
 void Solver::open() {
   if (_isOpen) {
     throw SolverOpenException("SolverBase already open.");
@@ -38,6 +66,9 @@ void Solver::close() {
     std::cout << "foo";
   }
 
+  // A variable is propagated at most once per probe:
+  _probedVars.reserve(numVars());
+
   if (_propGraph.numLayers() > 1) {
     _layerQueueIndex.assign(_propGraph.numLayers(), 0);
     _layerQueue.resize(_propGraph.numLayers(), std::vector<VarId>{});
@@ -67,7 +98,7 @@ void Solver::close() {
   // then it is in the set of modified search variables
   assert(std::all_of(
       searchVars().begin(), searchVars().end(), [&](const VarId varId) {
-        return _store.intVar(varId).hasChanged(_currentTimestamp) ==
+        return _store.intVarValue(varId).hasChanged(_currentTimestamp) ==
                _modifiedSearchVars.contains(varId);
       }));
 
@@ -81,24 +112,22 @@ void Solver::close() {
   // assert that decsion variable varId is no longer modified.
   assert(std::all_of(_modifiedSearchVars.begin(), _modifiedSearchVars.end(),
                      [&](const size_t varId) {
-                       return !_store.intVar(varId).hasChanged(
+                       return !_store.intVarValue(varId).hasChanged(
                            _currentTimestamp);
                      }));
 }
 
 //---------------------Registration---------------------
 void Solver::enqueueDefinedVar(VarId id) {
-  assert(id < _isEnqueued.size());
-  if (_isEnqueued[id]) {
+  if (isEnqueued(id)) {
     return;
   }
   _propGraph.enqueuePropagationQueue(id);
-  _isEnqueued[id] = true;
+  markEnqueued(id);
 }
 
 void Solver::enqueueDefinedVar(VarId id, size_t curLayer) {
-  assert(id < _isEnqueued.size());
-  if (_isEnqueued[id]) {
+  if (isEnqueued(id)) {
     return;
   }
   const size_t varLayer = _propGraph.varLayer(id);
@@ -108,11 +137,11 @@ void Solver::enqueueDefinedVar(VarId id, size_t curLayer) {
     assert(
         std::all_of(_layerQueue[varLayer].begin(),
                     _layerQueue[varLayer].begin() + _layerQueueIndex[varLayer],
-                    [&](const VarId vId) { return _isEnqueued.at(vId); }));
+                    [&](const VarId vId) { return isEnqueued(vId); }));
     _layerQueue[varLayer][_layerQueueIndex[varLayer]] = id;
     ++_layerQueueIndex[varLayer];
   }
-  _isEnqueued[id] = true;
+  markEnqueued(id);
 }
 
 void Solver::registerInvariantInput(InvariantId invariantId, VarViewId inputId,
@@ -129,20 +158,43 @@ void Solver::registerVar(VarId id) {
   _numVars++;
   _propGraph.registerVar(id);
   _outputToInputExplorer.registerVar(id);
-  assert(id == _isEnqueued.size());
-  _isEnqueued.emplace_back(false);
+  assert(id == _enqueuedAt.size());
+  _enqueuedAt.emplace_back(NULL_TIMESTAMP);
+  _modifiedSearchVars.reserve(id + 1);
 }
 
 void Solver::registerInvariant(InvariantId invariantId) {
   _propGraph.registerInvariant(invariantId);
   _outputToInputExplorer.registerInvariant(invariantId);
+  if (_profiler != nullptr) {
+    _profiler->registerInvariant(invariantId);
+  }
+}
+
+void Solver::enableProfiling() {
+  if (_profiler == nullptr) {
+    _profiler = std::make_unique<InvariantProfiler>(numInvariants());
+  }
+}
+
+VarId Solver::profiledNextInput(InvariantId invariantId) {
+  InvariantProfilerScope scope(_profiler.get(), invariantId,
+                               InvariantCall::NEXT_INPUT);
+  return sourceId(_store.invariant(invariantId).nextInput(_currentTimestamp));
+}
+
+void Solver::profiledNotifyCurrentInputChanged(InvariantId invariantId) {
+  InvariantProfilerScope scope(_profiler.get(), invariantId,
+                               InvariantCall::NOTIFY);
+  _store.invariant(invariantId).notifyCurrentInputChanged(_currentTimestamp);
 }
 
 //---------------------Propagation---------------------
 
 VarId Solver::dequeueComputedVar(Timestamp) {
+  // In output-to-input mode, the queue is only propagated by endCommit:
   assert(propagationMode() == PropagationMode::INPUT_TO_OUTPUT ||
-         _solverState == SolverState::COMMIT);
+         _solverState == SolverState::PROCESSING);
   if (_propGraph.propagationQueueEmpty()) {
     return NULL_ID;
   }
@@ -150,8 +202,10 @@ VarId Solver::dequeueComputedVar(Timestamp) {
 }
 
 void Solver::clearPropagationQueue() {
+  // The variables that are still marked as enqueued were marked at an earlier
+  // timestamp and are implicitly unmarked by the new timestamp:
   _propGraph.clearPropagationQueue();
-  _isEnqueued.assign(_isEnqueued.size(), false);
+  std::fill(_layerQueueIndex.begin(), _layerQueueIndex.end(), 0);
 }
 
 void Solver::closeInvariants() {
@@ -183,8 +237,14 @@ void Solver::beginProbe() {
 
 void Solver::query(VarViewId id) {
   assert(!_isOpen);
-  assert(_solverState != SolverState::IDLE &&
-         _solverState != SolverState::PROCESSING);
+  assert(_solverState != SolverState::PROCESSING);
+  assert(_solverState != SolverState::IDLE || _isProbingBatch);
+
+  if (_solverState == SolverState::IDLE) {
+    // Queried for every probe of the batch:
+    _batchQueriedVars.emplace_back(sourceId(id));
+    return;
+  }
 
   if (_propagationMode != PropagationMode::INPUT_TO_OUTPUT) {
     _outputToInputExplorer.registerForPropagation(_currentTimestamp,
@@ -196,13 +256,17 @@ void Solver::endProbe() {
   assert(_solverState == SolverState::PROBE);
 
   _solverState = SolverState::PROCESSING;
+  _lastProbeTimestamp = NULL_TIMESTAMP;
   try {
     if (_propagationMode == PropagationMode::INPUT_TO_OUTPUT) {
+      _probedVars.clear();
       if (_propGraph.numLayers() == 1) {
         propagate<CommitMode::NO_COMMIT, true>();
       } else {
         propagate<CommitMode::NO_COMMIT, false>();
       }
+      // Every modified variable has been propagated:
+      _lastProbeTimestamp = _currentTimestamp;
     } else {
       // Assert that if decision variable varId is modified,
       // then it is in the set of modified decision variables
@@ -210,10 +274,15 @@ void Solver::endProbe() {
                  OutputToInputMarkingMode::OUTPUT_TO_INPUT_STATIC ||
              std::all_of(searchVars().begin(), searchVars().end(),
                          [&](const VarId varId) {
-                           return _store.intVar(varId).hasChanged(
+                           return _store.intVarValue(varId).hasChanged(
                                       _currentTimestamp) ==
                                   _modifiedSearchVars.contains(varId);
                          }));
+      if (_isProbingBatch) {
+        for (const VarId id : _batchQueriedVars) {
+          _outputToInputExplorer.registerForPropagation(_currentTimestamp, id);
+        }
+      }
       outputToInputPropagate();
     }
     _solverState = SolverState::IDLE;
@@ -223,11 +292,44 @@ void Solver::endProbe() {
   }
 }
 
+void Solver::beginProbeBatch() {
+  assert(!_isOpen);
+  assert(_solverState == SolverState::IDLE);
+  assert(!_isProbingBatch);
+
+  _outputToInputExplorer.clearRegisteredVars();
+  _batchQueriedVars.clear();
+  _isProbingBatch = true;
+}
+
+void Solver::endProbeBatch() {
+  assert(_solverState == SolverState::IDLE);
+  assert(_isProbingBatch);
+
+  _batchQueriedVars.clear();
+  _isProbingBatch = false;
+}
+
+void Solver::abortProbeBatch() {
+  assert(!_isOpen);
+  assert(_isProbingBatch);
+  assert(_solverState != SolverState::COMMIT);
+
+  // The values of the unfinished move or probe are at the current timestamp,
+  // which the next move increments past:
+  clearPropagationQueue();
+  _lastProbeTimestamp = NULL_TIMESTAMP;
+  _solverState = SolverState::IDLE;
+  endProbeBatch();
+}
+
 void Solver::beginCommit() {
   assert(!_isOpen);
   assert(_solverState == SolverState::IDLE);
+  assert(!_isProbingBatch);
 
   _outputToInputExplorer.clearRegisteredVars();
+  _lastProbeTimestamp = NULL_TIMESTAMP;
 
   _solverState = SolverState::COMMIT;
 }
@@ -245,7 +347,7 @@ void Solver::endCommit() {
                OutputToInputMarkingMode::OUTPUT_TO_INPUT_STATIC ||
            std::all_of(searchVars().begin(), searchVars().end(),
                        [&](const VarId varId) {
-                         return _store.intVar(varId).hasChanged(
+                         return _store.intVarValue(varId).hasChanged(
                                     _currentTimestamp) ==
                                 _modifiedSearchVars.contains(varId);
                        }));
@@ -259,7 +361,7 @@ void Solver::endCommit() {
     assert(_propagationMode != PropagationMode::OUTPUT_TO_INPUT ||
            std::all_of(_modifiedSearchVars.begin(), _modifiedSearchVars.end(),
                        [&](const size_t varId) {
-                         return !_store.intVar(varId).hasChanged(
+                         return !_store.intVarValue(varId).hasChanged(
                              _currentTimestamp);
                        }));
     _solverState = SolverState::IDLE;
@@ -269,6 +371,25 @@ void Solver::endCommit() {
   }
 }
 
+void Solver::commitLastProbe() {
+  assert(canCommitLastProbe(_currentTimestamp));
+  // Commit in the order of propagation, as endCommit does:
+  for (const VarId varId : _probedVars) {
+    const InvariantId definingInvariant = _propGraph.definingInvariant(varId);
+    if (definingInvariant != NULL_ID) {
+      Invariant& defInv = _store.invariant(definingInvariant);
+      if (varId == defInv.primaryDefinedVar()) {
+        InvariantProfilerScope scope(_profiler.get(), definingInvariant,
+                                     InvariantCall::COMMIT);
+        defInv.commit(_currentTimestamp);
+      }
+    }
+    commitIf(_currentTimestamp, varId);
+  }
+  _probedVars.clear();
+  _lastProbeTimestamp = NULL_TIMESTAMP;
+}
+
 void Solver::propagateOnClose() {
   std::vector<bool> committedInvariants(_propGraph.numInvariants());
   committedInvariants.assign(_propGraph.numInvariants(), false);
@@ -289,7 +410,13 @@ void Solver::propagateOnClose() {
       if (defInv != NULL_ID && !committedInvariants[defInv]) {
         committedInvariants[defInv] = true;
         Invariant& inv = _store.invariant(defInv);
-        inv.recompute(_currentTimestamp);
+        {
+          InvariantProfilerScope scope(_profiler.get(), defInv,
+                                       InvariantCall::RECOMPUTE);
+          inv.recompute(_currentTimestamp);
+        }
+        InvariantProfilerScope scope(_profiler.get(), defInv,
+                                     InvariantCall::COMMIT);
         inv.commit(_currentTimestamp);
       }
       commitIf(_currentTimestamp, varId);
@@ -310,6 +437,9 @@ void Solver::propagate() {
          queuedVar != NULL_ID;
          queuedVar = dequeueComputedVar(_currentTimestamp)) {
       assert(_propGraph.varLayer(queuedVar) == curLayer);
+      if constexpr (Mode == CommitMode::NO_COMMIT) {
+        _probedVars.emplace_back(queuedVar);
+      }
       // queuedVar has been computed under _currentTimestamp
       const InvariantId definingInvariant =
           _propGraph.definingInvariant(VarId(queuedVar));
@@ -323,13 +453,15 @@ void Solver::propagate() {
           // enqueue all modified defined vars:
           for (const VarId defVarId : defInv.nonPrimaryDefinedVars()) {
             if (hasChanged(_currentTimestamp, defVarId)) {
-              assert(!_isEnqueued.at(defVarId));
+              assert(!isEnqueued(defVarId));
               _propGraph.enqueuePropagationQueue(defVarId);
-              _isEnqueued[defVarId] = true;
+              markEnqueued(defVarId);
             }
           }
           if constexpr (Mode == CommitMode::COMMIT) {
             // Commit
+            InvariantProfilerScope scope(_profiler.get(), definingInvariant,
+                                         InvariantCall::COMMIT);
             defInv.commit(_currentTimestamp);
           }
         }
@@ -341,23 +473,27 @@ void Solver::propagate() {
 
       // For each invariant queuedVar is an input to:
       for (const auto& toNotify : listeningInvariantData(queuedVar)) {
+        if (toNotify.isDynamicInput &&
+            _store.dynamicInputVar(_currentTimestamp, toNotify.invariantId) !=
+                queuedVar) {
+          // The invariant only listens to its active dynamic input. If the
+          // active input changes, then so does a static input (such as the
+          // index of an element invariant), which always notifies the
+          // invariant:
+          continue;
+        }
         Invariant& invariant = _store.invariant(toNotify.invariantId);
         const VarId primaryDefinedVar = invariant.primaryDefinedVar();
         assert(primaryDefinedVar != NULL_ID);
         assert(toNotify.invariantId != definingInvariant);
-        invariant.notifyInputChanged(_currentTimestamp, toNotify.localId);
-        if constexpr (SingleLayer) {
-          assert(_propGraph.varPosition(queuedVar) <
-                 _propGraph.varPosition(primaryDefinedVar));
-        } else {
-          if (_propGraph.varPosition(queuedVar) >
-              _propGraph.varPosition(primaryDefinedVar)) {
-            assert(_propGraph.isDynamicInvariant(toNotify.invariantId) &&
-                   _store.dynamicInputVar(_currentTimestamp,
-                                          toNotify.invariantId) != queuedVar);
-            continue;
-          }
+        {
+          InvariantProfilerScope scope(_profiler.get(), toNotify.invariantId,
+                                       InvariantCall::NOTIFY);
+          invariant.notifyInputChanged(_currentTimestamp, toNotify.localId);
         }
+        // Only inactive dynamic inputs can come after the defined var:
+        assert(_propGraph.varPosition(queuedVar) <
+               _propGraph.varPosition(primaryDefinedVar));
         if constexpr (SingleLayer) {
           assert(_propGraph.varLayer(primaryDefinedVar) == 0);
           enqueueDefinedVar(primaryDefinedVar);
@@ -396,7 +532,7 @@ void Solver::propagate() {
       }
       // Add all queued variables to the propagation queue:
       for (size_t i = 0; i < _layerQueueIndex[curLayer]; ++i) {
-        assert(_isEnqueued.at(_layerQueue[curLayer][i]));
+        assert(isEnqueued(_layerQueue[curLayer][i]));
         _propGraph.enqueuePropagationQueue(_layerQueue[curLayer][i]);
       }
       _layerQueueIndex[curLayer] = 0;
@@ -5,6 +5,12 @@ namespace atlantis::propagation {
 SolverBase::SolverBase()
     : _currentTimestamp(NULL_TIMESTAMP + 1), _isOpen(false), _store() {}
 
+SolverBase::SolverBase(const SolverBase& other)
+    : _currentTimestamp(other._currentTimestamp),
+      _isOpen(other._isOpen),
+      _solverState(other._solverState),
+      _store(other._store, *this) {}
+
 //---------------------Registration---------------------
 
 VarViewId SolverBase::makeIntVar(Int initValue, Int lowerBound,
@@ -1,39 +1,113 @@
 #include "atlantis/propagation/store/store.hpp"
 
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+#include "atlantis/exceptions/exceptions.hpp"
+
 namespace atlantis::propagation {
 
-Store::Store() : _intVars(), _invariants(), _intViews(), _intViewSourceId() {}
+Store::Store()
+    : _intVarValues(),
+      _intVarLowerBounds(),
+      _intVarUpperBounds(),
+      _invariants(),
+      _intViews(),
+      _intViewSourceId(),
+      _intViewSourceMap(),
+      _invariantCloners(),
+      _intViewCloners() {}
+
+Store::Store(const Store& other, SolverBase& solver)
+    : _intVarValues(other._intVarValues),
+      _intVarLowerBounds(other._intVarLowerBounds),
+      _intVarUpperBounds(other._intVarUpperBounds),
+      _invariants(),
+      _intViews(),
+      _intViewSourceId(other._intViewSourceId),
+      _intViewSourceMap(other._intViewSourceMap),
+      _invariantCloners(other._invariantCloners),
+      _intViewCloners(other._intViewCloners) {
+  _invariants.reserve(other._invariants.size());
+  for (size_t i = 0; i < other._invariants.size(); ++i) {
+    if (_invariantCloners[i] == nullptr) {
+      throw SolverStateException("Invariant " + std::to_string(i) +
+                                 " cannot be copied.");
+    }
+    _invariants.emplace_back(
+        _invariantCloners[i](*other._invariants[i], solver));
+  }
+  _intViews.reserve(other._intViews.size());
+  for (size_t i = 0; i < other._intViews.size(); ++i) {
+    if (_intViewCloners[i] == nullptr) {
+      throw SolverStateException("View " + std::to_string(i) +
+                                 " cannot be copied.");
+    }
+    _intViews.emplace_back(_intViewCloners[i](*other._intViews[i], solver));
+  }
+}
 
 VarViewId Store::createIntVar(Timestamp ts, Int initValue, Int lowerBound,
                               Int upperBound) {
-  VarId vId(_intVars.size());
-  const VarViewId newId = VarViewId(vId, false);
-  _intVars.emplace_back(ts, vId, initValue, lowerBound, upperBound);
+  if (lowerBound > upperBound) {
+    throw std::out_of_range(
+        "Lower bound must be smaller than or equal to upper bound");
+  }
+  if (initValue < lowerBound || upperBound < initValue) {
+    throw std::out_of_range("value must be inside bounds");
+  }
+  const VarViewId newId = VarViewId(_intVarValues.size(), false);
+  _intVarValues.emplace_back(ts, initValue);
+  _intVarLowerBounds.emplace_back(lowerBound);
+  _intVarUpperBounds.emplace_back(upperBound);
   return newId;
 }
 
-InvariantId Store::createInvariantFromPtr(std::unique_ptr<Invariant>&& ptr) {
+void Store::updateIntVarBounds(VarId id, Int lowerBound, Int upperBound,
+                               bool widenOnly) {
+  Int& lb = _intVarLowerBounds[id];
+  Int& ub = _intVarUpperBounds[id];
+  lb = widenOnly ? std::min(lb, lowerBound) : lowerBound;
+  ub = widenOnly ? std::max(ub, upperBound) : upperBound;
+  if (lb > ub) {
+    throw std::out_of_range(
+        "Lower bound must be smaller than or equal to upper bound");
+  }
+}
+
+InvariantId Store::createInvariantFromPtr(std::unique_ptr<Invariant>&& ptr,
+                                          InvariantCloner cloner) {
   auto newId = InvariantId(_invariants.size());
   ptr->setId(newId);
   _invariants.emplace_back(std::move(ptr));
+  _invariantCloners.emplace_back(cloner);
   return newId;
 }
 
-VarViewId Store::createIntViewFromPtr(std::unique_ptr<IntView>&& ptr) {
+VarViewId Store::createIntViewFromPtr(std::unique_ptr<IntView>&& ptr,
+                                      IntViewCloner cloner) {
   const VarViewId newId = VarViewId(_intViews.size(), true);
   ptr->setId(ViewId(newId));
   const VarViewId parentId = ptr->parentId();
   const VarViewId source =
       parentId.isVar() ? parentId : _intViewSourceId[size_t(parentId)];
+  // Collapse the chain of affine views from the source into a single map:
+  std::optional<AffineMap> sourceMap = ptr->affineMap();
+  if (sourceMap.has_value() && parentId.isView()) {
+    const std::optional<AffineMap>& parentMap =
+        _intViewSourceMap[size_t(parentId)];
+    sourceMap = parentMap.has_value()
+                    ? std::optional<AffineMap>(sourceMap->compose(*parentMap))
+                    : std::nullopt;
+  }
   _intViews.emplace_back(std::move(ptr));
+  _intViewCloners.emplace_back(cloner);
   _intViewSourceId.emplace_back(VarId(source));
+  _intViewSourceMap.emplace_back(sourceMap);
   return newId;
 }
 
-IntVar& Store::intVar(VarId id) { return _intVars[id]; }
-
-const IntVar& Store::constIntVar(VarId id) const { return _intVars.at(id); }
-
 IntView& Store::intView(ViewId id) { return *(_intViews[id]); }
 
 const IntView& Store::constIntView(ViewId id) const {
@@ -45,10 +119,6 @@ VarId Store::sourceId(VarViewId id) const noexcept {
                        : (id.isVar() ? VarId(id) : intViewSourceId(VarId(id)));
 }
 
-VarId Store::intViewSourceId(ViewId id) const {
-  return _intViewSourceId.at(id);
-}
-
 Invariant& Store::invariant(InvariantId invariantId) {
   return *(_invariants[invariantId]);
 }
@@ -57,10 +127,6 @@ const Invariant& Store::constInvariant(InvariantId invariantId) const {
   return *(_invariants.at(invariantId));
 }
 
-std::vector<IntVar>::iterator Store::intVarBegin() { return _intVars.begin(); }
-
-std::vector<IntVar>::iterator Store::intVarEnd() { return _intVars.end(); }
-
 std::vector<std::unique_ptr<Invariant>>::iterator Store::invariantBegin() {
   return _invariants.begin();
 }
@@ -68,7 +134,7 @@ std::vector<std::unique_ptr<Invariant>>::iterator Store::invariantEnd() {
   return _invariants.end();
 }
 
-size_t Store::numVars() const { return _intVars.size(); }
+size_t Store::numVars() const { return _intVarValues.size(); }
 
 size_t Store::numInvariants() const { return _invariants.size(); }
 
@@ -0,0 +1,144 @@
+#include "atlantis/propagation/utils/invariantProfiler.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <nlohmann/json.hpp>
+#include <numeric>
+#include <string_view>
+#include <thread>
+#include <typeinfo>
+
+#include "atlantis/propagation/store/store.hpp"
+#include "atlantis/utils/type.hpp"
+
+namespace atlantis::propagation {
+
+using nlohmann::json;
+
+static constexpr std::array<std::string_view, InvariantProfiler::NUM_CALLS>
+    callNames{"notify", "nextInput", "recompute", "commit"};
+
+double InvariantProfiler::ticksPerSecond() {
+#ifdef ATLANTIS_PROFILER_RDTSC
+  // The time stamp counter is calibrated (once) against the steady clock:
+  static const double calibrated = [] {
+    const auto startTime = std::chrono::steady_clock::now();
+    const uint64_t startTicks = now();
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    const uint64_t endTicks = now();
+    const std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - startTime;
+    return static_cast<double>(endTicks - startTicks) / elapsed.count();
+  }();
+  return calibrated;
+#else
+  return static_cast<double>(std::chrono::steady_clock::period::den) /
+         static_cast<double>(std::chrono::steady_clock::period::num);
+#endif
+}
+
+static void add(InvariantProfiler::Counters& sum,
+                const InvariantProfiler::Counters& counters) {
+  for (size_t c = 0; c < InvariantProfiler::NUM_CALLS; ++c) {
+    sum.calls[c] += counters.calls[c];
+    sum.ticks[c] += counters.ticks[c];
+  }
+}
+
+void InvariantProfiler::merge(const InvariantProfiler& other) {
+  if (other._counters.size() > _counters.size()) {
+    _counters.resize(other._counters.size());
+  }
+  for (size_t i = 0; i < other._counters.size(); ++i) {
+    add(_counters[i], other._counters[i]);
+  }
+}
+
+static uint64_t totalTicks(const InvariantProfiler::Counters& counters) {
+  uint64_t total = 0;
+  for (const uint64_t ticks : counters.ticks) {
+    total += ticks;
+  }
+  return total;
+}
+
+static json toJson(const InvariantProfiler::Counters& counters,
+                   double ticksPerSecond) {
+  json entry;
+  for (size_t c = 0; c < InvariantProfiler::NUM_CALLS; ++c) {
+    entry[std::string(callNames[c])] = {
+        {"calls", counters.calls[c]},
+        {"seconds", static_cast<double>(counters.ticks[c]) / ticksPerSecond}};
+  }
+  entry["seconds"] = static_cast<double>(totalTicks(counters)) / ticksPerSecond;
+  return entry;
+}
+
+static std::string invariantTypeName(const Invariant& invariant) {
+  std::string name = demangle(typeid(invariant).name());
+  // Drop the namespace:
+  const size_t pos = name.rfind("::");
+  return pos == std::string::npos ? name : name.substr(pos + 2);
+}
+
+static json toJsonArray(
+    const std::map<std::string, InvariantProfiler::Counters>& groups,
+    const std::string& key, double ticksPerSecond) {
+  std::vector<std::pair<std::string, InvariantProfiler::Counters>> sorted(
+      groups.begin(), groups.end());
+  std::stable_sort(sorted.begin(), sorted.end(),
+                   [](const auto& a, const auto& b) {
+                     return totalTicks(a.second) > totalTicks(b.second);
+                   });
+  json array = json::array();
+  for (const auto& [name, counters] : sorted) {
+    json entry = toJson(counters, ticksPerSecond);
+    entry[key] = name;
+    array.emplace_back(std::move(entry));
+  }
+  return array;
+}
+
+void InvariantProfiler::writeJson(
+    std::ostream& out, const Store& store,
+    const std::vector<std::string>& constraintNames) const {
+  const double tps = ticksPerSecond();
+  const size_t numInvariants =
+      std::min(_counters.size(), store.numInvariants());
+
+  std::vector<std::string> constraints(numInvariants, "other");
+  std::vector<std::string> types(numInvariants);
+  std::map<std::string, Counters> perConstraint;
+  std::map<std::string, Counters> perType;
+  for (size_t i = 0; i < numInvariants; ++i) {
+    if (i < constraintNames.size() && !constraintNames[i].empty()) {
+      constraints[i] = constraintNames[i];
+    }
+    types[i] = invariantTypeName(store.constInvariant(InvariantId(i)));
+    add(perConstraint[constraints[i]], _counters[i]);
+    add(perType[types[i]], _counters[i]);
+  }
+
+  std::vector<size_t> order(numInvariants);
+  std::iota(order.begin(), order.end(), size_t{0});
+  std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+    return totalTicks(_counters[a]) > totalTicks(_counters[b]);
+  });
+  json invariants = json::array();
+  for (const size_t i : order) {
+    json entry = toJson(_counters[i], tps);
+    entry["id"] = i;
+    entry["constraint"] = constraints[i];
+    entry["type"] = types[i];
+    invariants.emplace_back(std::move(entry));
+  }
+
+  json report;
+  report["constraints"] = toJsonArray(perConstraint, "constraint", tps);
+  report["types"] = toJsonArray(perType, "type", tps);
+  report["invariants"] = std::move(invariants);
+  out << report.dump(2) << std::endl;
+}
+
+}  // namespace atlantis::propagation
@@ -0,0 +1,135 @@
+#include "atlantis/propagation/utils/valueCounts.hpp"
+
+#include <algorithm>
+#include <bit>
+
+namespace atlantis::propagation {
+
+// A dense table is used as long as it has at most this many entries per
+// counted input:
+static constexpr UInt DENSE_ENTRIES_PER_KEY = 32;
+// Tables of at most this many entries are always dense:
+static constexpr UInt MAX_SMALL_TABLE = 4096;
+
+bool ValueCounts::isWide(Int lb, Int ub, size_t numKeys) noexcept {
+  if (ub < lb) {
+    return false;
+  }
+  const UInt width = static_cast<UInt>(ub) - static_cast<UInt>(lb) + 1;
+  return width > MAX_SMALL_TABLE &&
+         width / DENSE_ENTRIES_PER_KEY > std::max<UInt>(1, numKeys);
+}
+
+void ValueCounts::assign(Int lb, Int ub, size_t numInputs) {
+  assert(lb > EMPTY || ub < lb);
+  _lb = lb;
+  _ub = ub;
+  _isSparse = isWide(lb, ub, numInputs);
+  _changedSlots.clear();
+  _changedTimestamp = NULL_TIMESTAMP;
+  if (!_isSparse) {
+    _dense.assign(ub < lb ? 0 : static_cast<size_t>(ub - lb + 1), 0);
+    _slots.clear();
+    _liveSlots.clear();
+    return;
+  }
+  _dense.clear();
+  // At most numInputs values have a committed count and at most numInputs
+  // values have a count at the current timestamp. A capacity of at least
+  // four times that keeps the load factor at most 1/4 after a rehash:
+  resizeSlots(std::bit_ceil(std::max<size_t>(16, 8 * numInputs)));
+  _changedSlots.reserve(_slots.size());
+  _liveSlots.reserve(_slots.size());
+}
+
+void ValueCounts::resizeSlots(size_t capacity) {
+  assert(std::has_single_bit(capacity));
+  _slots.assign(capacity, Slot{EMPTY, CommittableInt(NULL_TIMESTAMP, 0)});
+  _shift = 64 - static_cast<size_t>(std::countr_zero(capacity));
+  _numOccupied = 0;
+}
+
+size_t ValueCounts::insertSlot(Timestamp ts, Int key) {
+  assert(_isSparse);
+  if (2 * (_numOccupied + 1) > _slots.size()) {
+    rehash(ts);
+  }
+  const size_t mask = _slots.size() - 1;
+  size_t i = home(key);
+  while (_slots[i].key != EMPTY) {
+    assert(_slots[i].key != key);
+    i = (i + 1) & mask;
+  }
+  _slots[i].key = key;
+  _slots[i].count = CommittableInt(NULL_TIMESTAMP, 0);
+  ++_numOccupied;
+  return i;
+}
+
+void ValueCounts::rehash(Timestamp ts) {
+  assert(_changedTimestamp == ts);
+  // Only the values with a count (committed or at ts) are kept:
+  _liveSlots.clear();
+  for (const Slot& slot : _slots) {
+    if (slot.key != EMPTY &&
+        (slot.count.committedValue() != 0 || slot.count.value(ts) != 0)) {
+      _liveSlots.emplace_back(slot);
+    }
+  }
+  size_t capacity = _slots.size();
+  while (4 * (_liveSlots.size() + 1) > capacity) {
+    capacity *= 2;
+  }
+  resizeSlots(capacity);
+  _changedSlots.clear();
+  const size_t mask = _slots.size() - 1;
+  for (const Slot& slot : _liveSlots) {
+    size_t i = home(slot.key);
+    while (_slots[i].key != EMPTY) {
+      i = (i + 1) & mask;
+    }
+    _slots[i] = slot;
+    ++_numOccupied;
+    if (slot.count.tmpTimestamp() == ts) {
+      _changedSlots.emplace_back(i);
+    }
+  }
+}
+
+void ValueCounts::reset(Timestamp ts) {
+  if (!_isSparse) {
+    _dense.fill(ts, 0);
+    return;
+  }
+  if (_changedTimestamp != ts) {
+    _changedSlots.clear();
+    _changedTimestamp = ts;
+  }
+  for (size_t i = 0; i < _slots.size(); ++i) {
+    CommittableInt& count = _slots[i].count;
+    if (_slots[i].key == EMPTY || count.value(ts) == 0) {
+      continue;
+    }
+    if (count.tmpTimestamp() != ts) {
+      _changedSlots.emplace_back(i);
+    }
+    count.setValue(ts, 0);
+  }
+}
+
+void ValueCounts::commitIf(Timestamp ts) {
+  if (!_isSparse) {
+    _dense.commitIf(ts);
+    return;
+  }
+  if (_changedTimestamp != ts) {
+    return;
+  }
+  for (const size_t i : _changedSlots) {
+    // Resetting the timestamp makes later writes at ts mark the slot again:
+    _slots[i].count = CommittableInt(NULL_TIMESTAMP, _slots[i].count.value(ts));
+  }
+  _changedSlots.clear();
+}
+
+}  // namespace atlantis::propagation
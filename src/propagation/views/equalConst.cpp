@@ -10,16 +10,16 @@ EqualConst::EqualConst(SolverBase& solver, VarViewId parentId, Int val)
     : IntView(solver, parentId), _val(val) {}
 
 Int EqualConst::value(Timestamp ts) {
-  return compute(_solver.value(ts, _parentId), _val);
+  return compute(_solver->value(ts, _parentId), _val);
 }
 
 Int EqualConst::committedValue() {
-  return compute(_solver.committedValue(_parentId), _val);
+  return compute(_solver->committedValue(_parentId), _val);
 }
 
 Int EqualConst::lowerBound() const {
-  const Int lb = _solver.lowerBound(_parentId);
-  const Int ub = _solver.upperBound(_parentId);
+  const Int lb = _solver->lowerBound(_parentId);
+  const Int ub = _solver->upperBound(_parentId);
   if (lb <= _val && _val <= ub) {
     return Int(0);
   }
@@ -27,8 +27,8 @@ Int EqualConst::lowerBound() const {
 }
 
 Int EqualConst::upperBound() const {
-  return std::max(compute(_solver.lowerBound(_parentId), _val),
-                  compute(_solver.upperBound(_parentId), _val));
+  return std::max(compute(_solver->lowerBound(_parentId), _val),
+                  compute(_solver->upperBound(_parentId), _val));
 }
 
 }  // namespace atlantis::propagation
@@ -7,20 +7,20 @@ IfThenElseConst::IfThenElseConst(SolverBase& solver, VarViewId parentId,
     : IntView(solver, parentId), _values{thenVal, elseVal}, _condVal(condVal) {}
 
 Int IfThenElseConst::value(Timestamp ts) {
-  return _values[_solver.value(ts, _parentId) == _condVal ? 0 : 1];
+  return _values[_solver->value(ts, _parentId) == _condVal ? 0 : 1];
 }
 
 Int IfThenElseConst::committedValue() {
-  return _values[_solver.committedValue(_parentId) == _condVal ? 0 : 1];
+  return _values[_solver->committedValue(_parentId) == _condVal ? 0 : 1];
 }
 
 Int IfThenElseConst::lowerBound() const {
-  if (_condVal == _solver.lowerBound(_parentId) &&
-      _condVal == _solver.upperBound(_parentId)) {
+  if (_condVal == _solver->lowerBound(_parentId) &&
+      _condVal == _solver->upperBound(_parentId)) {
     // always true, take then case:
     return _values[0];
-  } else if (_condVal < _solver.lowerBound(_parentId) ||
-             _solver.upperBound(_parentId) < _condVal) {
+  } else if (_condVal < _solver->lowerBound(_parentId) ||
+             _solver->upperBound(_parentId) < _condVal) {
     // always false, take else case:
     return _values[1];
   }
@@ -28,12 +28,12 @@ Int IfThenElseConst::lowerBound() const {
 }
 
 Int IfThenElseConst::upperBound() const {
-  if (_condVal == _solver.lowerBound(_parentId) &&
-      _condVal == _solver.upperBound(_parentId)) {
+  if (_condVal == _solver->lowerBound(_parentId) &&
+      _condVal == _solver->upperBound(_parentId)) {
     // always true, take then case:
     return _values[0];
-  } else if (_condVal < _solver.lowerBound(_parentId) ||
-             _solver.upperBound(_parentId) < _condVal) {
+  } else if (_condVal < _solver->lowerBound(_parentId) ||
+             _solver->upperBound(_parentId) < _condVal) {
     // always false, take else case:
     return _values[1];
   }
@@ -55,7 +55,7 @@ Int InDomain::compute(const Int val) const {
 }
 
 Int InDomain::value(Timestamp ts) {
-  const Int val = _solver.value(ts, _parentId);
+  const Int val = _solver->value(ts, _parentId);
   if (_cache.get(ts).first != val) {
     _cache.set(ts, std::pair<Int, Int>{val, compute(val)});
   }
@@ -63,7 +63,7 @@ Int InDomain::value(Timestamp ts) {
 }
 
 Int InDomain::committedValue() {
-  const Int val = _solver.committedValue(_parentId);
+  const Int val = _solver->committedValue(_parentId);
   if (_cache.get(_cache.tmpTimestamp()).first != val) {
     _cache.commitValue(std::pair<Int, Int>{val, compute(val)});
   }
@@ -71,8 +71,8 @@ Int InDomain::committedValue() {
 }
 
 Int InDomain::lowerBound() const {
-  const Int parentLb = _solver.lowerBound(_parentId);
-  const Int parentUb = _solver.upperBound(_parentId);
+  const Int parentLb = _solver->lowerBound(_parentId);
+  const Int parentUb = _solver->upperBound(_parentId);
   Int minViol = std::numeric_limits<Int>::max();
   for (const auto& [dLb, dUb] : _domain) {
     if (parentUb < dLb) {
@@ -88,8 +88,8 @@ Int InDomain::lowerBound() const {
 }
 
 Int InDomain::upperBound() const {
-  const Int parentLb = _solver.lowerBound(_parentId);
-  const Int parentUb = _solver.upperBound(_parentId);
+  const Int parentLb = _solver->lowerBound(_parentId);
+  const Int parentUb = _solver->upperBound(_parentId);
   Int maxViol = std::numeric_limits<Int>::max();
   for (const auto& [dLb, dUb] : _domain) {
     if (parentUb < dLb) {
@@ -11,17 +11,17 @@ InIntervalConst::InIntervalConst(SolverBase& solver, VarViewId parentId, Int lb,
     : IntView(solver, parentId), _lb(lb), _ub(ub) {}
 
 Int InIntervalConst::value(Timestamp ts) {
-  const Int val = compute(_solver.value(ts, _parentId), _lb, _ub);
+  const Int val = compute(_solver->value(ts, _parentId), _lb, _ub);
   return val;
 }
 
 Int InIntervalConst::committedValue() {
-  return compute(_solver.committedValue(_parentId), _lb, _ub);
+  return compute(_solver->committedValue(_parentId), _lb, _ub);
 }
 
 Int InIntervalConst::lowerBound() const {
-  const Int lb = _solver.lowerBound(_parentId);
-  const Int ub = _solver.upperBound(_parentId);
+  const Int lb = _solver->lowerBound(_parentId);
+  const Int ub = _solver->upperBound(_parentId);
   if (ub < _lb || _ub < lb) {
     return 1;
   }
@@ -29,8 +29,8 @@ Int InIntervalConst::lowerBound() const {
 }
 
 Int InIntervalConst::upperBound() const {
-  const Int lb = _solver.lowerBound(_parentId);
-  const Int ub = _solver.upperBound(_parentId);
+  const Int lb = _solver->lowerBound(_parentId);
+  const Int ub = _solver->upperBound(_parentId);
   if (_lb <= lb && ub <= _ub) {
     return 0;
   }
@@ -35,7 +35,7 @@ InSparseDomain::InSparseDomain(SolverBase& solver, VarViewId parentId,
 }
 
 Int InSparseDomain::value(Timestamp ts) {
-  const Int val = _solver.value(ts, _parentId);
+  const Int val = _solver->value(ts, _parentId);
   if (val < _offset) {
     return _offset - val;
   }
@@ -46,7 +46,7 @@ Int InSparseDomain::value(Timestamp ts) {
 }
 
 Int InSparseDomain::committedValue() {
-  const Int val = _solver.committedValue(_parentId);
+  const Int val = _solver->committedValue(_parentId);
   if (val < _offset) {
     return _offset - val;
   }
@@ -57,8 +57,8 @@ Int InSparseDomain::committedValue() {
 }
 
 Int InSparseDomain::lowerBound() const {
-  const Int parentLb = _solver.lowerBound(_parentId);
-  const Int parentUb = _solver.upperBound(_parentId);
+  const Int parentLb = _solver->lowerBound(_parentId);
+  const Int parentUb = _solver->upperBound(_parentId);
   const Int dLb = _offset;
   const Int dUb = _offset + static_cast<Int>(_valueViolation.size()) - 1;
 
@@ -76,8 +76,8 @@ Int InSparseDomain::lowerBound() const {
 }
 
 Int InSparseDomain::upperBound() const {
-  const Int parentLb = _solver.lowerBound(_parentId);
-  const Int parentUb = _solver.upperBound(_parentId);
+  const Int parentLb = _solver->lowerBound(_parentId);
+  const Int parentUb = _solver->upperBound(_parentId);
   const Int dLb = _offset;
   const Int dUb = _offset + static_cast<Int>(_valueViolation.size()) - 1;
 
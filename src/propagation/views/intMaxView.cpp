@@ -6,19 +6,19 @@ IntMaxView::IntMaxView(SolverBase& solver, VarViewId parentId, Int max)
     : IntView(solver, parentId), _max(max) {}
 
 Int IntMaxView::value(Timestamp ts) {
-  return std::max<Int>(_max, _solver.value(ts, _parentId));
+  return std::max<Int>(_max, _solver->value(ts, _parentId));
 }
 
 Int IntMaxView::committedValue() {
-  return std::max<Int>(_max, _solver.committedValue(_parentId));
+  return std::max<Int>(_max, _solver->committedValue(_parentId));
 }
 
 Int IntMaxView::lowerBound() const {
-  return std::max<Int>(_max, _solver.lowerBound(_parentId));
+  return std::max<Int>(_max, _solver->lowerBound(_parentId));
 }
 
 Int IntMaxView::upperBound() const {
-  return std::max<Int>(_max, _solver.upperBound(_parentId));
+  return std::max<Int>(_max, _solver->upperBound(_parentId));
 }
 
 }  // namespace atlantis::propagation
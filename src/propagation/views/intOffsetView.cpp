@@ -6,19 +6,23 @@ IntOffsetView::IntOffsetView(SolverBase& solver, VarViewId parentId, Int offset)
     : IntView(solver, parentId), _offset(offset) {}
 
 Int IntOffsetView::value(Timestamp ts) {
-  return _offset + _solver.value(ts, _parentId);
+  return _offset + _solver->value(ts, _parentId);
 }
 
 Int IntOffsetView::committedValue() {
-  return _offset + _solver.committedValue(_parentId);
+  return _offset + _solver->committedValue(_parentId);
 }
 
 Int IntOffsetView::lowerBound() const {
-  return _offset + _solver.lowerBound(_parentId);
+  return _offset + _solver->lowerBound(_parentId);
 }
 
 Int IntOffsetView::upperBound() const {
-  return _offset + _solver.upperBound(_parentId);
+  return _offset + _solver->upperBound(_parentId);
+}
+
+std::optional<AffineMap> IntOffsetView::affineMap() const {
+  return AffineMap{1, _offset};
 }
 
 }  // namespace atlantis::propagation
@@ -10,11 +10,11 @@ ModView::ModView(SolverBase& solver, VarViewId parentId, Int denominator)
 }
 
 Int ModView::value(Timestamp ts) {
-  return _solver.value(ts, _parentId) % _denominator;
+  return _solver->value(ts, _parentId) % _denominator;
 }
 
 Int ModView::committedValue() {
-  return _solver.committedValue(_parentId) % _denominator;
+  return _solver->committedValue(_parentId) % _denominator;
 }
 
 Int ModView::lowerBound() const { return 0; }
@@ -8,11 +8,11 @@ Violation2BoolView::Violation2BoolView(SolverBase& solver, VarViewId parentId)
     : IntView(solver, parentId) {}
 
 Int Violation2BoolView::value(Timestamp ts) {
-  return convert(_solver.value(ts, _parentId));
+  return convert(_solver->value(ts, _parentId));
 }
 
 Int Violation2BoolView::committedValue() {
-  return convert(_solver.committedValue(_parentId));
+  return convert(_solver->committedValue(_parentId));
 }
 
 Int Violation2BoolView::lowerBound() const { return 0; }
@@ -3,8 +3,6 @@
 #include <cassert>
 #include <limits>
 
-#include "atlantis/propagation/variables/intVar.hpp"
-
 namespace atlantis::propagation {
 
 /**
@@ -14,8 +12,7 @@ AllDifferent::AllDifferent(SolverBase& solver, VarId violationId,
                            std::vector<VarViewId>&& vars)
     : ViolationInvariant(solver, violationId),
       _vars(std::move(vars)),
-      _counts(),
-      _offset(0) {}
+      _counts() {}
 
 AllDifferent::AllDifferent(SolverBase& solver, VarViewId violationId,
                            std::vector<VarViewId>&& vars)
@@ -26,17 +23,17 @@ AllDifferent::AllDifferent(SolverBase& solver, VarViewId violationId,
 void AllDifferent::registerVars() {
   assert(_id != NULL_ID);
   for (size_t i = 0; i < _vars.size(); ++i) {
-    _solver.registerInvariantInput(_id, _vars[i], i, false);
+    _solver->registerInvariantInput(_id, _vars[i], i, false);
   }
   registerDefinedVar(_violationId);
 }
 
 void AllDifferent::updateBounds(bool widenOnly) {
-  _solver.updateBounds(_violationId, 0, static_cast<Int>(_vars.size() - 1),
-                       widenOnly);
+  _solver->updateBounds(_violationId, 0, static_cast<Int>(_vars.size() - 1),
+                        widenOnly);
 }
 
-void AllDifferent::close(Timestamp ts) {
+void AllDifferent::close(Timestamp) {
   Int lb = std::numeric_limits<Int>::max();
   Int ub = std::numeric_limits<Int>::min();
 
@@ -44,46 +41,40 @@ void AllDifferent::close(Timestamp ts) {
   Int overlapUb = ub;
 
   for (const auto& var : _vars) {
-    if (_solver.lowerBound(var) < lb) {
+    if (_solver->lowerBound(var) < lb) {
       assert(lb <= overlapLb);
       overlapLb = lb;
-      lb = _solver.lowerBound(var);
-    } else if (_solver.lowerBound(var) < overlapLb) {
-      overlapLb = _solver.lowerBound(var);
+      lb = _solver->lowerBound(var);
+    } else if (_solver->lowerBound(var) < overlapLb) {
+      overlapLb = _solver->lowerBound(var);
     }
-    if (_solver.upperBound(var) >= ub) {
+    if (_solver->upperBound(var) >= ub) {
       assert(ub >= overlapUb);
       overlapUb = ub;
-      ub = _solver.upperBound(var);
-    } else if (_solver.upperBound(var) > overlapUb) {
-      overlapUb = _solver.upperBound(var);
+      ub = _solver->upperBound(var);
+    } else if (_solver->upperBound(var) > overlapUb) {
+      overlapUb = _solver->upperBound(var);
     }
   }
-  if (overlapUb < overlapLb) {
-    _counts.clear();
-  } else {
-    _counts.resize(static_cast<unsigned long>(overlapUb - overlapLb + 1),
-                   CommittableInt(ts, 0));
-  }
-  _offset = overlapLb;
+  // Only the values in the domain of at least two variables can violate the
+  // constraint (the range is empty if there are no such values):
+  _counts.assign(overlapLb, overlapUb, _vars.size());
 }
 
 void AllDifferent::recompute(Timestamp ts) {
-  for (CommittableInt& c : _counts) {
-    c.setValue(ts, 0);
-  }
+  _counts.reset(ts);
 
   Int violInc = 0;
   for (const auto& var : _vars) {
-    violInc += increaseCount(ts, _solver.value(ts, var));
+    violInc += increaseCount(ts, _solver->value(ts, var));
   }
   updateValue(ts, _violationId, violInc);
 }
 
 void AllDifferent::notifyInputChanged(Timestamp ts, LocalId id) {
   assert(id < _vars.size());
-  const Int newValue = _solver.value(ts, _vars[id]);
-  const Int committedValue = _solver.committedValue(_vars[id]);
+  const Int newValue = _solver->value(ts, _vars[id]);
+  const Int committedValue = _solver->committedValue(_vars[id]);
   if (newValue == committedValue) {
     return;
   }
@@ -108,9 +99,7 @@ void AllDifferent::notifyCurrentInputChanged(Timestamp ts) {
 void AllDifferent::commit(Timestamp ts) {
   Invariant::commit(ts);
 
-  for (CommittableInt& committableInt : _counts) {
-    committableInt.commitIf(ts);
-  }
+  _counts.commitIf(ts);
 }
 
 }  // namespace atlantis::propagation
@@ -31,13 +31,11 @@ AllDifferentExcept::AllDifferentExcept(SolverBase& solver,
 }
 
 void AllDifferentExcept::recompute(Timestamp ts) {
-  for (CommittableInt& c : _counts) {
-    c.setValue(ts, 0);
-  }
+  _counts.reset(ts);
 
   Int violInc = 0;
   for (const auto& var : _vars) {
-    const Int val = _solver.value(ts, var);
+    const Int val = _solver->value(ts, var);
     if (!isIgnored(val)) {
       violInc += increaseCount(ts, val);
     }
@@ -47,8 +45,8 @@ void AllDifferentExcept::recompute(Timestamp ts) {
 
 void AllDifferentExcept::notifyInputChanged(Timestamp ts, LocalId id) {
   assert(id < _vars.size());
-  const Int newValue = _solver.value(ts, _vars[id]);
-  const Int committedValue = _solver.committedValue(_vars[id]);
+  const Int newValue = _solver->value(ts, _vars[id]);
+  const Int committedValue = _solver->committedValue(_vars[id]);
   if (newValue == committedValue) {
     return;
   }
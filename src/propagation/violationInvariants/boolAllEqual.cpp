@@ -28,20 +28,20 @@ BoolAllEqual::BoolAllEqual(SolverBase& solver, VarViewId violationId,
 void BoolAllEqual::registerVars() {
   assert(_id != NULL_ID);
   for (size_t i = 0; i < _vars.size(); ++i) {
-    _solver.registerInvariantInput(_id, _vars[i], i, false);
+    _solver->registerInvariantInput(_id, _vars[i], i, false);
   }
   registerDefinedVar(_violationId);
 }
 
 void BoolAllEqual::updateBounds(bool widenOnly) {
-  _solver.updateBounds(_violationId, 0, static_cast<Int>(_vars.size()) / 2,
-                       widenOnly);
+  _solver->updateBounds(_violationId, 0, static_cast<Int>(_vars.size()) / 2,
+                        widenOnly);
 }
 
 void BoolAllEqual::recompute(Timestamp ts) {
   Int numTrue = 0;
   for (const auto& var : _vars) {
-    numTrue += _solver.value(ts, var) == 0 ? 1 : 0;
+    numTrue += _solver->value(ts, var) == 0 ? 1 : 0;
   }
 
   _numTrue.setValue(ts, numTrue);
@@ -54,8 +54,8 @@ void BoolAllEqual::recompute(Timestamp ts) {
 
 void BoolAllEqual::notifyInputChanged(Timestamp ts, LocalId id) {
   assert(id < _vars.size());
-  const bool newValue = _solver.value(ts, _vars[id]) == 0;
-  const bool committedValue = _solver.committedValue(_vars[id]) == 0;
+  const bool newValue = _solver->value(ts, _vars[id]) == 0;
+  const bool committedValue = _solver->committedValue(_vars[id]) == 0;
   assert(_varNotified[id].value(ts) == 0);
   _varNotified[id].setValue(ts, 1);
   if (newValue == committedValue) {
@@ -94,7 +94,7 @@ void BoolAllEqual::commit(Timestamp ts) {
 
   Int numTrue = 0;
   for (const auto& var : _vars) {
-    numTrue += _solver.value(ts, var) == 0 ? 1 : 0;
+    numTrue += _solver->value(ts, var) == 0 ? 1 : 0;
   }
   assert(_numTrue.committedValue() == numTrue);
 #endif
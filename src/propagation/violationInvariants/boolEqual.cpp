@@ -20,19 +20,19 @@ BoolEqual::BoolEqual(SolverBase& solver, VarViewId violationId, VarViewId x,
 
 void BoolEqual::registerVars() {
   assert(_id != NULL_ID);
-  _solver.registerInvariantInput(_id, _x, LocalId(0), false);
-  _solver.registerInvariantInput(_id, _y, LocalId(0), false);
+  _solver->registerInvariantInput(_id, _x, LocalId(0), false);
+  _solver->registerInvariantInput(_id, _y, LocalId(0), false);
   registerDefinedVar(_violationId);
 }
 
 void BoolEqual::updateBounds(bool widenOnly) {
-  _solver.updateBounds(_violationId, 0, 1, widenOnly);
+  _solver->updateBounds(_violationId, 0, 1, widenOnly);
 }
 
 void BoolEqual::recompute(Timestamp ts) {
   updateValue(ts, _violationId,
-              static_cast<Int>((_solver.value(ts, _x) != 0) !=
-                               (_solver.value(ts, _y) != 0)));
+              static_cast<Int>((_solver->value(ts, _x) != 0) !=
+                               (_solver->value(ts, _y) != 0)));
 }
 
 void BoolEqual::notifyInputChanged(Timestamp ts, LocalId) { recompute(ts); }
@@ -20,19 +20,19 @@ BoolLessEqual::BoolLessEqual(SolverBase& solver, VarViewId violationId,
 
 void BoolLessEqual::registerVars() {
   assert(_id != NULL_ID);
-  _solver.registerInvariantInput(_id, _x, LocalId(0), false);
-  _solver.registerInvariantInput(_id, _y, LocalId(0), false);
+  _solver->registerInvariantInput(_id, _x, LocalId(0), false);
+  _solver->registerInvariantInput(_id, _y, LocalId(0), false);
   registerDefinedVar(_violationId);
 }
 
 void BoolLessEqual::updateBounds(bool widenOnly) {
-  _solver.updateBounds(_violationId, 0, 1, widenOnly);
+  _solver->updateBounds(_violationId, 0, 1, widenOnly);
 }
 
 void BoolLessEqual::recompute(Timestamp ts) {
   updateValue(ts, _violationId,
-              static_cast<Int>((_solver.value(ts, _x) == 0) &&
-                               (_solver.value(ts, _y) != 0)));
+              static_cast<Int>((_solver->value(ts, _x) == 0) &&
+                               (_solver->value(ts, _y) != 0)));
 }
 
 void BoolLessEqual::notifyInputChanged(Timestamp ts, LocalId) { recompute(ts); }
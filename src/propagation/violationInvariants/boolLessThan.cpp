@@ -20,19 +20,19 @@ BoolLessThan::BoolLessThan(SolverBase& solver, VarViewId violationId,
 
 void BoolLessThan::registerVars() {
   assert(_id != NULL_ID);
-  _solver.registerInvariantInput(_id, _x, LocalId(0), false);
-  _solver.registerInvariantInput(_id, _y, LocalId(0), false);
+  _solver->registerInvariantInput(_id, _x, LocalId(0), false);
+  _solver->registerInvariantInput(_id, _y, LocalId(0), false);
   registerDefinedVar(_violationId);
 }
 
 void BoolLessThan::updateBounds(bool widenOnly) {
-  _solver.updateBounds(_violationId, 0, 1, widenOnly);
+  _solver->updateBounds(_violationId, 0, 1, widenOnly);
 }
 
 void BoolLessThan::recompute(Timestamp ts) {
   updateValue(
       ts, _violationId,
-      static_cast<Int>(_solver.value(ts, _x) == 0) + _solver.value(ts, _y));
+      static_cast<Int>(_solver->value(ts, _x) == 0) + _solver->value(ts, _y));
 }
 
 void BoolLessThan::notifyInputChanged(Timestamp ts, LocalId) { recompute(ts); }
@@ -0,0 +1,219 @@
+#include "atlantis/propagation/violationInvariants/cumulative.hpp"
+
+#include <cassert>
+#include <limits>
+#include <utility>
+
+namespace atlantis::propagation {
+
+/**
+ * @param violationId id for the violationCount
+ * @param starts the start time of each task
+ * @param durations the duration of each task
+ * @param requirements the resource requirement of each task
+ * @param capacity the capacity of the resource
+ */
+Cumulative::Cumulative(SolverBase& solver, VarId violationId,
+                       std::vector<VarViewId>&& starts,
+                       std::vector<VarViewId>&& durations,
+                       std::vector<VarViewId>&& requirements,
+                       VarViewId capacity)
+    : ViolationInvariant(solver, violationId),
+      _starts(std::move(starts)),
+      _durations(std::move(durations)),
+      _requirements(std::move(requirements)),
+      _capacity(capacity) {
+  assert(_starts.size() == _durations.size());
+  assert(_starts.size() == _requirements.size());
+}
+
+Cumulative::Cumulative(SolverBase& solver, VarViewId violationId,
+                       std::vector<VarViewId>&& starts,
+                       std::vector<VarViewId>&& durations,
+                       std::vector<VarViewId>&& requirements,
+                       VarViewId capacity)
+    : Cumulative(solver, VarId(violationId), std::move(starts),
+                 std::move(durations), std::move(requirements), capacity) {
+  assert(violationId.isVar());
+}
+
+void Cumulative::registerVars() {
+  assert(_id != NULL_ID);
+  const size_t numTasks = _starts.size();
+  for (size_t i = 0; i < numTasks; ++i) {
+    _solver->registerInvariantInput(_id, _starts[i], i, false);
+  }
+  for (size_t i = 0; i < numTasks; ++i) {
+    _solver->registerInvariantInput(_id, _durations[i], numTasks + i, false);
+  }
+  for (size_t i = 0; i < numTasks; ++i) {
+    _solver->registerInvariantInput(_id, _requirements[i], 2 * numTasks + i,
+                                    false);
+  }
+  _solver->registerInvariantInput(_id, _capacity, 3 * numTasks, false);
+  registerDefinedVar(_violationId);
+}
+
+std::pair<Int, Int> Cumulative::horizon() const {
+  if (_starts.empty()) {
+    return {0, 0};
+  }
+  Int begin = std::numeric_limits<Int>::max();
+  Int end = std::numeric_limits<Int>::min();
+  for (size_t i = 0; i < _starts.size(); ++i) {
+    begin = std::min(begin, _solver->lowerBound(_starts[i]));
+    end = std::max(
+        end, _solver->upperBound(_starts[i]) +
+                 std::max<Int>(0, _solver->upperBound(_durations[i])));
+  }
+  return {begin, std::max(begin, end)};
+}
+
+void Cumulative::updateBounds(bool widenOnly) {
+  // Every task can at most overload the resource by its requirement (plus
+  // the absolute value of a negative capacity) during its duration:
+  const Int capacityExcess = std::max<Int>(0, -_solver->lowerBound(_capacity));
+  Int ub = 0;
+  for (size_t i = 0; i < _starts.size(); ++i) {
+    ub += std::max<Int>(0, _solver->upperBound(_durations[i])) *
+          (std::max<Int>(0, _solver->upperBound(_requirements[i])) +
+           capacityExcess);
+  }
+  _solver->updateBounds(_violationId, 0, ub, widenOnly);
+}
+
+void Cumulative::close(Timestamp) {
+  const auto [begin, end] = horizon();
+  _offset = begin;
+  _loads.assign(static_cast<size_t>(end - begin), 0);
+  _taskStarts.assign(_starts.size(), 0);
+  _taskEnds.assign(_starts.size(), 0);
+  _taskRequirements.assign(_starts.size(), 0);
+}
+
+Int Cumulative::computeViolation(Timestamp ts) const {
+  const Int capacity = _solver->value(ts, _capacity);
+  Int violation = 0;
+  for (size_t t = 0; t < _loads.size(); ++t) {
+    violation += overload(_loads.value(ts, t), capacity);
+  }
+  return violation;
+}
+
+/**
+ * Increases the load of the time points in [start, end) by delta and
+ * returns the resulting change of the violation.
+ */
+Int Cumulative::increaseLoad(Timestamp ts, Int start, Int end, Int delta) {
+  const Int capacity = _solver->value(ts, _capacity);
+  const Int first = std::max(start, _offset) - _offset;
+  const Int last = std::min(end, _offset + static_cast<Int>(_loads.size())) -
+                   _offset;
+  Int violationDelta = 0;
+  for (Int t = first; t < last; ++t) {
+    const Int oldLoad = _loads.value(ts, static_cast<size_t>(t));
+    const Int newLoad = _loads.incValue(ts, static_cast<size_t>(t), delta);
+    violationDelta += overload(newLoad, capacity) - overload(oldLoad, capacity);
+  }
+  return violationDelta;
+}
+
+void Cumulative::placeTask(Timestamp ts, size_t task, Int start, Int end,
+                           Int requirement) {
+  _taskStarts.setValue(ts, task, start);
+  _taskEnds.setValue(ts, task, end);
+  _taskRequirements.setValue(ts, task, requirement);
+}
+
+void Cumulative::moveTask(Timestamp ts, size_t task) {
+  const Int oldStart = _taskStarts.value(ts, task);
+  const Int oldEnd = _taskEnds.value(ts, task);
+  const Int oldRequirement = _taskRequirements.value(ts, task);
+
+  const Int newStart = _solver->value(ts, _starts[task]);
+  const Int newEnd =
+      newStart + std::max<Int>(0, _solver->value(ts, _durations[task]));
+  const Int newRequirement =
+      std::max<Int>(0, _solver->value(ts, _requirements[task]));
+
+  if (oldStart == newStart && oldEnd == newEnd &&
+      oldRequirement == newRequirement) {
+    return;
+  }
+  placeTask(ts, task, newStart, newEnd, newRequirement);
+  if (oldRequirement == 0 && newRequirement == 0) {
+    return;
+  }
+
+  Int violationDelta = 0;
+  if (oldRequirement == newRequirement) {
+    // Only the time points that the task leaves or enters change load:
+    violationDelta +=
+        increaseLoad(ts, oldStart, std::min(oldEnd, newStart), -oldRequirement);
+    violationDelta +=
+        increaseLoad(ts, std::max(oldStart, newEnd), oldEnd, -oldRequirement);
+    violationDelta +=
+        increaseLoad(ts, newStart, std::min(newEnd, oldStart), newRequirement);
+    violationDelta +=
+        increaseLoad(ts, std::max(newStart, oldEnd), newEnd, newRequirement);
+  } else {
+    violationDelta += increaseLoad(ts, oldStart, oldEnd, -oldRequirement);
+    violationDelta += increaseLoad(ts, newStart, newEnd, newRequirement);
+  }
+  incValue(ts, _violationId, violationDelta);
+}
+
+void Cumulative::recompute(Timestamp ts) {
+  _loads.fill(ts, 0);
+  for (size_t i = 0; i < _starts.size(); ++i) {
+    const Int start = _solver->value(ts, _starts[i]);
+    const Int end = start + std::max<Int>(0, _solver->value(ts, _durations[i]));
+    const Int requirement =
+        std::max<Int>(0, _solver->value(ts, _requirements[i]));
+    placeTask(ts, i, start, end, requirement);
+    increaseLoad(ts, start, end, requirement);
+  }
+  updateValue(ts, _violationId, computeViolation(ts));
+}
+
+void Cumulative::notifyInputChanged(Timestamp ts, LocalId id) {
+  const size_t numTasks = _starts.size();
+  assert(id <= 3 * numTasks);
+  if (id == 3 * numTasks) {
+    // The capacity changed, which affects the overload of every time point:
+    updateValue(ts, _violationId, computeViolation(ts));
+  } else {
+    moveTask(ts, id % numTasks);
+  }
+}
+
+VarViewId Cumulative::nextInput(Timestamp ts) {
+  const auto index = static_cast<size_t>(_state.incValue(ts, 1));
+  const size_t numTasks = _starts.size();
+  if (index < numTasks) {
+    return _starts[index];
+  } else if (index < 2 * numTasks) {
+    return _durations[index - numTasks];
+  } else if (index < 3 * numTasks) {
+    return _requirements[index - 2 * numTasks];
+  } else if (index == 3 * numTasks) {
+    return _capacity;
+  }
+  return NULL_ID;
+}
+
+void Cumulative::notifyCurrentInputChanged(Timestamp ts) {
+  assert(static_cast<size_t>(_state.value(ts)) <= 3 * _starts.size());
+  notifyInputChanged(ts, static_cast<size_t>(_state.value(ts)));
+}
+
+void Cumulative::commit(Timestamp ts) {
+  Invariant::commit(ts);
+
+  _loads.commitIf(ts);
+  _taskStarts.commitIf(ts);
+  _taskEnds.commitIf(ts);
+  _taskRequirements.commitIf(ts);
+}
+
+}  // namespace atlantis::propagation
@@ -19,16 +19,16 @@ Equal::Equal(SolverBase& solver, VarViewId violationId, VarViewId x,
 
 void Equal::registerVars() {
   assert(_id != NULL_ID);
-  _solver.registerInvariantInput(_id, _x, LocalId(0), false);
-  _solver.registerInvariantInput(_id, _y, LocalId(0), false);
+  _solver->registerInvariantInput(_id, _x, LocalId(0), false);
+  _solver->registerInvariantInput(_id, _y, LocalId(0), false);
   registerDefinedVar(_violationId);
 }
 
 void Equal::updateBounds(bool widenOnly) {
-  const Int xLb = _solver.lowerBound(_x);
-  const Int xUb = _solver.upperBound(_x);
-  const Int yLb = _solver.lowerBound(_y);
-  const Int yUb = _solver.upperBound(_y);
+  const Int xLb = _solver->lowerBound(_x);
+  const Int xUb = _solver->upperBound(_x);
+  const Int yLb = _solver->lowerBound(_y);
+  const Int yUb = _solver->upperBound(_y);
 
   const Int lb = xLb <= yUb && yLb <= xUb
                      ? 0
@@ -37,12 +37,12 @@ void Equal::updateBounds(bool widenOnly) {
   const Int ub = std::max(std::max(std::abs(xLb - yLb), std::abs(xLb - yUb)),
                           std::max(std::abs(xUb - yLb), std::abs(xUb - yUb)));
 
-  _solver.updateBounds(_violationId, lb, ub, widenOnly);
+  _solver->updateBounds(_violationId, lb, ub, widenOnly);
 }
 
 void Equal::recompute(Timestamp ts) {
   updateValue(ts, _violationId,
-              std::abs(_solver.value(ts, _x) - _solver.value(ts, _y)));
+              std::abs(_solver->value(ts, _x) - _solver->value(ts, _y)));
 }
 
 void Equal::notifyInputChanged(Timestamp ts, LocalId) { recompute(ts); }
@@ -10,6 +10,7 @@ GlobalCardinalityLowUp::GlobalCardinalityLowUp(
       _vars(std::move(t_vars)),
       _lowerBounds(),
       _upperBounds(),
+      _sortedCover(),
       _shortage(NULL_TIMESTAMP, 0),
       _excess(NULL_TIMESTAMP, 0),
       _counts(),
@@ -19,6 +20,20 @@ GlobalCardinalityLowUp::GlobalCardinalityLowUp(
 
   const auto [lb, ub] = std::minmax_element(cover.begin(), cover.end());
 
+  if (ValueCounts::isWide(*lb, *ub, cover.size())) {
+    _sortedCover = cover;
+    std::sort(_sortedCover.begin(), _sortedCover.end());
+    _lowerBounds.assign(cover.size() + 1, -1);
+    _upperBounds.assign(cover.size() + 1, -1);
+    for (size_t i = 0; i < cover.size(); ++i) {
+      assert(lowerBound[i] >= 0);
+      assert(lowerBound[i] <= upperBound[i]);
+      _lowerBounds[position(cover[i])] = lowerBound[i];
+      _upperBounds[position(cover[i])] = upperBound[i];
+    }
+    return;
+  }
+
   // a bound of -1 means that the count of a value is not restricted:
   _lowerBounds.assign(static_cast<Int>(*ub - *lb + 3), -1);
   _upperBounds.assign(static_cast<Int>(*ub - *lb + 3), -1);
@@ -62,7 +77,7 @@ GlobalCardinalityLowUp::GlobalCardinalityLowUp(SolverBase& solver,
 void GlobalCardinalityLowUp::registerVars() {
   assert(_id != NULL_ID);
   for (size_t i = 0; i < _vars.size(); ++i) {
-    _solver.registerInvariantInput(_id, _vars[i], LocalId(i), false);
+    _solver->registerInvariantInput(_id, _vars[i], LocalId(i), false);
   }
   registerDefinedVar(_violationId);
 }
@@ -76,20 +91,18 @@ void GlobalCardinalityLowUp::updateBounds(bool widenOnly) {
   for (const Int ub : _upperBounds) {
     excess = std::max(excess, static_cast<Int>(_vars.size()) - ub);
   }
-  _solver.updateBounds(_violationId, 0, std::max(shortage, excess), widenOnly);
+  _solver->updateBounds(_violationId, 0, std::max(shortage, excess), widenOnly);
 }
 
-void GlobalCardinalityLowUp::close(Timestamp timestamp) {
-  _counts.resize(_lowerBounds.size(), CommittableInt(timestamp, 0));
+void GlobalCardinalityLowUp::close(Timestamp) {
+  _counts.assign(_lowerBounds.size(), 0);
 }
 
 void GlobalCardinalityLowUp::recompute(Timestamp timestamp) {
-  for (CommittableInt& c : _counts) {
-    c.setValue(timestamp, 0);
-  }
+  _counts.fill(timestamp, 0);
 
   for (const auto& var : _vars) {
-    increaseCount(timestamp, _solver.value(timestamp, var));
+    increaseCount(timestamp, _solver->value(timestamp, var));
   }
 
   Int shortage = 0;
@@ -101,9 +114,9 @@ void GlobalCardinalityLowUp::recompute(Timestamp timestamp) {
       continue;
     }
     shortage +=
-        std::max(Int(0), _lowerBounds.at(i) - _counts.at(i).value(timestamp));
+        std::max(Int(0), _lowerBounds.at(i) - _counts.value(timestamp, i));
     excess +=
-        std::max(Int(0), _counts.at(i).value(timestamp) - _upperBounds.at(i));
+        std::max(Int(0), _counts.value(timestamp, i) - _upperBounds.at(i));
   }
 
   _shortage.setValue(timestamp, shortage);
@@ -115,8 +128,8 @@ void GlobalCardinalityLowUp::recompute(Timestamp timestamp) {
 void GlobalCardinalityLowUp::notifyInputChanged(Timestamp timestamp,
                                                 LocalId localId) {
   assert(localId < _vars.size());
-  const Int newValue = _solver.value(timestamp, _vars[localId]);
-  const Int committedValue = _solver.committedValue(_vars[localId]);
+  const Int newValue = _solver->value(timestamp, _vars[localId]);
+  const Int committedValue = _solver->committedValue(_vars[localId]);
   if (newValue == committedValue) {
     return;
   }
@@ -149,8 +162,6 @@ void GlobalCardinalityLowUp::commit(Timestamp timestamp) {
   _shortage.commitIf(timestamp);
   _excess.commitIf(timestamp);
 
-  for (CommittableInt& CommittableInt : _counts) {
-    CommittableInt.commitIf(timestamp);
-  }
+  _counts.commitIf(timestamp);
 }
 }  // namespace atlantis::propagation
@@ -0,0 +1,133 @@
+#include "atlantis/propagation/violationInvariants/inverse.hpp"
+
+#include <cassert>
+
+namespace atlantis::propagation {
+
+/**
+ * @param violationId id for the violationCount
+ * @param f the variables of the first array
+ * @param fOffset the first index of f
+ * @param invf the variables of the second array
+ * @param invfOffset the first index of invf
+ */
+Inverse::Inverse(SolverBase& solver, VarId violationId,
+                 std::vector<VarViewId>&& f, Int fOffset,
+                 std::vector<VarViewId>&& invf, Int invfOffset)
+    : ViolationInvariant(solver, violationId),
+      _f(std::move(f)),
+      _fOffset(fOffset),
+      _invf(std::move(invf)),
+      _invfOffset(invfOffset),
+      _numMatched(NULL_TIMESTAMP, 0) {
+  assert(_f.size() == _invf.size());
+}
+
+Inverse::Inverse(SolverBase& solver, VarViewId violationId,
+                 std::vector<VarViewId>&& f, Int fOffset,
+                 std::vector<VarViewId>&& invf, Int invfOffset)
+    : Inverse(solver, VarId(violationId), std::move(f), fOffset,
+              std::move(invf), invfOffset) {
+  assert(violationId.isVar());
+}
+
+void Inverse::registerVars() {
+  assert(_id != NULL_ID);
+  for (size_t i = 0; i < _f.size(); ++i) {
+    _solver->registerInvariantInput(_id, _f[i], i, false);
+  }
+  for (size_t j = 0; j < _invf.size(); ++j) {
+    _solver->registerInvariantInput(_id, _invf[j], _f.size() + j, false);
+  }
+  registerDefinedVar(_violationId);
+}
+
+void Inverse::updateBounds(bool widenOnly) {
+  _solver->updateBounds(_violationId, 0, static_cast<Int>(_f.size()),
+                        widenOnly);
+}
+
+void Inverse::close(Timestamp ts) {
+  _values.assign(_f.size() + _invf.size(), 0);
+  _numMatched = CommittableInt(ts, 0);
+}
+
+bool Inverse::isMatched(Timestamp ts, size_t fIndex) const {
+  const Int invfIndex = _values.value(ts, fIndex) - _invfOffset;
+  return 0 <= invfIndex && invfIndex < static_cast<Int>(_invf.size()) &&
+         _values.value(ts, _f.size() + static_cast<size_t>(invfIndex)) -
+                 _fOffset ==
+             static_cast<Int>(fIndex);
+}
+
+bool Inverse::isInvMatched(Timestamp ts, size_t invfIndex) const {
+  const Int fIndex = _values.value(ts, _f.size() + invfIndex) - _fOffset;
+  return 0 <= fIndex && fIndex < static_cast<Int>(_f.size()) &&
+         _values.value(ts, static_cast<size_t>(fIndex)) - _invfOffset ==
+             static_cast<Int>(invfIndex);
+}
+
+void Inverse::recompute(Timestamp ts) {
+  for (size_t i = 0; i < _f.size(); ++i) {
+    _values.setValue(ts, i, _solver->value(ts, _f[i]));
+  }
+  for (size_t j = 0; j < _invf.size(); ++j) {
+    _values.setValue(ts, _f.size() + j, _solver->value(ts, _invf[j]));
+  }
+  Int numMatched = 0;
+  for (size_t i = 0; i < _f.size(); ++i) {
+    if (isMatched(ts, i)) {
+      ++numMatched;
+    }
+  }
+  _numMatched.setValue(ts, numMatched);
+  updateValue(ts, _violationId, static_cast<Int>(_f.size()) - numMatched);
+}
+
+void Inverse::notifyInputChanged(Timestamp ts, LocalId id) {
+  assert(id < _values.size());
+  const Int newValue =
+      _solver->value(ts, id < _f.size() ? _f[id] : _invf[id - _f.size()]);
+  if (_values.value(ts, id) == newValue) {
+    return;
+  }
+  // Only the pair containing the old value and the pair containing the new
+  // value of the changed variable can change:
+  const auto matched = [&]() {
+    return id < _f.size() ? isMatched(ts, id)
+                          : isInvMatched(ts, id - _f.size());
+  };
+  if (matched()) {
+    _numMatched.incValue(ts, -1);
+  }
+  _values.setValue(ts, id, newValue);
+  if (matched()) {
+    _numMatched.incValue(ts, 1);
+  }
+  updateValue(ts, _violationId,
+              static_cast<Int>(_f.size()) - _numMatched.value(ts));
+}
+
+VarViewId Inverse::nextInput(Timestamp ts) {
+  const auto index = static_cast<size_t>(_state.incValue(ts, 1));
+  if (index < _f.size()) {
+    return _f[index];
+  } else if (index < _f.size() + _invf.size()) {
+    return _invf[index - _f.size()];
+  }
+  return NULL_ID;
+}
+
+void Inverse::notifyCurrentInputChanged(Timestamp ts) {
+  assert(static_cast<size_t>(_state.value(ts)) < _values.size());
+  notifyInputChanged(ts, static_cast<size_t>(_state.value(ts)));
+}
+
+void Inverse::commit(Timestamp ts) {
+  Invariant::commit(ts);
+
+  _values.commitIf(ts);
+  _numMatched.commitIf(ts);
+}
+
+}  // namespace atlantis::propagation
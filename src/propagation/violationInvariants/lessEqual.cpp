@@ -20,22 +20,23 @@ LessEqual::LessEqual(SolverBase& solver, VarViewId violationId, VarViewId x,
 
 void LessEqual::registerVars() {
   assert(_id != NULL_ID);
-  _solver.registerInvariantInput(_id, _x, LocalId(0), false);
-  _solver.registerInvariantInput(_id, _y, LocalId(0), false);
+  _solver->registerInvariantInput(_id, _x, LocalId(0), false);
+  _solver->registerInvariantInput(_id, _y, LocalId(0), false);
   registerDefinedVar(_violationId);
 }
 
 void LessEqual::updateBounds(bool widenOnly) {
-  _solver.updateBounds(
+  _solver->updateBounds(
       _violationId,
-      std::max(Int(0), _solver.lowerBound(_x) - _solver.upperBound(_y)),
-      std::max(Int(0), _solver.upperBound(_x) - _solver.lowerBound(_y)),
+      std::max(Int(0), _solver->lowerBound(_x) - _solver->upperBound(_y)),
+      std::max(Int(0), _solver->upperBound(_x) - _solver->lowerBound(_y)),
       widenOnly);
 }
 
 void LessEqual::recompute(Timestamp ts) {
-  updateValue(ts, _violationId,
-              std::max(Int(0), _solver.value(ts, _x) - _solver.value(ts, _y)));
+  updateValue(
+      ts, _violationId,
+      std::max(Int(0), _solver->value(ts, _x) - _solver->value(ts, _y)));
 }
 
 void LessEqual::notifyInputChanged(Timestamp ts, LocalId) { recompute(ts); }
@@ -20,23 +20,23 @@ LessThan::LessThan(SolverBase& solver, VarViewId violationId, VarViewId x,
 
 void LessThan::registerVars() {
   assert(_id != NULL_ID);
-  _solver.registerInvariantInput(_id, _x, LocalId(0), false);
-  _solver.registerInvariantInput(_id, _y, LocalId(0), false);
+  _solver->registerInvariantInput(_id, _x, LocalId(0), false);
+  _solver->registerInvariantInput(_id, _y, LocalId(0), false);
   registerDefinedVar(_violationId);
 }
 
 void LessThan::updateBounds(bool widenOnly) {
-  _solver.updateBounds(
+  _solver->updateBounds(
       _violationId,
-      std::max(Int(0), 1 + _solver.lowerBound(_x) - _solver.upperBound(_y)),
-      std::max(Int(0), 1 + _solver.upperBound(_x) - _solver.lowerBound(_y)),
+      std::max(Int(0), 1 + _solver->lowerBound(_x) - _solver->upperBound(_y)),
+      std::max(Int(0), 1 + _solver->upperBound(_x) - _solver->lowerBound(_y)),
       widenOnly);
 }
 
 void LessThan::recompute(Timestamp ts) {
   updateValue(
       ts, _violationId,
-      std::max(Int(0), _solver.value(ts, _x) - _solver.value(ts, _y) + 1));
+      std::max(Int(0), _solver->value(ts, _x) - _solver->value(ts, _y) + 1));
 }
 
 void LessThan::notifyInputChanged(Timestamp ts, LocalId) { recompute(ts); }
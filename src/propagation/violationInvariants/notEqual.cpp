@@ -22,32 +22,33 @@ NotEqual::NotEqual(SolverBase& solver, VarViewId violationId, VarViewId x,
 
 void NotEqual::registerVars() {
   assert(_id != NULL_ID);
-  _solver.registerInvariantInput(_id, _x, LocalId(0), false);
-  _solver.registerInvariantInput(_id, _y, LocalId(0), false);
+  _solver->registerInvariantInput(_id, _x, LocalId(0), false);
+  _solver->registerInvariantInput(_id, _y, LocalId(0), false);
   registerDefinedVar(_violationId);
 }
 
 void NotEqual::updateBounds(bool widenOnly) {
-  const Int xLb = _solver.lowerBound(_x);
-  const Int xUb = _solver.upperBound(_x);
-  const Int yLb = _solver.lowerBound(_y);
-  const Int yUb = _solver.upperBound(_y);
+  const Int xLb = _solver->lowerBound(_x);
+  const Int xUb = _solver->upperBound(_x);
+  const Int yLb = _solver->lowerBound(_y);
+  const Int yUb = _solver->upperBound(_y);
   if (xUb < yLb || yUb < xLb) {
-    _solver.updateBounds(_violationId, 0, 0, widenOnly);
+    _solver->updateBounds(_violationId, 0, 0, widenOnly);
     return;
   }
 
   for (const Int val : std::array<Int, 3>{xUb, yLb, yUb}) {
     if (xLb != val) {
-      _solver.updateBounds(_violationId, 0, 1, widenOnly);
+      _solver->updateBounds(_violationId, 0, 1, widenOnly);
       return;
     }
   }
-  _solver.updateBounds(_violationId, 1, 1, widenOnly);
+  _solver->updateBounds(_violationId, 1, 1, widenOnly);
 }
 
 void NotEqual::recompute(Timestamp ts) {
-  updateValue(ts, _violationId, _solver.value(ts, _x) == _solver.value(ts, _y));
+  updateValue(ts, _violationId,
+              _solver->value(ts, _x) == _solver->value(ts, _y));
 }
 
 void NotEqual::notifyInputChanged(Timestamp ts, LocalId) { recompute(ts); }
@@ -21,26 +21,27 @@ PowDomain::PowDomain(SolverBase& solver, VarViewId violationId, VarViewId x,
 
 void PowDomain::registerVars() {
   assert(_id != NULL_ID);
-  _solver.registerInvariantInput(_id, _x, LocalId(0), false);
-  _solver.registerInvariantInput(_id, _y, LocalId(0), false);
+  _solver->registerInvariantInput(_id, _x, LocalId(0), false);
+  _solver->registerInvariantInput(_id, _y, LocalId(0), false);
   registerDefinedVar(_violationId);
 }
 
 void PowDomain::updateBounds(bool widenOnly) {
-  const Int xLb = _solver.lowerBound(_x);
-  const Int xUb = _solver.upperBound(_x);
-  const Int yLb = _solver.lowerBound(_y);
-  const Int yUb = _solver.upperBound(_y);
+  const Int xLb = _solver->lowerBound(_x);
+  const Int xUb = _solver->upperBound(_x);
+  const Int yLb = _solver->lowerBound(_y);
+  const Int yUb = _solver->upperBound(_y);
 
   const Int lb = xLb == 0 && xUb == 0 && yUb < 0 ? 1 : 0;
   const Int ub = xLb <= 0 && 0 <= xUb && yLb < 0 ? 1 : 0;
 
-  _solver.updateBounds(_violationId, lb, ub, widenOnly);
+  _solver->updateBounds(_violationId, lb, ub, widenOnly);
 }
 
 void PowDomain::recompute(Timestamp ts) {
-  updateValue(ts, _violationId,
-              _solver.value(ts, _x) == 0 && _solver.value(ts, _y) < 0 ? 1 : 0);
+  updateValue(
+      ts, _violationId,
+      _solver->value(ts, _x) == 0 && _solver->value(ts, _y) < 0 ? 1 : 0);
 }
 
 void PowDomain::notifyInputChanged(Timestamp ts, LocalId) { recompute(ts); }
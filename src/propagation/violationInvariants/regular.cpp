@@ -0,0 +1,400 @@
+#include "atlantis/propagation/violationInvariants/regular.hpp"
+
+#include <algorithm>
+#include <cassert>
+
+namespace atlantis::propagation {
+
+/**
+ * @param violationId id for the violationCount
+ * @param vars the sequence of variables
+ * @param numStates the number of states of the automaton
+ * @param numSymbols the number of symbols of the automaton
+ * @param transitions the numStates x numSymbols transition matrix in
+ * row-major order, where 0 is the failure state
+ * @param initialState the initial state
+ * @param acceptingStates the accepting states
+ */
+Regular::Regular(SolverBase& solver, VarId violationId,
+                 std::vector<VarViewId>&& vars, Int numStates, Int numSymbols,
+                 std::vector<Int>&& transitions, Int initialState,
+                 const std::vector<Int>& acceptingStates)
+    : ViolationInvariant(solver, violationId),
+      _vars(std::move(vars)),
+      _numStates(static_cast<size_t>(std::max<Int>(0, numStates))),
+      _numSymbols(std::max<Int>(0, numSymbols)),
+      _transitions(std::move(transitions)),
+      _initialState(initialState),
+      _isAccepting(_numStates, false),
+      _unreachable(static_cast<Int>(_vars.size()) + 1) {
+  assert(_transitions.size() ==
+         _numStates * static_cast<size_t>(_numSymbols));
+  for (const Int state : acceptingStates) {
+    if (1 <= state && state <= static_cast<Int>(_numStates)) {
+      _isAccepting[static_cast<size_t>(state - 1)] = true;
+    }
+  }
+}
+
+Regular::Regular(SolverBase& solver, VarViewId violationId,
+                 std::vector<VarViewId>&& vars, Int numStates, Int numSymbols,
+                 std::vector<Int>&& transitions, Int initialState,
+                 const std::vector<Int>& acceptingStates)
+    : Regular(solver, VarId(violationId), std::move(vars), numStates,
+              numSymbols, std::move(transitions), initialState,
+              acceptingStates) {
+  assert(violationId.isVar());
+}
+
+void Regular::registerVars() {
+  assert(_id != NULL_ID);
+  for (size_t i = 0; i < _vars.size(); ++i) {
+    _solver->registerInvariantInput(_id, _vars[i], i, false);
+  }
+  registerDefinedVar(_violationId);
+}
+
+void Regular::updateBounds(bool widenOnly) {
+  // An automaton that accepts no sequence of length n is never satisfied:
+  _solver->updateBounds(_violationId, 0,
+                        std::max<Int>(1, static_cast<Int>(_vars.size())),
+                        widenOnly);
+}
+
+void Regular::close(Timestamp) {
+  _arcBegin.assign(1, 0);
+  _arcSymbols.clear();
+  _arcTargets.clear();
+  for (size_t q = 0; q < _numStates; ++q) {
+    for (Int s = 1; s <= _numSymbols; ++s) {
+      const Int next =
+          _transitions[q * static_cast<size_t>(_numSymbols) +
+                       static_cast<size_t>(s - 1)];
+      if (1 <= next && next <= static_cast<Int>(_numStates)) {
+        _arcSymbols.emplace_back(s);
+        _arcTargets.emplace_back(static_cast<size_t>(next - 1));
+      }
+    }
+    _arcBegin.emplace_back(_arcSymbols.size());
+  }
+  _inArcBegin.assign(_numStates + 1, 0);
+  for (const size_t r : _arcTargets) {
+    ++_inArcBegin[r + 1];
+  }
+  for (size_t r = 0; r < _numStates; ++r) {
+    _inArcBegin[r + 1] += _inArcBegin[r];
+  }
+  _inArcSymbols.assign(_arcSymbols.size(), 0);
+  _inArcSources.assign(_arcSymbols.size(), 0);
+  std::vector<size_t> inArcEnd(_inArcBegin.begin(), _inArcBegin.end() - 1);
+  for (size_t q = 0; q < _numStates; ++q) {
+    for (size_t i = _arcBegin[q]; i < _arcBegin[q + 1]; ++i) {
+      const size_t j = inArcEnd[_arcTargets[i]]++;
+      _inArcSymbols[j] = _arcSymbols[i];
+      _inArcSources[j] = q;
+    }
+  }
+  const size_t tableSize = (_vars.size() + 1) * _numStates;
+  _forward.assign(tableSize, _unreachable);
+  _backward.assign(tableSize, _unreachable);
+  _backwardMinDeltas.assign(_vars.size(), 0);
+  _minSums.assign(_vars.size() + 1, _unreachable);
+  _relaxedMins.assign(_vars.size(), _unreachable);
+  _probeForward.assign(tableSize, _unreachable);
+  _probeOffsets.assign(_vars.size() + 1, 0);
+  _row.assign(_numStates, _unreachable);
+  _probeTimestamp = NULL_TIMESTAMP;
+}
+
+static Int normalise(Int* row, size_t numStates, Int unreachable) {
+  const Int minimum = *std::min_element(row, row + numStates);
+  if (minimum >= unreachable) {
+    return unreachable;
+  }
+  for (size_t q = 0; q < numStates; ++q) {
+    if (row[q] < unreachable) {
+      row[q] -= minimum;
+    }
+  }
+  return minimum;
+}
+
+// Rows hold numbers of changes in 0..n or _unreachable, so adding a change
+// to _unreachable gives a value that is clamped back to _unreachable:
+Int Regular::forwardStep(const Int* from, Int value, Int* to) const {
+  for (size_t r = 0; r < _numStates; ++r) {
+    Int changes = _unreachable;
+    for (size_t i = _inArcBegin[r]; i < _inArcBegin[r + 1]; ++i) {
+      changes = std::min(changes, from[_inArcSources[i]] +
+                                      (_inArcSymbols[i] == value ? 0 : 1));
+    }
+    to[r] = std::min(changes, _unreachable);
+  }
+  return normalise(to, _numStates, _unreachable);
+}
+
+Int Regular::backwardStep(const Int* from, Int value, Int* to) const {
+  for (size_t q = 0; q < _numStates; ++q) {
+    Int changes = _unreachable;
+    for (size_t i = _arcBegin[q]; i < _arcBegin[q + 1]; ++i) {
+      changes = std::min(changes, from[_arcTargets[i]] +
+                                      (_arcSymbols[i] == value ? 0 : 1));
+    }
+    to[q] = std::min(changes, _unreachable);
+  }
+  return normalise(to, _numStates, _unreachable);
+}
+
+Int Regular::minSum(const Int* forward, const Int* backward) const {
+  Int changes = _unreachable;
+  for (size_t q = 0; q < _numStates; ++q) {
+    if (forward[q] < _unreachable && backward[q] < _unreachable) {
+      changes = std::min(changes, forward[q] + backward[q]);
+    }
+  }
+  return changes;
+}
+
+Int Regular::relaxedMin(const Int* forward, const Int* backward) const {
+  Int changes = _unreachable;
+  for (size_t q = 0; q < _numStates; ++q) {
+    for (size_t i = _arcBegin[q]; i < _arcBegin[q + 1]; ++i) {
+      changes = std::min(changes, forward[q] + backward[_arcTargets[i]]);
+    }
+  }
+  return std::min(changes, _unreachable);
+}
+
+void Regular::updateMins(size_t first, size_t last) {
+  for (size_t t = first; t <= last; ++t) {
+    _minSums[t] = minSum(row(_forward, t), row(_backward, t));
+    if (t < _vars.size()) {
+      _relaxedMins[t] = relaxedMin(row(_forward, t), row(_backward, t + 1));
+    }
+  }
+}
+
+void Regular::recomputeTables() {
+  const size_t n = _vars.size();
+  Int* first = row(_forward, 0);
+  for (size_t q = 0; q < _numStates; ++q) {
+    first[q] = static_cast<Int>(q) + 1 == _initialState ? 0 : _unreachable;
+  }
+  for (size_t t = 0; t < n; ++t) {
+    forwardStep(row(_forward, t), _solver->committedValue(_vars[t]),
+                row(_forward, t + 1));
+  }
+  Int* last = row(_backward, n);
+  for (size_t q = 0; q < _numStates; ++q) {
+    last[q] = _isAccepting[q] ? 0 : _unreachable;
+  }
+  Int minChanges = 0;
+  for (size_t t = n; t-- > 0;) {
+    const Int delta = backwardStep(
+        row(_backward, t + 1), _solver->committedValue(_vars[t]),
+        row(_backward, t));
+    _backwardMinDeltas[t] = delta < _unreachable ? delta : 0;
+    minChanges += _backwardMinDeltas[t];
+  }
+  updateMins(0, n);
+  _committedChanges =
+      _minSums[0] < _unreachable ? minChanges + _minSums[0] : _unreachable;
+}
+
+void Regular::propagateProbe(Timestamp ts, size_t begin, size_t end) {
+  for (size_t t = begin; t < end; ++t) {
+    // The first probed row is the committed one:
+    const Int* prev =
+        t == _probeBegin ? row(_forward, t) : row(_probeForward, t);
+    Int* next = row(_probeForward, t + 1);
+    const Int value = _solver->value(ts, _vars[t]);
+    if (t + 1 >= _probeEnd) {
+      const Int delta = forwardStep(prev, value, next);
+      _probeOffsets[t + 1] =
+          _probeOffsets[t] + (delta < _unreachable ? delta : 0);
+      continue;
+    }
+    const Int delta = forwardStep(prev, value, _row.data());
+    const Int offset = _probeOffsets[t] + (delta < _unreachable ? delta : 0);
+    // Rows after a row that is unchanged only depend on variables that have
+    // not changed since they were computed:
+    if (_probeOffsets[t + 1] == offset &&
+        std::equal(_row.begin(), _row.end(), next)) {
+      return;
+    }
+    std::copy(_row.begin(), _row.end(), next);
+    _probeOffsets[t + 1] = offset;
+  }
+}
+
+void Regular::probePosition(Timestamp ts, size_t position) {
+  assert(position < _vars.size());
+  if (_probeTimestamp != ts) {
+    // The forward row after a single changed variable is only computed when
+    // another variable changes, or on commit:
+    _probeTimestamp = ts;
+    _probeBegin = position;
+    _probeEnd = position + 1;
+    _probeRowsValid = false;
+    return;
+  }
+  if (!_probeRowsValid) {
+    if (position == _probeBegin) {
+      return;
+    }
+    computeProbeRow(ts);
+  }
+  if (_probeBegin == _probeEnd || position < _probeBegin) {
+    // Start from the committed forward row, and recompute every row up to
+    // the end of the probed range:
+    _probeOffsets[position] = 0;
+    const size_t end = std::max(_probeEnd, position + 1);
+    _probeBegin = position;
+    _probeEnd = position;
+    propagateProbe(ts, position, end);
+    _probeEnd = end;
+  } else if (position >= _probeEnd) {
+    propagateProbe(ts, _probeEnd, position + 1);
+    _probeEnd = position + 1;
+  } else {
+    propagateProbe(ts, position, _probeEnd);
+  }
+}
+
+void Regular::computeProbeRow(Timestamp ts) {
+  assert(!_probeRowsValid && _probeEnd == _probeBegin + 1);
+  _probeOffsets[_probeBegin] = 0;
+  propagateProbe(ts, _probeBegin, _probeEnd);
+  _probeRowsValid = true;
+}
+
+Int Regular::singleChanges(size_t t, Int value) const {
+  // Either vars[t] changes, or the automaton reads value in some state q:
+  Int changes = _relaxedMins[t] + 1;
+  if (1 <= value && value <= _numSymbols) {
+    const Int* forward = _forward.data() + t * _numStates;
+    const Int* backward = _backward.data() + (t + 1) * _numStates;
+    for (size_t q = 0; q < _numStates; ++q) {
+      const Int next = _transitions[q * static_cast<size_t>(_numSymbols) +
+                                    static_cast<size_t>(value - 1)];
+      if (1 <= next && next <= static_cast<Int>(_numStates)) {
+        changes = std::min(
+            changes, forward[q] + backward[static_cast<size_t>(next - 1)]);
+      }
+    }
+  }
+  if (changes >= _unreachable) {
+    return _unreachable;
+  }
+  return _committedChanges - _minSums[t] - _backwardMinDeltas[t] + changes;
+}
+
+Int Regular::probeChanges(Timestamp ts) {
+  if (_committedChanges >= _unreachable) {
+    return _unreachable;
+  }
+  if (_probeBegin == _probeEnd) {
+    return _committedChanges;
+  }
+  if (!_probeRowsValid) {
+    return singleChanges(_probeBegin, _solver->value(ts, _vars[_probeBegin]));
+  }
+  // The minimum of forward row b plus the minimum of backward row b is the
+  // committed number of changes minus minSum at row b:
+  Int changes = _committedChanges - _minSums[_probeBegin];
+  for (size_t t = _probeBegin; t < _probeEnd; ++t) {
+    changes -= _backwardMinDeltas[t];
+  }
+  return changes + _probeOffsets[_probeEnd] +
+         minSum(row(_probeForward, _probeEnd), row(_backward, _probeEnd));
+}
+
+Int Regular::violation(Int changes) const {
+  return changes < _unreachable
+             ? changes
+             : std::max<Int>(1, static_cast<Int>(_vars.size()));
+}
+
+void Regular::recompute(Timestamp ts) {
+  recomputeTables();
+  _probeTimestamp = ts;
+  _probeBegin = _probeEnd = 0;
+  _probeRowsValid = true;
+  for (size_t t = 0; t < _vars.size(); ++t) {
+    if (_solver->value(ts, _vars[t]) != _solver->committedValue(_vars[t])) {
+      probePosition(ts, t);
+    }
+  }
+  _probeChanges = probeChanges(ts);
+  updateValue(ts, _violationId, violation(_probeChanges));
+}
+
+void Regular::notifyInputChanged(Timestamp ts, LocalId id) {
+  assert(id < _vars.size());
+  probePosition(ts, id);
+  _probeChanges = probeChanges(ts);
+  updateValue(ts, _violationId, violation(_probeChanges));
+}
+
+VarViewId Regular::nextInput(Timestamp ts) {
+  const auto index = static_cast<size_t>(_state.incValue(ts, 1));
+  if (index < _vars.size()) {
+    return _vars[index];
+  }
+  return NULL_ID;
+}
+
+void Regular::notifyCurrentInputChanged(Timestamp ts) {
+  assert(static_cast<size_t>(_state.value(ts)) < _vars.size());
+  notifyInputChanged(ts, static_cast<size_t>(_state.value(ts)));
+}
+
+void Regular::commit(Timestamp ts) {
+  Invariant::commit(ts);
+
+  if (_probeTimestamp != ts) {
+    return;
+  }
+  _probeTimestamp = NULL_TIMESTAMP;
+  if (_probeBegin == _probeEnd) {
+    return;
+  }
+  if (!_probeRowsValid) {
+    computeProbeRow(ts);
+  }
+  const size_t n = _vars.size();
+  // The forward rows until _probeEnd have already been computed, and the
+  // later rows are recomputed until a row is unchanged:
+  std::copy(row(_probeForward, _probeBegin + 1),
+            row(_probeForward, _probeEnd + 1), row(_forward, _probeBegin + 1));
+  size_t lastChanged = _probeEnd;
+  for (; lastChanged < n; ++lastChanged) {
+    forwardStep(row(_forward, lastChanged),
+                _solver->value(ts, _vars[lastChanged]), _row.data());
+    if (std::equal(_row.begin(), _row.end(), row(_forward, lastChanged + 1))) {
+      break;
+    }
+    std::copy(_row.begin(), _row.end(), row(_forward, lastChanged + 1));
+  }
+  // The backward rows of the changed variables are recomputed, and so are
+  // the earlier rows until a row is unchanged:
+  size_t firstChanged = _probeEnd;
+  while (firstChanged > 0) {
+    const size_t t = firstChanged - 1;
+    const Int delta = backwardStep(row(_backward, t + 1),
+                                   _solver->value(ts, _vars[t]), _row.data());
+    _backwardMinDeltas[t] = delta < _unreachable ? delta : 0;
+    if (t < _probeBegin &&
+        std::equal(_row.begin(), _row.end(), row(_backward, t))) {
+      break;
+    }
+    std::copy(_row.begin(), _row.end(), row(_backward, t));
+    firstChanged = t;
+  }
+  // The minima of rows firstChanged..lastChanged, and the relaxed minimum
+  // before them, depend on a changed row:
+  updateMins(firstChanged > 0 ? firstChanged - 1 : 0, lastChanged);
+  _committedChanges = _probeChanges;
+}
+
+}  // namespace atlantis::propagation
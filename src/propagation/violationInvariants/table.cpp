@@ -0,0 +1,194 @@
+#include "atlantis/propagation/violationInvariants/table.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <limits>
+
+namespace atlantis::propagation {
+
+/**
+ * @param violationId id for the violationCount
+ * @param vars the variables of the constraint
+ * @param table the tuples in row-major order (vars.size() values per tuple)
+ */
+Table::Table(SolverBase& solver, VarId violationId,
+             std::vector<VarViewId>&& vars, std::vector<Int>&& table)
+    : ViolationInvariant(solver, violationId),
+      _vars(std::move(vars)),
+      _table(std::move(table)),
+      _numTuples(_vars.empty() ? 0 : _table.size() / _vars.size()) {
+  assert(_vars.empty() || _table.size() % _vars.size() == 0);
+}
+
+Table::Table(SolverBase& solver, VarViewId violationId,
+             std::vector<VarViewId>&& vars, std::vector<Int>&& table)
+    : Table(solver, VarId(violationId), std::move(vars), std::move(table)) {
+  assert(violationId.isVar());
+}
+
+void Table::registerVars() {
+  assert(_id != NULL_ID);
+  for (size_t i = 0; i < _vars.size(); ++i) {
+    _solver->registerInvariantInput(_id, _vars[i], i, false);
+  }
+  registerDefinedVar(_violationId);
+}
+
+void Table::updateBounds(bool widenOnly) {
+  // An empty table is never satisfied:
+  const Int arity = static_cast<Int>(_vars.size());
+  _solver->updateBounds(_violationId, 0,
+                        _numTuples == 0 ? std::max<Int>(1, arity) : arity,
+                        widenOnly);
+}
+
+void Table::close(Timestamp ts) {
+  const size_t arity = _vars.size();
+  _supports.assign(arity, {});
+  _offsets.assign(arity, 0);
+  for (size_t i = 0; i < arity; ++i) {
+    // Only the values that both are in the domain of the variable and occur
+    // in column i of the table have supports:
+    Int lb = std::numeric_limits<Int>::max();
+    Int ub = std::numeric_limits<Int>::min();
+    for (size_t t = 0; t < _numTuples; ++t) {
+      lb = std::min(lb, _table[t * arity + i]);
+      ub = std::max(ub, _table[t * arity + i]);
+    }
+    lb = std::max(lb, _solver->lowerBound(_vars[i]));
+    ub = std::min(ub, _solver->upperBound(_vars[i]));
+    if (ub < lb) {
+      continue;
+    }
+    _offsets[i] = lb;
+    _supports[i].resize(static_cast<size_t>(ub - lb + 1));
+    for (size_t t = 0; t < _numTuples; ++t) {
+      const Int value = _table[t * arity + i];
+      if (lb <= value && value <= ub) {
+        _supports[i][static_cast<size_t>(value - lb)].emplace_back(t);
+      }
+    }
+  }
+  _values.assign(arity, 0);
+  _distances.assign(_numTuples, CommittableInt(ts, 0));
+  _numTuplesAtDistance.assign(arity + 1, CommittableInt(ts, 0));
+}
+
+const std::vector<size_t>* Table::supports(size_t var, Int value) const {
+  if (value < _offsets[var] ||
+      static_cast<Int>(_supports[var].size()) <= value - _offsets[var]) {
+    return nullptr;
+  }
+  return &_supports[var][static_cast<size_t>(value - _offsets[var])];
+}
+
+Int Table::minDistance(Timestamp ts) const {
+  for (size_t d = 0; d < _numTuplesAtDistance.size(); ++d) {
+    if (_numTuplesAtDistance[d].value(ts) > 0) {
+      return static_cast<Int>(d);
+    }
+  }
+  // An empty table is never satisfied:
+  return std::max<Int>(1, static_cast<Int>(_vars.size()));
+}
+
+void Table::moveTuple(Timestamp ts, size_t tuple, Int delta) {
+  const Int oldDistance = _distances[tuple].value(ts);
+  const Int newDistance = _distances[tuple].incValue(ts, delta);
+  assert(0 <= newDistance && newDistance <= static_cast<Int>(_vars.size()));
+  _numTuplesAtDistance[static_cast<size_t>(oldDistance)].incValue(ts, -1);
+  _numTuplesAtDistance[static_cast<size_t>(newDistance)].incValue(ts, 1);
+}
+
+void Table::recompute(Timestamp ts) {
+  _recomputeTimestamp = ts;
+  const size_t arity = _vars.size();
+  for (size_t i = 0; i < arity; ++i) {
+    _values.setValue(ts, i, _solver->value(ts, _vars[i]));
+  }
+  for (CommittableInt& numTuples : _numTuplesAtDistance) {
+    numTuples.setValue(ts, 0);
+  }
+  for (size_t t = 0; t < _numTuples; ++t) {
+    Int distance = 0;
+    for (size_t i = 0; i < arity; ++i) {
+      if (_table[t * arity + i] != _values.value(ts, i)) {
+        ++distance;
+      }
+    }
+    _distances[t].setValue(ts, distance);
+    _numTuplesAtDistance[static_cast<size_t>(distance)].incValue(ts, 1);
+  }
+  updateValue(ts, _violationId, minDistance(ts));
+}
+
+void Table::notifyInputChanged(Timestamp ts, LocalId id) {
+  assert(id < _vars.size());
+  const Int oldValue = _values.value(ts, id);
+  const Int newValue = _solver->value(ts, _vars[id]);
+  if (oldValue == newValue) {
+    return;
+  }
+  _values.setValue(ts, id, newValue);
+  if (const auto* oldSupports = supports(id, oldValue);
+      oldSupports != nullptr) {
+    for (const size_t t : *oldSupports) {
+      moveTuple(ts, t, 1);
+    }
+  }
+  if (const auto* newSupports = supports(id, newValue);
+      newSupports != nullptr) {
+    for (const size_t t : *newSupports) {
+      moveTuple(ts, t, -1);
+    }
+  }
+  updateValue(ts, _violationId, minDistance(ts));
+}
+
+VarViewId Table::nextInput(Timestamp ts) {
+  const auto index = static_cast<size_t>(_state.incValue(ts, 1));
+  if (index < _vars.size()) {
+    return _vars[index];
+  }
+  return NULL_ID;
+}
+
+void Table::notifyCurrentInputChanged(Timestamp ts) {
+  assert(static_cast<size_t>(_state.value(ts)) < _vars.size());
+  notifyInputChanged(ts, static_cast<size_t>(_state.value(ts)));
+}
+
+void Table::commitSupports(Timestamp ts, size_t var, Int value) {
+  if (const auto* valueSupports = supports(var, value);
+      valueSupports != nullptr) {
+    for (const size_t t : *valueSupports) {
+      _distances[t].commitIf(ts);
+    }
+  }
+}
+
+void Table::commit(Timestamp ts) {
+  Invariant::commit(ts);
+
+  if (_recomputeTimestamp == ts) {
+    for (CommittableInt& distance : _distances) {
+      distance.commitIf(ts);
+    }
+  } else {
+    // Only the supports of the committed and the current value of a changed
+    // variable have changed distances (if the variable changed more than
+    // once, the changes of the intermediate values cancel out):
+    for (size_t i = 0; i < _vars.size(); ++i) {
+      if (_values.hasChanged(ts, i)) {
+        commitSupports(ts, i, _values.committedValue(i));
+        commitSupports(ts, i, _values.value(ts, i));
+      }
+    }
+  }
+  _values.commitIf(ts);
+  for (CommittableInt& numTuples : _numTuplesAtDistance) {
+    numTuples.commitIf(ts);
+  }
+}
+
+}  // namespace atlantis::propagation
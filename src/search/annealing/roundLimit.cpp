@@ -0,0 +1,29 @@
+#include "atlantis/search/annealing/roundLimit.hpp"
+
+#include <cassert>
+
+namespace atlantis::search {
+
+void RoundLimit::start(double initialTemperature) {
+  _schedule->start(initialTemperature);
+}
+
+void RoundLimit::nextRound(const RoundStatistics& statistics) {
+  assert(_round < _numRounds);
+
+  if (_onRound) {
+    _onRound(_round, statistics);
+  }
+  _schedule->nextRound(statistics);
+  if (++_round == _numRounds) {
+    _sharedState.stop();
+  }
+}
+
+double RoundLimit::temperature() { return _schedule->temperature(); }
+
+bool RoundLimit::frozen() {
+  return _round >= _numRounds || _schedule->frozen();
+}
+
+}  // namespace atlantis::search
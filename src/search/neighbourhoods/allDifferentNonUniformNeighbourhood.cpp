@@ -5,15 +5,13 @@
 namespace atlantis::search::neighbourhoods {
 
 AllDifferentNonUniformNeighbourhood::AllDifferentNonUniformNeighbourhood(
-    std::vector<SearchVar>&& vars, Int domainLb, Int domainUb,
-    const propagation::SolverBase& solver)
+    std::vector<SearchVar>&& vars, Int domainLb, Int domainUb)
     : _vars(std::move(vars)),
       _varIndices(_vars.size()),
       _domainOffset(domainLb),
       _valueIndexToVarIndex(domainUb - domainLb + 1, _vars.size()),
       _domains(_vars.size()),
-      _inDomain(_vars.size()),
-      _solver(solver) {
+      _inDomain(_vars.size()) {
   assert(_vars.size() > 1);
   std::iota(_varIndices.begin(), _varIndices.end(), 0u);
   assert(_valueIndexToVarIndex.size() >= _vars.size());
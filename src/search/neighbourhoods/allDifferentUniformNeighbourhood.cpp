@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <numeric>
 
 namespace atlantis::search::neighbourhoods {
 
@@ -9,9 +10,11 @@ AllDifferentUniformNeighbourhood::AllDifferentUniformNeighbourhood(
     std::vector<SearchVar>&& vars, std::vector<Int>&& domain)
     : _vars(std::move(vars)),
       _domain(std::move(domain)),
-      _hasFreeValues(_domain.size() > _vars.size()) {
+      _hasFreeValues(_domain.size() > _vars.size()),
+      _varIndices(_vars.size()) {
   assert(_vars.size() > 1);
   assert(_domain.size() >= _vars.size());
+  std::iota(_varIndices.begin(), _varIndices.end(), 0);
 
   std::sort(_domain.begin(), _domain.end());
   _domain.erase(std::unique(_domain.begin(), _domain.end()), _domain.end());
@@ -71,6 +74,78 @@ bool AllDifferentUniformNeighbourhood::swapValues(RandomProvider& random,
                      annealer);
 }
 
+bool AllDifferentUniformNeighbourhood::enumerateMoves(
+    RandomProvider& random, const Assignment& assignment, size_t maxVars,
+    std::vector<CandidateMove>& moves) {
+  const Int numVars = static_cast<Int>(_vars.size());
+  const Int numValues = static_cast<Int>(_domain.size());
+  const size_t numSelected = selectIndices(random, _varIndices, maxVars);
+  for (size_t k = 0; k < numSelected; ++k) {
+    const size_t i = _varIndices[k];
+    const auto var1 = _vars[i].solverId();
+    if (_hasFreeValues) {
+      // Replace the value of the variable with a free value:
+      const auto appendMove = [&](size_t valIndex) {
+        moves.emplace_back(std::array<propagation::VarViewId, 1>{var1},
+                           std::array<Int, 1>{_domain[valIndex]});
+      };
+      if (static_cast<size_t>(numValues - numVars) > MAX_ENUMERATED_VALUES) {
+        for (size_t j = 0; j < MAX_ENUMERATED_VALUES; ++j) {
+          appendMove(
+              static_cast<size_t>(random.intInRange(numVars, numValues - 1)));
+        }
+      } else {
+        for (size_t valIndex = _vars.size(); valIndex < _domain.size();
+             ++valIndex) {
+          appendMove(valIndex);
+        }
+      }
+      continue;
+    }
+    // Swap the values of the variable and another variable:
+    const auto appendMove = [&](size_t j) {
+      const auto var2 = _vars[j].solverId();
+      moves.emplace_back(
+          std::array<propagation::VarViewId, 2>{var1, var2},
+          std::array<Int, 2>{assignment.value(var2), assignment.value(var1)});
+    };
+    if (_vars.size() - 1 > MAX_ENUMERATED_VALUES) {
+      for (size_t j = 0; j < MAX_ENUMERATED_VALUES; ++j) {
+        appendMove(
+            (i + static_cast<size_t>(random.intInRange(1, numVars - 1))) %
+            _vars.size());
+      }
+    } else {
+      for (size_t j = 0; j < _vars.size(); ++j) {
+        if (j != i) {
+          appendMove(j);
+        }
+      }
+    }
+  }
+  return true;
+}
+
+void AllDifferentUniformNeighbourhood::commitMove(const CandidateMove& move,
+                                                  Assignment& assignment) {
+  move.commit(assignment);
+  if (!_hasFreeValues) {
+    return;
+  }
+  // The value of the variable was replaced with a free value, which is no
+  // longer free:
+  assert(move.size() == 1);
+  const auto varIt =
+      std::find_if(_vars.begin(), _vars.end(), [&](const SearchVar& var) {
+        return var.solverId() == move.var(0);
+      });
+  const auto valIt =
+      std::find(_domain.begin() + static_cast<std::ptrdiff_t>(_vars.size()),
+                _domain.end(), move.value(0));
+  assert(varIt != _vars.end() && valIt != _domain.end());
+  std::swap(_domain[static_cast<size_t>(varIt - _vars.begin())], *valIt);
+}
+
 bool AllDifferentUniformNeighbourhood::assignValue(RandomProvider& random,
                                                    Assignment& assignment,
                                                    Annealer& annealer) {
@@ -1,12 +1,15 @@
 #include "atlantis/search/neighbourhoods/circuitNeighbourhood.hpp"
 
 #include <algorithm>
+#include <numeric>
 
 namespace atlantis::search::neighbourhoods {
 
 CircuitNeighbourhood::CircuitNeighbourhood(std::vector<SearchVar>&& vars,
                                            Int offset)
-    : _vars(std::move(vars)), _offset(offset) {}
+    : _vars(std::move(vars)), _offset(offset), _varIndices(_vars.size()) {
+  std::iota(_varIndices.begin(), _varIndices.end(), 0);
+}
 
 void CircuitNeighbourhood::initialise(RandomProvider& random,
                                       AssignmentModifier& modifications) {
@@ -115,6 +118,52 @@ bool CircuitNeighbourhood::randomMove(RandomProvider& random,
   return annealer.acceptMove(move);
 }
 
+bool CircuitNeighbourhood::enumerateMoves(RandomProvider& random,
+                                          const Assignment& assignment,
+                                          size_t maxVars,
+                                          std::vector<CandidateMove>& moves) {
+  if (_vars.size() < 3) {
+    return true;
+  }
+  const size_t numSelected = selectIndices(random, _varIndices, maxVars);
+  for (size_t k = 0; k < numSelected; ++k) {
+    // Move the successor of nodeIdx to after newNextIdx:
+    const size_t nodeIdx = _varIndices[k];
+    const size_t oldNextIdx =
+        node2Idx(assignment.value(_vars[nodeIdx].solverId()));
+    if (_vars[nodeIdx].isFixed() || _vars[oldNextIdx].isFixed()) {
+      continue;
+    }
+    const size_t kIdx =
+        node2Idx(assignment.value(_vars[oldNextIdx].solverId()));
+    const auto appendMove = [&](size_t newNextIdx) {
+      if (_vars[newNextIdx].isFixed()) {
+        return;
+      }
+      const size_t lastIdx =
+          node2Idx(assignment.value(_vars[newNextIdx].solverId()));
+      moves.emplace_back(
+          std::array<propagation::VarViewId, 3>{
+              _vars[nodeIdx].solverId(), _vars[oldNextIdx].solverId(),
+              _vars[newNextIdx].solverId()},
+          std::array<Int, 3>{idx2Node(kIdx), idx2Node(lastIdx),
+                             idx2Node(oldNextIdx)});
+    };
+    if (_vars.size() - 2 > MAX_ENUMERATED_VALUES) {
+      for (size_t i = 0; i < MAX_ENUMERATED_VALUES; ++i) {
+        appendMove(determineNewNext(random, nodeIdx, oldNextIdx, _vars.size()));
+      }
+    } else {
+      for (size_t newNextIdx = 0; newNextIdx < _vars.size(); ++newNextIdx) {
+        if (newNextIdx != nodeIdx && newNextIdx != oldNextIdx) {
+          appendMove(newNextIdx);
+        }
+      }
+    }
+  }
+  return true;
+}
+
 Int CircuitNeighbourhood::idx2Node(size_t nodeIdx) noexcept {
   // Account for index sets starting at _offset instead of 0.
   return static_cast<Int>(nodeIdx) + _offset;
@@ -0,0 +1,93 @@
+#include "atlantis/search/neighbourhoods/inverseNeighbourhood.hpp"
+
+#include <cassert>
+
+namespace atlantis::search::neighbourhoods {
+
+InverseNeighbourhood::InverseNeighbourhood(std::vector<SearchVar>&& vars,
+                                           Int fOffset, Int invfOffset)
+    : _vars(std::move(vars)),
+      _numVars(_vars.size() / 2),
+      _fOffset(fOffset),
+      _invfOffset(invfOffset) {
+  assert(_vars.size() % 2 == 0);
+  for (size_t i = 0; i < _numVars; ++i) {
+    if (!f(i).isFixed()) {
+      _freeIndices.emplace_back(i);
+    }
+  }
+}
+
+const SearchVar& InverseNeighbourhood::f(size_t index) const noexcept {
+  assert(index < _numVars);
+  return _vars[index];
+}
+
+const SearchVar& InverseNeighbourhood::invf(size_t index) const noexcept {
+  assert(index < _numVars);
+  return _vars[_numVars + index];
+}
+
+void InverseNeighbourhood::initialise(RandomProvider& random,
+                                      AssignmentModifier& modifications) {
+  // The fixed variables of f and invf are assumed to be fixed in pairs, so
+  // the indices of the free variables of invf are the free values of f:
+  std::vector<size_t> freeValues;
+  freeValues.reserve(_freeIndices.size());
+  for (size_t j = 0; j < _numVars; ++j) {
+    if (invf(j).isFixed()) {
+      modifications.set(invf(j).solverId(), invf(j).constDomain().lowerBound());
+    } else {
+      freeValues.emplace_back(j);
+    }
+  }
+  assert(freeValues.size() == _freeIndices.size());
+  random.shuffle<size_t>(freeValues);
+
+  for (size_t i = 0; i < _numVars; ++i) {
+    if (f(i).isFixed()) {
+      modifications.set(f(i).solverId(), f(i).constDomain().lowerBound());
+    }
+  }
+  for (size_t k = 0; k < _freeIndices.size(); ++k) {
+    const size_t i = _freeIndices[k];
+    const size_t j = freeValues[k];
+    modifications.set(f(i).solverId(), static_cast<Int>(j) + _invfOffset);
+    modifications.set(invf(j).solverId(), static_cast<Int>(i) + _fOffset);
+  }
+}
+
+bool InverseNeighbourhood::randomMove(RandomProvider& random,
+                                      Assignment& assignment,
+                                      Annealer& annealer) {
+  if (_freeIndices.size() < 2) {
+    return false;
+  }
+  const size_t k1 = static_cast<size_t>(
+      random.intInRange(0, static_cast<Int>(_freeIndices.size()) - 1));
+  const size_t k2 =
+      (k1 + static_cast<size_t>(random.intInRange(
+                1, static_cast<Int>(_freeIndices.size()) - 1))) %
+      _freeIndices.size();
+
+  const size_t i1 = _freeIndices[k1];
+  const size_t i2 = _freeIndices[k2];
+  const Int value1 = assignment.value(f(i1).solverId());
+  const Int value2 = assignment.value(f(i2).solverId());
+  assert(_invfOffset <= value1 &&
+         value1 < _invfOffset + static_cast<Int>(_numVars));
+  assert(_invfOffset <= value2 &&
+         value2 < _invfOffset + static_cast<Int>(_numVars));
+  const auto j1 = static_cast<size_t>(value1 - _invfOffset);
+  const auto j2 = static_cast<size_t>(value2 - _invfOffset);
+
+  // f[i1] <-> f[i2] and invf[f[i1]] <-> invf[f[i2]]:
+  return maybeCommit(
+      Move<4>({f(i1).solverId(), f(i2).solverId(), invf(j1).solverId(),
+               invf(j2).solverId()},
+              {value2, value1, static_cast<Int>(i2) + _fOffset,
+               static_cast<Int>(i1) + _fOffset}),
+      assignment, annealer);
+}
+
+}  // namespace atlantis::search::neighbourhoods
@@ -32,6 +32,15 @@ NeighbourhoodCombinator::NeighbourhoodCombinator(
       std::discrete_distribution<size_t>{weights.begin(), weights.end()};
 }
 
+std::shared_ptr<Neighbourhood> NeighbourhoodCombinator::clone() const {
+  std::vector<std::shared_ptr<Neighbourhood>> neighbourhoods;
+  neighbourhoods.reserve(_neighbourhoods.size());
+  for (const auto& neighbourhood : _neighbourhoods) {
+    neighbourhoods.emplace_back(neighbourhood->clone());
+  }
+  return std::make_shared<NeighbourhoodCombinator>(std::move(neighbourhoods));
+}
+
 void NeighbourhoodCombinator::initialise(RandomProvider& random,
                                          AssignmentModifier& modifications) {
   for (const auto& neighbourhood : _neighbourhoods) {
@@ -46,6 +55,20 @@ bool NeighbourhoodCombinator::randomMove(RandomProvider& random,
   return neighbourhood.randomMove(random, assignment, annealer);
 }
 
+bool NeighbourhoodCombinator::enumerateMoves(
+    RandomProvider& random, const Assignment& assignment, size_t maxVars,
+    std::vector<CandidateMove>& moves) {
+  _enumeratingIndex =
+      random.fromDistribution<size_t>(_neighbourhoodDistribution);
+  return _neighbourhoods[_enumeratingIndex]->enumerateMoves(
+      random, assignment, maxVars, moves);
+}
+
+void NeighbourhoodCombinator::commitMove(const CandidateMove& move,
+                                         Assignment& assignment) {
+  _neighbourhoods[_enumeratingIndex]->commitMove(move, assignment);
+}
+
 void NeighbourhoodCombinator::printNeighbourhood(logging::Logger& logger) {
   for (const auto& neighbourhood : _neighbourhoods) {
     logger.debug("Neighbourhood {} covers {} variables.",
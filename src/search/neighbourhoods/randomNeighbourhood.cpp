@@ -1,9 +1,13 @@
 #include "atlantis/search/neighbourhoods/randomNeighbourhood.hpp"
 
+#include <numeric>
+
 namespace atlantis::search::neighbourhoods {
 
 RandomNeighbourhood::RandomNeighbourhood(std::vector<SearchVar>&& vars)
-    : _vars(std::move(vars)) {}
+    : _vars(std::move(vars)), _varIndices(_vars.size()) {
+  std::iota(_varIndices.begin(), _varIndices.end(), 0);
+}
 
 void RandomNeighbourhood::initialise(RandomProvider& random,
                                      AssignmentModifier& modifications) {
@@ -15,11 +19,47 @@ void RandomNeighbourhood::initialise(RandomProvider& random,
 bool RandomNeighbourhood::randomMove(RandomProvider& random,
                                      Assignment& assignment,
                                      Annealer& annealer) {
-  auto var = random.element(_vars);
+  SearchVar& var = random.element(_vars);
 
   return maybeCommit(
       Move<1u>({var.solverId()}, {random.inDomain(var.domain())}), assignment,
       annealer);
 }
 
+bool RandomNeighbourhood::enumerateMoves(RandomProvider& random,
+                                         const Assignment& assignment,
+                                         size_t maxVars,
+                                         std::vector<CandidateMove>& moves) {
+  const size_t numSelected = selectIndices(random, _varIndices, maxVars);
+  for (size_t i = 0; i < numSelected; ++i) {
+    SearchVar& var = _vars[_varIndices[i]];
+    if (var.isFixed()) {
+      continue;
+    }
+    const Int oldValue = assignment.value(var.solverId());
+    const auto appendMove = [&](Int value) {
+      if (value != oldValue) {
+        moves.emplace_back(
+            std::array<propagation::VarViewId, 1>{var.solverId()},
+            std::array<Int, 1>{value});
+      }
+    };
+    if (var.domain().size() > MAX_ENUMERATED_VALUES) {
+      for (size_t j = 0; j < MAX_ENUMERATED_VALUES; ++j) {
+        appendMove(random.inDomain(var.domain()));
+      }
+    } else if (var.domain().isInterval()) {
+      for (Int value = var.domain().lowerBound();
+           value <= var.domain().upperBound(); ++value) {
+        appendMove(value);
+      }
+    } else {
+      for (const Int value : var.domain().values()) {
+        appendMove(value);
+      }
+    }
+  }
+  return true;
+}
+
 }  // namespace atlantis::search::neighbourhoods
@@ -8,10 +8,31 @@
 
 namespace atlantis::search {
 
+propagation::ObjectiveDirection objectiveDirection(
+    fznparser::ProblemType problemType) {
+  switch (problemType) {
+    case fznparser::ProblemType::MINIMIZE:
+      return propagation::ObjectiveDirection::MINIMIZE;
+    case fznparser::ProblemType::MAXIMIZE:
+      return propagation::ObjectiveDirection::MAXIMIZE;
+    case fznparser::ProblemType::SATISFY:
+    default:
+      return propagation::ObjectiveDirection::NONE;
+  }
+}
+
 Objective::Objective(propagation::Solver& solver,
                      fznparser::ProblemType problemType)
     : _solver(solver), _problemType(problemType) {}
 
+Objective::Objective(propagation::Solver& solver, const Objective& other)
+    : _solver(solver),
+      _problemType(other._problemType),
+      _bound(other._bound),
+      _objective(other._objective),
+      _violation(other._violation),
+      _sharedState(other._sharedState) {}
+
 propagation::VarViewId Objective::registerNode(
     propagation::VarViewId totalViolationVarId,
     propagation::VarViewId objectiveVarId) {
@@ -45,12 +66,28 @@ void Objective::tighten() {
     return;
   }
 
-  const Int newBound =
+  Int newBound =
       _problemType == fznparser::ProblemType::SATISFY
           ? _solver.committedValue(*_bound)
           : (_solver.committedValue(*_objective) +
              (_problemType == fznparser::ProblemType::MINIMIZE ? -1 : 1));
 
+  if (_sharedState != nullptr) {
+    newBound = _sharedState->tightenObjectiveBound(newBound);
+  }
+
+  setBound(newBound);
+}
+
+void Objective::adoptSharedBound() {
+  if (!_bound || _sharedState == nullptr ||
+      !_sharedState->isTighterThan(_solver.committedValue(*_bound))) {
+    return;
+  }
+  setBound(_sharedState->objectiveBound());
+}
+
+void Objective::setBound(Int newBound) {
   _solver.beginMove();
   _solver.setValue(*_bound, newBound);
   _solver.endMove();
@@ -3,8 +3,15 @@
 namespace atlantis::search {
 
 bool SearchController::shouldRun(const Assignment& assignment) {
+  if (_sharedState != nullptr && _sharedState->stopped()) {
+    return false;
+  }
+
   if (_foundSolution &&
       (_isSatisfactionProblem || assignment.objectiveIsOptimal())) {
+    if (_sharedState != nullptr) {
+      _sharedState->stop();
+    }
     return false;
   }
 
@@ -19,6 +26,9 @@ bool SearchController::shouldRun(const Assignment& assignment) {
 
 void SearchController::onSolution(const Assignment& assignment) {
   _foundSolution = true;
+  if (_sharedState != nullptr) {
+    _sharedState->registerSolution();
+  }
   _onSolution(assignment);
 }
 
@@ -69,6 +69,8 @@ SearchStatistics SearchProcedure::run(SearchController& controller,
             });
         annealer.nextRound();
         rounds->increment();
+        // Other workers might have found better solutions:
+        _objective.adoptSharedBound();
       });
     }
   } while (controller.shouldRun(_assignment));
@@ -0,0 +1,163 @@
+#include "atlantis/search/tabuSearch.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+
+#include "atlantis/exceptions/exceptions.hpp"
+
+namespace atlantis::search {
+
+// Like the annealer, only the violation is minimised, where the objective is
+// improved by tightening its bound whenever a solution is found:
+static Int evaluate(const Cost& cost) { return cost.evaluate(1, 0); }
+
+TabuSearch::TabuSearch(RandomProvider& random, Assignment& assignment,
+                       neighbourhoods::Neighbourhood& neighbourhood,
+                       Objective objective, size_t tenure,
+                       size_t varsPerIteration, size_t maxStagnation)
+    : _random(random),
+      _assignment(assignment),
+      _neighbourhood(neighbourhood),
+      _objective(objective),
+      _tenure(tenure),
+      _varsPerIteration(std::max<size_t>(1, varsPerIteration)),
+      _maxStagnation(
+          maxStagnation > 0
+              ? maxStagnation
+              : std::max<size_t>(1000, 10 * assignment.searchVars().size())) {}
+
+bool TabuSearch::isTabu(const CandidateMove& move, size_t iteration) const {
+  for (size_t i = 0; i < move.size(); ++i) {
+    const auto it = _tabuUntil.find(
+        std::make_pair(static_cast<size_t>(move.var(i)), move.value(i)));
+    if (it != _tabuUntil.end() && iteration < it->second) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void TabuSearch::dropExpired(size_t iteration) {
+  std::erase_if(_tabuUntil,
+                [&](const auto& entry) { return entry.second <= iteration; });
+}
+
+bool TabuSearch::commitBestMove(size_t iteration, Int lowestCost) {
+  try {
+    _assignment.probeBatch(_moves, _costs);
+  } catch (TopologicalOrderError&) {
+    // The probe contains one or more undeterminable dynamic cycles
+    return false;
+  }
+
+  size_t bestIndex = _moves.size();
+  Int bestCost = std::numeric_limits<Int>::max();
+  Int numBest = 0;
+  for (size_t i = 0; i < _moves.size(); ++i) {
+    const Int cost = evaluate(_costs[i]);
+    // A tabu move is only allowed if it results in a new lowest cost:
+    if (cost > bestCost ||
+        (cost >= lowestCost && isTabu(_moves[i], iteration))) {
+      continue;
+    }
+    // Break ties uniformly at random:
+    numBest = cost < bestCost ? 1 : numBest + 1;
+    if (numBest == 1 || _random.intInRange(1, numBest) == 1) {
+      bestIndex = i;
+    }
+    bestCost = cost;
+  }
+  if (bestIndex == _moves.size()) {
+    return false;
+  }
+
+  if (iteration >= _nextDropIteration) {
+    dropExpired(iteration);
+    _nextDropIteration = iteration + _tenure + 1;
+  }
+  const CandidateMove& move = _moves[bestIndex];
+  for (size_t i = 0; i < move.size(); ++i) {
+    _tabuUntil[std::make_pair(static_cast<size_t>(move.var(i)),
+                              _assignment.value(move.var(i)))] =
+        iteration + _tenure + 1;
+  }
+  _neighbourhood.commitMove(move, _assignment);
+  return true;
+}
+
+SearchStatistics TabuSearch::run(SearchController& controller,
+                                 Annealer& annealer, logging::Logger& logger) {
+  auto iterations = std::make_unique<CounterStatistic>("Iterations");
+  auto initialisations = std::make_unique<CounterStatistic>("Initialisations");
+  auto moves = std::make_unique<CounterStatistic>("Moves");
+
+  do {
+    initialisations->increment();
+
+    logger.timedProcedure(logging::Level::LVL_TRACE, "initialise assignment",
+                          [&] {
+                            _assignment.assign([&](auto& modifications) {
+                              _neighbourhood.initialise(_random, modifications);
+                            });
+                          });
+
+    if (_assignment.satisfiesConstraints()) {
+      controller.onSolution(_assignment);
+      _objective.tighten();
+    }
+
+    annealer.start();
+    _tabuUntil.clear();
+    _nextDropIteration = 0;
+
+    Int lowestCost = evaluate(_assignment.cost());
+    size_t lastImprovement = 0;
+    for (size_t iteration = 1; controller.shouldRun(_assignment) &&
+                               iteration - lastImprovement <= _maxStagnation;
+         ++iteration) {
+      iterations->increment();
+
+      _moves.clear();
+      bool madeMove;
+      if (_neighbourhood.enumerateMoves(_random, _assignment,
+                                        _varsPerIteration, _moves)) {
+        madeMove = !_moves.empty() && commitBestMove(iteration, lowestCost);
+      } else {
+        madeMove = _neighbourhood.randomMove(_random, _assignment, annealer);
+      }
+
+      if (madeMove) {
+        moves->increment();
+      }
+
+      if (madeMove && _assignment.satisfiesConstraints()) {
+        controller.onSolution(_assignment);
+        _objective.tighten();
+        // Tightening the bound increases the cost:
+        lowestCost = evaluate(_assignment.cost());
+        lastImprovement = iteration;
+      }
+
+      // Other workers might have found better solutions:
+      _objective.adoptSharedBound();
+
+      if (const Int cost = evaluate(_assignment.cost()); cost < lowestCost) {
+        lowestCost = cost;
+        lastImprovement = iteration;
+      }
+    }
+    logger.trace("Lowest cost before reinitialising: {:d}", lowestCost);
+  } while (controller.shouldRun(_assignment));
+
+  std::vector<std::unique_ptr<Statistic>> statistics;
+  statistics.push_back(std::move(iterations));
+  statistics.push_back(std::move(initialisations));
+  statistics.push_back(std::move(moves));
+
+  controller.onFinish();
+
+  return SearchStatistics{std::move(statistics)};
+}
+
+}  // namespace atlantis::search
@@ -0,0 +1,268 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <fznparser/parser.hpp>
+#include <memory>
+#include <new>
+#include <optional>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "atlantis/fznBackend.hpp"
+#include "atlantis/fznSearch.hpp"
+#include "atlantis/logging/logger.hpp"
+#include "atlantis/propagation/invariants/element2dConst.hpp"
+#include "atlantis/propagation/invariants/linear.hpp"
+#include "atlantis/propagation/solver.hpp"
+#include "atlantis/propagation/violationInvariants/allDifferent.hpp"
+#include "atlantis/search/annealer.hpp"
+#include "atlantis/search/annealing/annealerContainer.hpp"
+#include "atlantis/search/annealing/annealingScheduleFactory.hpp"
+#include "atlantis/search/annealing/roundLimit.hpp"
+#include "atlantis/search/assignment.hpp"
+#include "atlantis/search/neighbourhoods/neighbourhoodCombinator.hpp"
+#include "atlantis/search/neighbourhoods/randomNeighbourhood.hpp"
+#include "atlantis/search/objective.hpp"
+#include "atlantis/search/randomProvider.hpp"
+#include "atlantis/search/searchController.hpp"
+#include "atlantis/search/searchProcedure.hpp"
+#include "atlantis/search/sharedSearchState.hpp"
+#include "atlantis/utils/matrix.hpp"
+
+/*
+ * These tests replace the global operator new and operator delete, and are
+ * therefore built into their own executable (runAllocationTests) rather than
+ * into runUnitTests. Only the allocations of the thread that enables
+ * counting are counted.
+ */
+static thread_local bool isCounting = false;
+static thread_local size_t numCounted = 0;
+
+static void* countedAllocate(std::size_t size) {
+  if (isCounting) {
+    ++numCounted;
+  }
+  void* ptr = std::malloc(size == 0 ? 1 : size);
+  if (ptr == nullptr) {
+    throw std::bad_alloc();
+  }
+  return ptr;
+}
+
+void* operator new(std::size_t size) { return countedAllocate(size); }
+void* operator new[](std::size_t size) { return countedAllocate(size); }
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete[](void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, std::size_t) noexcept { std::free(ptr); }
+
+namespace atlantis::testing {
+
+using namespace atlantis::search;
+
+/**
+ * Counts the heap allocations of the annealing rounds after the warm-up
+ * rounds, that is, of the inner loop of SearchProcedure::run (neighbourhood
+ * selection, move construction, probe, accept, and commit) and of the
+ * bookkeeping between rounds.
+ */
+class AllocationCounter {
+ private:
+  UInt _numWarmUpRounds;
+  UInt _numRounds;
+  size_t _numAllocations{0};
+  size_t _numProbes{0};
+
+ public:
+  AllocationCounter(UInt numWarmUpRounds, UInt numRounds)
+      : _numWarmUpRounds(numWarmUpRounds), _numRounds(numRounds) {
+    assert(0 < numWarmUpRounds && numWarmUpRounds < numRounds);
+  }
+
+  ~AllocationCounter() { isCounting = false; }
+
+  [[nodiscard]] size_t numAllocations() const noexcept {
+    return _numAllocations;
+  }
+
+  [[nodiscard]] size_t numProbes() const noexcept { return _numProbes; }
+
+  RoundLimit::RoundCallback onRound() {
+    return [this](UInt round, const RoundStatistics& statistics) {
+      if (round + 1 == _numWarmUpRounds) {
+        numCounted = 0;
+        isCounting = true;
+      } else if (round >= _numWarmUpRounds) {
+        // Up to the end of this round, in case the search stops early:
+        _numAllocations = numCounted;
+        _numProbes += statistics.attemptedMoves;
+        isCounting = round + 1 < _numRounds;
+      }
+    };
+  }
+};
+
+static constexpr UInt NUM_WARM_UP_ROUNDS = 2;
+static constexpr UInt NUM_ROUNDS = 10;
+
+static void setSolverMode(propagation::Solver& solver, size_t mode) {
+  using propagation::OutputToInputMarkingMode;
+  using propagation::PropagationMode;
+  const std::array<OutputToInputMarkingMode, 4> markingModes{
+      OutputToInputMarkingMode::NONE, OutputToInputMarkingMode::NONE,
+      OutputToInputMarkingMode::OUTPUT_TO_INPUT_STATIC,
+      OutputToInputMarkingMode::INPUT_TO_OUTPUT_EXPLORATION};
+  solver.setPropagationMode(mode == 0 ? PropagationMode::INPUT_TO_OUTPUT
+                                      : PropagationMode::OUTPUT_TO_INPUT);
+  solver.setOutputToInputMarkingMode(markingModes.at(mode));
+}
+
+/**
+ * A travelling-salesperson-like model: minimise the sum of dist(x[i],
+ * x[i + 1]) subject to all_different(x), where every distance is at least 1
+ * (so that the optimal value 0 is never reached and the search never stops
+ * early). The search variables are covered by two random neighbourhoods,
+ * which are combined.
+ */
+TEST(MoveLoopAllocations, InCodeModel) {
+  const Int n = 30;
+  std::mt19937 gen(1234);
+  std::uniform_int_distribution<Int> distanceDist(1, 100);
+  std::vector<std::vector<Int>> dist(n, std::vector<Int>(n));
+  for (auto& row : dist) {
+    for (Int& distance : row) {
+      distance = distanceDist(gen);
+    }
+  }
+
+  for (size_t mode = 0; mode <= 3; ++mode) {
+    SCOPED_TRACE("solver mode " + std::to_string(mode));
+    propagation::Solver solver;
+    Objective objective(solver, fznparser::ProblemType::MINIMIZE);
+    solver.open();
+    setSolverMode(solver, mode);
+    std::vector<propagation::VarViewId> x;
+    std::vector<SearchVar> firstHalf;
+    std::vector<SearchVar> secondHalf;
+    for (Int i = 0; i < n; ++i) {
+      x.emplace_back(solver.makeIntVar(i + 1, 1, n));
+      (i < n / 2 ? firstHalf : secondHalf)
+          .emplace_back(x.back(), SearchDomain(1, n));
+    }
+    const propagation::VarViewId allDifferentViolation =
+        solver.makeIntVar(0, 0, n);
+    solver.makeViolationInvariant<propagation::AllDifferent>(
+        solver, allDifferentViolation, std::vector<propagation::VarViewId>(x));
+    std::vector<propagation::VarViewId> distances;
+    for (Int i = 0; i + 1 < n; ++i) {
+      distances.emplace_back(solver.makeIntVar(1, 1, 100));
+      solver.makeInvariant<propagation::Element2dConst>(
+          solver, distances.back(), x[i], x[i + 1], Matrix<Int>(dist), 1, 1);
+    }
+    const propagation::VarViewId objectiveVar =
+        solver.makeIntVar(0, 0, 100 * n);
+    solver.makeInvariant<propagation::Linear>(solver, objectiveVar,
+                                              std::move(distances));
+    const propagation::VarViewId violation =
+        objective.registerNode(allDifferentViolation, objectiveVar);
+    solver.close();
+
+    Assignment assignment(solver, violation, objectiveVar,
+                          propagation::ObjectiveDirection::MINIMIZE, 0);
+    neighbourhoods::NeighbourhoodCombinator neighbourhood(
+        std::vector<std::shared_ptr<neighbourhoods::Neighbourhood>>{
+            std::make_shared<neighbourhoods::RandomNeighbourhood>(
+                std::move(firstHalf)),
+            std::make_shared<neighbourhoods::RandomNeighbourhood>(
+                std::move(secondHalf))});
+
+    RandomProvider random(1234);
+    SharedSearchState sharedState(propagation::ObjectiveDirection::MINIMIZE);
+    SearchController controller(false, [](const Assignment&) {}, [](bool) {},
+                                std::optional<std::chrono::milliseconds>{});
+    controller.share(sharedState);
+    AllocationCounter counter(NUM_WARM_UP_ROUNDS, NUM_ROUNDS);
+    // The cooling schedule never freezes within the limit, so that the
+    // search is never restarted (which allocates):
+    RoundLimit schedule(AnnealerContainer::cooling(0.99, NUM_ROUNDS),
+                        NUM_ROUNDS, sharedState, counter.onRound());
+    Annealer annealer(assignment, random, schedule);
+    SearchProcedure search(random, assignment, neighbourhood, objective);
+    logging::Logger logger(stderr, logging::Level::LVL_ERROR);
+    search.run(controller, annealer, logger);
+
+    EXPECT_GT(counter.numProbes(), 0);
+    EXPECT_EQ(counter.numAllocations(), 0);
+  }
+}
+
+/**
+ * @return the paths of the FlatZinc models in FZN_DIR, in order.
+ */
+static std::vector<std::filesystem::path> fznModelFiles() {
+  std::vector<std::filesystem::path> modelFilePaths;
+  for (const auto& entry : std::filesystem::directory_iterator(FZN_DIR)) {
+    if (entry.is_regular_file() && entry.path().extension() == ".fzn") {
+      modelFilePaths.emplace_back(entry.path());
+    }
+  }
+  std::sort(modelFilePaths.begin(), modelFilePaths.end());
+  return modelFilePaths;
+}
+
+class FznMoveLoopAllocations
+    : public ::testing::TestWithParam<std::filesystem::path> {};
+
+/**
+ * The same for every FlatZinc model in FZN_DIR, set up and searched by
+ * FznBackend (with a single worker), as the solver executable does.
+ */
+TEST_P(FznMoveLoopAllocations, FznModel) {
+  FznBackend backend(fznparser::parseFznFile(GetParam()));
+  logging::Logger logger(stderr, logging::Level::LVL_ERROR);
+  const std::unique_ptr<FznSearch> fznSearch = backend.setUp(logger);
+  if (!fznSearch->hasSearchVars()) {
+    GTEST_SKIP() << "the model has no search variables";
+  }
+
+  // The same cooling schedule as above, given as a schedule definition:
+  const std::filesystem::path schedulePath =
+      std::filesystem::temp_directory_path() /
+      ("tMoveLoopAllocations_" + GetParam().stem().string() + ".json");
+  {
+    std::ofstream scheduleFile(schedulePath);
+    scheduleFile << R"({"cooling": {"coolingRate": 0.99, )"
+                 << R"("successiveFutileRoundsThreshold": )" << NUM_ROUNDS
+                 << "}}";
+  }
+  backend.setAnnealingScheduleFactory(AnnealingScheduleFactory(schedulePath));
+  backend.setRandomSeed(1234);
+  backend.setOnSolution(
+      [](const invariantgraph::FznInvariantGraph&, const Assignment&) {});
+  backend.setOnFinish([](bool) {});
+  AllocationCounter counter(NUM_WARM_UP_ROUNDS, NUM_ROUNDS);
+  backend.setRoundLimit(NUM_ROUNDS, counter.onRound());
+  backend.run(logger, *fznSearch);
+  std::filesystem::remove(schedulePath);
+
+  if (counter.numProbes() == 0) {
+    GTEST_SKIP() << "the search finished during the warm-up rounds";
+  }
+  EXPECT_EQ(counter.numAllocations(), 0);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    MoveLoopAllocations, FznMoveLoopAllocations,
+    ::testing::ValuesIn(fznModelFiles()),
+    [](const ::testing::TestParamInfo<std::filesystem::path>& info) {
+      return info.param.stem().string();
+    });
+
+}  // namespace atlantis::testing
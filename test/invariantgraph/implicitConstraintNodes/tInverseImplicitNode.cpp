@@ -0,0 +1,72 @@
+#include "../nodeTestBase.hpp"
+#include "atlantis/invariantgraph/implicitConstraintNodes/inverseImplicitNode.hpp"
+#include "atlantis/search/neighbourhoods/inverseNeighbourhood.hpp"
+
+namespace atlantis::testing {
+
+using namespace atlantis::invariantgraph;
+
+class InverseImplicitNodeTestFixture
+    : public NodeTestBase<InverseImplicitNode> {
+ public:
+  VarNodeId f1{NULL_NODE_ID};
+  VarNodeId f2{NULL_NODE_ID};
+  VarNodeId f3{NULL_NODE_ID};
+  VarNodeId invf1{NULL_NODE_ID};
+  VarNodeId invf2{NULL_NODE_ID};
+  VarNodeId invf3{NULL_NODE_ID};
+
+  void SetUp() override {
+    NodeTestBase::SetUp();
+    f1 = retrieveIntVarNode(1, 3, "f1");
+    f2 = retrieveIntVarNode(1, 3, "f2");
+    f3 = retrieveIntVarNode(1, 3, "f3");
+    invf1 = retrieveIntVarNode(1, 3, "invf1");
+    invf2 = retrieveIntVarNode(1, 3, "invf2");
+    invf3 = retrieveIntVarNode(1, 3, "invf3");
+
+    createImplicitConstraintNode(*_invariantGraph,
+                                 std::vector<VarNodeId>{f1, f2, f3}, 1,
+                                 std::vector<VarNodeId>{invf1, invf2, invf3},
+                                 1);
+  }
+};
+
+TEST_P(InverseImplicitNodeTestFixture, construction) {
+  std::vector<VarNodeId> expectedVars{f1, f2, f3, invf1, invf2, invf3};
+
+  EXPECT_EQ(invNode().outputVarNodeIds(), expectedVars);
+}
+
+TEST_P(InverseImplicitNodeTestFixture, application) {
+  _solver->open();
+  for (VarNodeId outputVarNodeId : invNode().outputVarNodeIds()) {
+    EXPECT_EQ(varId(outputVarNodeId), propagation::NULL_ID);
+  }
+  invNode().registerOutputVars();
+  for (VarNodeId outputVarNodeId : invNode().outputVarNodeIds()) {
+    EXPECT_NE(varId(outputVarNodeId), propagation::NULL_ID);
+  }
+  invNode().registerNode();
+  _solver->close();
+
+  // f1, f2, f3, invf1, invf2 and invf3
+  EXPECT_EQ(_solver->searchVars().size(), 6);
+
+  // f1, f2, f3, invf1, invf2 and invf3
+  EXPECT_EQ(_solver->numVars(), 6);
+
+  EXPECT_EQ(_solver->numInvariants(), 0);
+
+  auto neighbourhood = invNode().neighbourhood();
+
+  EXPECT_TRUE(dynamic_cast<search::neighbourhoods::InverseNeighbourhood*>(
+      neighbourhood.get()));
+  EXPECT_EQ(neighbourhood->coveredVars().size(), 6);
+}
+
+INSTANTIATE_TEST_CASE_P(InverseImplicitNodeTest,
+                        InverseImplicitNodeTestFixture,
+                        ::testing::Values(ParamData{}));
+
+}  // namespace atlantis::testing
@@ -18,18 +18,38 @@ class ArrayVarElement2dNodeTestFixture
   Int offsetIdx1 = 1;
   Int offsetIdx2 = 1;
 
-  bool isIntElement() const { return _paramData.data <= 2; }
+  bool isIntElement() const {
+    return _paramData.data <= 2 || isNonSquare();
+  }
+  // A 2x3 matrix, where a fixed index selects the last row or column:
+  bool isNonSquare() const { return _paramData.data >= 4; }
   bool idx1ShouldBeReplaced() const {
-    return shouldBeReplaced() && (_paramData.data == 0 || _paramData.data == 2);
+    return shouldBeReplaced() && _paramData.data % 2 == 0;
   }
   bool idx2ShouldBeReplaced() const {
-    return shouldBeReplaced() && (_paramData.data == 1 || _paramData.data == 3);
+    return shouldBeReplaced() && _paramData.data % 2 == 1;
+  }
+
+  Int fixedIdx(Int offset, size_t dim) const {
+    return isNonSquare() ? offset + static_cast<Int>(dim) - 1 : offset;
+  }
+
+  size_t numMatrixVars() const {
+    return varMatrixVarNodeIds.size() * varMatrixVarNodeIds.front().size();
   }
 
   void SetUp() override {
     NodeTestBase::SetUp();
 
-    if (isIntElement()) {
+    if (isNonSquare()) {
+      offsetIdx2 = -1;
+      varMatrixVarNodeIds = {
+          {retrieveIntVarNode(-2, -1, "x00"), retrieveIntVarNode(-1, 0, "x01"),
+           retrieveIntVarNode(0, 1, "x02")},
+          {retrieveIntVarNode(1, 2, "x10"), retrieveIntVarNode(2, 3, "x11"),
+           retrieveIntVarNode(3, 4, "x12")}};
+      outputVarNodeId = retrieveIntVarNode(-2, 4, outputIdentifier);
+    } else if (isIntElement()) {
       varMatrixVarNodeIds = {
           {retrieveIntVarNode(-2, -1, "x00"), retrieveIntVarNode(-1, 0, "x01")},
           {retrieveIntVarNode(0, 1, "x10"), retrieveIntVarNode(1, 2, "x11")}};
@@ -41,19 +61,22 @@ class ArrayVarElement2dNodeTestFixture
       outputVarNodeId = retrieveBoolVarNode(outputIdentifier);
     }
 
-    idx1VarNodeId = retrieveIntVarNode(
-        offsetIdx1,
-        idx1ShouldBeReplaced()
-            ? offsetIdx1
-            : (offsetIdx1 + static_cast<Int>(varMatrixVarNodeIds.size()) - 1),
-        "idx1");
-    idx2VarNodeId = retrieveIntVarNode(
-        offsetIdx2,
-        idx2ShouldBeReplaced()
-            ? offsetIdx2
-            : (offsetIdx2 +
-               static_cast<Int>(varMatrixVarNodeIds.front().size()) - 1),
-        "idx2");
+    const size_t numRows = varMatrixVarNodeIds.size();
+    const size_t numCols = varMatrixVarNodeIds.front().size();
+    if (idx1ShouldBeReplaced()) {
+      const Int idx1 = fixedIdx(offsetIdx1, numRows);
+      idx1VarNodeId = retrieveIntVarNode(idx1, idx1, "idx1");
+    } else {
+      idx1VarNodeId = retrieveIntVarNode(
+          offsetIdx1, offsetIdx1 + static_cast<Int>(numRows) - 1, "idx1");
+    }
+    if (idx2ShouldBeReplaced()) {
+      const Int idx2 = fixedIdx(offsetIdx2, numCols);
+      idx2VarNodeId = retrieveIntVarNode(idx2, idx2, "idx2");
+    } else {
+      idx2VarNodeId = retrieveIntVarNode(
+          offsetIdx2, offsetIdx2 + static_cast<Int>(numCols) - 1, "idx2");
+    }
 
     createInvariantNode(
         *_invariantGraph, idx1VarNodeId, idx2VarNodeId,
@@ -96,11 +119,11 @@ TEST_P(ArrayVarElement2dNodeTestFixture, application) {
   invNode().registerNode();
   _solver->close();
 
-  // x00, x01, x10, x11, idx1VarNodeId, idx2VarNodeId
-  EXPECT_EQ(_solver->searchVars().size(), 6);
+  // The matrix variables, idx1VarNodeId, and idx2VarNodeId
+  EXPECT_EQ(_solver->searchVars().size(), numMatrixVars() + 2);
 
-  // x00, x01, x10, x11, idx1VarNodeId, idx2VarNodeId, and outputVarNodeId
-  EXPECT_EQ(_solver->numVars(), 7);
+  // The matrix variables, idx1VarNodeId, idx2VarNodeId, and outputVarNodeId
+  EXPECT_EQ(_solver->numVars(), numMatrixVars() + 3);
 
   // element2dVar
   EXPECT_EQ(_solver->numInvariants(), 1);
@@ -115,6 +138,23 @@ TEST_P(ArrayVarElement2dNodeTestFixture, replace) {
     EXPECT_TRUE(invNode().replace());
     invNode().deactivate();
     EXPECT_EQ(invNode().state(), InvariantNodeState::SUBSUMED);
+    if (isNonSquare()) {
+      // The replacing element node is over the selected row or column:
+      const auto& definingNodes =
+          _invariantGraph->varNodeConst(outputVarNodeId).definingNodes();
+      ASSERT_EQ(definingNodes.size(), 1);
+      const auto& elementNode =
+          _invariantGraph->invariantNode(*definingNodes.begin());
+      std::vector<VarNodeId> expected;
+      if (idx1ShouldBeReplaced()) {
+        expected = varMatrixVarNodeIds.back();
+      } else {
+        for (const auto& row : varMatrixVarNodeIds) {
+          expected.emplace_back(row.back());
+        }
+      }
+      EXPECT_EQ(elementNode.dynamicInputVarNodeIds(), expected);
+    }
   } else {
     EXPECT_FALSE(invNode().canBeReplaced());
   }
@@ -177,6 +217,8 @@ INSTANTIATE_TEST_CASE_P(
     ::testing::Values(ParamData{0}, ParamData{InvariantNodeAction::REPLACE, 0},
                       ParamData{InvariantNodeAction::REPLACE, 1}, ParamData{2},
                       ParamData{InvariantNodeAction::REPLACE, 2},
-                      ParamData{InvariantNodeAction::REPLACE, 3}));
+                      ParamData{InvariantNodeAction::REPLACE, 3}, ParamData{4},
+                      ParamData{InvariantNodeAction::REPLACE, 4},
+                      ParamData{InvariantNodeAction::REPLACE, 5}));
 
 }  // namespace atlantis::testing
@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 
 #include <string>
+#include <vector>
 
 #include "atlantis/invariantgraph/fznInvariantGraph.hpp"
 #include "atlantis/invariantgraph/invariantGraphRoot.hpp"
@@ -176,6 +177,38 @@ TEST(InvariantGraphTest, SplitGraph) {
   EXPECT_EQ(solver.numInvariants(), numInvariants + 1);
 }
 
+TEST(InvariantGraphTest, ReplaceNamedVarNodes) {
+  propagation::Solver solver;
+  InvariantGraph invariantGraph(solver);
+  // (std::string, as a string literal would resolve to varNodeId(bool))
+  const std::vector<std::string> names{"a", "b", "c", "d"};
+  const VarNodeId a =
+      invariantGraph.retrieveIntVarNode(SearchDomain(0, 10), names[0]);
+  const VarNodeId b =
+      invariantGraph.retrieveIntVarNode(SearchDomain(0, 10), names[1]);
+  const VarNodeId c =
+      invariantGraph.retrieveIntVarNode(SearchDomain(0, 10), names[2]);
+  const VarNodeId d =
+      invariantGraph.retrieveIntVarNode(SearchDomain(0, 10), names[3]);
+
+  invariantGraph.replaceVarNode(a, b);
+  EXPECT_EQ(invariantGraph.varNodeId(names[0]), b);
+  EXPECT_EQ(invariantGraph.varNodeId(names[1]), b);
+
+  invariantGraph.replaceVarNode(b, c);
+  EXPECT_EQ(invariantGraph.varNodeId(names[0]), c);
+  EXPECT_EQ(invariantGraph.varNodeId(names[1]), c);
+  EXPECT_EQ(invariantGraph.varNodeConst(names[0]).varNodeId(), c);
+
+  // Replacing a node by a node that it replaced:
+  invariantGraph.replaceVarNode(c, a);
+  for (size_t i = 0; i < 3; ++i) {
+    EXPECT_EQ(invariantGraph.varNodeId(names[i]), a);
+  }
+  EXPECT_EQ(invariantGraph.varNodeId(names[3]), d);
+  EXPECT_EQ(invariantGraph.retrieveIntVarNode(names[1]), a);
+}
+
 TEST(InvariantGraphTest, BreakSimpleCycle) {
   propagation::Solver solver;
   InvariantGraph invariantGraph(solver);
@@ -222,6 +255,102 @@ TEST(InvariantGraphTest, BreakSimpleCycle) {
   EXPECT_EQ(solver.numInvariants(), 2 + 1);
 }
 
+static bool hasStaticCycle(InvariantGraph& invariantGraph) {
+  // Kahn's algorithm over the variable nodes:
+  const size_t numVarNodes = invariantGraph.nextVarNodeId();
+  std::vector<size_t> inDegree(numVarNodes, 0);
+  for (VarNodeId vId = 0; vId < numVarNodes; ++vId) {
+    for (const InvariantNodeId& invNodeId :
+         invariantGraph.varNode(vId).staticInputTo()) {
+      for (const VarNodeId outputId :
+           invariantGraph.invariantNode(invNodeId).outputVarNodeIds()) {
+        ++inDegree[outputId];
+      }
+    }
+  }
+  std::vector<VarNodeId> sources;
+  for (VarNodeId vId = 0; vId < numVarNodes; ++vId) {
+    if (inDegree[vId] == 0) {
+      sources.emplace_back(vId);
+    }
+  }
+  size_t numSorted = 0;
+  while (!sources.empty()) {
+    const VarNodeId vId = sources.back();
+    sources.pop_back();
+    ++numSorted;
+    for (const InvariantNodeId& invNodeId :
+         invariantGraph.varNode(vId).staticInputTo()) {
+      for (const VarNodeId outputId :
+           invariantGraph.invariantNode(invNodeId).outputVarNodeIds()) {
+        if (--inDegree[outputId] == 0) {
+          sources.emplace_back(outputId);
+        }
+      }
+    }
+  }
+  return numSorted < numVarNodes;
+}
+
+TEST(InvariantGraphTest, BreakManyCycles) {
+  propagation::Solver solver;
+  InvariantGraph invariantGraph(solver);
+  // numCycles disjoint copies of the graph in BreakSimpleCycle:
+  const size_t numCycles = 50;
+  for (size_t i = 0; i < numCycles; ++i) {
+    const VarNodeId x1 =
+        invariantGraph.retrieveIntVarNode(SearchDomain(0, 10));
+    const VarNodeId x2 =
+        invariantGraph.retrieveIntVarNode(SearchDomain(0, 10));
+    const VarNodeId output1 = invariantGraph.retrieveIntVarNode(
+        SearchDomain(0, 40), VarNode::DomainType::NONE);
+    const VarNodeId output2 = invariantGraph.retrieveIntVarNode(
+        SearchDomain(0, 40), VarNode::DomainType::NONE);
+
+    invariantGraph.addInvariantNode(
+        std::make_shared<IntPlusNode>(invariantGraph, x1, output2, output1));
+
+    invariantGraph.addInvariantNode(
+        std::make_shared<IntPlusNode>(invariantGraph, output1, x2, output2));
+  }
+
+  invariantGraph.construct();
+  EXPECT_FALSE(hasStaticCycle(invariantGraph));
+  invariantGraph.close();
+
+  // 2 Linear per cycle
+  // 1 from breaking each cycle
+  // 1 Total violation
+  EXPECT_EQ(solver.numInvariants(), 3 * numCycles + 1);
+}
+
+TEST(InvariantGraphTest, BreakNestedCycles) {
+  propagation::Solver solver;
+  InvariantGraph invariantGraph(solver);
+  // A single strongly connected component with many (overlapping) cycles:
+  // vars[i] = vars[i - 1] + vars[i - 2] (where the indices wrap around)
+  const size_t numVars = 20;
+  std::vector<VarNodeId> vars;
+  for (size_t i = 0; i < numVars; ++i) {
+    vars.emplace_back(invariantGraph.retrieveIntVarNode(
+        SearchDomain(0, 10), VarNode::DomainType::NONE));
+  }
+  for (size_t i = 0; i < numVars; ++i) {
+    invariantGraph.addInvariantNode(std::make_shared<IntPlusNode>(
+        invariantGraph, vars[(i + numVars - 1) % numVars],
+        vars[(i + numVars - 2) % numVars], vars[i]));
+  }
+
+  EXPECT_TRUE(hasStaticCycle(invariantGraph));
+  invariantGraph.construct();
+  EXPECT_FALSE(hasStaticCycle(invariantGraph));
+  invariantGraph.close();
+
+  // numVars Linear
+  // At least 1 from breaking cycles
+  EXPECT_GT(solver.numInvariants(), numVars);
+}
+
 TEST(InvariantGraphTest, BreakElementIndexCycle) {
   propagation::Solver solver;
   InvariantGraph invariantGraph(solver);
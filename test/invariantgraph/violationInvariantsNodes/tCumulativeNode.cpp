@@ -0,0 +1,166 @@
+#include <gmock/gmock.h>
+
+#include "../nodeTestBase.hpp"
+#include "atlantis/invariantgraph/violationInvariantNodes/cumulativeNode.hpp"
+
+namespace atlantis::testing {
+
+using namespace atlantis::invariantgraph;
+
+using ::testing::ContainerEq;
+
+class CumulativeNodeTestFixture : public NodeTestBase<CumulativeNode> {
+ public:
+  std::vector<VarNodeId> startVarNodeIds;
+  std::vector<VarNodeId> durationVarNodeIds;
+  std::vector<VarNodeId> requirementVarNodeIds;
+  VarNodeId capacityVarNodeId{NULL_NODE_ID};
+  VarNodeId reifiedVarNodeId{NULL_NODE_ID};
+  std::string reifiedIdentifier{"reified"};
+
+  Int value(VarNodeId varNodeId, bool isRegistered) {
+    return !isRegistered || varNode(varNodeId).isFixed()
+               ? varNode(varNodeId).lowerBound()
+               : _solver->currentValue(varId(varNodeId));
+  }
+
+  bool isViolating(bool isRegistered = false) {
+    const Int capacity = value(capacityVarNodeId, isRegistered);
+    for (const VarNodeId& startVarNodeId : startVarNodeIds) {
+      const Int t = value(startVarNodeId, isRegistered);
+      Int load = 0;
+      for (size_t i = 0; i < startVarNodeIds.size(); ++i) {
+        const Int start = value(startVarNodeIds.at(i), isRegistered);
+        if (start <= t &&
+            t < start + value(durationVarNodeIds.at(i), isRegistered)) {
+          load += value(requirementVarNodeIds.at(i), isRegistered);
+        }
+      }
+      if (load > capacity) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  void SetUp() override {
+    NodeTestBase::SetUp();
+    startVarNodeIds = {retrieveIntVarNode(0, 2, "s1"),
+                       retrieveIntVarNode(0, 2, "s2")};
+    durationVarNodeIds = {retrieveIntVarNode(1, 2, "d1"),
+                          retrieveIntVarNode(1, 2, "d2")};
+    requirementVarNodeIds = {retrieveIntVarNode(1, 2, "r1"),
+                             retrieveIntVarNode(1, 2, "r2")};
+    capacityVarNodeId = retrieveIntVarNode(1, 2, "b");
+
+    if (isReified()) {
+      reifiedVarNodeId = retrieveBoolVarNode(reifiedIdentifier);
+      createInvariantNode(*_invariantGraph,
+                          std::vector<VarNodeId>{startVarNodeIds},
+                          std::vector<VarNodeId>{durationVarNodeIds},
+                          std::vector<VarNodeId>{requirementVarNodeIds},
+                          capacityVarNodeId, reifiedVarNodeId);
+    } else {
+      createInvariantNode(*_invariantGraph,
+                          std::vector<VarNodeId>{startVarNodeIds},
+                          std::vector<VarNodeId>{durationVarNodeIds},
+                          std::vector<VarNodeId>{requirementVarNodeIds},
+                          capacityVarNodeId, shouldHold());
+    }
+  }
+};
+
+TEST_P(CumulativeNodeTestFixture, construction) {
+  expectInputTo(invNode());
+  expectOutputOf(invNode());
+
+  std::vector<VarNodeId> inputVarNodeIds;
+  inputVarNodeIds.insert(inputVarNodeIds.end(), startVarNodeIds.begin(),
+                         startVarNodeIds.end());
+  inputVarNodeIds.insert(inputVarNodeIds.end(), durationVarNodeIds.begin(),
+                         durationVarNodeIds.end());
+  inputVarNodeIds.insert(inputVarNodeIds.end(), requirementVarNodeIds.begin(),
+                         requirementVarNodeIds.end());
+  inputVarNodeIds.emplace_back(capacityVarNodeId);
+  EXPECT_THAT(inputVarNodeIds, ContainerEq(invNode().staticInputVarNodeIds()));
+
+  if (isReified()) {
+    EXPECT_EQ(invNode().outputVarNodeIds().size(), 1);
+    EXPECT_EQ(invNode().outputVarNodeIds().front(), reifiedVarNodeId);
+    EXPECT_TRUE(invNode().isReified());
+    EXPECT_EQ(invNode().reifiedViolationNodeId(), reifiedVarNodeId);
+  } else {
+    EXPECT_EQ(invNode().outputVarNodeIds().size(), 0);
+    EXPECT_FALSE(invNode().isReified());
+    EXPECT_EQ(invNode().reifiedViolationNodeId(), NULL_NODE_ID);
+  }
+}
+
+TEST_P(CumulativeNodeTestFixture, application) {
+  _solver->open();
+  addInputVarsToSolver();
+
+  EXPECT_EQ(invNode().violationVarId(), propagation::NULL_ID);
+  invNode().registerOutputVars();
+  for (const auto& outputVarNodeId : invNode().outputVarNodeIds()) {
+    EXPECT_NE(varId(outputVarNodeId), propagation::NULL_ID);
+  }
+  EXPECT_NE(invNode().violationVarId(), propagation::NULL_ID);
+
+  invNode().registerNode();
+  _solver->close();
+
+  EXPECT_EQ(_solver->searchVars().size(), 7);
+  EXPECT_EQ(_solver->numInvariants(), 1);
+  EXPECT_EQ(_solver->lowerBound(invNode().violationVarId()), 0);
+  EXPECT_GT(_solver->upperBound(invNode().violationVarId()), 0);
+}
+
+TEST_P(CumulativeNodeTestFixture, propagation) {
+  propagation::Solver solver;
+  _invariantGraph->construct();
+  _invariantGraph->close();
+
+  std::vector<propagation::VarViewId> inputVarIds;
+  for (const auto& inputVarNodeId : invNode().staticInputVarNodeIds()) {
+    EXPECT_NE(varId(inputVarNodeId), propagation::NULL_ID);
+    inputVarIds.emplace_back(varId(inputVarNodeId));
+  }
+
+  const propagation::VarViewId violVarId =
+      isReified() ? varId(reifiedIdentifier)
+                  : _invariantGraph->totalViolationVarId();
+
+  EXPECT_NE(violVarId, propagation::NULL_ID);
+
+  std::vector<Int> inputVals = makeInputVals(inputVarIds);
+
+  while (increaseNextVal(inputVarIds, inputVals) >= 0) {
+    _solver->beginMove();
+    setVarVals(inputVarIds, inputVals);
+    _solver->endMove();
+
+    _solver->beginProbe();
+    _solver->query(violVarId);
+    _solver->endProbe();
+
+    expectVarVals(inputVarIds, inputVals);
+
+    const bool actual = _solver->currentValue(violVarId) > 0;
+    const bool expected = isViolating(true);
+
+    if (!shouldFail()) {
+      EXPECT_EQ(actual, expected);
+    } else {
+      EXPECT_NE(actual, expected);
+    }
+  }
+}
+
+INSTANTIATE_TEST_CASE_P(
+    CumulativeNodeTest, CumulativeNodeTestFixture,
+    ::testing::Values(ParamData{ViolationInvariantType::CONSTANT_TRUE},
+                      ParamData{ViolationInvariantType::CONSTANT_FALSE},
+                      ParamData{ViolationInvariantType::REIFIED}));
+
+}  // namespace atlantis::testing
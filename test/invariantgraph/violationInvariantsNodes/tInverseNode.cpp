@@ -0,0 +1,211 @@
+#include <gmock/gmock.h>
+
+#include "../nodeTestBase.hpp"
+#include "atlantis/invariantgraph/violationInvariantNodes/inverseNode.hpp"
+
+namespace atlantis::testing {
+
+using namespace atlantis::invariantgraph;
+
+using ::testing::ContainerEq;
+
+class InverseNodeTestFixture : public NodeTestBase<InverseNode> {
+ public:
+  size_t numInputs = 3;
+  Int fOffset = 1;
+  Int invfOffset = 0;
+  std::vector<VarNodeId> fVarNodeIds;
+  std::vector<VarNodeId> invfVarNodeIds;
+  VarNodeId reifiedVarNodeId{NULL_NODE_ID};
+  std::string reifiedIdentifier{"reified"};
+
+  Int value(VarNodeId varNodeId) {
+    return varNode(varNodeId).isFixed()
+               ? varNode(varNodeId).lowerBound()
+               : _solver->currentValue(varId(varNodeId));
+  }
+
+  bool isViolating() {
+    for (size_t i = 0; i < numInputs; ++i) {
+      const Int j = value(fVarNodeIds.at(i)) - invfOffset;
+      if (j < 0 || static_cast<Int>(numInputs) <= j ||
+          value(invfVarNodeIds.at(static_cast<size_t>(j))) - fOffset !=
+              static_cast<Int>(i)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  void SetUp() override {
+    NodeTestBase::SetUp();
+    const Int n = static_cast<Int>(numInputs);
+    for (size_t i = 0; i < numInputs; ++i) {
+      fVarNodeIds.emplace_back(retrieveIntVarNode(
+          invfOffset, invfOffset + n - 1, "f_" + std::to_string(i)));
+    }
+    for (size_t j = 0; j < numInputs; ++j) {
+      invfVarNodeIds.emplace_back(retrieveIntVarNode(
+          fOffset, fOffset + n - 1, "invf_" + std::to_string(j)));
+    }
+    if (!shouldBeMadeImplicit()) {
+      for (const auto& varNodeId : concat(fVarNodeIds, invfVarNodeIds)) {
+        _invariantGraph->root().addSearchVarNode(varNodeId);
+      }
+    }
+
+    if (isReified()) {
+      reifiedVarNodeId = retrieveBoolVarNode(reifiedIdentifier);
+      createInvariantNode(*_invariantGraph, std::vector<VarNodeId>{fVarNodeIds},
+                          fOffset, std::vector<VarNodeId>{invfVarNodeIds},
+                          invfOffset, reifiedVarNodeId);
+    } else {
+      createInvariantNode(*_invariantGraph, std::vector<VarNodeId>{fVarNodeIds},
+                          fOffset, std::vector<VarNodeId>{invfVarNodeIds},
+                          invfOffset, shouldHold());
+    }
+  }
+
+  static std::vector<VarNodeId> concat(const std::vector<VarNodeId>& a,
+                                       const std::vector<VarNodeId>& b) {
+    std::vector<VarNodeId> result(a);
+    result.insert(result.end(), b.begin(), b.end());
+    return result;
+  }
+};
+
+TEST_P(InverseNodeTestFixture, construction) {
+  expectInputTo(invNode());
+  expectOutputOf(invNode());
+
+  EXPECT_THAT(concat(fVarNodeIds, invfVarNodeIds),
+              ContainerEq(invNode().staticInputVarNodeIds()));
+
+  if (isReified()) {
+    EXPECT_EQ(invNode().outputVarNodeIds().size(), 1);
+    EXPECT_EQ(invNode().outputVarNodeIds().front(), reifiedVarNodeId);
+    EXPECT_TRUE(invNode().isReified());
+    EXPECT_EQ(invNode().reifiedViolationNodeId(), reifiedVarNodeId);
+  } else {
+    EXPECT_EQ(invNode().outputVarNodeIds().size(), 0);
+    EXPECT_FALSE(invNode().isReified());
+    EXPECT_EQ(invNode().reifiedViolationNodeId(), NULL_NODE_ID);
+  }
+}
+
+TEST_P(InverseNodeTestFixture, application) {
+  _solver->open();
+  addInputVarsToSolver();
+
+  EXPECT_EQ(invNode().violationVarId(), propagation::NULL_ID);
+  invNode().registerOutputVars();
+  for (const auto& outputVarNodeId : invNode().outputVarNodeIds()) {
+    EXPECT_NE(varId(outputVarNodeId), propagation::NULL_ID);
+  }
+  EXPECT_NE(invNode().violationVarId(), propagation::NULL_ID);
+
+  invNode().registerNode();
+  _solver->close();
+
+  EXPECT_EQ(_solver->searchVars().size(), 2 * numInputs);
+  EXPECT_EQ(_solver->numInvariants(), 1);
+  EXPECT_EQ(_solver->lowerBound(invNode().violationVarId()), 0);
+  EXPECT_GT(_solver->upperBound(invNode().violationVarId()), 0);
+}
+
+TEST_P(InverseNodeTestFixture, makeImplicit) {
+  EXPECT_EQ(invNode().state(), InvariantNodeState::ACTIVE);
+  invNode().updateState();
+  EXPECT_EQ(invNode().state(), InvariantNodeState::ACTIVE);
+  EXPECT_EQ(invNode().canBeMadeImplicit(), shouldBeMadeImplicit());
+  if (shouldBeMadeImplicit()) {
+    EXPECT_TRUE(invNode().makeImplicit());
+    invNode().deactivate();
+    EXPECT_EQ(invNode().state(), InvariantNodeState::SUBSUMED);
+  }
+}
+
+TEST_P(InverseNodeTestFixture, fixedInputs) {
+  if (!shouldHold()) {
+    return;
+  }
+  // f[2] = 2 implies invf[2] = 2, and invf[0] = 3 implies f[3] = 0:
+  varNode(fVarNodeIds.at(1)).fixToValue(Int{2});
+  varNode(invfVarNodeIds.at(0)).fixToValue(Int{3});
+  invNode().updateState();
+  EXPECT_EQ(invNode().state(), InvariantNodeState::ACTIVE);
+  EXPECT_TRUE(varNode(invfVarNodeIds.at(2)).isFixed());
+  EXPECT_EQ(varNode(invfVarNodeIds.at(2)).lowerBound(), 2);
+  EXPECT_TRUE(varNode(fVarNodeIds.at(2)).isFixed());
+  EXPECT_EQ(varNode(fVarNodeIds.at(2)).lowerBound(), 0);
+
+  // Fixing the remaining pair subsumes the constraint:
+  varNode(fVarNodeIds.at(0)).fixToValue(Int{1});
+  invNode().updateState();
+  EXPECT_TRUE(varNode(invfVarNodeIds.at(1)).isFixed());
+  EXPECT_EQ(varNode(invfVarNodeIds.at(1)).lowerBound(), 1);
+  EXPECT_EQ(invNode().state(), InvariantNodeState::SUBSUMED);
+}
+
+TEST_P(InverseNodeTestFixture, inconsistentInputs) {
+  if (!shouldHold()) {
+    return;
+  }
+  // f[1] = 0 and f[2] = 0 cannot both hold:
+  varNode(fVarNodeIds.at(0)).fixToValue(Int{0});
+  varNode(fVarNodeIds.at(1)).fixToValue(Int{0});
+  EXPECT_THROW(invNode().updateState(), InconsistencyException);
+}
+
+TEST_P(InverseNodeTestFixture, propagation) {
+  if (shouldBeMadeImplicit()) {
+    return;
+  }
+  propagation::Solver solver;
+  _invariantGraph->construct();
+  _invariantGraph->close();
+
+  std::vector<propagation::VarViewId> inputVarIds;
+  for (const auto& inputVarNodeId : concat(fVarNodeIds, invfVarNodeIds)) {
+    EXPECT_NE(varId(inputVarNodeId), propagation::NULL_ID);
+    inputVarIds.emplace_back(varId(inputVarNodeId));
+  }
+
+  const propagation::VarViewId violVarId =
+      isReified() ? varId(reifiedIdentifier)
+                  : _invariantGraph->totalViolationVarId();
+
+  EXPECT_NE(violVarId, propagation::NULL_ID);
+
+  std::vector<Int> inputVals = makeInputVals(inputVarIds);
+
+  while (increaseNextVal(inputVarIds, inputVals) >= 0) {
+    _solver->beginMove();
+    setVarVals(inputVarIds, inputVals);
+    _solver->endMove();
+
+    _solver->beginProbe();
+    _solver->query(violVarId);
+    _solver->endProbe();
+
+    expectVarVals(inputVarIds, inputVals);
+
+    const bool actual = _solver->currentValue(violVarId) > 0;
+    const bool expected = isViolating();
+
+    if (!shouldFail()) {
+      EXPECT_EQ(actual, expected);
+    } else {
+      EXPECT_NE(actual, expected);
+    }
+  }
+}
+
+INSTANTIATE_TEST_CASE_P(
+    InverseNodeTest, InverseNodeTestFixture,
+    ::testing::Values(ParamData{ViolationInvariantType::CONSTANT_TRUE},
+                      ParamData{ViolationInvariantType::CONSTANT_FALSE},
+                      ParamData{ViolationInvariantType::REIFIED},
+                      ParamData{InvariantNodeAction::MAKE_IMPLICIT}));
+
+}  // namespace atlantis::testing
@@ -0,0 +1,166 @@
+#include <gmock/gmock.h>
+
+#include "../nodeTestBase.hpp"
+#include "atlantis/invariantgraph/violationInvariantNodes/regularNode.hpp"
+
+namespace atlantis::testing {
+
+using namespace atlantis::invariantgraph;
+
+using ::testing::ContainerEq;
+
+class RegularNodeTestFixture : public NodeTestBase<RegularNode> {
+ public:
+  std::vector<VarNodeId> inputVarNodeIds;
+  // Sequences over {1, 2} without two consecutive 2s, where state 1 (2) is
+  // reached after reading 1 (2):
+  const Int numStates{2};
+  const Int numSymbols{2};
+  const std::vector<Int> transitions{1, 2,  //
+                                     1, 0};
+  const Int initialState{1};
+  const std::vector<Int> acceptingStates{1, 2};
+  VarNodeId reifiedVarNodeId{NULL_NODE_ID};
+  std::string reifiedIdentifier{"reified"};
+
+  bool isViolating() {
+    Int state = initialState;
+    for (const VarNodeId& inputVarNodeId : inputVarNodeIds) {
+      const Int val = varNode(inputVarNodeId).isFixed()
+                          ? varNode(inputVarNodeId).lowerBound()
+                          : _solver->currentValue(varId(inputVarNodeId));
+      if (state == 0 || val < 1 || numSymbols < val) {
+        return true;
+      }
+      state = transitions.at(
+          static_cast<size_t>((state - 1) * numSymbols + val - 1));
+    }
+    return std::find(acceptingStates.begin(), acceptingStates.end(), state) ==
+           acceptingStates.end();
+  }
+
+  void SetUp() override {
+    NodeTestBase::SetUp();
+    // The value 3 is not a symbol of the automaton:
+    inputVarNodeIds = {
+        retrieveIntVarNode(1, 3, "x1"), retrieveIntVarNode(1, 3, "x2"),
+        retrieveIntVarNode(1, 3, "x3"), retrieveIntVarNode(1, 3, "x4")};
+
+    if (isReified()) {
+      reifiedVarNodeId = retrieveBoolVarNode(reifiedIdentifier);
+      createInvariantNode(
+          *_invariantGraph, std::vector<VarNodeId>{inputVarNodeIds}, numStates,
+          numSymbols, std::vector<Int>{transitions}, initialState,
+          std::vector<Int>{acceptingStates}, reifiedVarNodeId);
+    } else {
+      createInvariantNode(
+          *_invariantGraph, std::vector<VarNodeId>{inputVarNodeIds}, numStates,
+          numSymbols, std::vector<Int>{transitions}, initialState,
+          std::vector<Int>{acceptingStates}, shouldHold());
+    }
+  }
+};
+
+TEST_P(RegularNodeTestFixture, construction) {
+  expectInputTo(invNode());
+  expectOutputOf(invNode());
+
+  EXPECT_THAT(inputVarNodeIds, ContainerEq(invNode().staticInputVarNodeIds()));
+
+  if (isReified()) {
+    EXPECT_EQ(invNode().outputVarNodeIds().size(), 1);
+    EXPECT_EQ(invNode().outputVarNodeIds().front(), reifiedVarNodeId);
+    EXPECT_TRUE(invNode().isReified());
+    EXPECT_EQ(invNode().reifiedViolationNodeId(), reifiedVarNodeId);
+  } else {
+    EXPECT_EQ(invNode().outputVarNodeIds().size(), 0);
+    EXPECT_FALSE(invNode().isReified());
+    EXPECT_EQ(invNode().reifiedViolationNodeId(), NULL_NODE_ID);
+  }
+}
+
+TEST_P(RegularNodeTestFixture, application) {
+  _solver->open();
+  addInputVarsToSolver();
+
+  EXPECT_EQ(invNode().violationVarId(), propagation::NULL_ID);
+  invNode().registerOutputVars();
+  for (const auto& outputVarNodeId : invNode().outputVarNodeIds()) {
+    EXPECT_NE(varId(outputVarNodeId), propagation::NULL_ID);
+  }
+  EXPECT_NE(invNode().violationVarId(), propagation::NULL_ID);
+
+  invNode().registerNode();
+  _solver->close();
+
+  EXPECT_EQ(_solver->searchVars().size(), inputVarNodeIds.size());
+  EXPECT_EQ(_solver->numInvariants(), 1);
+  EXPECT_EQ(_solver->lowerBound(invNode().violationVarId()), 0);
+  EXPECT_GT(_solver->upperBound(invNode().violationVarId()), 0);
+}
+
+TEST_P(RegularNodeTestFixture, propagation) {
+  propagation::Solver solver;
+  _invariantGraph->construct();
+  _invariantGraph->close();
+
+  std::vector<propagation::VarViewId> inputVarIds;
+  for (const auto& inputVarNodeId : inputVarNodeIds) {
+    EXPECT_NE(varId(inputVarNodeId), propagation::NULL_ID);
+    inputVarIds.emplace_back(varId(inputVarNodeId));
+  }
+
+  const propagation::VarViewId violVarId =
+      isReified() ? varId(reifiedIdentifier)
+                  : _invariantGraph->totalViolationVarId();
+
+  EXPECT_NE(violVarId, propagation::NULL_ID);
+
+  std::vector<Int> inputVals = makeInputVals(inputVarIds);
+
+  while (increaseNextVal(inputVarIds, inputVals) >= 0) {
+    _solver->beginMove();
+    setVarVals(inputVarIds, inputVals);
+    _solver->endMove();
+
+    _solver->beginProbe();
+    _solver->query(violVarId);
+    _solver->endProbe();
+
+    expectVarVals(inputVarIds, inputVals);
+
+    const bool actual = _solver->currentValue(violVarId) > 0;
+    const bool expected = isViolating();
+
+    if (!shouldFail()) {
+      EXPECT_EQ(actual, expected);
+    } else {
+      EXPECT_NE(actual, expected);
+    }
+  }
+}
+
+TEST_P(RegularNodeTestFixture, fixedInputs) {
+  // 1, 2, 1, 2 is accepted:
+  for (size_t i = 0; i < inputVarNodeIds.size(); ++i) {
+    varNode(inputVarNodeIds.at(i)).fixToValue(Int{i % 2 == 0 ? 1 : 2});
+  }
+  if (shouldFail()) {
+    EXPECT_THROW(invNode().updateState(), InconsistencyException);
+    return;
+  }
+  invNode().updateState();
+  EXPECT_EQ(invNode().state(), InvariantNodeState::SUBSUMED);
+  if (isReified()) {
+    EXPECT_TRUE(varNode(reifiedVarNodeId).isFixed());
+    EXPECT_TRUE(varNode(reifiedVarNodeId).inDomain(bool{true}));
+  }
+}
+
+INSTANTIATE_TEST_CASE_P(
+    RegularNodeTest, RegularNodeTestFixture,
+    ::testing::Values(ParamData{ViolationInvariantType::CONSTANT_TRUE},
+                      ParamData{ViolationInvariantType::CONSTANT_FALSE},
+                      ParamData{ViolationInvariantType::REIFIED}));
+
+}  // namespace atlantis::testing
@@ -0,0 +1,160 @@
+#include <gmock/gmock.h>
+
+#include "../nodeTestBase.hpp"
+#include "atlantis/invariantgraph/violationInvariantNodes/tableNode.hpp"
+
+namespace atlantis::testing {
+
+using namespace atlantis::invariantgraph;
+
+using ::testing::ContainerEq;
+
+class TableNodeTestFixture : public NodeTestBase<TableNode> {
+ public:
+  std::vector<VarNodeId> inputVarNodeIds;
+  // The second and the last tuple are not supported by the domains:
+  const std::vector<Int> table{0, 1, 2,  //
+                               5, 1, 1,  //
+                               2, 2, 0,  //
+                               1, 0, 1,  //
+                               0, 0, -1};
+  VarNodeId reifiedVarNodeId{NULL_NODE_ID};
+  std::string reifiedIdentifier{"reified"};
+
+  bool isViolating() {
+    const size_t arity = inputVarNodeIds.size();
+    for (size_t t = 0; t < table.size() / arity; ++t) {
+      bool isMatch = true;
+      for (size_t i = 0; i < arity; ++i) {
+        const VarNodeId inputVarNodeId = inputVarNodeIds.at(i);
+        const Int val = varNode(inputVarNodeId).isFixed()
+                            ? varNode(inputVarNodeId).lowerBound()
+                            : _solver->currentValue(varId(inputVarNodeId));
+        isMatch = isMatch && val == table.at(t * arity + i);
+      }
+      if (isMatch) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  void SetUp() override {
+    NodeTestBase::SetUp();
+    inputVarNodeIds = {retrieveIntVarNode(0, 2, "x1"),
+                       retrieveIntVarNode(0, 2, "x2"),
+                       retrieveIntVarNode(0, 2, "x3")};
+
+    if (isReified()) {
+      reifiedVarNodeId = retrieveBoolVarNode(reifiedIdentifier);
+      createInvariantNode(*_invariantGraph,
+                          std::vector<VarNodeId>{inputVarNodeIds},
+                          std::vector<Int>{table}, reifiedVarNodeId);
+    } else {
+      createInvariantNode(*_invariantGraph,
+                          std::vector<VarNodeId>{inputVarNodeIds},
+                          std::vector<Int>{table}, shouldHold());
+    }
+  }
+};
+
+TEST_P(TableNodeTestFixture, construction) {
+  expectInputTo(invNode());
+  expectOutputOf(invNode());
+
+  EXPECT_THAT(inputVarNodeIds, ContainerEq(invNode().staticInputVarNodeIds()));
+
+  if (isReified()) {
+    EXPECT_EQ(invNode().outputVarNodeIds().size(), 1);
+    EXPECT_EQ(invNode().outputVarNodeIds().front(), reifiedVarNodeId);
+    EXPECT_TRUE(invNode().isReified());
+    EXPECT_EQ(invNode().reifiedViolationNodeId(), reifiedVarNodeId);
+  } else {
+    EXPECT_EQ(invNode().outputVarNodeIds().size(), 0);
+    EXPECT_FALSE(invNode().isReified());
+    EXPECT_EQ(invNode().reifiedViolationNodeId(), NULL_NODE_ID);
+  }
+}
+
+TEST_P(TableNodeTestFixture, application) {
+  _solver->open();
+  addInputVarsToSolver();
+
+  EXPECT_EQ(invNode().violationVarId(), propagation::NULL_ID);
+  invNode().registerOutputVars();
+  for (const auto& outputVarNodeId : invNode().outputVarNodeIds()) {
+    EXPECT_NE(varId(outputVarNodeId), propagation::NULL_ID);
+  }
+  EXPECT_NE(invNode().violationVarId(), propagation::NULL_ID);
+
+  invNode().registerNode();
+  _solver->close();
+
+  EXPECT_EQ(_solver->searchVars().size(), inputVarNodeIds.size());
+  EXPECT_EQ(_solver->numInvariants(), 1);
+  EXPECT_EQ(_solver->lowerBound(invNode().violationVarId()), 0);
+  EXPECT_GT(_solver->upperBound(invNode().violationVarId()), 0);
+}
+
+TEST_P(TableNodeTestFixture, propagation) {
+  propagation::Solver solver;
+  _invariantGraph->construct();
+  _invariantGraph->close();
+
+  std::vector<propagation::VarViewId> inputVarIds;
+  for (const auto& inputVarNodeId : inputVarNodeIds) {
+    EXPECT_NE(varId(inputVarNodeId), propagation::NULL_ID);
+    inputVarIds.emplace_back(varId(inputVarNodeId));
+  }
+
+  const propagation::VarViewId violVarId =
+      isReified() ? varId(reifiedIdentifier)
+                  : _invariantGraph->totalViolationVarId();
+
+  EXPECT_NE(violVarId, propagation::NULL_ID);
+
+  std::vector<Int> inputVals = makeInputVals(inputVarIds);
+
+  while (increaseNextVal(inputVarIds, inputVals) >= 0) {
+    _solver->beginMove();
+    setVarVals(inputVarIds, inputVals);
+    _solver->endMove();
+
+    _solver->beginProbe();
+    _solver->query(violVarId);
+    _solver->endProbe();
+
+    expectVarVals(inputVarIds, inputVals);
+
+    const bool actual = _solver->currentValue(violVarId) > 0;
+    const bool expected = isViolating();
+
+    if (!shouldFail()) {
+      EXPECT_EQ(actual, expected);
+    } else {
+      EXPECT_NE(actual, expected);
+    }
+  }
+}
+
+TEST_P(TableNodeTestFixture, fixedInputs) {
+  if (!shouldHold()) {
+    return;
+  }
+  // Only the tuple {1, 0, 1} remains when x1 is fixed to 1, and x1 is
+  // removed:
+  varNode(inputVarNodeIds.front()).fixToValue(Int{1});
+  invNode().updateState();
+  EXPECT_EQ(invNode().state(), InvariantNodeState::ACTIVE);
+  EXPECT_THAT(std::vector<VarNodeId>(inputVarNodeIds.begin() + 1,
+                                     inputVarNodeIds.end()),
+              ContainerEq(invNode().staticInputVarNodeIds()));
+}
+
+INSTANTIATE_TEST_CASE_P(
+    TableNodeTest, TableNodeTestFixture,
+    ::testing::Values(ParamData{ViolationInvariantType::CONSTANT_TRUE},
+                      ParamData{ViolationInvariantType::CONSTANT_FALSE},
+                      ParamData{ViolationInvariantType::REIFIED}));
+
+}  // namespace atlantis::testing
@@ -149,6 +149,60 @@ TEST_F(Element2dVarTest, UpdateBounds) {
   }
 }
 
+TEST_F(Element2dVarTest, UpdateBoundsWithEmptyClampedIndex) {
+  for (const auto& [ro, co] : offsets) {
+    rowOffset = ro;
+    colOffset = co;
+
+    _solver->open();
+    auto& invariant = generate();
+    _solver->close();
+
+    // The row index lies outside the rows, so that all rows are considered:
+    _solver->updateBounds(VarId(rowIndexVar), rowIndexUb() + 1,
+                          rowIndexUb() + 3, false);
+    for (Int colIndexVal = colIndexLb(); colIndexVal <= colIndexUb();
+         ++colIndexVal) {
+      _solver->updateBounds(VarId(colIndexVar), colIndexVal, colIndexVal,
+                            false);
+      invariant.updateBounds(false);
+      Int minVal = std::numeric_limits<Int>::max();
+      Int maxVal = std::numeric_limits<Int>::min();
+      for (Int rowIndexVal = rowIndexLb(); rowIndexVal <= rowIndexUb();
+           ++rowIndexVal) {
+        minVal = std::min(
+            minVal, _solver->lowerBound(getInput(rowIndexVal, colIndexVal)));
+        maxVal = std::max(
+            maxVal, _solver->upperBound(getInput(rowIndexVal, colIndexVal)));
+      }
+      EXPECT_EQ(minVal, _solver->lowerBound(outputVar));
+      EXPECT_EQ(maxVal, _solver->upperBound(outputVar));
+    }
+
+    // The column index lies outside the columns, so that all columns are
+    // considered:
+    _solver->updateBounds(VarId(colIndexVar), colIndexLb() - 3,
+                          colIndexLb() - 1, false);
+    for (Int rowIndexVal = rowIndexLb(); rowIndexVal <= rowIndexUb();
+         ++rowIndexVal) {
+      _solver->updateBounds(VarId(rowIndexVar), rowIndexVal, rowIndexVal,
+                            false);
+      invariant.updateBounds(false);
+      Int minVal = std::numeric_limits<Int>::max();
+      Int maxVal = std::numeric_limits<Int>::min();
+      for (Int colIndexVal = colIndexLb(); colIndexVal <= colIndexUb();
+           ++colIndexVal) {
+        minVal = std::min(
+            minVal, _solver->lowerBound(getInput(rowIndexVal, colIndexVal)));
+        maxVal = std::max(
+            maxVal, _solver->upperBound(getInput(rowIndexVal, colIndexVal)));
+      }
+      EXPECT_EQ(minVal, _solver->lowerBound(outputVar));
+      EXPECT_EQ(maxVal, _solver->upperBound(outputVar));
+    }
+  }
+}
+
 TEST_F(Element2dVarTest, Recompute) {
   generateState = GenerateState::LB;
 
@@ -159,6 +159,16 @@ TEST_F(ExistsTest, NextInput) {
 TEST_F(ExistsTest, NotifyCurrentInputChanged) {
   auto& invariant = generate();
 
+  // Inputs that are not notified must keep their committed values:
+  const Timestamp committedTs = _solver->currentTimestamp();
+  for (const VarViewId& input : inputVars) {
+    _solver->setValue(committedTs, input, 1);
+    _solver->commitIf(committedTs, VarId(input));
+  }
+  invariant.recompute(committedTs);
+  invariant.commit(committedTs);
+  _solver->commitIf(committedTs, VarId(outputVar));
+
   for (Int i = 0; i < numInputVars; ++i) {
     const Timestamp ts =
         _solver->currentTimestamp() + static_cast<Timestamp>(i);
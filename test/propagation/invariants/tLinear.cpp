@@ -4,6 +4,8 @@
 
 #include "../invariantTestHelper.hpp"
 #include "atlantis/propagation/invariants/linear.hpp"
+#include "atlantis/propagation/views/intOffsetView.hpp"
+#include "atlantis/propagation/views/scalarView.hpp"
 
 namespace atlantis::testing {
 
@@ -285,6 +287,45 @@ TEST_F(LinearTest, Commit) {
   }
 }
 
+TEST_F(LinearTest, AffineViewInputs) {
+  for (const auto& [propMode, markingMode] : propMarkModes) {
+    _solver = std::make_shared<Solver>();
+    _solver->open();
+    _solver->setPropagationMode(propMode);
+    _solver->setOutputToInputMarkingMode(markingMode);
+    const VarViewId x = _solver->makeIntVar(2, -10, 10);
+    const VarViewId y = _solver->makeIntVar(3, -10, 10);
+    // 2 * (3x + 1) - (x + 4) + y + x = 6x + y - 2:
+    const VarViewId scaled =
+        _solver->makeIntView<ScalarView>(*_solver, x, 3, 1);
+    const VarViewId offset =
+        _solver->makeIntView<IntOffsetView>(*_solver, x, 4);
+    outputVar = _solver->makeIntVar(0, 0, 0);
+    _solver->makeInvariant<Linear>(
+        *_solver, outputVar, std::vector<Int>{2, -1, 1, 1},
+        std::vector<VarViewId>{scaled, offset, y, x});
+    _solver->close();
+
+    EXPECT_EQ(_solver->lowerBound(outputVar), -72);
+    EXPECT_EQ(_solver->upperBound(outputVar), 68);
+    EXPECT_EQ(_solver->currentValue(outputVar), 13);
+
+    for (Int xVal = -10; xVal <= 10; xVal += 5) {
+      for (Int yVal = -10; yVal <= 10; yVal += 5) {
+        _solver->beginMove();
+        _solver->setValue(x, xVal);
+        _solver->setValue(y, yVal);
+        _solver->endMove();
+
+        _solver->beginProbe();
+        _solver->query(outputVar);
+        _solver->endProbe();
+        EXPECT_EQ(_solver->currentValue(outputVar), 6 * xVal + yVal - 2);
+      }
+    }
+  }
+}
+
 RC_GTEST_FIXTURE_PROP(LinearTest, rapidcheck, ()) {
   _solver->open();
   numInputVars = *rc::gen::inRange(1, 100);
@@ -164,6 +164,16 @@ TEST_F(MinTest, NotifyCurrentInputChanged) {
   EXPECT_EQ(_solver->lowerBound(outputVar), inputVarLb);
   EXPECT_GE(inputVarUb - inputVarLb, 2);
 
+  // Inputs that are not notified must keep their committed values:
+  const Timestamp committedTs = _solver->currentTimestamp();
+  for (const VarViewId& input : inputVars) {
+    _solver->setValue(committedTs, input, inputVarUb);
+    _solver->commitIf(committedTs, VarId(input));
+  }
+  invariant.recompute(committedTs);
+  invariant.commit(committedTs);
+  _solver->commitIf(committedTs, VarId(outputVar));
+
   for (Int i = 0; i < numInputVars; ++i) {
     const Timestamp ts =
         _solver->currentTimestamp() + static_cast<Timestamp>(i);
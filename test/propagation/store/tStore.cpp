@@ -0,0 +1,60 @@
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+
+#include "atlantis/propagation/store/store.hpp"
+#include "atlantis/propagation/types.hpp"
+
+namespace atlantis::testing {
+
+using namespace atlantis::propagation;
+
+TEST(StoreTest, CreateIntVar) {
+  Store store;
+  const Timestamp ts = 1;
+  const VarId a = VarId(store.createIntVar(ts, 0, -10, 10));
+  const VarId b = VarId(store.createIntVar(ts, 7, 5, 7));
+  EXPECT_NE(a, b);
+
+  EXPECT_EQ(store.constIntVarValue(a).value(ts), 0);
+  EXPECT_EQ(store.constIntVarValue(a).committedValue(), 0);
+  EXPECT_EQ(store.intVarLowerBound(a), -10);
+  EXPECT_EQ(store.intVarUpperBound(a), 10);
+
+  EXPECT_EQ(store.constIntVarValue(b).value(ts + 1), 7);
+  EXPECT_EQ(store.constIntVarValue(b).committedValue(), 7);
+  EXPECT_FALSE(store.constIntVarValue(b).hasChanged(ts + 1));
+  EXPECT_EQ(store.intVarLowerBound(b), 5);
+  EXPECT_EQ(store.intVarUpperBound(b), 7);
+
+  EXPECT_THROW(store.createIntVar(ts, 0, 5, -5), std::out_of_range);
+  EXPECT_THROW(store.createIntVar(ts, 10, -5, 5), std::out_of_range);
+}
+
+TEST(StoreTest, UpdateIntVarBounds) {
+  Store store;
+  const VarId a = VarId(store.createIntVar(1, 0, 0, 0));
+  const VarId b = VarId(store.createIntVar(1, 0, -1, 1));
+
+  for (Int value = 1; value <= 1000; ++value) {
+    store.updateIntVarBounds(a, -value, value, false);
+    EXPECT_EQ(store.intVarLowerBound(a), -value);
+    EXPECT_EQ(store.intVarUpperBound(a), value);
+  }
+  // The bounds of the other variables are unaffected:
+  EXPECT_EQ(store.intVarLowerBound(b), -1);
+  EXPECT_EQ(store.intVarUpperBound(b), 1);
+
+  store.updateIntVarBounds(a, -5, 5, false);
+  EXPECT_EQ(store.intVarLowerBound(a), -5);
+  EXPECT_EQ(store.intVarUpperBound(a), 5);
+
+  store.updateIntVarBounds(a, 0, 10, true);
+  EXPECT_EQ(store.intVarLowerBound(a), -5);
+  EXPECT_EQ(store.intVarUpperBound(a), 10);
+
+  EXPECT_THROW(store.updateIntVarBounds(a, 10, -10, false),
+               std::out_of_range);
+}
+
+}  // namespace atlantis::testing
@@ -0,0 +1,101 @@
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+#include "atlantis/propagation/utils/committableArray.hpp"
+#include "atlantis/propagation/variables/committableInt.hpp"
+
+namespace atlantis::testing {
+
+using namespace atlantis::propagation;
+
+TEST(CommittableArrayTest, SetAndCommit) {
+  CommittableArray array(5, 0);
+  EXPECT_EQ(array.size(), 5);
+
+  Timestamp ts = 1;
+  EXPECT_EQ(array.setValue(ts, 1, 3), 3);
+  EXPECT_EQ(array.incValue(ts, 1, 2), 5);
+  EXPECT_EQ(array.incValue(ts, 4, -1), -1);
+  EXPECT_EQ(array.value(ts, 1), 5);
+  EXPECT_EQ(array.value(ts, 4), -1);
+  EXPECT_TRUE(array.hasChanged(ts, 1));
+  EXPECT_FALSE(array.hasChanged(ts, 2));
+  EXPECT_EQ(array.committedValue(1), 0);
+
+  // The values of another timestamp are the committed ones:
+  EXPECT_EQ(array.value(ts + 1, 1), 0);
+
+  // Committing another timestamp does nothing:
+  array.commitIf(ts + 1);
+  EXPECT_EQ(array.committedValue(1), 0);
+
+  array.commitIf(ts);
+  EXPECT_EQ(array.committedValue(1), 5);
+  EXPECT_EQ(array.committedValue(4), -1);
+  EXPECT_EQ(array.value(ts, 1), 5);
+  EXPECT_FALSE(array.hasChanged(ts, 1));
+
+  // Writes at a later timestamp are discarded unless committed:
+  ++ts;
+  array.setValue(ts, 1, 7);
+  ++ts;
+  EXPECT_EQ(array.value(ts, 1), 5);
+  array.incValue(ts, 2, 1);
+  array.commitIf(ts);
+  EXPECT_EQ(array.committedValue(1), 5);
+  EXPECT_EQ(array.committedValue(2), 1);
+
+  // Entries can be written again at the timestamp they were committed at:
+  array.incValue(ts, 2, 1);
+  array.commitIf(ts);
+  EXPECT_EQ(array.committedValue(2), 2);
+
+  ++ts;
+  array.fill(ts, 1);
+  for (size_t i = 0; i < array.size(); ++i) {
+    EXPECT_EQ(array.value(ts, i), 1);
+  }
+  array.commitIf(ts);
+  for (size_t i = 0; i < array.size(); ++i) {
+    EXPECT_EQ(array.committedValue(i), 1);
+  }
+}
+
+TEST(CommittableArrayTest, BehavesAsCommittableInts) {
+  std::mt19937 gen(1234);
+  const size_t size = 20;
+  std::uniform_int_distribution<size_t> indexDist(0, size - 1);
+  std::uniform_int_distribution<Int> valueDist(-5, 5);
+
+  CommittableArray array(size, 0);
+  std::vector<CommittableInt> expected(size, CommittableInt(NULL_TIMESTAMP, 0));
+
+  for (Timestamp ts = 1; ts < 1000; ++ts) {
+    const size_t numWrites = indexDist(gen) % 4;
+    for (size_t w = 0; w < numWrites; ++w) {
+      const size_t i = indexDist(gen);
+      const Int value = valueDist(gen);
+      if (w % 2 == 0) {
+        EXPECT_EQ(array.incValue(ts, i, value),
+                  expected[i].incValue(ts, value));
+      } else {
+        EXPECT_EQ(array.setValue(ts, i, value),
+                  expected[i].setValue(ts, value));
+      }
+    }
+    if (ts % 3 == 0) {
+      array.commitIf(ts);
+      for (CommittableInt& committableInt : expected) {
+        committableInt.commitIf(ts);
+      }
+    }
+    for (size_t i = 0; i < size; ++i) {
+      EXPECT_EQ(array.value(ts, i), expected[i].value(ts));
+      EXPECT_EQ(array.committedValue(i), expected[i].committedValue());
+    }
+  }
+}
+
+}  // namespace atlantis::testing
@@ -1,13 +1,17 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <array>
 #include <random>
+#include <utility>
 #include <vector>
 
 #include "atlantis/propagation/invariants/elementVar.hpp"
+#include "atlantis/propagation/invariants/ifThenElse.hpp"
 #include "atlantis/propagation/invariants/linear.hpp"
 #include "atlantis/propagation/invariants/min.hpp"
 #include "atlantis/propagation/solver.hpp"
+#include "atlantis/propagation/utils/invariantProfiler.hpp"
 #include "atlantis/propagation/views/intOffsetView.hpp"
 #include "atlantis/types.hpp"
 
@@ -32,7 +36,7 @@ class MockInvariantSimple : public Invariant {
         inputVar(t_inputVar) {}
 
   void registerVars() override {
-    _solver.registerInvariantInput(_id, inputVar, LocalId(0), false);
+    _solver->registerInvariantInput(_id, inputVar, LocalId(0), false);
     registerDefinedVar(outputVar);
     isRegistered = true;
   }
@@ -65,7 +69,7 @@ class MockInvariantAdvanced : public Invariant {
   void registerVars() override {
     assert(_id != NULL_ID);
     for (size_t i = 0; i < inputs.size(); ++i) {
-      _solver.registerInvariantInput(_id, inputs[i], LocalId(i), false);
+      _solver->registerInvariantInput(_id, inputs[i], LocalId(i), false);
     }
     registerDefinedVar(output);
     isRegistered = true;
@@ -99,28 +103,31 @@ class MockSimplePlus : public Invariant {
 
     ON_CALL(*this, notifyCurrentInputChanged)
         .WillByDefault([this](Timestamp ts) {
-          updateValue(ts, output, _solver.value(ts, x) + _solver.value(ts, y));
+          updateValue(ts, output,
+                      _solver->value(ts, x) + _solver->value(ts, y));
         });
 
     ON_CALL(*this, notifyInputChanged)
         .WillByDefault([this](Timestamp ts, LocalId) {
-          updateValue(ts, output, _solver.value(ts, x) + _solver.value(ts, y));
+          updateValue(ts, output,
+                      _solver->value(ts, x) + _solver->value(ts, y));
         });
   }
 
   void registerVars() override {
     assert(_id != NULL_ID);
 
-    _solver.registerInvariantInput(_id, x, LocalId(0), false);
-    _solver.registerInvariantInput(_id, y, LocalId(1), false);
+    _solver->registerInvariantInput(_id, x, LocalId(0), false);
+    _solver->registerInvariantInput(_id, y, LocalId(1), false);
     registerDefinedVar(output);
     isRegistered = true;
   }
 
   void updateBounds(bool widenOnly) override {
-    _solver.updateBounds(output, _solver.lowerBound(x) + _solver.lowerBound(y),
-                         _solver.upperBound(x) + _solver.upperBound(y),
-                         widenOnly);
+    _solver->updateBounds(output,
+                          _solver->lowerBound(x) + _solver->lowerBound(y),
+                          _solver->upperBound(x) + _solver->upperBound(y),
+                          widenOnly);
     if (position != nullptr) {
       position->emplace_back(_id);
     }
@@ -262,6 +269,265 @@ class SolverTest : public ::testing::Test {
     }
     solver->endProbe();
   }
+
+  void probeBatch(PropagationMode propMode,
+                  OutputToInputMarkingMode markingMode) {
+    solver->open();
+    solver->setPropagationMode(propMode);
+    solver->setOutputToInputMarkingMode(markingMode);
+
+    // output <- min(inputs[0] + inputs[1] + inputs[2],
+    //               inputs[3] + inputs[4] + inputs[5])
+    std::vector<VarViewId> inputs;
+    for (size_t i = 0; i < 6; ++i) {
+      inputs.emplace_back(solver->makeIntVar(0, 0, 10));
+    }
+    const VarViewId left = solver->makeIntVar(0, 0, 30);
+    const VarViewId right = solver->makeIntVar(0, 0, 30);
+    const VarViewId output = solver->makeIntVar(0, 0, 30);
+    solver->makeInvariant<Linear>(
+        *solver, left,
+        std::vector<VarViewId>{inputs[0], inputs[1], inputs[2]});
+    solver->makeInvariant<Linear>(
+        *solver, right,
+        std::vector<VarViewId>{inputs[3], inputs[4], inputs[5]});
+    solver->makeInvariant<Min>(*solver, output,
+                               std::vector<VarViewId>{left, right});
+    solver->close();
+
+    std::uniform_int_distribution<size_t> indexDist(0, inputs.size() - 1);
+    std::uniform_int_distribution<Int> valueDist(0, 10);
+
+    for (size_t iteration = 0; iteration < 10; ++iteration) {
+      std::vector<std::array<std::pair<size_t, Int>, 2>> moves(20);
+      for (auto& move : moves) {
+        for (auto& [index, value] : move) {
+          index = indexDist(gen);
+          value = valueDist(gen);
+        }
+      }
+      const Int committedOutput = solver->committedValue(output);
+
+      std::vector<Int> batchOutputs;
+      solver->beginProbeBatch();
+      solver->query(output);
+      for (const auto& move : moves) {
+        solver->beginMove();
+        for (const auto& [index, value] : move) {
+          solver->setValue(inputs[index], value);
+        }
+        solver->endMove();
+        solver->beginProbe();
+        solver->endProbe();
+        batchOutputs.emplace_back(solver->currentValue(output));
+      }
+      solver->endProbeBatch();
+
+      EXPECT_EQ(solver->committedValue(output), committedOutput);
+
+      for (size_t i = 0; i < moves.size(); ++i) {
+        solver->beginMove();
+        for (const auto& [index, value] : moves[i]) {
+          solver->setValue(inputs[index], value);
+        }
+        solver->endMove();
+        solver->beginProbe();
+        solver->query(output);
+        solver->endProbe();
+        EXPECT_EQ(solver->currentValue(output), batchOutputs[i]);
+      }
+
+      // Moves can be committed after the batch:
+      solver->beginMove();
+      for (const auto& [index, value] : moves[iteration]) {
+        solver->setValue(inputs[index], value);
+      }
+      solver->endMove();
+      solver->beginCommit();
+      solver->query(output);
+      solver->endCommit();
+      EXPECT_EQ(solver->committedValue(output), batchOutputs[iteration]);
+    }
+  }
+
+  void clone(PropagationMode propMode, OutputToInputMarkingMode markingMode) {
+    solver->open();
+    solver->setPropagationMode(propMode);
+    solver->setOutputToInputMarkingMode(markingMode);
+
+    // output <- min(inputs[0] + inputs[1] + inputs[2],
+    //               element(index, [inputs[3], inputs[4] + 1, inputs[5]]))
+    std::vector<VarViewId> inputs;
+    for (size_t i = 0; i < 6; ++i) {
+      inputs.emplace_back(solver->makeIntVar(0, 0, 10));
+    }
+    const VarViewId index = solver->makeIntVar(1, 1, 3);
+    const VarViewId left = solver->makeIntVar(0, 0, 30);
+    const VarViewId right = solver->makeIntVar(0, 0, 11);
+    const VarViewId output = solver->makeIntVar(0, 0, 30);
+    const VarViewId offsetView =
+        solver->makeIntView<IntOffsetView>(*solver, inputs[4], 1);
+    solver->makeInvariant<Linear>(
+        *solver, left,
+        std::vector<VarViewId>{inputs[0], inputs[1], inputs[2]});
+    solver->makeInvariant<ElementVar>(
+        *solver, right, index,
+        std::vector<VarViewId>{inputs[3], offsetView, inputs[5]}, 1);
+    solver->makeInvariant<Min>(*solver, output,
+                               std::vector<VarViewId>{left, right});
+    solver->close();
+
+    std::vector<VarViewId> searchVars(inputs);
+    searchVars.emplace_back(index);
+
+    std::unique_ptr<Solver> copy = solver->clone();
+    EXPECT_FALSE(copy->isOpen());
+    EXPECT_EQ(copy->numVars(), solver->numVars());
+    EXPECT_EQ(copy->numInvariants(), solver->numInvariants());
+    EXPECT_EQ(copy->propagationMode(), solver->propagationMode());
+    EXPECT_EQ(copy->outputToInputMarkingMode(),
+              solver->outputToInputMarkingMode());
+
+    std::uniform_int_distribution<size_t> varDist(0, searchVars.size() - 1);
+
+    for (size_t iteration = 0; iteration < 20; ++iteration) {
+      const size_t i = varDist(gen);
+      std::uniform_int_distribution<Int> valueDist(
+          solver->lowerBound(searchVars[i]), solver->upperBound(searchVars[i]));
+      const Int value = valueDist(gen);
+
+      // Committing a move in the copy does not change the original:
+      const Int committedOutput = solver->committedValue(output);
+      copy->beginMove();
+      copy->setValue(searchVars[i], value);
+      copy->endMove();
+      copy->beginCommit();
+      copy->query(output);
+      copy->endCommit();
+      EXPECT_EQ(solver->committedValue(output), committedOutput);
+
+      solver->beginMove();
+      solver->setValue(searchVars[i], value);
+      solver->endMove();
+      solver->beginProbe();
+      solver->query(output);
+      solver->endProbe();
+      EXPECT_EQ(solver->currentValue(output), copy->committedValue(output));
+
+      solver->beginMove();
+      solver->setValue(searchVars[i], value);
+      solver->endMove();
+      solver->beginCommit();
+      solver->query(output);
+      solver->endCommit();
+      for (const VarViewId var : {left, right, output}) {
+        EXPECT_EQ(solver->committedValue(var), copy->committedValue(var));
+      }
+    }
+  }
+
+  void commitLastProbe(PropagationMode propMode,
+                       OutputToInputMarkingMode markingMode) {
+    solver->open();
+    solver->setPropagationMode(propMode);
+    solver->setOutputToInputMarkingMode(markingMode);
+
+    // output <- min(inputs[0] + inputs[1] + inputs[2],
+    //               element(index, [inputs[3], inputs[4], inputs[5]]))
+    std::vector<VarViewId> inputs;
+    for (size_t i = 0; i < 6; ++i) {
+      inputs.emplace_back(solver->makeIntVar(0, 0, 10));
+    }
+    const VarViewId index = solver->makeIntVar(1, 1, 3);
+    const VarViewId left = solver->makeIntVar(0, 0, 30);
+    const VarViewId right = solver->makeIntVar(0, 0, 10);
+    const VarViewId output = solver->makeIntVar(0, 0, 30);
+    solver->makeInvariant<Linear>(
+        *solver, left,
+        std::vector<VarViewId>{inputs[0], inputs[1], inputs[2]});
+    solver->makeInvariant<ElementVar>(
+        *solver, right, index,
+        std::vector<VarViewId>{inputs[3], inputs[4], inputs[5]}, 1);
+    solver->makeInvariant<Min>(*solver, output,
+                               std::vector<VarViewId>{left, right});
+    solver->close();
+
+    std::vector<VarViewId> searchVars(inputs);
+    searchVars.emplace_back(index);
+
+    // The copy commits every move by propagating it:
+    std::unique_ptr<Solver> copy = solver->clone();
+
+    std::uniform_int_distribution<size_t> varDist(0, searchVars.size() - 1);
+
+    for (size_t iteration = 0; iteration < 50; ++iteration) {
+      std::array<std::pair<size_t, Int>, 2> move;
+      for (auto& [i, value] : move) {
+        i = varDist(gen);
+        std::uniform_int_distribution<Int> valueDist(
+            solver->lowerBound(searchVars[i]),
+            solver->upperBound(searchVars[i]));
+        value = valueDist(gen);
+      }
+
+      copy->beginMove();
+      for (const auto& [i, value] : move) {
+        copy->setValue(searchVars[i], value);
+      }
+      copy->endMove();
+      copy->beginCommit();
+      copy->query(output);
+      copy->endCommit();
+
+      solver->beginMove();
+      for (const auto& [i, value] : move) {
+        solver->setValue(searchVars[i], value);
+      }
+      solver->endMove();
+      solver->beginProbe();
+      solver->query(output);
+      solver->endProbe();
+      const Timestamp probeTimestamp = solver->currentTimestamp();
+
+      // Only input-to-output probes propagate every modified variable:
+      ASSERT_EQ(solver->canCommitLastProbe(probeTimestamp),
+                propMode == PropagationMode::INPUT_TO_OUTPUT);
+      if (iteration % 5 == 0) {
+        // A new move invalidates the probe:
+        solver->beginMove();
+        solver->endMove();
+        EXPECT_FALSE(solver->canCommitLastProbe(probeTimestamp));
+        EXPECT_FALSE(solver->canCommitLastProbe(solver->currentTimestamp()));
+        solver->beginMove();
+        for (const auto& [i, value] : move) {
+          solver->setValue(searchVars[i], value);
+        }
+        solver->endMove();
+        solver->beginCommit();
+        solver->query(output);
+        solver->endCommit();
+      } else if (solver->canCommitLastProbe(probeTimestamp)) {
+        solver->commitLastProbe();
+        EXPECT_FALSE(solver->canCommitLastProbe(probeTimestamp));
+      } else {
+        solver->beginMove();
+        for (const auto& [i, value] : move) {
+          solver->setValue(searchVars[i], value);
+        }
+        solver->endMove();
+        solver->beginCommit();
+        solver->query(output);
+        solver->endCommit();
+      }
+
+      for (const VarViewId var : searchVars) {
+        EXPECT_EQ(solver->committedValue(var), copy->committedValue(var));
+      }
+      for (const VarViewId var : {left, right, output}) {
+        EXPECT_EQ(solver->committedValue(var), copy->committedValue(var));
+      }
+    }
+  }
 };
 
 TEST_F(SolverTest, CreateVarsAndInvariant) {
@@ -898,4 +1164,171 @@ TEST_F(SolverTest, NotificationsOutputToInputInputToOutputExploration) {
               OutputToInputMarkingMode::INPUT_TO_OUTPUT_EXPLORATION);
 }
 
+TEST_F(SolverTest, InputToOutputProbeBatch) {
+  probeBatch(PropagationMode::INPUT_TO_OUTPUT, OutputToInputMarkingMode::NONE);
+}
+
+TEST_F(SolverTest, OutputToInputProbeBatchNone) {
+  probeBatch(PropagationMode::OUTPUT_TO_INPUT, OutputToInputMarkingMode::NONE);
+}
+
+TEST_F(SolverTest, OutputToInputProbeBatchOutputToInputStatic) {
+  probeBatch(PropagationMode::OUTPUT_TO_INPUT,
+             OutputToInputMarkingMode::OUTPUT_TO_INPUT_STATIC);
+}
+
+TEST_F(SolverTest, OutputToInputProbeBatchInputToOutputExploration) {
+  probeBatch(PropagationMode::OUTPUT_TO_INPUT,
+             OutputToInputMarkingMode::INPUT_TO_OUTPUT_EXPLORATION);
+}
+
+TEST_F(SolverTest, InputToOutputClone) {
+  clone(PropagationMode::INPUT_TO_OUTPUT, OutputToInputMarkingMode::NONE);
+}
+
+TEST_F(SolverTest, OutputToInputCloneNone) {
+  clone(PropagationMode::OUTPUT_TO_INPUT, OutputToInputMarkingMode::NONE);
+}
+
+TEST_F(SolverTest, OutputToInputCloneOutputToInputStatic) {
+  clone(PropagationMode::OUTPUT_TO_INPUT,
+        OutputToInputMarkingMode::OUTPUT_TO_INPUT_STATIC);
+}
+
+TEST_F(SolverTest, OutputToInputCloneInputToOutputExploration) {
+  clone(PropagationMode::OUTPUT_TO_INPUT,
+        OutputToInputMarkingMode::INPUT_TO_OUTPUT_EXPLORATION);
+}
+
+TEST_F(SolverTest, InputToOutputCommitLastProbe) {
+  commitLastProbe(PropagationMode::INPUT_TO_OUTPUT,
+                  OutputToInputMarkingMode::NONE);
+}
+
+TEST_F(SolverTest, OutputToInputCommitLastProbeNone) {
+  commitLastProbe(PropagationMode::OUTPUT_TO_INPUT,
+                  OutputToInputMarkingMode::NONE);
+}
+
+TEST_F(SolverTest, OutputToInputCommitLastProbeOutputToInputStatic) {
+  commitLastProbe(PropagationMode::OUTPUT_TO_INPUT,
+                  OutputToInputMarkingMode::OUTPUT_TO_INPUT_STATIC);
+}
+
+TEST_F(SolverTest, OutputToInputCommitLastProbeInputToOutputExploration) {
+  commitLastProbe(PropagationMode::OUTPUT_TO_INPUT,
+                  OutputToInputMarkingMode::INPUT_TO_OUTPUT_EXPLORATION);
+}
+
+TEST_F(SolverTest, NotifyActiveDynamicInputOnly) {
+  solver->open();
+  solver->enableProfiling();
+  const VarViewId index = solver->makeIntVar(0, 0, 3);
+  std::vector<VarViewId> varArray;
+  for (Int i = 0; i < 4; ++i) {
+    varArray.emplace_back(solver->makeIntVar(10 * i, 0, 100));
+  }
+  const VarViewId element = solver->makeIntVar(0, 0, 100);
+  solver->makeInvariant<ElementVar>(*solver, element, index,
+                                    std::vector<VarViewId>(varArray), 0);
+  const VarViewId condition = solver->makeIntVar(0, 0, 1);
+  const VarViewId output = solver->makeIntVar(0, 0, 100);
+  solver->makeInvariant<IfThenElse>(*solver, output, condition, element,
+                                    varArray[3]);
+  solver->close();
+  const InvariantProfiler& profiler = *solver->profiler();
+
+  const auto numNotifications = [&](InvariantId id) {
+    return profiler.counters(id)
+        .calls[static_cast<size_t>(InvariantCall::NOTIFY)];
+  };
+  using Notifications = std::pair<size_t, size_t>;
+  // Makes a move and returns the number of notifications of the element and
+  // of the if-then-else:
+  const auto move = [&](const std::vector<std::pair<VarViewId, Int>>& values,
+                        bool commit) {
+    const size_t elementNotifications = numNotifications(0);
+    const size_t ifThenElseNotifications = numNotifications(1);
+    solver->beginMove();
+    for (const auto& [var, value] : values) {
+      solver->setValue(var, value);
+    }
+    solver->endMove();
+    if (commit) {
+      solver->beginCommit();
+    } else {
+      solver->beginProbe();
+    }
+    solver->query(output);
+    if (commit) {
+      solver->endCommit();
+    } else {
+      solver->endProbe();
+    }
+    return Notifications(numNotifications(0) - elementNotifications,
+                         numNotifications(1) - ifThenElseNotifications);
+  };
+
+  // Changing inactive inputs does not notify the invariants:
+  EXPECT_EQ(move({{varArray[1], 11}, {varArray[2], 21}}, false),
+            Notifications(0, 0));
+  EXPECT_EQ(solver->currentValue(output), 0);
+  // varArray[3] is an inactive input of the element and of the if-then-else:
+  EXPECT_EQ(move({{varArray[3], 31}}, false), Notifications(0, 0));
+  EXPECT_EQ(solver->currentValue(output), 0);
+
+  // Changing the active input notifies the invariants:
+  EXPECT_EQ(move({{varArray[0], 1}, {varArray[1], 11}}, false),
+            Notifications(1, 1));
+  EXPECT_EQ(solver->currentValue(output), 1);
+
+  // Changing the index notifies the element, as does its new active input:
+  EXPECT_EQ(move({{index, 2}, {varArray[2], 22}, {varArray[0], 2}}, true),
+            Notifications(2, 1));
+  EXPECT_EQ(solver->committedValue(output), 22);
+
+  // After the commit, varArray[2] is the only active input of the element:
+  EXPECT_EQ(move({{varArray[0], 3}}, false), Notifications(0, 0));
+  EXPECT_EQ(move({{varArray[2], 23}}, false), Notifications(1, 1));
+  EXPECT_EQ(solver->currentValue(output), 23);
+
+  // Changing the condition makes varArray[3] the active input of the
+  // if-then-else:
+  EXPECT_EQ(move({{condition, 1}, {varArray[3], 33}}, false),
+            Notifications(0, 2));
+  EXPECT_EQ(solver->currentValue(output), 33);
+  EXPECT_EQ(move({{index, 3}, {varArray[3], 35}}, false), Notifications(2, 1));
+  EXPECT_EQ(solver->currentValue(output), 35);
+}
+
+TEST_F(SolverTest, CloneOpenOrBusySolver) {
+  solver->open();
+  const VarViewId input = solver->makeIntVar(0, 0, 10);
+  const VarViewId output = solver->makeIntVar(0, 0, 10);
+  EXPECT_THROW(static_cast<void>(solver->clone()), SolverOpenException);
+  solver->makeInvariant<Linear>(*solver, output,
+                                std::vector<VarViewId>{input});
+  solver->close();
+
+  solver->beginMove();
+  EXPECT_THROW(static_cast<void>(solver->clone()), SolverStateException);
+  solver->endMove();
+
+  EXPECT_NO_THROW(static_cast<void>(solver->clone()));
+}
+
+TEST_F(SolverTest, CloneUncopyableInvariant) {
+  solver->open();
+  const VarViewId input = solver->makeIntVar(0, 0, 10);
+  const VarViewId output = solver->makeIntVar(0, 0, 10);
+  // Mock invariants cannot be copied:
+  auto& invariant =
+      solver->makeInvariant<MockInvariantSimple>(*solver, output, input);
+  EXPECT_CALL(invariant, recompute(::testing::_)).Times(AtLeast(1));
+  EXPECT_CALL(invariant, commit(::testing::_)).Times(AtLeast(1));
+  solver->close();
+
+  EXPECT_THROW(static_cast<void>(solver->clone()), SolverStateException);
+}
+
 }  // namespace atlantis::testing
@@ -0,0 +1,166 @@
+#include <gtest/gtest.h>
+
+#include <nlohmann/json.hpp>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "atlantis/propagation/invariants/linear.hpp"
+#include "atlantis/propagation/invariants/plus.hpp"
+#include "atlantis/propagation/solver.hpp"
+#include "atlantis/propagation/utils/invariantProfiler.hpp"
+
+namespace atlantis::testing {
+
+using namespace atlantis::propagation;
+
+class InvariantProfilerTest : public ::testing::Test {
+ protected:
+  std::unique_ptr<Solver> solver;
+  VarViewId x{NULL_ID};
+  VarViewId y{NULL_ID};
+  VarViewId sum{NULL_ID};
+  VarViewId output{NULL_ID};
+
+  static size_t numCalls(const InvariantProfiler& profiler, InvariantId id,
+                         InvariantCall call) {
+    return profiler.counters(id).calls[static_cast<size_t>(call)];
+  }
+
+  // output <- (x + y) + y
+  void SetUp() override {
+    solver = std::make_unique<Solver>();
+    solver->open();
+    x = solver->makeIntVar(1, 0, 10);
+    y = solver->makeIntVar(2, 0, 10);
+    sum = solver->makeIntVar(0, 0, 20);
+    solver->makeInvariant<Plus>(*solver, sum, x, y);
+    output = solver->makeIntVar(0, 0, 30);
+    solver->makeInvariant<Linear>(*solver, output,
+                                  std::vector<VarViewId>{sum, y});
+  }
+
+  void move(Int xVal, Int yVal, bool commit) {
+    solver->beginMove();
+    solver->setValue(x, xVal);
+    solver->setValue(y, yVal);
+    solver->endMove();
+    if (commit) {
+      solver->beginCommit();
+      solver->query(output);
+      solver->endCommit();
+    } else {
+      solver->beginProbe();
+      solver->query(output);
+      solver->endProbe();
+    }
+  }
+};
+
+TEST_F(InvariantProfilerTest, DisabledByDefault) {
+  solver->close();
+  EXPECT_EQ(solver->profiler(), nullptr);
+}
+
+TEST_F(InvariantProfilerTest, InputToOutput) {
+  solver->enableProfiling();
+  solver->close();
+  const InvariantProfiler& profiler = *solver->profiler();
+  ASSERT_EQ(profiler.numInvariants(), 2);
+
+  // Closing the solver recomputes and commits every invariant once:
+  for (InvariantId id = 0; id < 2; ++id) {
+    EXPECT_EQ(numCalls(profiler, id, InvariantCall::RECOMPUTE), 1);
+    EXPECT_EQ(numCalls(profiler, id, InvariantCall::COMMIT), 1);
+    EXPECT_EQ(numCalls(profiler, id, InvariantCall::NOTIFY), 0);
+  }
+
+  move(3, 4, false);
+  // Plus is notified of x and y, and Linear of sum and y:
+  EXPECT_EQ(numCalls(profiler, 0, InvariantCall::NOTIFY), 2);
+  EXPECT_EQ(numCalls(profiler, 1, InvariantCall::NOTIFY), 2);
+  EXPECT_EQ(numCalls(profiler, 1, InvariantCall::COMMIT), 1);
+
+  move(3, 4, true);
+  EXPECT_EQ(numCalls(profiler, 0, InvariantCall::NOTIFY), 4);
+  EXPECT_EQ(numCalls(profiler, 1, InvariantCall::NOTIFY), 4);
+  EXPECT_EQ(numCalls(profiler, 0, InvariantCall::COMMIT), 2);
+  EXPECT_EQ(numCalls(profiler, 1, InvariantCall::COMMIT), 2);
+  EXPECT_EQ(solver->currentValue(output), 11);
+}
+
+TEST_F(InvariantProfilerTest, OutputToInput) {
+  solver->setPropagationMode(PropagationMode::OUTPUT_TO_INPUT);
+  solver->enableProfiling();
+  solver->close();
+  const InvariantProfiler& profiler = *solver->profiler();
+
+  move(3, 4, false);
+  // The inputs of both invariants are explored and all of them changed:
+  EXPECT_GT(numCalls(profiler, 0, InvariantCall::NEXT_INPUT), 0);
+  EXPECT_GT(numCalls(profiler, 1, InvariantCall::NEXT_INPUT), 0);
+  EXPECT_EQ(numCalls(profiler, 0, InvariantCall::NOTIFY), 2);
+  EXPECT_EQ(numCalls(profiler, 1, InvariantCall::NOTIFY), 2);
+  EXPECT_EQ(solver->currentValue(output), 11);
+}
+
+TEST_F(InvariantProfilerTest, EnabledWhileOpen) {
+  solver->enableProfiling();
+  const VarViewId other = solver->makeIntVar(0, 0, 40);
+  solver->makeInvariant<Linear>(*solver, other,
+                                std::vector<VarViewId>{output, x});
+  solver->close();
+  EXPECT_EQ(solver->profiler()->numInvariants(), 3);
+  EXPECT_EQ(numCalls(*solver->profiler(), 2, InvariantCall::RECOMPUTE), 1);
+}
+
+TEST_F(InvariantProfilerTest, CloneAndMerge) {
+  solver->enableProfiling();
+  solver->close();
+  std::unique_ptr<Solver> copy = solver->clone();
+  ASSERT_NE(copy->profiler(), nullptr);
+  EXPECT_EQ(copy->profiler()->numInvariants(), 2);
+  EXPECT_EQ(numCalls(*copy->profiler(), 0, InvariantCall::RECOMPUTE), 0);
+
+  copy->beginMove();
+  copy->setValue(x, 5);
+  copy->endMove();
+  copy->beginProbe();
+  copy->query(output);
+  copy->endProbe();
+  EXPECT_EQ(numCalls(*copy->profiler(), 0, InvariantCall::NOTIFY), 1);
+  EXPECT_EQ(numCalls(*solver->profiler(), 0, InvariantCall::NOTIFY), 0);
+
+  solver->profiler()->merge(*copy->profiler());
+  EXPECT_EQ(numCalls(*solver->profiler(), 0, InvariantCall::NOTIFY), 1);
+  EXPECT_EQ(numCalls(*solver->profiler(), 0, InvariantCall::RECOMPUTE), 1);
+}
+
+TEST_F(InvariantProfilerTest, WriteJson) {
+  solver->enableProfiling();
+  solver->close();
+  move(3, 4, true);
+
+  std::stringstream stream;
+  solver->profiler()->writeJson(stream, solver->store(), {"int_plus"});
+  const nlohmann::json report = nlohmann::json::parse(stream.str());
+
+  ASSERT_EQ(report["invariants"].size(), 2);
+  ASSERT_EQ(report["constraints"].size(), 2);
+  ASSERT_EQ(report["types"].size(), 2);
+  for (const auto& entry : report["invariants"]) {
+    if (entry["id"] == 0) {
+      EXPECT_EQ(entry["constraint"], "int_plus");
+      EXPECT_EQ(entry["type"], "Plus");
+    } else {
+      EXPECT_EQ(entry["constraint"], "other");
+      EXPECT_EQ(entry["type"], "Linear");
+    }
+    EXPECT_EQ(entry["notify"]["calls"], 2);
+    EXPECT_EQ(entry["commit"]["calls"], 2);
+    EXPECT_EQ(entry["recompute"]["calls"], 1);
+    EXPECT_GE(entry["seconds"].get<double>(), 0.0);
+  }
+}
+
+}  // namespace atlantis::testing
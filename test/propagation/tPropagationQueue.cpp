@@ -1,14 +1,18 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <numeric>
 #include <random>
 #include <vector>
 
-#include "atlantis/propagation/propagation/propagationQueue.hpp"
+#include "atlantis/propagation/propagation/propagationBucketQueue.hpp"
+#include "atlantis/propagation/propagation/propagationListQueue.hpp"
 
 namespace atlantis::testing {
 
 using namespace atlantis::propagation;
 
+template <class Queue>
 class PropagationQueueTest : public ::testing::Test {
  protected:
   void SetUp() override {
@@ -18,20 +22,24 @@ class PropagationQueueTest : public ::testing::Test {
   std::mt19937 gen;
 };
 
+using QueueTypes =
+    ::testing::Types<PropagationListQueue, PropagationBucketQueue>;
+TYPED_TEST_SUITE(PropagationQueueTest, QueueTypes);
+
 /**
  *  Testing constructor
  */
 
-TEST_F(PropagationQueueTest, init) {
-  PropagationQueue queue;
+TYPED_TEST(PropagationQueueTest, init) {
+  TypeParam queue;
   queue.initVar(VarId{0}, 1);
   queue.initVar(VarId{1}, 2);
   EXPECT_EQ(queue.empty(), true);
   EXPECT_EQ(queue.pop(), NULL_ID);
 }
 
-TEST_F(PropagationQueueTest, isEmpty) {
-  PropagationQueue queue;
+TYPED_TEST(PropagationQueueTest, isEmpty) {
+  TypeParam queue;
   EXPECT_EQ(queue.empty(), true);
   queue.initVar(VarId{0}, 1);
   queue.initVar(VarId{1}, 2);
@@ -45,8 +53,8 @@ TEST_F(PropagationQueueTest, isEmpty) {
   EXPECT_EQ(queue.empty(), true);
 }
 
-TEST_F(PropagationQueueTest, pushAndPop) {
-  PropagationQueue queue;
+TYPED_TEST(PropagationQueueTest, pushAndPop) {
+  TypeParam queue;
   for (VarId varId = 0; varId < 100; ++varId) {
     queue.initVar(varId, varId);
   }
@@ -58,8 +66,8 @@ TEST_F(PropagationQueueTest, pushAndPop) {
   }
 }
 
-TEST_F(PropagationQueueTest, ignoreDuplicates) {
-  PropagationQueue queue;
+TYPED_TEST(PropagationQueueTest, ignoreDuplicates) {
+  TypeParam queue;
   for (VarId varId = 0; varId < 100; ++varId) {
     queue.initVar(varId, varId);
   }
@@ -75,4 +83,62 @@ TEST_F(PropagationQueueTest, ignoreDuplicates) {
   EXPECT_EQ(queue.empty(), true);
 }
 
+TYPED_TEST(PropagationQueueTest, popInPriorityOrder) {
+  TypeParam queue;
+  const size_t numVars = 1000;
+  std::uniform_int_distribution<size_t> priorityDist(0, numVars / 10);
+  std::vector<size_t> priorities(numVars);
+  for (VarId varId = 0; varId < numVars; ++varId) {
+    priorities[varId] = priorityDist(this->gen);
+    queue.initVar(varId, priorities[varId]);
+  }
+  std::vector<VarId> varIds(numVars);
+  std::iota(varIds.begin(), varIds.end(), 0);
+  std::shuffle(varIds.begin(), varIds.end(), this->gen);
+  for (const VarId varId : varIds) {
+    queue.push(varId);
+  }
+  size_t prevPriority = 0;
+  for (size_t i = 0; i < numVars; ++i) {
+    EXPECT_FALSE(queue.empty());
+    const VarId varId = queue.top();
+    EXPECT_EQ(queue.pop(), varId);
+    EXPECT_LE(prevPriority, priorities[varId]);
+    prevPriority = priorities[varId];
+  }
+  EXPECT_TRUE(queue.empty());
+}
+
+TYPED_TEST(PropagationQueueTest, pushDuringPop) {
+  TypeParam queue;
+  for (VarId varId = 0; varId < 100; ++varId) {
+    queue.initVar(varId, varId);
+  }
+  queue.push(VarId{0});
+  for (VarId varId = 0; varId < 100; ++varId) {
+    EXPECT_EQ(queue.pop(), varId);
+    if (varId + 1 < 100) {
+      queue.push(varId + 1);
+    }
+  }
+  EXPECT_EQ(queue.empty(), true);
+}
+
+TYPED_TEST(PropagationQueueTest, updatePriority) {
+  TypeParam queue;
+  for (VarId varId = 0; varId < 100; ++varId) {
+    queue.initVar(varId, varId);
+  }
+  for (VarId varId = 0; varId < 100; ++varId) {
+    queue.updatePriority(varId, 200 - varId);
+  }
+  for (VarId varId = 0; varId < 100; ++varId) {
+    queue.push(varId);
+  }
+  for (VarId varId = 100; varId > 0; --varId) {
+    EXPECT_EQ(queue.pop(), varId - 1);
+  }
+  EXPECT_EQ(queue.empty(), true);
+}
+
 }  // namespace atlantis::testing
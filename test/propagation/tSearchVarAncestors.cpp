@@ -0,0 +1,164 @@
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+#include "atlantis/propagation/invariants/elementVar.hpp"
+#include "atlantis/propagation/invariants/linear.hpp"
+#include "atlantis/propagation/propagation/searchVarAncestors.hpp"
+#include "atlantis/propagation/solver.hpp"
+#include "atlantis/propagation/views/intOffsetView.hpp"
+
+namespace atlantis::testing {
+
+using namespace atlantis::propagation;
+
+class SearchVarAncestorsTest : public ::testing::Test {
+ protected:
+  std::unique_ptr<Solver> solver;
+  std::mt19937 gen;
+
+  void SetUp() override {
+    solver = std::make_unique<Solver>();
+    gen = std::mt19937(1234);
+  }
+
+  // The ancestors of each variable by a depth-first search from each search
+  // variable:
+  std::vector<std::vector<bool>> bruteForceAncestors() {
+    const size_t numVars = solver->numVars();
+    std::vector<std::vector<bool>> isAncestor(numVars,
+                                              std::vector<bool>(numVars));
+    for (const VarId searchVar : solver->searchVars()) {
+      std::vector<VarId> stack{searchVar};
+      isAncestor[searchVar][searchVar] = true;
+      while (!stack.empty()) {
+        const VarId id = stack.back();
+        stack.pop_back();
+        for (const auto& data : solver->listeningInvariantData(id)) {
+          for (const VarId output : solver->varsDefinedBy(data.invariantId)) {
+            if (!isAncestor[output][searchVar]) {
+              isAncestor[output][searchVar] = true;
+              stack.emplace_back(output);
+            }
+          }
+        }
+      }
+    }
+    return isAncestor;
+  }
+
+  void expectAncestors() {
+    SearchVarAncestors ancestors;
+    ancestors.build(*solver);
+    const auto expected = bruteForceAncestors();
+    for (VarId id = 0; id < solver->numVars(); ++id) {
+      for (VarId searchVar = 0; searchVar < solver->numVars(); ++searchVar) {
+        EXPECT_EQ(ancestors.isAncestor(searchVar, id),
+                  expected[id][searchVar])
+            << "var " << id << ", search var " << searchVar;
+      }
+    }
+  }
+};
+
+TEST_F(SearchVarAncestorsTest, Chain) {
+  solver->open();
+  std::vector<VarViewId> inputs;
+  for (size_t i = 0; i < 4; ++i) {
+    inputs.emplace_back(solver->makeIntVar(0, 0, 10));
+  }
+  VarViewId prev = solver->makeIntVar(0, 0, 100);
+  solver->makeInvariant<Linear>(*solver, prev,
+                                std::vector<VarViewId>{inputs[0], inputs[1]});
+  for (size_t i = 0; i < 10; ++i) {
+    const VarViewId output = solver->makeIntVar(0, 0, 100);
+    solver->makeInvariant<Linear>(*solver, output,
+                                  std::vector<VarViewId>{prev, inputs[3]});
+    prev = output;
+  }
+  solver->close();
+  expectAncestors();
+
+  SearchVarAncestors ancestors;
+  ancestors.build(*solver);
+  // One interval per search variable, one for the first Linear, two for the
+  // first link of the chain, and the remaining links share the latter:
+  EXPECT_EQ(ancestors.numIntervals(), 4 + 1 + 2);
+}
+
+TEST_F(SearchVarAncestorsTest, RandomDag) {
+  for (size_t instance = 0; instance < 10; ++instance) {
+    SetUp();
+    solver->open();
+    std::vector<VarViewId> vars;
+    const size_t numSearchVars = 20;
+    for (size_t i = 0; i < numSearchVars; ++i) {
+      vars.emplace_back(solver->makeIntVar(0, 0, 10));
+    }
+    for (size_t i = 0; i < 40; ++i) {
+      std::uniform_int_distribution<size_t> varDist(0, vars.size() - 1);
+      std::vector<VarViewId> inputs;
+      for (size_t j = 0; j < 3; ++j) {
+        inputs.emplace_back(vars[varDist(gen)]);
+      }
+      const VarViewId output = solver->makeIntVar(0, 0, 1000);
+      solver->makeInvariant<Linear>(*solver, output, std::move(inputs));
+      vars.emplace_back(output);
+    }
+    solver->close();
+    expectAncestors();
+  }
+}
+
+TEST_F(SearchVarAncestorsTest, DynamicCycle) {
+  // x1, x2, and x3 are each an element of the same array, which contains
+  // (views of) all three of them, so they form a cycle through their dynamic
+  // inputs:
+  solver->open();
+  const VarViewId base = solver->makeIntVar(1, -10, 10);
+  const VarViewId i1 = solver->makeIntVar(1, 1, 4);
+  const VarViewId i2 = solver->makeIntVar(2, 1, 4);
+  const VarViewId i3 = solver->makeIntVar(3, 1, 4);
+  const VarViewId unrelated = solver->makeIntVar(0, 0, 10);
+  const VarViewId x1 = solver->makeIntVar(1, -100, 100);
+  const VarViewId x2 = solver->makeIntVar(1, -100, 100);
+  const VarViewId x3 = solver->makeIntVar(1, -100, 100);
+  const VarViewId output = solver->makeIntVar(2, -300, 300);
+  const VarViewId unrelatedOutput = solver->makeIntVar(0, 0, 20);
+
+  const std::vector<VarViewId> varArray{
+      base, solver->makeIntView<IntOffsetView>(*solver, x1, 1),
+      solver->makeIntView<IntOffsetView>(*solver, x2, 2),
+      solver->makeIntView<IntOffsetView>(*solver, x3, 3)};
+  solver->makeInvariant<ElementVar>(*solver, x1, i1,
+                                    std::vector<VarViewId>(varArray));
+  solver->makeInvariant<ElementVar>(*solver, x2, i2,
+                                    std::vector<VarViewId>(varArray));
+  solver->makeInvariant<ElementVar>(*solver, x3, i3,
+                                    std::vector<VarViewId>(varArray));
+  solver->makeInvariant<Linear>(*solver, output,
+                                std::vector<VarViewId>{x1, x2, x3});
+  solver->makeInvariant<Linear>(*solver, unrelatedOutput,
+                                std::vector<VarViewId>{unrelated, i1});
+  solver->close();
+  expectAncestors();
+
+  SearchVarAncestors ancestors;
+  ancestors.build(*solver);
+  for (const VarViewId id : {x1, x2, x3, output}) {
+    for (const VarViewId searchVar : {base, i1, i2, i3}) {
+      EXPECT_TRUE(ancestors.isAncestor(VarId(searchVar), VarId(id)));
+    }
+    EXPECT_FALSE(ancestors.isAncestor(VarId(unrelated), VarId(id)));
+  }
+  EXPECT_TRUE(ancestors.isAncestor(VarId(i1), VarId(unrelatedOutput)));
+  EXPECT_FALSE(ancestors.isAncestor(VarId(i2), VarId(unrelatedOutput)));
+  // The variables of the cycle share their ancestors:
+  EXPECT_EQ(ancestors.numIntervals(),
+            // One per search variable, one for the cycle and output, and
+            // two for unrelatedOutput:
+            5 + 1 + 2);
+}
+
+}  // namespace atlantis::testing
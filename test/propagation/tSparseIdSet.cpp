@@ -0,0 +1,72 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <set>
+#include <vector>
+
+#include "atlantis/propagation/utils/sparseIdSet.hpp"
+
+namespace atlantis::testing {
+
+using namespace atlantis::propagation;
+
+TEST(SparseIdSetTest, EmplaceAndErase) {
+  SparseIdSet set;
+  set.reserve(10);
+  EXPECT_EQ(set.capacity(), 10);
+  EXPECT_TRUE(set.empty());
+
+  set.emplace(3);
+  set.emplace(7);
+  set.emplace(3);
+  EXPECT_EQ(set.size(), 2);
+  EXPECT_TRUE(set.contains(3));
+  EXPECT_TRUE(set.contains(7));
+  EXPECT_FALSE(set.contains(0));
+  EXPECT_FALSE(set.contains(100));
+
+  set.erase(3);
+  set.erase(5);
+  EXPECT_EQ(set.size(), 1);
+  EXPECT_FALSE(set.contains(3));
+  EXPECT_TRUE(set.contains(7));
+
+  set.clear();
+  EXPECT_TRUE(set.empty());
+  EXPECT_FALSE(set.contains(7));
+}
+
+TEST(SparseIdSetTest, Random) {
+  std::mt19937 gen(1234);
+  const size_t capacity = 100;
+  std::uniform_int_distribution<size_t> idDist(0, capacity - 1);
+  SparseIdSet set;
+  for (size_t id = 0; id < capacity; ++id) {
+    set.reserve(id + 1);
+  }
+  std::set<size_t> expected;
+  for (size_t i = 0; i < 10000; ++i) {
+    const size_t id = idDist(gen);
+    if (i % 1000 == 999) {
+      set.clear();
+      expected.clear();
+    } else if (gen() % 2 == 0) {
+      set.emplace(id);
+      expected.emplace(id);
+    } else {
+      set.erase(id);
+      expected.erase(id);
+    }
+    ASSERT_EQ(set.size(), expected.size());
+    std::vector<size_t> ids(set.begin(), set.end());
+    std::sort(ids.begin(), ids.end());
+    ASSERT_TRUE(std::equal(ids.begin(), ids.end(), expected.begin(),
+                           expected.end()));
+    for (size_t id2 = 0; id2 < capacity; ++id2) {
+      ASSERT_EQ(set.contains(id2), expected.contains(id2));
+    }
+  }
+}
+
+}  // namespace atlantis::testing
@@ -0,0 +1,91 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "atlantis/propagation/utils/tournamentTree.hpp"
+
+namespace atlantis::testing {
+
+using namespace atlantis::propagation;
+
+class TournamentTreeTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    std::random_device rd;
+    gen = std::mt19937(rd());
+  }
+  std::mt19937 gen;
+};
+
+TEST_F(TournamentTreeTest, Constructor) {
+  for (size_t size = 0; size < 100; ++size) {
+    TournamentTree<std::less<Int>> tree(size, 0);
+    EXPECT_EQ(tree.size(), size);
+  }
+}
+
+TEST_F(TournamentTreeTest, Recompute) {
+  for (size_t size = 1; size < 40; ++size) {
+    TournamentTree<std::less<Int>> minTree(size,
+                                           std::numeric_limits<Int>::max());
+    TournamentTree<std::greater<Int>> maxTree(size,
+                                              std::numeric_limits<Int>::min());
+    std::uniform_int_distribution<Int> valueDist(-100, 100);
+    std::vector<Int> values(size);
+    const Timestamp ts = 1;
+    for (size_t i = 0; i < size; ++i) {
+      values[i] = valueDist(gen);
+      minTree.resetValue(ts, i, values[i]);
+      maxTree.resetValue(ts, i, values[i]);
+    }
+    minTree.recompute(ts);
+    maxTree.recompute(ts);
+    EXPECT_EQ(minTree.top(ts), *std::min_element(values.begin(), values.end()));
+    EXPECT_EQ(maxTree.top(ts), *std::max_element(values.begin(), values.end()));
+  }
+}
+
+TEST_F(TournamentTreeTest, SetValueAndCommit) {
+  const size_t size = 37;
+  TournamentTree<std::less<Int>> tree(size, std::numeric_limits<Int>::max());
+  std::uniform_int_distribution<Int> valueDist(-100, 100);
+  std::uniform_int_distribution<size_t> indexDist(0, size - 1);
+  std::vector<Int> committed(size);
+
+  Timestamp ts = 1;
+  for (size_t i = 0; i < size; ++i) {
+    committed[i] = valueDist(gen);
+    tree.resetValue(ts, i, committed[i]);
+  }
+  tree.recompute(ts);
+  tree.commitIf(ts);
+
+  for (size_t iteration = 0; iteration < 1000; ++iteration) {
+    ++ts;
+    std::vector<Int> values(committed);
+    for (size_t j = 0; j < 3; ++j) {
+      const size_t index = indexDist(gen);
+      values[index] = valueDist(gen);
+      tree.setValue(ts, index, values[index]);
+      EXPECT_EQ(tree.top(ts), *std::min_element(values.begin(), values.end()));
+    }
+    // The committed values are unaffected by the probe:
+    EXPECT_EQ(tree.top(ts + 1),
+              *std::min_element(committed.begin(), committed.end()));
+    if (iteration % 2 == 0) {
+      tree.commitIf(ts);
+      committed = values;
+    }
+    for (size_t i = 0; i < size; ++i) {
+      EXPECT_EQ(tree.value(ts + 1, i), committed[i]);
+    }
+    EXPECT_EQ(tree.top(ts + 1),
+              *std::min_element(committed.begin(), committed.end()));
+  }
+}
+
+}  // namespace atlantis::testing
@@ -0,0 +1,112 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <random>
+#include <vector>
+
+#include "atlantis/propagation/utils/valueCounts.hpp"
+#include "atlantis/propagation/variables/committableInt.hpp"
+
+namespace atlantis::testing {
+
+using namespace atlantis::propagation;
+
+TEST(ValueCountsTest, Representation) {
+  ValueCounts counts;
+  counts.assign(0, 99, 10);
+  EXPECT_FALSE(counts.isSparse());
+  EXPECT_EQ(counts.numEntries(), 100);
+
+  counts.assign(0, 10000000, 10);
+  EXPECT_TRUE(counts.isSparse());
+  EXPECT_LT(counts.numEntries(), 1000);
+
+  // A wide range is dense if there are enough inputs:
+  counts.assign(0, 10000, 1000);
+  EXPECT_FALSE(counts.isSparse());
+
+  counts.assign(1, 0, 10);
+  EXPECT_EQ(counts.numEntries(), 0);
+  EXPECT_FALSE(counts.inRange(0));
+  EXPECT_EQ(counts.value(1, 0), 0);
+}
+
+class ValueCountsTest : public ::testing::TestWithParam<Int> {};
+
+TEST_P(ValueCountsTest, BehavesAsCommittableInts) {
+  // Moves the values of numInputs inputs in [0, ub], where at most a few
+  // moves are committed:
+  const Int ub = GetParam();
+  const size_t numInputs = 20;
+  std::mt19937 gen(1234);
+  std::uniform_int_distribution<size_t> inputDist(0, numInputs - 1);
+  std::uniform_int_distribution<Int> valueDist(0, ub);
+
+  ValueCounts counts;
+  counts.assign(0, ub, numInputs);
+  EXPECT_EQ(counts.isSparse(), ub > 100000);
+  const size_t numEntries = counts.numEntries();
+
+  std::vector<Int> values(numInputs, 0);
+  std::map<Int, CommittableInt> expected;
+  const auto expectedCount = [&](Timestamp ts, Int value) {
+    const auto it = expected.find(value);
+    return it == expected.end() ? 0 : it->second.value(ts);
+  };
+  const auto incExpected = [&](Timestamp ts, Int value, Int inc) {
+    return expected.try_emplace(value, NULL_TIMESTAMP, 0)
+        .first->second.incValue(ts, inc);
+  };
+
+  Timestamp ts = 1;
+  counts.reset(ts);
+  for (const Int value : values) {
+    EXPECT_EQ(counts.incValue(ts, value, 1), incExpected(ts, value, 1));
+  }
+  counts.commitIf(ts);
+  for (auto& [value, count] : expected) {
+    count.commitIf(ts);
+  }
+
+  for (++ts; ts < 5000; ++ts) {
+    std::vector<Int> newValues(values);
+    for (size_t m = inputDist(gen) % 3; m < 3; ++m) {
+      const size_t i = inputDist(gen);
+      const Int value = valueDist(gen);
+      EXPECT_EQ(counts.incValue(ts, newValues[i], -1),
+                incExpected(ts, newValues[i], -1));
+      EXPECT_EQ(counts.incValue(ts, value, 1), incExpected(ts, value, 1));
+      newValues[i] = value;
+    }
+    for (const Int value : newValues) {
+      EXPECT_EQ(counts.value(ts, value), expectedCount(ts, value));
+    }
+    if (ts % 4 == 0) {
+      counts.commitIf(ts);
+      for (auto& [value, count] : expected) {
+        count.commitIf(ts);
+      }
+      values = newValues;
+    }
+    for (const Int value : values) {
+      EXPECT_EQ(counts.value(ts + 1, value), expectedCount(ts + 1, value));
+    }
+  }
+  // The table does not grow with the number of distinct values:
+  EXPECT_EQ(counts.numEntries(), numEntries);
+
+  // Resetting sets every count to 0:
+  counts.reset(ts);
+  for (const Int value : values) {
+    EXPECT_EQ(counts.value(ts, value), 0);
+  }
+  counts.commitIf(ts);
+  for (const Int value : values) {
+    EXPECT_EQ(counts.value(ts + 1, value), 0);
+  }
+}
+
+INSTANTIATE_TEST_CASE_P(ValueCountsTest, ValueCountsTest,
+                        ::testing::Values(Int(50), Int(10000000)));
+
+}  // namespace atlantis::testing
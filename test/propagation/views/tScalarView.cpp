@@ -2,6 +2,8 @@
 #include <rapidcheck/gtest.h>
 
 #include "atlantis/propagation/solver.hpp"
+#include "atlantis/propagation/views/intMaxView.hpp"
+#include "atlantis/propagation/views/intOffsetView.hpp"
 #include "atlantis/propagation/views/scalarView.hpp"
 
 namespace atlantis::testing {
@@ -25,4 +27,49 @@ RC_GTEST_FIXTURE_PROP(ScalarViewTest, simple,
 
   RC_ASSERT(_solver->committedValue(viewId) == val * scalar + offset);
 }
+
+RC_GTEST_FIXTURE_PROP(ScalarViewTest, chain, ()) {
+  const Int scalar = *rc::gen::inRange<Int>(-100, 100);
+  const Int offset = *rc::gen::inRange<Int>(-100, 100);
+  const Int maxValue = *rc::gen::inRange<Int>(-100, 100);
+
+  _solver->open();
+  auto varId = _solver->makeIntVar(0, -100, 100);
+  // An affine chain, which is evaluated as a single map of varId:
+  auto offsetViewId = _solver->makeIntView<IntOffsetView>(*_solver, varId, 1);
+  auto scalarViewId = _solver->makeIntView<ScalarView>(*_solver, offsetViewId,
+                                                       scalar, offset);
+  // A chain that is broken by a view that is not affine:
+  auto maxViewId =
+      _solver->makeIntView<IntMaxView>(*_solver, scalarViewId, maxValue);
+  auto lastViewId =
+      _solver->makeIntView<ScalarView>(*_solver, maxViewId, scalar, offset);
+  _solver->close();
+
+  for (size_t i = 0; i < 10; ++i) {
+    const Int val = *rc::gen::inRange<Int>(-100, 100);
+    _solver->beginMove();
+    _solver->setValue(varId, val);
+    _solver->endMove();
+
+    const Int scalarValue = (val + 1) * scalar + offset;
+    const Int lastValue = std::max(maxValue, scalarValue) * scalar + offset;
+
+    _solver->beginProbe();
+    _solver->query(lastViewId);
+    _solver->endProbe();
+    RC_ASSERT(_solver->currentValue(scalarViewId) == scalarValue);
+    RC_ASSERT(_solver->currentValue(lastViewId) == lastValue);
+
+    _solver->beginMove();
+    _solver->setValue(varId, val);
+    _solver->endMove();
+    _solver->beginCommit();
+    _solver->query(lastViewId);
+    _solver->endCommit();
+    RC_ASSERT(_solver->committedValue(scalarViewId) == scalarValue);
+    RC_ASSERT(_solver->committedValue(lastViewId) == lastValue);
+  }
+}
+
 }  // namespace atlantis::testing
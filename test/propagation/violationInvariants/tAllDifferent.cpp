@@ -230,6 +230,45 @@ TEST_F(AllDifferentTest, Commit) {
   }
 }
 
+TEST_F(AllDifferentTest, CommitWideDomain) {
+  // The domains are much wider than the number of variables, so the counts
+  // are sparse:
+  numInputVars = 50;
+  inputVarLb = 0;
+  inputVarUb = 10000000;
+
+  auto& invariant = generate();
+
+  // Only use a few values so that some variables share values:
+  std::uniform_int_distribution<size_t> indexDist(0, numInputVars - 1);
+  std::uniform_int_distribution<Int> valueDist(0, 9);
+
+  Timestamp ts = _solver->currentTimestamp();
+  for (size_t iteration = 0; iteration < 1000; ++iteration) {
+    ++ts;
+    const size_t i = indexDist(gen);
+    const Int oldVal = _solver->committedValue(inputVars.at(i));
+    do {
+      _solver->setValue(ts, inputVars.at(i), valueDist(gen) * 1000003);
+    } while (oldVal == _solver->value(ts, inputVars.at(i)));
+
+    invariant.notifyInputChanged(ts, LocalId(i));
+    ASSERT_EQ(_solver->value(ts, outputVar), computeOutput(ts));
+
+    if (iteration % 2 == 0) {
+      // Only commit every other move:
+      continue;
+    }
+    const Int notifiedViolation = _solver->value(ts, outputVar);
+    _solver->commitIf(ts, VarId(inputVars.at(i)));
+    _solver->commitIf(ts, VarId(outputVar));
+    invariant.commit(ts);
+    invariant.recompute(ts + 1);
+    ASSERT_EQ(notifiedViolation, _solver->value(ts + 1, outputVar));
+    ++ts;
+  }
+}
+
 RC_GTEST_FIXTURE_PROP(AllDifferentTest, rapidcheck, ()) {
   numInputVars = *rc::gen::inRange(1, 100);
 
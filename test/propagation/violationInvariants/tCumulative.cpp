@@ -0,0 +1,369 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <rapidcheck/gtest.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "../invariantTestHelper.hpp"
+#include "atlantis/propagation/violationInvariants/cumulative.hpp"
+
+namespace atlantis::testing {
+
+using namespace atlantis::propagation;
+
+class CumulativeTest : public InvariantTest {
+ public:
+  size_t numTasks{3};
+
+  Int startLb{0};
+  Int startUb{5};
+  Int durationLb{0};
+  Int durationUb{3};
+  Int requirementLb{0};
+  Int requirementUb{3};
+  Int capacityLb{1};
+  Int capacityUb{4};
+
+  std::vector<VarViewId> starts;
+  std::vector<VarViewId> durations;
+  std::vector<VarViewId> requirements;
+  VarViewId capacity{NULL_ID};
+  // starts, durations, requirements, and capacity (in the order of the local
+  // ids of the invariant):
+  std::vector<VarViewId> inputVars;
+  VarViewId outputVar{NULL_ID};
+
+  Int computeOutput(bool committedValue = false) {
+    std::vector<Int> values(inputVars.size(), 0);
+    for (size_t i = 0; i < inputVars.size(); ++i) {
+      values.at(i) = committedValue ? _solver->committedValue(inputVars.at(i))
+                                    : _solver->currentValue(inputVars.at(i));
+    }
+    return computeOutput(values);
+  }
+
+  Int computeOutput(Timestamp ts) {
+    std::vector<Int> values(inputVars.size(), 0);
+    for (size_t i = 0; i < inputVars.size(); ++i) {
+      values.at(i) = _solver->value(ts, inputVars.at(i));
+    }
+    return computeOutput(values);
+  }
+
+  Int computeOutput(const std::vector<Int>& values) const {
+    Int begin = 0;
+    Int end = 0;
+    for (size_t i = 0; i < numTasks; ++i) {
+      begin = std::min(begin, values.at(i));
+      end = std::max(end, values.at(i) + values.at(numTasks + i));
+    }
+    const Int cap = values.at(3 * numTasks);
+    Int violation = 0;
+    for (Int t = begin; t < end; ++t) {
+      Int load = 0;
+      for (size_t i = 0; i < numTasks; ++i) {
+        if (values.at(i) <= t && t < values.at(i) + values.at(numTasks + i)) {
+          load += std::max(Int(0), values.at(2 * numTasks + i));
+        }
+      }
+      if (load > 0) {
+        violation += std::max(Int(0), load - cap);
+      }
+    }
+    return violation;
+  }
+
+  Cumulative& generate() {
+    starts.clear();
+    durations.clear();
+    requirements.clear();
+    inputVars.clear();
+
+    if (!_solver->isOpen()) {
+      _solver->open();
+    }
+
+    for (size_t i = 0; i < numTasks; ++i) {
+      starts.emplace_back(makeIntVar(startLb, startUb));
+    }
+    for (size_t i = 0; i < numTasks; ++i) {
+      durations.emplace_back(makeIntVar(durationLb, durationUb));
+    }
+    for (size_t i = 0; i < numTasks; ++i) {
+      requirements.emplace_back(makeIntVar(requirementLb, requirementUb));
+    }
+    capacity = makeIntVar(capacityLb, capacityUb);
+
+    inputVars.insert(inputVars.end(), starts.begin(), starts.end());
+    inputVars.insert(inputVars.end(), durations.begin(), durations.end());
+    inputVars.insert(inputVars.end(), requirements.begin(),
+                     requirements.end());
+    inputVars.emplace_back(capacity);
+
+    outputVar = _solver->makeIntVar(0, 0, 0);
+    Cumulative& invariant = _solver->makeInvariant<Cumulative>(
+        *_solver, outputVar, std::vector<VarViewId>(starts),
+        std::vector<VarViewId>(durations), std::vector<VarViewId>(requirements),
+        capacity);
+    _solver->close();
+    return invariant;
+  }
+
+  VarViewId makeIntVar(Int lb, Int ub) {
+    return _solver->makeIntVar(
+        std::uniform_int_distribution<Int>(lb, ub)(gen), lb, ub);
+  }
+
+  Int randomValue(VarViewId var) {
+    return std::uniform_int_distribution<Int>(_solver->lowerBound(var),
+                                              _solver->upperBound(var))(gen);
+  }
+};
+
+TEST_F(CumulativeTest, UpdateBounds) {
+  numTasks = 2;
+  capacityLb = -2;
+  capacityUb = 2;
+  auto& invariant = generate();
+  EXPECT_EQ(_solver->lowerBound(outputVar), 0);
+  auto inputVals = makeValVector(inputVars);
+  while (increaseNextVal(inputVars, inputVals) >= 0) {
+    setVarVals(_solver->currentTimestamp(), inputVars, inputVals);
+    invariant.updateBounds(false);
+    invariant.recompute(_solver->currentTimestamp());
+    EXPECT_GE(_solver->currentValue(outputVar), 0);
+    EXPECT_LE(_solver->currentValue(outputVar), _solver->upperBound(outputVar));
+  }
+}
+
+TEST_F(CumulativeTest, Recompute) {
+  generateState = GenerateState::LB;
+  numTasks = 2;
+  startLb = -1;
+  startUb = 2;
+  durationUb = 2;
+  requirementLb = -1;
+  requirementUb = 2;
+  capacityLb = 0;
+  capacityUb = 1;
+
+  auto& invariant = generate();
+  auto inputVals = makeValVector(inputVars);
+  Timestamp ts = _solver->currentTimestamp();
+
+  while (increaseNextVal(inputVars, inputVals) >= 0) {
+    ++ts;
+    setVarVals(ts, inputVars, inputVals);
+    invariant.recompute(ts);
+    EXPECT_EQ(_solver->value(ts, outputVar), computeOutput(ts));
+  }
+}
+
+TEST_F(CumulativeTest, NotifyInputChanged) {
+  generateState = GenerateState::LB;
+  numTasks = 2;
+  startLb = -1;
+  startUb = 2;
+  durationLb = -1;
+  durationUb = 2;
+  requirementUb = 2;
+  capacityLb = 0;
+  capacityUb = 1;
+
+  auto& invariant = generate();
+  auto inputVals = makeValVector(inputVars);
+  Timestamp ts = _solver->currentTimestamp();
+
+  while (increaseNextVal(inputVars, inputVals) >= 0) {
+    ++ts;
+    setVarVals(ts, inputVars, inputVals);
+    notifyInputsChanged(ts, invariant, inputVars);
+    EXPECT_EQ(_solver->value(ts, outputVar), computeOutput(ts));
+  }
+}
+
+TEST_F(CumulativeTest, NextInput) {
+  numTasks = 100;
+  auto& invariant = generate();
+  expectNextInput(inputVars, invariant);
+}
+
+TEST_F(CumulativeTest, NotifyCurrentInputChanged) {
+  numTasks = 20;
+  auto& invariant = generate();
+
+  for (Timestamp ts = _solver->currentTimestamp() + 1;
+       ts < _solver->currentTimestamp() + 4; ++ts) {
+    for (const VarViewId& varId : inputVars) {
+      EXPECT_EQ(invariant.nextInput(ts), varId);
+      const Int oldVal = _solver->value(ts, varId);
+      do {
+        _solver->setValue(ts, varId, randomValue(varId));
+      } while (_solver->value(ts, varId) == oldVal);
+      invariant.notifyCurrentInputChanged(ts);
+      EXPECT_EQ(_solver->value(ts, outputVar), computeOutput(ts));
+    }
+  }
+}
+
+TEST_F(CumulativeTest, Commit) {
+  numTasks = 20;
+  auto& invariant = generate();
+
+  std::vector<size_t> indices(inputVars.size());
+  std::iota(indices.begin(), indices.end(), 0);
+  std::shuffle(indices.begin(), indices.end(), rng);
+
+  std::vector<Int> committedValues(inputVars.size());
+  for (size_t i = 0; i < inputVars.size(); ++i) {
+    committedValues.at(i) = _solver->committedValue(inputVars.at(i));
+  }
+
+  EXPECT_EQ(_solver->currentValue(outputVar), computeOutput());
+
+  for (const size_t i : indices) {
+    Timestamp ts = _solver->currentTimestamp() + Timestamp(i);
+    for (size_t j = 0; j < inputVars.size(); ++j) {
+      // Check that we do not accidentally commit:
+      ASSERT_EQ(_solver->committedValue(inputVars.at(j)),
+                committedValues.at(j));
+    }
+
+    const Int oldVal = committedValues.at(i);
+    do {
+      _solver->setValue(ts, inputVars.at(i), randomValue(inputVars.at(i)));
+    } while (oldVal == _solver->value(ts, inputVars.at(i)));
+
+    // notify changes
+    invariant.notifyInputChanged(ts, LocalId(i));
+
+    // incremental value
+    const Int notifiedViolation = _solver->value(ts, outputVar);
+    invariant.recompute(ts);
+
+    ASSERT_EQ(notifiedViolation, _solver->value(ts, outputVar));
+
+    _solver->commitIf(ts, VarId(inputVars.at(i)));
+    committedValues.at(i) = _solver->value(ts, VarId(inputVars.at(i)));
+    _solver->commitIf(ts, VarId(outputVar));
+
+    invariant.commit(ts);
+    invariant.recompute(ts + 1);
+    ASSERT_EQ(notifiedViolation, _solver->value(ts + 1, outputVar));
+  }
+}
+
+RC_GTEST_FIXTURE_PROP(CumulativeTest, RapidCheck, ()) {
+  numTasks = *rc::gen::inRange<size_t>(1, 30);
+  startLb = *rc::gen::inRange<Int>(-100, 100);
+  startUb = startLb + *rc::gen::inRange<Int>(0, 50);
+  durationLb = *rc::gen::inRange<Int>(-2, 5);
+  durationUb = durationLb + *rc::gen::inRange<Int>(0, 10);
+  requirementLb = *rc::gen::inRange<Int>(-2, 5);
+  requirementUb = requirementLb + *rc::gen::inRange<Int>(0, 5);
+  capacityLb = *rc::gen::inRange<Int>(-2, 10);
+  capacityUb = capacityLb + *rc::gen::inRange<Int>(0, 10);
+
+  generate();
+
+  const size_t numCommits = 3;
+  const size_t numProbes = 3;
+
+  for (size_t c = 0; c < numCommits; ++c) {
+    RC_ASSERT(_solver->committedValue(outputVar) == computeOutput(true));
+
+    for (size_t p = 0; p <= numProbes; ++p) {
+      _solver->beginMove();
+      for (const VarViewId& varId : inputVars) {
+        if (randBool()) {
+          _solver->setValue(varId, randomValue(varId));
+        }
+      }
+      _solver->endMove();
+
+      if (p == numProbes) {
+        _solver->beginCommit();
+      } else {
+        _solver->beginProbe();
+      }
+      _solver->query(outputVar);
+      if (p == numProbes) {
+        _solver->endCommit();
+      } else {
+        _solver->endProbe();
+      }
+      RC_ASSERT(_solver->currentValue(outputVar) == computeOutput());
+    }
+    RC_ASSERT(_solver->committedValue(outputVar) == computeOutput(true));
+  }
+}
+
+class MockCumulative : public Cumulative {
+ public:
+  bool registered = false;
+  void registerVars() override {
+    registered = true;
+    Cumulative::registerVars();
+  }
+  explicit MockCumulative(SolverBase& solver, VarViewId outputVar,
+                          std::vector<VarViewId>&& starts,
+                          std::vector<VarViewId>&& durations,
+                          std::vector<VarViewId>&& requirements,
+                          VarViewId capacity)
+      : Cumulative(solver, outputVar, std::move(starts), std::move(durations),
+                   std::move(requirements), capacity) {
+    EXPECT_TRUE(outputVar.isVar());
+
+    ON_CALL(*this, recompute).WillByDefault([this](Timestamp timestamp) {
+      return Cumulative::recompute(timestamp);
+    });
+    ON_CALL(*this, nextInput).WillByDefault([this](Timestamp timestamp) {
+      return Cumulative::nextInput(timestamp);
+    });
+    ON_CALL(*this, notifyCurrentInputChanged)
+        .WillByDefault([this](Timestamp timestamp) {
+          Cumulative::notifyCurrentInputChanged(timestamp);
+        });
+    ON_CALL(*this, notifyInputChanged)
+        .WillByDefault([this](Timestamp timestamp, LocalId localId) {
+          Cumulative::notifyInputChanged(timestamp, localId);
+        });
+    ON_CALL(*this, commit).WillByDefault([this](Timestamp timestamp) {
+      Cumulative::commit(timestamp);
+    });
+  }
+  MOCK_METHOD(void, recompute, (Timestamp), (override));
+  MOCK_METHOD(VarViewId, nextInput, (Timestamp), (override));
+  MOCK_METHOD(void, notifyCurrentInputChanged, (Timestamp), (override));
+  MOCK_METHOD(void, notifyInputChanged, (Timestamp, LocalId), (override));
+  MOCK_METHOD(void, commit, (Timestamp), (override));
+};
+
+TEST_F(CumulativeTest, SolverIntegration) {
+  for (const auto& [propMode, markingMode] : propMarkModes) {
+    if (!_solver->isOpen()) {
+      _solver->open();
+    }
+    const size_t numArgs = 4;
+    std::vector<VarViewId> taskStarts;
+    std::vector<VarViewId> taskDurations;
+    std::vector<VarViewId> taskRequirements;
+    for (size_t i = 0; i < numArgs; ++i) {
+      taskStarts.emplace_back(_solver->makeIntVar(0, 0, 10));
+      taskDurations.emplace_back(_solver->makeIntVar(1, 0, 3));
+      taskRequirements.emplace_back(_solver->makeIntVar(1, 0, 3));
+    }
+    const VarViewId cap = _solver->makeIntVar(2, 0, 4);
+    const VarViewId viol = _solver->makeIntVar(0, 0, 100);
+    const VarViewId modifiedVarId = taskStarts.front();
+
+    testNotifications<MockCumulative>(
+        &_solver->makeInvariant<MockCumulative>(
+            *_solver, viol, std::move(taskStarts), std::move(taskDurations),
+            std::move(taskRequirements), cap),
+        {propMode, markingMode, 3 * numArgs + 2, modifiedVarId, 1, viol});
+  }
+}
+
+}  // namespace atlantis::testing
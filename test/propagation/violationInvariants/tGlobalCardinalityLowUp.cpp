@@ -331,6 +331,49 @@ TEST_F(GlobalCardinalityLowUpTest, Commit) {
   }
 }
 
+TEST_F(GlobalCardinalityLowUpTest, CommitWideCover) {
+  // The cover is much wider than the number of cover values, so the bounds
+  // are stored sparsely:
+  numInputVars = 20;
+  inputVarLb = 0;
+  inputVarUb = 10000000;
+  coverSet = std::unordered_map<Int, std::pair<Int, Int>>{
+      {0, std::pair<Int, Int>{0, 1}},
+      {5000000, std::pair<Int, Int>{2, 4}},
+      {10000000, std::pair<Int, Int>{0, 0}}};
+
+  auto& invariant = generate();
+
+  const std::vector<Int> values{0, 3, 5000000, 5000001, 10000000};
+  std::uniform_int_distribution<size_t> indexDist(0, numInputVars - 1);
+  std::uniform_int_distribution<size_t> valueDist(0, values.size() - 1);
+
+  Timestamp ts = _solver->currentTimestamp();
+  for (size_t iteration = 0; iteration < 1000; ++iteration) {
+    ++ts;
+    const size_t i = indexDist(gen);
+    const Int oldVal = _solver->committedValue(inputVars.at(i));
+    do {
+      _solver->setValue(ts, inputVars.at(i), values.at(valueDist(gen)));
+    } while (oldVal == _solver->value(ts, inputVars.at(i)));
+
+    invariant.notifyInputChanged(ts, LocalId(i));
+    ASSERT_EQ(_solver->value(ts, outputVar), computeOutput(ts));
+
+    if (iteration % 2 == 0) {
+      // Only commit every other move:
+      continue;
+    }
+    const Int notifiedViolation = _solver->value(ts, outputVar);
+    _solver->commitIf(ts, VarId(inputVars.at(i)));
+    _solver->commitIf(ts, VarId(outputVar));
+    invariant.commit(ts);
+    invariant.recompute(ts + 1);
+    ASSERT_EQ(notifiedViolation, _solver->value(ts + 1, outputVar));
+    ++ts;
+  }
+}
+
 RC_GTEST_FIXTURE_PROP(GlobalCardinalityLowUpTest, RapidCheck, ()) {
   numInputVars = *rc::gen::inRange(1, 100);
 
@@ -0,0 +1,351 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <rapidcheck/gtest.h>
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+#include "../invariantTestHelper.hpp"
+#include "atlantis/propagation/violationInvariants/inverse.hpp"
+
+namespace atlantis::testing {
+
+using namespace atlantis::propagation;
+
+class InverseTest : public InvariantTest {
+ public:
+  size_t numInputVars{3};
+  Int fOffset{1};
+  Int invfOffset{0};
+
+  // f followed by invf:
+  std::vector<VarViewId> inputVars;
+  std::uniform_int_distribution<Int> fDist;
+  std::uniform_int_distribution<Int> invfDist;
+  VarViewId outputVar{NULL_ID};
+
+  Int computeOutput(bool committedValue = false) {
+    std::vector<Int> values(inputVars.size(), 0);
+    for (size_t i = 0; i < inputVars.size(); ++i) {
+      values.at(i) = committedValue ? _solver->committedValue(inputVars.at(i))
+                                    : _solver->currentValue(inputVars.at(i));
+    }
+    return computeOutput(values);
+  }
+
+  Int computeOutput(Timestamp ts) {
+    std::vector<Int> values(inputVars.size(), 0);
+    for (size_t i = 0; i < inputVars.size(); ++i) {
+      values.at(i) = _solver->value(ts, inputVars.at(i));
+    }
+    return computeOutput(values);
+  }
+
+  Int computeOutput(const std::vector<Int>& values) const {
+    const Int n = static_cast<Int>(numInputVars);
+    Int violation = 0;
+    for (Int i = 0; i < n; ++i) {
+      // f[i + fOffset] must be in the index set of invf:
+      const Int j = values.at(i);
+      if (j < invfOffset || invfOffset + n <= j) {
+        ++violation;
+        continue;
+      }
+      // invf[f[i + fOffset]] must be i + fOffset:
+      if (values.at(n + j - invfOffset) != i + fOffset) {
+        ++violation;
+      }
+    }
+    return violation;
+  }
+
+  Inverse& generate() {
+    const Int n = static_cast<Int>(numInputVars);
+    // Include one value outside the index set on either side:
+    fDist = std::uniform_int_distribution<Int>(invfOffset - 1, invfOffset + n);
+    invfDist = std::uniform_int_distribution<Int>(fOffset - 1, fOffset + n);
+    inputVars.clear();
+
+    if (!_solver->isOpen()) {
+      _solver->open();
+    }
+
+    std::vector<VarViewId> f;
+    std::vector<VarViewId> invf;
+    for (size_t i = 0; i < numInputVars; ++i) {
+      f.emplace_back(_solver->makeIntVar(fDist(gen), fDist.min(), fDist.max()));
+    }
+    for (size_t j = 0; j < numInputVars; ++j) {
+      invf.emplace_back(
+          _solver->makeIntVar(invfDist(gen), invfDist.min(), invfDist.max()));
+    }
+    inputVars = f;
+    inputVars.insert(inputVars.end(), invf.begin(), invf.end());
+
+    outputVar = _solver->makeIntVar(0, 0, 0);
+    Inverse& invariant = _solver->makeInvariant<Inverse>(
+        *_solver, outputVar, std::move(f), fOffset, std::move(invf),
+        invfOffset);
+    _solver->close();
+    return invariant;
+  }
+
+  Int randomValue(size_t index) {
+    return index < numInputVars ? fDist(gen) : invfDist(gen);
+  }
+};
+
+TEST_F(InverseTest, UpdateBounds) {
+  for (const size_t n : {size_t{1}, size_t{2}}) {
+    numInputVars = n;
+    auto& invariant = generate();
+    auto inputVals = makeValVector(inputVars);
+    while (increaseNextVal(inputVars, inputVals) >= 0) {
+      setVarVals(_solver->currentTimestamp(), inputVars, inputVals);
+      invariant.updateBounds(false);
+      invariant.recompute(_solver->currentTimestamp());
+      EXPECT_GE(_solver->currentValue(outputVar),
+                _solver->lowerBound(outputVar));
+      EXPECT_LE(_solver->currentValue(outputVar),
+                _solver->upperBound(outputVar));
+    }
+  }
+}
+
+TEST_F(InverseTest, Recompute) {
+  generateState = GenerateState::LB;
+  for (const size_t n : {size_t{1}, size_t{2}, size_t{3}}) {
+    numInputVars = n;
+    auto& invariant = generate();
+    auto inputVals = makeValVector(inputVars);
+    Timestamp ts = _solver->currentTimestamp();
+
+    while (increaseNextVal(inputVars, inputVals) >= 0) {
+      ++ts;
+      setVarVals(ts, inputVars, inputVals);
+      invariant.recompute(ts);
+      EXPECT_EQ(_solver->value(ts, outputVar), computeOutput(ts));
+    }
+  }
+}
+
+TEST_F(InverseTest, NotifyInputChanged) {
+  generateState = GenerateState::LB;
+  for (const size_t n : {size_t{1}, size_t{2}, size_t{3}}) {
+    numInputVars = n;
+    auto& invariant = generate();
+    auto inputVals = makeValVector(inputVars);
+    Timestamp ts = _solver->currentTimestamp();
+
+    while (increaseNextVal(inputVars, inputVals) >= 0) {
+      ++ts;
+      setVarVals(ts, inputVars, inputVals);
+      notifyInputsChanged(ts, invariant, inputVars);
+      EXPECT_EQ(_solver->value(ts, outputVar), computeOutput(ts));
+    }
+  }
+}
+
+TEST_F(InverseTest, NextInput) {
+  numInputVars = 50;
+  auto& invariant = generate();
+  expectNextInput(inputVars, invariant);
+}
+
+TEST_F(InverseTest, NotifyCurrentInputChanged) {
+  numInputVars = 20;
+  auto& invariant = generate();
+
+  for (Timestamp ts = _solver->currentTimestamp() + 1;
+       ts < _solver->currentTimestamp() + 4; ++ts) {
+    for (size_t i = 0; i < inputVars.size(); ++i) {
+      EXPECT_EQ(invariant.nextInput(ts), inputVars.at(i));
+      const Int oldVal = _solver->value(ts, inputVars.at(i));
+      do {
+        _solver->setValue(ts, inputVars.at(i), randomValue(i));
+      } while (_solver->value(ts, inputVars.at(i)) == oldVal);
+      invariant.notifyCurrentInputChanged(ts);
+      EXPECT_EQ(_solver->value(ts, outputVar), computeOutput(ts));
+    }
+  }
+}
+
+TEST_F(InverseTest, Commit) {
+  numInputVars = 20;
+  auto& invariant = generate();
+
+  std::vector<size_t> indices(inputVars.size());
+  std::iota(indices.begin(), indices.end(), 0);
+  std::shuffle(indices.begin(), indices.end(), rng);
+
+  std::vector<Int> committedValues(inputVars.size());
+  for (size_t i = 0; i < inputVars.size(); ++i) {
+    committedValues.at(i) = _solver->committedValue(inputVars.at(i));
+  }
+
+  EXPECT_EQ(_solver->currentValue(outputVar), computeOutput());
+
+  for (const size_t i : indices) {
+    Timestamp ts = _solver->currentTimestamp() + Timestamp(i);
+    for (size_t j = 0; j < inputVars.size(); ++j) {
+      // Check that we do not accidentally commit:
+      ASSERT_EQ(_solver->committedValue(inputVars.at(j)),
+                committedValues.at(j));
+    }
+
+    const Int oldVal = committedValues.at(i);
+    do {
+      _solver->setValue(ts, inputVars.at(i), randomValue(i));
+    } while (oldVal == _solver->value(ts, inputVars.at(i)));
+
+    // notify changes
+    invariant.notifyInputChanged(ts, LocalId(i));
+
+    // incremental value
+    const Int notifiedViolation = _solver->value(ts, outputVar);
+    invariant.recompute(ts);
+
+    ASSERT_EQ(notifiedViolation, _solver->value(ts, outputVar));
+
+    _solver->commitIf(ts, VarId(inputVars.at(i)));
+    committedValues.at(i) = _solver->value(ts, VarId(inputVars.at(i)));
+    _solver->commitIf(ts, VarId(outputVar));
+
+    invariant.commit(ts);
+    invariant.recompute(ts + 1);
+    ASSERT_EQ(notifiedViolation, _solver->value(ts + 1, outputVar));
+  }
+}
+
+TEST_F(InverseTest, CommitWithoutRecompute) {
+  numInputVars = 20;
+  auto& invariant = generate();
+  std::uniform_int_distribution<size_t> indexDist(0, inputVars.size() - 1);
+  std::uniform_int_distribution<size_t> numChangesDist(1, 4);
+
+  const Timestamp start = _solver->currentTimestamp() + 1;
+  for (Timestamp ts = start; ts < start + 100; ++ts) {
+    // Every change is notified incrementally from the values committed at the
+    // previous timestamp, and a variable can change more than once:
+    const size_t numChanges = numChangesDist(gen);
+    std::vector<size_t> changed;
+    for (size_t c = 0; c < numChanges; ++c) {
+      const size_t i = indexDist(gen);
+      _solver->setValue(ts, inputVars.at(i), randomValue(i));
+      invariant.notifyInputChanged(ts, LocalId(i));
+      ASSERT_EQ(_solver->value(ts, outputVar), computeOutput(ts));
+      changed.emplace_back(i);
+    }
+
+    for (const size_t i : changed) {
+      _solver->commitIf(ts, VarId(inputVars.at(i)));
+    }
+    _solver->commitIf(ts, VarId(outputVar));
+    invariant.commit(ts);
+    ASSERT_EQ(_solver->committedValue(outputVar), computeOutput(true));
+  }
+}
+
+RC_GTEST_FIXTURE_PROP(InverseTest, RapidCheck, ()) {
+  numInputVars = *rc::gen::inRange<size_t>(1, 20);
+  fOffset = *rc::gen::inRange<Int>(-5, 5);
+  invfOffset = *rc::gen::inRange<Int>(-5, 5);
+
+  generate();
+
+  const size_t numCommits = 3;
+  const size_t numProbes = 3;
+
+  for (size_t c = 0; c < numCommits; ++c) {
+    RC_ASSERT(_solver->committedValue(outputVar) == computeOutput(true));
+
+    for (size_t p = 0; p <= numProbes; ++p) {
+      _solver->beginMove();
+      for (size_t i = 0; i < inputVars.size(); ++i) {
+        if (randBool()) {
+          _solver->setValue(inputVars.at(i), randomValue(i));
+        }
+      }
+      _solver->endMove();
+
+      if (p == numProbes) {
+        _solver->beginCommit();
+      } else {
+        _solver->beginProbe();
+      }
+      _solver->query(outputVar);
+      if (p == numProbes) {
+        _solver->endCommit();
+      } else {
+        _solver->endProbe();
+      }
+      RC_ASSERT(_solver->currentValue(outputVar) == computeOutput());
+    }
+    RC_ASSERT(_solver->committedValue(outputVar) == computeOutput(true));
+  }
+}
+
+class MockInverse : public Inverse {
+ public:
+  bool registered = false;
+  void registerVars() override {
+    registered = true;
+    Inverse::registerVars();
+  }
+  explicit MockInverse(SolverBase& solver, VarViewId outputVar,
+                       std::vector<VarViewId>&& f,
+                       std::vector<VarViewId>&& invf)
+      : Inverse(solver, outputVar, std::move(f), 1, std::move(invf), 1) {
+    EXPECT_TRUE(outputVar.isVar());
+
+    ON_CALL(*this, recompute).WillByDefault([this](Timestamp timestamp) {
+      return Inverse::recompute(timestamp);
+    });
+    ON_CALL(*this, nextInput).WillByDefault([this](Timestamp timestamp) {
+      return Inverse::nextInput(timestamp);
+    });
+    ON_CALL(*this, notifyCurrentInputChanged)
+        .WillByDefault([this](Timestamp timestamp) {
+          Inverse::notifyCurrentInputChanged(timestamp);
+        });
+    ON_CALL(*this, notifyInputChanged)
+        .WillByDefault([this](Timestamp timestamp, LocalId localId) {
+          Inverse::notifyInputChanged(timestamp, localId);
+        });
+    ON_CALL(*this, commit).WillByDefault([this](Timestamp timestamp) {
+      Inverse::commit(timestamp);
+    });
+  }
+  MOCK_METHOD(void, recompute, (Timestamp), (override));
+  MOCK_METHOD(VarViewId, nextInput, (Timestamp), (override));
+  MOCK_METHOD(void, notifyCurrentInputChanged, (Timestamp), (override));
+  MOCK_METHOD(void, notifyInputChanged, (Timestamp, LocalId), (override));
+  MOCK_METHOD(void, commit, (Timestamp), (override));
+};
+
+TEST_F(InverseTest, SolverIntegration) {
+  for (const auto& [propMode, markingMode] : propMarkModes) {
+    if (!_solver->isOpen()) {
+      _solver->open();
+    }
+    std::vector<VarViewId> f;
+    std::vector<VarViewId> invf;
+    const size_t numArgs = 5;
+    const Int n = static_cast<Int>(numArgs);
+    for (size_t i = 0; i < numArgs; ++i) {
+      f.push_back(_solver->makeIntVar(n, 1, n));
+      invf.push_back(_solver->makeIntVar(n, 1, n));
+    }
+
+    const VarViewId viol = _solver->makeIntVar(0, 0, n);
+    const VarViewId modifiedVarId = f.front();
+
+    testNotifications<MockInverse>(
+        &_solver->makeInvariant<MockInverse>(*_solver, viol, std::move(f),
+                                             std::move(invf)),
+        {propMode, markingMode, 2 * numArgs + 1, modifiedVarId, 1, viol});
+  }
+}
+
+}  // namespace atlantis::testing
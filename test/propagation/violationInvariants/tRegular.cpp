@@ -0,0 +1,366 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <rapidcheck/gtest.h>
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+#include "../invariantTestHelper.hpp"
+#include "atlantis/propagation/violationInvariants/regular.hpp"
+
+namespace atlantis::testing {
+
+using namespace atlantis::propagation;
+
+class RegularTest : public InvariantTest {
+ public:
+  size_t numInputVars{4};
+  Int numStates{4};
+  Int numSymbols{3};
+
+  std::vector<VarViewId> inputVars;
+  std::vector<Int> transitions;
+  Int initialState{1};
+  std::vector<Int> acceptingStates;
+  std::uniform_int_distribution<Int> inputVarDist;
+  VarViewId outputVar{NULL_ID};
+
+  Int computeOutput(bool committedValue = false) {
+    std::vector<Int> values(inputVars.size(), 0);
+    for (size_t i = 0; i < inputVars.size(); ++i) {
+      values.at(i) = committedValue ? _solver->committedValue(inputVars.at(i))
+                                    : _solver->currentValue(inputVars.at(i));
+    }
+    return computeOutput(values);
+  }
+
+  Int computeOutput(Timestamp ts) {
+    std::vector<Int> values(inputVars.size(), 0);
+    for (size_t i = 0; i < inputVars.size(); ++i) {
+      values.at(i) = _solver->value(ts, inputVars.at(i));
+    }
+    return computeOutput(values);
+  }
+
+  Int computeOutput(const std::vector<Int>& values) const {
+    // changes[q] is the minimum number of changes to reach q (where 0 is the
+    // failure state):
+    const Int unreachable = std::numeric_limits<Int>::max();
+    std::vector<Int> changes(static_cast<size_t>(numStates) + 1, unreachable);
+    if (1 <= initialState && initialState <= numStates) {
+      changes.at(static_cast<size_t>(initialState)) = 0;
+    }
+    for (const Int value : values) {
+      std::vector<Int> next(changes.size(), unreachable);
+      for (Int q = 1; q <= numStates; ++q) {
+        if (changes.at(static_cast<size_t>(q)) == unreachable) {
+          continue;
+        }
+        for (Int s = 1; s <= numSymbols; ++s) {
+          const auto r = static_cast<size_t>(transitions.at(
+              static_cast<size_t>((q - 1) * numSymbols + s - 1)));
+          next.at(r) = std::min(
+              next.at(r), changes.at(static_cast<size_t>(q)) + (s != value));
+        }
+      }
+      changes = std::move(next);
+    }
+    Int violation = unreachable;
+    for (const Int q : acceptingStates) {
+      violation = std::min(violation, changes.at(static_cast<size_t>(q)));
+    }
+    return violation == unreachable
+               ? std::max<Int>(1, static_cast<Int>(values.size()))
+               : violation;
+  }
+
+  Regular& generate() {
+    inputVarDist = std::uniform_int_distribution<Int>(0, numSymbols + 1);
+    std::uniform_int_distribution<Int> stateDist(0, numStates);
+    inputVars.clear();
+    transitions.clear();
+    acceptingStates.clear();
+
+    if (!_solver->isOpen()) {
+      _solver->open();
+    }
+
+    for (size_t i = 0; i < numInputVars; ++i) {
+      inputVars.emplace_back(_solver->makeIntVar(
+          inputVarDist(gen), inputVarDist.min(), inputVarDist.max()));
+    }
+    // Make the failure state less likely:
+    for (Int i = 0; i < numStates * numSymbols; ++i) {
+      const Int q = stateDist(gen);
+      transitions.emplace_back(q == 0 ? stateDist(gen) : q);
+    }
+    initialState = std::max<Int>(1, stateDist(gen));
+    for (Int q = 1; q <= numStates; ++q) {
+      if (randBool()) {
+        acceptingStates.emplace_back(q);
+      }
+    }
+
+    outputVar = _solver->makeIntVar(0, 0, 0);
+    Regular& invariant = _solver->makeInvariant<Regular>(
+        *_solver, outputVar, std::vector<VarViewId>(inputVars), numStates,
+        numSymbols, std::vector<Int>(transitions), initialState,
+        acceptingStates);
+    _solver->close();
+    return invariant;
+  }
+};
+
+TEST_F(RegularTest, UpdateBounds) {
+  for (const size_t n : {size_t{0}, size_t{1}, size_t{4}}) {
+    numInputVars = n;
+    auto& invariant = generate();
+    auto inputVals = makeValVector(inputVars);
+    while (increaseNextVal(inputVars, inputVals) >= 0) {
+      setVarVals(_solver->currentTimestamp(), inputVars, inputVals);
+      invariant.updateBounds(false);
+      invariant.recompute(_solver->currentTimestamp());
+      EXPECT_GE(_solver->currentValue(outputVar),
+                _solver->lowerBound(outputVar));
+      EXPECT_LE(_solver->currentValue(outputVar),
+                _solver->upperBound(outputVar));
+    }
+  }
+}
+
+TEST_F(RegularTest, Recompute) {
+  generateState = GenerateState::LB;
+  for (const size_t n : {size_t{0}, size_t{1}, size_t{5}}) {
+    numInputVars = n;
+    auto& invariant = generate();
+    auto inputVals = makeValVector(inputVars);
+    Timestamp ts = _solver->currentTimestamp();
+
+    while (increaseNextVal(inputVars, inputVals) >= 0) {
+      ++ts;
+      setVarVals(ts, inputVars, inputVals);
+      invariant.recompute(ts);
+      EXPECT_EQ(_solver->value(ts, outputVar), computeOutput(ts));
+    }
+  }
+}
+
+TEST_F(RegularTest, NotifyInputChanged) {
+  generateState = GenerateState::LB;
+  for (const size_t n : {size_t{0}, size_t{1}, size_t{5}}) {
+    numInputVars = n;
+    auto& invariant = generate();
+    auto inputVals = makeValVector(inputVars);
+    Timestamp ts = _solver->currentTimestamp();
+
+    while (increaseNextVal(inputVars, inputVals) >= 0) {
+      ++ts;
+      setVarVals(ts, inputVars, inputVals);
+      notifyInputsChanged(ts, invariant, inputVars);
+      EXPECT_EQ(_solver->value(ts, outputVar), computeOutput(ts));
+    }
+  }
+}
+
+TEST_F(RegularTest, NextInput) {
+  numInputVars = 100;
+  auto& invariant = generate();
+  expectNextInput(inputVars, invariant);
+}
+
+TEST_F(RegularTest, NotifyCurrentInputChanged) {
+  numInputVars = 30;
+  auto& invariant = generate();
+
+  for (Timestamp ts = _solver->currentTimestamp() + 1;
+       ts < _solver->currentTimestamp() + 4; ++ts) {
+    for (const VarViewId& varId : inputVars) {
+      EXPECT_EQ(invariant.nextInput(ts), varId);
+      const Int oldVal = _solver->value(ts, varId);
+      do {
+        _solver->setValue(ts, varId, inputVarDist(gen));
+      } while (_solver->value(ts, varId) == oldVal);
+      invariant.notifyCurrentInputChanged(ts);
+      EXPECT_EQ(_solver->value(ts, outputVar), computeOutput(ts));
+    }
+  }
+}
+
+TEST_F(RegularTest, Commit) {
+  numInputVars = 30;
+  auto& invariant = generate();
+
+  std::vector<size_t> indices(numInputVars);
+  std::iota(indices.begin(), indices.end(), 0);
+  std::shuffle(indices.begin(), indices.end(), rng);
+
+  std::vector<Int> committedValues(numInputVars);
+  for (size_t i = 0; i < numInputVars; ++i) {
+    committedValues.at(i) = _solver->committedValue(inputVars.at(i));
+  }
+
+  EXPECT_EQ(_solver->currentValue(outputVar), computeOutput());
+
+  for (const size_t i : indices) {
+    Timestamp ts = _solver->currentTimestamp() + Timestamp(i);
+    for (size_t j = 0; j < numInputVars; ++j) {
+      // Check that we do not accidentally commit:
+      ASSERT_EQ(_solver->committedValue(inputVars.at(j)),
+                committedValues.at(j));
+    }
+
+    const Int oldVal = committedValues.at(i);
+    do {
+      _solver->setValue(ts, inputVars.at(i), inputVarDist(gen));
+    } while (oldVal == _solver->value(ts, inputVars.at(i)));
+
+    // notify changes
+    invariant.notifyInputChanged(ts, LocalId(i));
+
+    // incremental value
+    const Int notifiedViolation = _solver->value(ts, outputVar);
+    ASSERT_EQ(notifiedViolation, computeOutput(ts));
+    invariant.recompute(ts);
+
+    ASSERT_EQ(notifiedViolation, _solver->value(ts, outputVar));
+
+    _solver->commitIf(ts, VarId(inputVars.at(i)));
+    committedValues.at(i) = _solver->value(ts, VarId(inputVars.at(i)));
+    _solver->commitIf(ts, VarId(outputVar));
+
+    invariant.commit(ts);
+    invariant.recompute(ts + 1);
+    ASSERT_EQ(notifiedViolation, _solver->value(ts + 1, outputVar));
+  }
+}
+
+TEST_F(RegularTest, ProbeAfterCommit) {
+  numInputVars = 20;
+  auto& invariant = generate();
+  std::uniform_int_distribution<size_t> indexDist(0, numInputVars - 1);
+  Timestamp ts = _solver->currentTimestamp();
+
+  for (size_t c = 0; c < 200; ++c) {
+    // Commit a change to a random variable:
+    const size_t i = indexDist(gen);
+    ++ts;
+    _solver->setValue(ts, inputVars.at(i), inputVarDist(gen));
+    invariant.notifyInputChanged(ts, LocalId(i));
+    _solver->commitIf(ts, VarId(inputVars.at(i)));
+    _solver->commitIf(ts, VarId(outputVar));
+    invariant.commit(ts);
+
+    // Probe every value of every variable:
+    for (size_t j = 0; j < numInputVars; ++j) {
+      for (Int value = inputVarDist.min(); value <= inputVarDist.max();
+           ++value) {
+        ++ts;
+        _solver->setValue(ts, inputVars.at(j), value);
+        invariant.notifyInputChanged(ts, LocalId(j));
+        ASSERT_EQ(_solver->value(ts, outputVar), computeOutput(ts));
+      }
+    }
+  }
+}
+
+RC_GTEST_FIXTURE_PROP(RegularTest, RapidCheck, ()) {
+  numInputVars = *rc::gen::inRange<size_t>(0, 40);
+  numStates = *rc::gen::inRange<Int>(1, 8);
+  numSymbols = *rc::gen::inRange<Int>(1, 5);
+
+  generate();
+
+  const size_t numCommits = 3;
+  const size_t numProbes = 3;
+
+  for (size_t c = 0; c < numCommits; ++c) {
+    RC_ASSERT(_solver->committedValue(outputVar) == computeOutput(true));
+
+    for (size_t p = 0; p <= numProbes; ++p) {
+      _solver->beginMove();
+      // Change a few variables, like a local search move:
+      for (const VarViewId& varId : inputVars) {
+        if (randBool() && randBool()) {
+          _solver->setValue(varId, inputVarDist(gen));
+        }
+      }
+      _solver->endMove();
+
+      if (p == numProbes) {
+        _solver->beginCommit();
+      } else {
+        _solver->beginProbe();
+      }
+      _solver->query(outputVar);
+      if (p == numProbes) {
+        _solver->endCommit();
+      } else {
+        _solver->endProbe();
+      }
+      RC_ASSERT(_solver->currentValue(outputVar) == computeOutput());
+    }
+    RC_ASSERT(_solver->committedValue(outputVar) == computeOutput(true));
+  }
+}
+
+class MockRegular : public Regular {
+ public:
+  bool registered = false;
+  void registerVars() override {
+    registered = true;
+    Regular::registerVars();
+  }
+  explicit MockRegular(SolverBase& solver, VarViewId outputVar,
+                       std::vector<VarViewId>&& inputVars)
+      : Regular(solver, outputVar, std::move(inputVars), 2, 2,
+                std::vector<Int>{2, 1, 2, 0}, 1, std::vector<Int>{2}) {
+    EXPECT_TRUE(outputVar.isVar());
+
+    ON_CALL(*this, recompute).WillByDefault([this](Timestamp timestamp) {
+      return Regular::recompute(timestamp);
+    });
+    ON_CALL(*this, nextInput).WillByDefault([this](Timestamp timestamp) {
+      return Regular::nextInput(timestamp);
+    });
+    ON_CALL(*this, notifyCurrentInputChanged)
+        .WillByDefault([this](Timestamp timestamp) {
+          Regular::notifyCurrentInputChanged(timestamp);
+        });
+    ON_CALL(*this, notifyInputChanged)
+        .WillByDefault([this](Timestamp timestamp, LocalId localId) {
+          Regular::notifyInputChanged(timestamp, localId);
+        });
+    ON_CALL(*this, commit).WillByDefault([this](Timestamp timestamp) {
+      Regular::commit(timestamp);
+    });
+  }
+  MOCK_METHOD(void, recompute, (Timestamp), (override));
+  MOCK_METHOD(VarViewId, nextInput, (Timestamp), (override));
+  MOCK_METHOD(void, notifyCurrentInputChanged, (Timestamp), (override));
+  MOCK_METHOD(void, notifyInputChanged, (Timestamp, LocalId), (override));
+  MOCK_METHOD(void, commit, (Timestamp), (override));
+};
+
+TEST_F(RegularTest, SolverIntegration) {
+  for (const auto& [propMode, markingMode] : propMarkModes) {
+    if (!_solver->isOpen()) {
+      _solver->open();
+    }
+    std::vector<VarViewId> args;
+    const size_t numArgs = 10;
+    for (size_t value = 0; value < numArgs; ++value) {
+      args.push_back(_solver->makeIntVar(2, 1, 2));
+    }
+
+    const VarViewId viol = _solver->makeIntVar(0, 0, static_cast<Int>(numArgs));
+    const VarViewId modifiedVarId = args.front();
+
+    testNotifications<MockRegular>(
+        &_solver->makeInvariant<MockRegular>(*_solver, viol, std::move(args)),
+        {propMode, markingMode, numArgs + 1, modifiedVarId, 1, viol});
+  }
+}
+
+}  // namespace atlantis::testing
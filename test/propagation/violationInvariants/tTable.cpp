@@ -0,0 +1,342 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <rapidcheck/gtest.h>
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+#include "../invariantTestHelper.hpp"
+#include "atlantis/propagation/violationInvariants/table.hpp"
+
+namespace atlantis::testing {
+
+using namespace atlantis::propagation;
+
+class TableTest : public InvariantTest {
+ public:
+  size_t numInputVars{3};
+  size_t numTuples{10};
+
+  Int inputVarLb{-2};
+  Int inputVarUb{2};
+  Int tableLb{-3};
+  Int tableUb{3};
+
+  std::vector<VarViewId> inputVars;
+  std::vector<Int> table;
+  std::uniform_int_distribution<Int> inputVarDist;
+  VarViewId outputVar{NULL_ID};
+
+  Int computeOutput(bool committedValue = false) {
+    std::vector<Int> values(inputVars.size(), 0);
+    for (size_t i = 0; i < inputVars.size(); ++i) {
+      values.at(i) = committedValue ? _solver->committedValue(inputVars.at(i))
+                                    : _solver->currentValue(inputVars.at(i));
+    }
+    return computeOutput(values);
+  }
+
+  Int computeOutput(Timestamp ts) {
+    std::vector<Int> values(inputVars.size(), 0);
+    for (size_t i = 0; i < inputVars.size(); ++i) {
+      values.at(i) = _solver->value(ts, inputVars.at(i));
+    }
+    return computeOutput(values);
+  }
+
+  Int computeOutput(const std::vector<Int>& values) const {
+    const size_t arity = values.size();
+    Int minDistance = std::max<Int>(1, static_cast<Int>(arity));
+    for (size_t t = 0; t < numTuples; ++t) {
+      Int distance = 0;
+      for (size_t i = 0; i < arity; ++i) {
+        if (table.at(t * arity + i) != values.at(i)) {
+          ++distance;
+        }
+      }
+      minDistance = std::min(minDistance, distance);
+    }
+    return minDistance;
+  }
+
+  Table& generate() {
+    inputVarDist = std::uniform_int_distribution<Int>(inputVarLb, inputVarUb);
+    std::uniform_int_distribution<Int> tableDist(tableLb, tableUb);
+    inputVars.clear();
+    table.clear();
+
+    if (!_solver->isOpen()) {
+      _solver->open();
+    }
+
+    for (size_t i = 0; i < numInputVars; ++i) {
+      inputVars.emplace_back(
+          _solver->makeIntVar(inputVarDist(gen), inputVarLb, inputVarUb));
+    }
+    for (size_t i = 0; i < numTuples * numInputVars; ++i) {
+      table.emplace_back(tableDist(gen));
+    }
+
+    outputVar = _solver->makeIntVar(0, 0, 0);
+    Table& invariant = _solver->makeInvariant<Table>(
+        *_solver, outputVar, std::vector<VarViewId>(inputVars),
+        std::vector<Int>(table));
+    _solver->close();
+    return invariant;
+  }
+};
+
+TEST_F(TableTest, UpdateBounds) {
+  for (const size_t n : {size_t{0}, size_t{1}, size_t{10}}) {
+    numTuples = n;
+    auto& invariant = generate();
+    auto inputVals = makeValVector(inputVars);
+    while (increaseNextVal(inputVars, inputVals) >= 0) {
+      setVarVals(_solver->currentTimestamp(), inputVars, inputVals);
+      invariant.updateBounds(false);
+      invariant.recompute(_solver->currentTimestamp());
+      EXPECT_GE(_solver->currentValue(outputVar),
+                _solver->lowerBound(outputVar));
+      EXPECT_LE(_solver->currentValue(outputVar),
+                _solver->upperBound(outputVar));
+    }
+  }
+}
+
+TEST_F(TableTest, Recompute) {
+  generateState = GenerateState::LB;
+  for (const size_t n : {size_t{0}, size_t{1}, size_t{20}}) {
+    numTuples = n;
+    auto& invariant = generate();
+    auto inputVals = makeValVector(inputVars);
+    Timestamp ts = _solver->currentTimestamp();
+
+    while (increaseNextVal(inputVars, inputVals) >= 0) {
+      ++ts;
+      setVarVals(ts, inputVars, inputVals);
+      invariant.recompute(ts);
+      EXPECT_EQ(_solver->value(ts, outputVar), computeOutput(ts));
+    }
+  }
+}
+
+TEST_F(TableTest, NotifyInputChanged) {
+  generateState = GenerateState::LB;
+  for (const size_t n : {size_t{0}, size_t{1}, size_t{20}}) {
+    numTuples = n;
+    auto& invariant = generate();
+    auto inputVals = makeValVector(inputVars);
+    Timestamp ts = _solver->currentTimestamp();
+
+    while (increaseNextVal(inputVars, inputVals) >= 0) {
+      ++ts;
+      setVarVals(ts, inputVars, inputVals);
+      notifyInputsChanged(ts, invariant, inputVars);
+      EXPECT_EQ(_solver->value(ts, outputVar), computeOutput(ts));
+    }
+  }
+}
+
+TEST_F(TableTest, NextInput) {
+  numInputVars = 100;
+  auto& invariant = generate();
+  expectNextInput(inputVars, invariant);
+}
+
+TEST_F(TableTest, NotifyCurrentInputChanged) {
+  numInputVars = 20;
+  numTuples = 100;
+  auto& invariant = generate();
+
+  for (Timestamp ts = _solver->currentTimestamp() + 1;
+       ts < _solver->currentTimestamp() + 4; ++ts) {
+    for (const VarViewId& varId : inputVars) {
+      EXPECT_EQ(invariant.nextInput(ts), varId);
+      const Int oldVal = _solver->value(ts, varId);
+      do {
+        _solver->setValue(ts, varId, inputVarDist(gen));
+      } while (_solver->value(ts, varId) == oldVal);
+      invariant.notifyCurrentInputChanged(ts);
+      EXPECT_EQ(_solver->value(ts, outputVar), computeOutput(ts));
+    }
+  }
+}
+
+TEST_F(TableTest, Commit) {
+  numInputVars = 20;
+  numTuples = 100;
+  auto& invariant = generate();
+
+  std::vector<size_t> indices(numInputVars);
+  std::iota(indices.begin(), indices.end(), 0);
+  std::shuffle(indices.begin(), indices.end(), rng);
+
+  std::vector<Int> committedValues(numInputVars);
+  for (size_t i = 0; i < numInputVars; ++i) {
+    committedValues.at(i) = _solver->committedValue(inputVars.at(i));
+  }
+
+  EXPECT_EQ(_solver->currentValue(outputVar), computeOutput());
+
+  for (const size_t i : indices) {
+    Timestamp ts = _solver->currentTimestamp() + Timestamp(i);
+    for (size_t j = 0; j < numInputVars; ++j) {
+      // Check that we do not accidentally commit:
+      ASSERT_EQ(_solver->committedValue(inputVars.at(j)),
+                committedValues.at(j));
+    }
+
+    const Int oldVal = committedValues.at(i);
+    do {
+      _solver->setValue(ts, inputVars.at(i), inputVarDist(gen));
+    } while (oldVal == _solver->value(ts, inputVars.at(i)));
+
+    // notify changes
+    invariant.notifyInputChanged(ts, LocalId(i));
+
+    // incremental value
+    const Int notifiedViolation = _solver->value(ts, outputVar);
+    invariant.recompute(ts);
+
+    ASSERT_EQ(notifiedViolation, _solver->value(ts, outputVar));
+
+    _solver->commitIf(ts, VarId(inputVars.at(i)));
+    committedValues.at(i) = _solver->value(ts, VarId(inputVars.at(i)));
+    _solver->commitIf(ts, VarId(outputVar));
+
+    invariant.commit(ts);
+    invariant.recompute(ts + 1);
+    ASSERT_EQ(notifiedViolation, _solver->value(ts + 1, outputVar));
+  }
+}
+
+TEST_F(TableTest, CommitWithoutRecompute) {
+  numInputVars = 5;
+  numTuples = 100;
+  auto& invariant = generate();
+  std::uniform_int_distribution<size_t> varDist(0, numInputVars - 1);
+
+  const Timestamp start = _solver->currentTimestamp() + 1;
+  for (Timestamp ts = start; ts < start + 100; ++ts) {
+    const size_t i = varDist(gen);
+    // Every change is notified incrementally from the distances committed at
+    // the previous timestamp. Every other variable changes twice:
+    const size_t numChanges = ts % 2 == 0 ? 1 : 2;
+    for (size_t c = 0; c < numChanges; ++c) {
+      _solver->setValue(ts, inputVars.at(i), inputVarDist(gen));
+      invariant.notifyInputChanged(ts, LocalId(i));
+      ASSERT_EQ(_solver->value(ts, outputVar), computeOutput(ts));
+    }
+
+    _solver->commitIf(ts, VarId(inputVars.at(i)));
+    _solver->commitIf(ts, VarId(outputVar));
+    invariant.commit(ts);
+    ASSERT_EQ(_solver->committedValue(outputVar), computeOutput(true));
+  }
+}
+
+RC_GTEST_FIXTURE_PROP(TableTest, RapidCheck, ()) {
+  numInputVars = *rc::gen::inRange<size_t>(1, 20);
+  numTuples = *rc::gen::inRange<size_t>(0, 200);
+  inputVarLb = *rc::gen::inRange<Int>(-10, 10);
+  inputVarUb = inputVarLb + *rc::gen::inRange<Int>(0, 10);
+  tableLb = inputVarLb - *rc::gen::inRange<Int>(0, 3);
+  tableUb = inputVarUb + *rc::gen::inRange<Int>(0, 3);
+
+  generate();
+
+  const size_t numCommits = 3;
+  const size_t numProbes = 3;
+
+  for (size_t c = 0; c < numCommits; ++c) {
+    RC_ASSERT(_solver->committedValue(outputVar) == computeOutput(true));
+
+    for (size_t p = 0; p <= numProbes; ++p) {
+      _solver->beginMove();
+      for (const VarViewId& varId : inputVars) {
+        if (randBool()) {
+          _solver->setValue(varId, inputVarDist(gen));
+        }
+      }
+      _solver->endMove();
+
+      if (p == numProbes) {
+        _solver->beginCommit();
+      } else {
+        _solver->beginProbe();
+      }
+      _solver->query(outputVar);
+      if (p == numProbes) {
+        _solver->endCommit();
+      } else {
+        _solver->endProbe();
+      }
+      RC_ASSERT(_solver->currentValue(outputVar) == computeOutput());
+    }
+    RC_ASSERT(_solver->committedValue(outputVar) == computeOutput(true));
+  }
+}
+
+class MockTable : public Table {
+ public:
+  bool registered = false;
+  void registerVars() override {
+    registered = true;
+    Table::registerVars();
+  }
+  explicit MockTable(SolverBase& solver, VarViewId outputVar,
+                     std::vector<VarViewId>&& inputVars,
+                     std::vector<Int>&& table)
+      : Table(solver, outputVar, std::move(inputVars), std::move(table)) {
+    EXPECT_TRUE(outputVar.isVar());
+
+    ON_CALL(*this, recompute).WillByDefault([this](Timestamp timestamp) {
+      return Table::recompute(timestamp);
+    });
+    ON_CALL(*this, nextInput).WillByDefault([this](Timestamp timestamp) {
+      return Table::nextInput(timestamp);
+    });
+    ON_CALL(*this, notifyCurrentInputChanged)
+        .WillByDefault([this](Timestamp timestamp) {
+          Table::notifyCurrentInputChanged(timestamp);
+        });
+    ON_CALL(*this, notifyInputChanged)
+        .WillByDefault([this](Timestamp timestamp, LocalId localId) {
+          Table::notifyInputChanged(timestamp, localId);
+        });
+    ON_CALL(*this, commit).WillByDefault([this](Timestamp timestamp) {
+      Table::commit(timestamp);
+    });
+  }
+  MOCK_METHOD(void, recompute, (Timestamp), (override));
+  MOCK_METHOD(VarViewId, nextInput, (Timestamp), (override));
+  MOCK_METHOD(void, notifyCurrentInputChanged, (Timestamp), (override));
+  MOCK_METHOD(void, notifyInputChanged, (Timestamp, LocalId), (override));
+  MOCK_METHOD(void, commit, (Timestamp), (override));
+};
+
+TEST_F(TableTest, SolverIntegration) {
+  for (const auto& [propMode, markingMode] : propMarkModes) {
+    if (!_solver->isOpen()) {
+      _solver->open();
+    }
+    std::vector<VarViewId> args;
+    const size_t numArgs = 10;
+    for (size_t value = 0; value < numArgs; ++value) {
+      args.push_back(_solver->makeIntVar(0, -10, 10));
+    }
+    std::vector<Int> tuples(3 * numArgs);
+    std::iota(tuples.begin(), tuples.end(), -10);
+
+    const VarViewId viol = _solver->makeIntVar(0, 0, static_cast<Int>(numArgs));
+    const VarViewId modifiedVarId = args.front();
+
+    testNotifications<MockTable>(
+        &_solver->makeInvariant<MockTable>(*_solver, viol, std::move(args),
+                                           std::move(tuples)),
+        {propMode, markingMode, numArgs + 1, modifiedVarId, 1, viol});
+  }
+}
+
+}  // namespace atlantis::testing
@@ -0,0 +1,88 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "atlantis/search/annealing/roundLimit.hpp"
+
+namespace atlantis::testing {
+
+using namespace atlantis::search;
+
+using ::testing::Return;
+
+class DummyAnnealingSchedule : public AnnealingSchedule {
+ public:
+  MOCK_METHOD(void, start, (double initialTemperature), (override));
+  MOCK_METHOD(void, nextRound, (const RoundStatistics& initialTemperature),
+              (override));
+  MOCK_METHOD(double, temperature, (), (override));
+  MOCK_METHOD(bool, frozen, (), (override));
+};
+
+class RoundLimitTest : public ::testing::Test {
+ protected:
+  SharedSearchState sharedState{propagation::ObjectiveDirection::NONE};
+  double initialTemperature{0.5};
+};
+
+TEST_F(RoundLimitTest, nested_schedule_is_active) {
+  auto temperature = 1.0;
+
+  auto dummySchedule = std::make_unique<DummyAnnealingSchedule>();
+
+  EXPECT_CALL(*dummySchedule, start(initialTemperature)).Times(1);
+  EXPECT_CALL(*dummySchedule, temperature()).WillOnce(Return(temperature));
+  EXPECT_CALL(*dummySchedule, frozen()).WillOnce(Return(false));
+
+  RoundLimit schedule(std::move(dummySchedule), 2, sharedState);
+  schedule.start(initialTemperature);
+
+  EXPECT_EQ(schedule.temperature(), temperature);
+  EXPECT_FALSE(schedule.frozen());
+}
+
+TEST_F(RoundLimitTest, stops_the_search_after_the_last_round) {
+  auto dummySchedule = std::make_unique<DummyAnnealingSchedule>();
+
+  EXPECT_CALL(*dummySchedule, start(initialTemperature)).Times(1);
+  EXPECT_CALL(*dummySchedule, nextRound(::testing::_)).Times(3);
+  EXPECT_CALL(*dummySchedule, frozen()).WillRepeatedly(Return(false));
+
+  std::vector<UInt> rounds;
+  std::vector<UInt> attemptedMoves;
+  RoundLimit schedule(std::move(dummySchedule), 3, sharedState,
+                      [&](UInt round, const RoundStatistics& statistics) {
+                        rounds.emplace_back(round);
+                        attemptedMoves.emplace_back(statistics.attemptedMoves);
+                      });
+  schedule.start(initialTemperature);
+
+  for (UInt round = 0; round < 3; ++round) {
+    EXPECT_FALSE(schedule.frozen());
+    EXPECT_FALSE(sharedState.stopped());
+    RoundStatistics statistics{};
+    statistics.attemptedMoves = 10 * (round + 1);
+    schedule.nextRound(statistics);
+  }
+
+  EXPECT_TRUE(schedule.frozen());
+  EXPECT_TRUE(sharedState.stopped());
+  EXPECT_EQ(rounds, (std::vector<UInt>{0, 1, 2}));
+  EXPECT_EQ(attemptedMoves, (std::vector<UInt>{10, 20, 30}));
+}
+
+TEST_F(RoundLimitTest, frozen_if_the_nested_schedule_is_frozen) {
+  auto dummySchedule = std::make_unique<DummyAnnealingSchedule>();
+
+  EXPECT_CALL(*dummySchedule, start(initialTemperature)).Times(1);
+  EXPECT_CALL(*dummySchedule, frozen()).WillOnce(Return(true));
+
+  RoundLimit schedule(std::move(dummySchedule), 3, sharedState);
+  schedule.start(initialTemperature);
+
+  EXPECT_TRUE(schedule.frozen());
+  EXPECT_FALSE(sharedState.stopped());
+}
+
+}  // namespace atlantis::testing
@@ -58,7 +58,7 @@ class AllDifferentNonUniformNeighbourhoodTest : public ::testing::Test {
 
 TEST_F(AllDifferentNonUniformNeighbourhoodTest, Initialize) {
   search::neighbourhoods::AllDifferentNonUniformNeighbourhood neighbourhood(
-      std::vector<search::SearchVar>(_vars), domainLb, domainUb, *_solver);
+      std::vector<search::SearchVar>(_vars), domainLb, domainUb);
 
   std::vector<std::unordered_set<Int>> setDomains(_domains.size());
   for (size_t i = 0u; i < _vars.size(); ++i) {
@@ -85,7 +85,7 @@ TEST_F(AllDifferentNonUniformNeighbourhoodTest, Initialize) {
 
 TEST_F(AllDifferentNonUniformNeighbourhoodTest, CanSwap) {
   search::neighbourhoods::AllDifferentNonUniformNeighbourhood neighbourhood(
-      std::vector<search::SearchVar>(_vars), domainLb, domainUb, *_solver);
+      std::vector<search::SearchVar>(_vars), domainLb, domainUb);
 
   std::vector<std::unordered_set<Int>> setDomains(_domains.size());
   for (size_t i = 0u; i < _vars.size(); ++i) {
@@ -123,7 +123,7 @@ TEST_F(AllDifferentNonUniformNeighbourhoodTest, CanSwap) {
 
 TEST_F(AllDifferentNonUniformNeighbourhoodTest, Swap) {
   search::neighbourhoods::AllDifferentNonUniformNeighbourhood neighbourhood(
-      std::vector<search::SearchVar>(_vars), domainLb, domainUb, *_solver);
+      std::vector<search::SearchVar>(_vars), domainLb, domainUb);
 
   auto schedule = search::AnnealerContainer::cooling(0.99, 4);
   AlwaysAcceptingAnnealer annealer(*_assignment, _random, *schedule);
@@ -164,7 +164,7 @@ TEST_F(AllDifferentNonUniformNeighbourhoodTest, Swap) {
 
 TEST_F(AllDifferentNonUniformNeighbourhoodTest, AssignValue) {
   search::neighbourhoods::AllDifferentNonUniformNeighbourhood neighbourhood(
-      std::vector<search::SearchVar>(_vars), domainLb, domainUb, *_solver);
+      std::vector<search::SearchVar>(_vars), domainLb, domainUb);
 
   auto schedule = search::AnnealerContainer::cooling(0.99, 4);
   AlwaysAcceptingAnnealer annealer(*_assignment, _random, *schedule);
@@ -207,7 +207,7 @@ TEST_F(AllDifferentNonUniformNeighbourhoodTest, AssignValue) {
 
 TEST_F(AllDifferentNonUniformNeighbourhoodTest, RandomMove) {
   search::neighbourhoods::AllDifferentNonUniformNeighbourhood neighbourhood(
-      std::vector<search::SearchVar>(_vars), domainLb, domainUb, *_solver);
+      std::vector<search::SearchVar>(_vars), domainLb, domainUb);
 
   auto schedule = search::AnnealerContainer::cooling(0.99, 4);
   AlwaysAcceptingAnnealer annealer(*_assignment, _random, *schedule);
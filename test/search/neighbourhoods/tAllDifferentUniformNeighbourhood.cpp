@@ -42,4 +42,47 @@ TEST_F(AllDifferentUniformNeighbourhoodTest, all_values_are_initialised) {
   }
 }
 
+TEST_F(AllDifferentUniformNeighbourhoodTest, enumerated_swaps_are_distinct) {
+  search::neighbourhoods::AllDifferentUniformNeighbourhood neighbourhood(
+      std::vector<search::SearchVar>(vars), std::vector<Int>{1, 2, 3, 4});
+
+  _assignment->assign(
+      [&](auto& modifier) { neighbourhood.initialise(_d, modifier); });
+
+  std::vector<search::CandidateMove> moves;
+  EXPECT_TRUE(neighbourhood.enumerateMoves(_d, *_assignment, 2, moves));
+  // Each of the 2 selected variables can swap with the 3 other variables:
+  EXPECT_EQ(moves.size(), 2 * 3);
+  for (const auto& move : moves) {
+    ASSERT_EQ(move.size(), 2);
+    EXPECT_EQ(move.value(0), _assignment->value(move.var(1)));
+    EXPECT_EQ(move.value(1), _assignment->value(move.var(0)));
+  }
+}
+
+TEST_F(AllDifferentUniformNeighbourhoodTest,
+       enumerated_moves_assign_free_values) {
+  vars.resize(2, vars.front());
+  search::neighbourhoods::AllDifferentUniformNeighbourhood neighbourhood(
+      std::vector<search::SearchVar>(vars), std::vector<Int>{1, 2, 3, 4});
+
+  _assignment->assign(
+      [&](auto& modifier) { neighbourhood.initialise(_d, modifier); });
+
+  std::vector<search::CandidateMove> moves;
+  for (auto i = 0; i < 100; i++) {
+    moves.clear();
+    EXPECT_TRUE(neighbourhood.enumerateMoves(_d, *_assignment, 1, moves));
+    // The selected variable can take each of the 2 free values:
+    ASSERT_EQ(moves.size(), 2);
+    for (const auto& move : moves) {
+      ASSERT_EQ(move.size(), 1);
+      for (const auto& var : vars) {
+        EXPECT_NE(move.value(0), _assignment->value(var.solverId()));
+      }
+    }
+    neighbourhood.commitMove(moves[i % moves.size()], *_assignment);
+  }
+}
+
 }  // namespace atlantis::testing
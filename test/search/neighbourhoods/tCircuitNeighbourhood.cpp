@@ -86,4 +86,24 @@ TEST_F(CircuitNeighbourhoodTest, moves_maintain_circuit) {
   }
 }
 
+TEST_F(CircuitNeighbourhoodTest, enumerated_moves_maintain_circuit) {
+  static int CONFIDENCE = 100;
+
+  search::neighbourhoods::CircuitNeighbourhood neighbourhood(
+      std::vector<search::SearchVar>(next), 1);
+  _assignment->assign(
+      [&](auto& modifier) { neighbourhood.initialise(_random, modifier); });
+
+  std::vector<search::CandidateMove> moves;
+  for (auto i = 0; i < CONFIDENCE; i++) {
+    moves.clear();
+    EXPECT_TRUE(neighbourhood.enumerateMoves(_random, *_assignment,
+                                             next.size(), moves));
+    // Each of the 4 nodes can be moved to after the 2 other nodes:
+    EXPECT_EQ(moves.size(), 4 * 2);
+    neighbourhood.commitMove(_random.element(moves), *_assignment);
+    expectCycle();
+  }
+}
+
 }  // namespace atlantis::testing
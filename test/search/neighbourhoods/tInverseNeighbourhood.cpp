@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+
+#include "../testHelper.hpp"
+#include "atlantis/search/annealing/annealerContainer.hpp"
+#include "atlantis/search/neighbourhoods/inverseNeighbourhood.hpp"
+
+namespace atlantis::testing {
+
+using namespace atlantis::search;
+
+class InverseNeighbourhoodTest : public ::testing::Test {
+ public:
+  std::shared_ptr<propagation::Solver> _solver;
+  std::shared_ptr<search::Assignment> _assignment;
+  search::RandomProvider _random{123456789};
+
+  size_t numVars{6};
+  Int fOffset{1};
+  Int invfOffset{0};
+  // f followed by invf:
+  std::vector<search::SearchVar> vars;
+
+  void SetUp() override {
+    _solver = std::make_unique<propagation::Solver>();
+
+    _solver->open();
+    const Int n = static_cast<Int>(numVars);
+    for (size_t i = 0; i < numVars; ++i) {
+      vars.emplace_back(_solver->makeIntVar(invfOffset, invfOffset,
+                                            invfOffset + n - 1),
+                        SearchDomain(invfOffset, invfOffset + n - 1));
+    }
+    for (size_t j = 0; j < numVars; ++j) {
+      vars.emplace_back(
+          _solver->makeIntVar(fOffset, fOffset, fOffset + n - 1),
+          SearchDomain(fOffset, fOffset + n - 1));
+    }
+
+    propagation::VarViewId objective = _solver->makeIntVar(0, 0, 0);
+    propagation::VarViewId violation = _solver->makeIntVar(0, 0, 0);
+    _solver->close();
+
+    _assignment = std::make_shared<search::Assignment>(
+        *_solver, objective, violation, propagation::ObjectiveDirection::NONE,
+        0);
+  }
+
+  void expectInverse() {
+    for (size_t i = 0; i < numVars; ++i) {
+      const Int j = _solver->committedValue(vars.at(i).solverId());
+      ASSERT_LE(invfOffset, j);
+      ASSERT_LT(j, invfOffset + static_cast<Int>(numVars));
+      EXPECT_EQ(_solver->committedValue(
+                    vars.at(numVars + static_cast<size_t>(j - invfOffset))
+                        .solverId()),
+                static_cast<Int>(i) + fOffset);
+    }
+  }
+};
+
+TEST_F(InverseNeighbourhoodTest, all_values_are_initialised) {
+  search::neighbourhoods::InverseNeighbourhood neighbourhood(
+      std::vector<search::SearchVar>(vars), fOffset, invfOffset);
+
+  _assignment->assign(
+      [&](auto& modifier) { neighbourhood.initialise(_random, modifier); });
+
+  expectInverse();
+}
+
+TEST_F(InverseNeighbourhoodTest, fixed_vars_are_considered) {
+  // f[2] = 4 and invf[4] = 2:
+  vars.at(1) = search::SearchVar(vars.at(1).solverId(), SearchDomain({4}));
+  vars.at(numVars + 4) =
+      search::SearchVar(vars.at(numVars + 4).solverId(), SearchDomain({2}));
+
+  search::neighbourhoods::InverseNeighbourhood neighbourhood(
+      std::vector<search::SearchVar>(vars), fOffset, invfOffset);
+
+  _assignment->assign(
+      [&](auto& modifier) { neighbourhood.initialise(_random, modifier); });
+
+  expectInverse();
+  EXPECT_EQ(_solver->committedValue(vars.at(1).solverId()), 4);
+  EXPECT_EQ(_solver->committedValue(vars.at(numVars + 4).solverId()), 2);
+}
+
+TEST_F(InverseNeighbourhoodTest, moves_maintain_inverse) {
+  static int CONFIDENCE = 1000;
+
+  vars.at(3) = search::SearchVar(vars.at(3).solverId(), SearchDomain({0}));
+  vars.at(numVars) =
+      search::SearchVar(vars.at(numVars).solverId(), SearchDomain({4}));
+
+  search::neighbourhoods::InverseNeighbourhood neighbourhood(
+      std::vector<search::SearchVar>(vars), fOffset, invfOffset);
+  _assignment->assign(
+      [&](auto& modifier) { neighbourhood.initialise(_random, modifier); });
+
+  auto schedule = search::AnnealerContainer::cooling(0.99, 4);
+  AlwaysAcceptingAnnealer annealer(*_assignment, _random, *schedule);
+
+  for (auto i = 0; i < CONFIDENCE; i++) {
+    EXPECT_TRUE(neighbourhood.randomMove(_random, *_assignment, annealer));
+    expectInverse();
+    EXPECT_EQ(_solver->committedValue(vars.at(3).solverId()), 0);
+    EXPECT_EQ(_solver->committedValue(vars.at(numVars).solverId()), 4);
+  }
+}
+
+}  // namespace atlantis::testing
@@ -8,6 +8,7 @@ namespace atlantis::testing {
 
 using namespace atlantis::search;
 
+using ::testing::_;
 using ::testing::Ref;
 using ::testing::Return;
 using ::testing::ReturnRef;
@@ -22,8 +23,19 @@ class MockNeighbourhood : public search::neighbourhoods::Neighbourhood {
               (search::RandomProvider&, search::Assignment&, search::Annealer&),
               (override));
 
+  MOCK_METHOD(bool, enumerateMoves,
+              (search::RandomProvider&, const search::Assignment&, size_t,
+               std::vector<search::CandidateMove>&),
+              (override));
+
+  MOCK_METHOD(void, commitMove,
+              (const search::CandidateMove&, search::Assignment&), (override));
+
   MOCK_METHOD(const std::vector<search::SearchVar>&, coveredVars, (),
               (const override));
+
+  MOCK_METHOD(std::shared_ptr<search::neighbourhoods::Neighbourhood>, clone, (),
+              (const override));
 };
 
 class NeighbourhoodCombinatorTest : public ::testing::Test {
@@ -92,4 +104,33 @@ TEST_F(NeighbourhoodCombinatorTest,
   combinator.randomMove(random, assignment, annealer);
 }
 
+TEST_F(NeighbourhoodCombinatorTest,
+       commitMove_calls_the_neighbourhood_that_enumerated_the_moves) {
+  EXPECT_CALL(*n1, coveredVars()).WillRepeatedly(ReturnRef(vars));
+  EXPECT_CALL(*n2, coveredVars()).WillRepeatedly(ReturnRef(vars));
+
+  search::neighbourhoods::NeighbourhoodCombinator combinator(std::move(ns));
+
+  propagation::Solver solver;
+  search::RandomProvider random(123456789);
+  search::Assignment assignment(solver, propagation::NULL_ID,
+                                propagation::NULL_ID,
+                                propagation::ObjectiveDirection::NONE, Int{0});
+
+  std::vector<search::CandidateMove> moves;
+  EXPECT_CALL(*n1, enumerateMoves(_, _, _, _)).Times(0);
+  EXPECT_CALL(*n2, enumerateMoves(Ref(random), Ref(assignment), 4, Ref(moves)))
+      .WillOnce(Return(true));
+
+  EXPECT_TRUE(combinator.enumerateMoves(random, assignment, 4, moves));
+
+  const search::CandidateMove move(
+      std::array<propagation::VarViewId, 1>{propagation::NULL_ID},
+      std::array<Int, 1>{0});
+  EXPECT_CALL(*n1, commitMove(_, _)).Times(0);
+  EXPECT_CALL(*n2, commitMove(Ref(move), Ref(assignment))).Times(1);
+
+  combinator.commitMove(move, assignment);
+}
+
 }  // namespace atlantis::testing
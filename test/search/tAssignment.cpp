@@ -1,9 +1,13 @@
 #include <gtest/gtest.h>
 
+#include <stdexcept>
+#include <vector>
+
 #include "atlantis/propagation/invariants/linear.hpp"
 #include "atlantis/propagation/solver.hpp"
 #include "atlantis/propagation/violationInvariants/equal.hpp"
 #include "atlantis/search/assignment.hpp"
+#include "atlantis/search/move.hpp"
 
 namespace atlantis::testing {
 
@@ -100,6 +104,132 @@ TEST_F(AssignmentTest, probe) {
   EXPECT_EQ(cost.evaluate(1, 1), 1);
 }
 
+TEST_F(AssignmentTest, probe_batch) {
+  search::Assignment assignment{solver, violation, a,
+                                propagation::ObjectiveDirection::MINIMIZE,
+                                solver.lowerBound(a)};
+
+  std::vector<Move<2>> moves;
+  for (Int valA = 0; valA <= 4; ++valA) {
+    for (Int valB = 0; valB <= 4; ++valB) {
+      moves.emplace_back(std::array<propagation::VarViewId, 2>{a, b},
+                         std::array<Int, 2>{valA, valB});
+    }
+  }
+
+  auto costs = assignment.probeBatch(moves);
+  ASSERT_EQ(costs.size(), moves.size());
+
+  // The batch does not change the assignment:
+  EXPECT_EQ(assignment.value(a), 0);
+  EXPECT_EQ(assignment.value(b), 0);
+  EXPECT_EQ(assignment.cost().evaluate(1, 1), 3);
+
+  size_t i = 0;
+  for (Int valA = 0; valA <= 4; ++valA) {
+    for (Int valB = 0; valB <= 4; ++valB) {
+      auto cost = assignment.probe([&](auto& modifications) {
+        modifications.set(a, valA);
+        modifications.set(b, valB);
+      });
+      EXPECT_EQ(costs[i].evaluate(1, 1), cost.evaluate(1, 1));
+      EXPECT_EQ(costs[i].satisfiesConstraints(), valA + valB == 3);
+      ++i;
+    }
+  }
+
+  moves[7].commit(assignment);
+  EXPECT_EQ(assignment.cost().evaluate(1, 1), costs[7].evaluate(1, 1));
+}
+
+TEST_F(AssignmentTest, probe_batch_into_buffer) {
+  search::Assignment assignment{solver, violation, a,
+                                propagation::ObjectiveDirection::MINIMIZE,
+                                solver.lowerBound(a)};
+
+  std::vector<Move<2>> moves;
+  for (Int valA = 0; valA <= 4; ++valA) {
+    moves.emplace_back(std::array<propagation::VarViewId, 2>{a, b},
+                       std::array<Int, 2>{valA, 3 - valA});
+  }
+
+  const auto expected = assignment.probeBatch(moves);
+
+  // Stale entries of the buffer are replaced:
+  std::vector<Cost> costs(2 * moves.size(), assignment.cost());
+  assignment.probeBatch(moves, costs);
+  ASSERT_EQ(costs.size(), moves.size());
+  for (size_t i = 0; i < moves.size(); ++i) {
+    EXPECT_EQ(costs[i].evaluate(1, 1), expected[i].evaluate(1, 1));
+    EXPECT_EQ(costs[i].satisfiesConstraints(),
+              expected[i].satisfiesConstraints());
+  }
+
+  // Probing again reuses the storage of the buffer:
+  const Cost* data = costs.data();
+  assignment.probeBatch(moves, costs);
+  EXPECT_EQ(costs.data(), data);
+  ASSERT_EQ(costs.size(), moves.size());
+}
+
+TEST_F(AssignmentTest, probe_batch_exception) {
+  search::Assignment assignment{solver, violation, a,
+                                propagation::ObjectiveDirection::MINIMIZE,
+                                solver.lowerBound(a)};
+
+  // A move that fails in the middle of modifying the assignment:
+  struct FailingMove {
+    propagation::VarViewId var;
+    const Cost& probe(const Assignment& assignment) {
+      static_cast<void>(assignment.probe([&](auto& modifications) {
+        modifications.set(var, 2);
+        throw std::runtime_error("failing move");
+      }));
+      throw std::logic_error("unreachable");
+    }
+  };
+  std::vector<FailingMove> moves{FailingMove{a}};
+  EXPECT_THROW(static_cast<void>(assignment.probeBatch(moves)),
+               std::runtime_error);
+
+  // The solver is idle and the failed move is discarded:
+  EXPECT_FALSE(solver.isProbingBatch());
+  EXPECT_EQ(assignment.value(a), 0);
+  auto cost = assignment.probe(
+      [&](auto& modifications) { modifications.set(b, 3); });
+  EXPECT_TRUE(cost.satisfiesConstraints());
+  EXPECT_EQ(cost.evaluate(1, 1), 0);
+}
+
+TEST_F(AssignmentTest, commit_probed_move) {
+  search::Assignment assignment{solver, violation, a,
+                                propagation::ObjectiveDirection::MINIMIZE,
+                                solver.lowerBound(a)};
+
+  Move<2> move({a, b}, {1, 2});
+  const auto cost = move.probe(assignment);
+  EXPECT_TRUE(assignment.commitProbe(assignment.probeTimestamp()));
+  // The probe can only be committed once:
+  EXPECT_FALSE(assignment.commitProbe(assignment.probeTimestamp()));
+
+  EXPECT_EQ(assignment.value(a), 1);
+  EXPECT_EQ(assignment.value(b), 2);
+  EXPECT_EQ(assignment.cost().evaluate(1, 1), cost.evaluate(1, 1));
+  EXPECT_TRUE(assignment.satisfiesConstraints());
+
+  // A move that is not the latest probe is propagated when committed:
+  Move<1> first({a}, {3});
+  Move<1> second({b}, {0});
+  static_cast<void>(first.probe(assignment));
+  static_cast<void>(second.probe(assignment));
+  first.commit(assignment);
+
+  EXPECT_EQ(assignment.value(a), 3);
+  EXPECT_EQ(assignment.value(b), 2);
+  EXPECT_EQ(assignment.value(c), 5);
+  EXPECT_FALSE(assignment.satisfiesConstraints());
+}
+
 TEST_F(AssignmentTest, satisfies_constraints) {
   search::Assignment assignment{solver, violation, a,
                                 propagation::ObjectiveDirection::MINIMIZE,
@@ -2,6 +2,7 @@
 
 #include "atlantis/propagation/solver.hpp"
 #include "atlantis/search/objective.hpp"
+#include "atlantis/search/sharedSearchState.hpp"
 #include "fznparser/model.hpp"
 
 namespace atlantis::testing {
@@ -112,4 +113,70 @@ TEST_F(ObjectiveTest, maximisation_objective) {
   EXPECT_EQ(_solver->committedValue(*searchObjective.bound()), 8);
 }
 
+TEST_F(ObjectiveTest, shared_minimisation_bound) {
+  fznparser::IntSet domain(1, 10);
+  SharedSearchState sharedState(propagation::ObjectiveDirection::MINIMIZE);
+
+  search::Objective searchObjective(*_solver, fznparser::ProblemType::MINIMIZE);
+  searchObjective.share(sharedState);
+  auto violation = install(searchObjective, domain, 5);
+
+  propagation::Solver otherSolver;
+  search::Objective otherObjective(otherSolver,
+                                   fznparser::ProblemType::MINIMIZE);
+  otherObjective.share(sharedState);
+  otherSolver.open();
+  auto otherObjectiveVarId = otherSolver.makeIntVar(8, 1, 10);
+  auto otherViolation = otherObjective.registerNode(
+      otherSolver.makeIntVar(0, 0, 0), otherObjectiveVarId);
+  otherSolver.close();
+
+  // Nothing has been published yet:
+  otherObjective.adoptSharedBound();
+  EXPECT_EQ(otherSolver.committedValue(*otherObjective.bound()), 10);
+
+  searchObjective.tighten();
+  EXPECT_EQ(sharedState.objectiveBound(), 4);
+  EXPECT_EQ(_solver->committedValue(*searchObjective.bound()), 4);
+
+  // The other objective adopts the tighter shared bound:
+  otherObjective.adoptSharedBound();
+  EXPECT_EQ(otherSolver.committedValue(*otherObjective.bound()), 4);
+  EXPECT_EQ(otherSolver.committedValue(otherViolation), 4);
+
+  // Tightening to a looser bound than the shared bound keeps the shared one:
+  otherObjective.tighten();
+  EXPECT_EQ(sharedState.objectiveBound(), 4);
+  EXPECT_EQ(otherSolver.committedValue(*otherObjective.bound()), 4);
+
+  // A bound that is looser than the committed bound is not adopted:
+  _solver->beginMove();
+  _solver->setValue(objectiveVarId, 2);
+  _solver->endMove();
+  _solver->beginCommit();
+  _solver->query(violation);
+  _solver->endCommit();
+  searchObjective.tighten();
+  EXPECT_EQ(sharedState.objectiveBound(), 1);
+  EXPECT_EQ(_solver->committedValue(*searchObjective.bound()), 1);
+  searchObjective.adoptSharedBound();
+  EXPECT_EQ(_solver->committedValue(*searchObjective.bound()), 1);
+}
+
+TEST_F(ObjectiveTest, shared_maximisation_bound) {
+  SharedSearchState sharedState(propagation::ObjectiveDirection::MAXIMIZE);
+
+  EXPECT_EQ(sharedState.tightenObjectiveBound(3), 3);
+  EXPECT_EQ(sharedState.tightenObjectiveBound(2), 3);
+  EXPECT_EQ(sharedState.tightenObjectiveBound(7), 7);
+  EXPECT_TRUE(sharedState.isTighterThan(6));
+  EXPECT_FALSE(sharedState.isTighterThan(7));
+  EXPECT_FALSE(sharedState.foundSolution());
+  EXPECT_FALSE(sharedState.stopped());
+  sharedState.registerSolution();
+  sharedState.stop();
+  EXPECT_TRUE(sharedState.foundSolution());
+  EXPECT_TRUE(sharedState.stopped());
+}
+
 }  // namespace atlantis::testing
@@ -0,0 +1,255 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <chrono>
+#include <limits>
+#include <optional>
+#include <unordered_set>
+
+#include "atlantis/logging/logger.hpp"
+#include "atlantis/propagation/invariants/linear.hpp"
+#include "atlantis/propagation/solver.hpp"
+#include "atlantis/propagation/violationInvariants/allDifferent.hpp"
+#include "atlantis/search/annealing/annealerContainer.hpp"
+#include "atlantis/search/neighbourhoods/allDifferentUniformNeighbourhood.hpp"
+#include "atlantis/search/neighbourhoods/randomNeighbourhood.hpp"
+#include "atlantis/search/objective.hpp"
+#include "atlantis/search/searchController.hpp"
+#include "atlantis/search/tabuSearch.hpp"
+#include "fznparser/model.hpp"
+
+namespace atlantis::testing {
+
+using namespace atlantis::search;
+
+// A random neighbourhood that cannot enumerate its moves:
+class SamplingNeighbourhood : public neighbourhoods::RandomNeighbourhood {
+ public:
+  size_t numRandomMoves{0};
+
+  explicit SamplingNeighbourhood(std::vector<SearchVar>&& vars)
+      : RandomNeighbourhood(std::move(vars)) {}
+
+  bool randomMove(RandomProvider& random, Assignment& assignment,
+                  Annealer& annealer) override {
+    ++numRandomMoves;
+    return RandomNeighbourhood::randomMove(random, assignment, annealer);
+  }
+
+  bool enumerateMoves(RandomProvider&, const Assignment&, size_t,
+                      std::vector<CandidateMove>&) override {
+    return false;
+  }
+};
+
+class TabuSearchTest : public ::testing::Test {
+ public:
+  static constexpr Int NUM_VARS = 8;
+
+  std::shared_ptr<propagation::Solver> _solver;
+  std::shared_ptr<Objective> _objective;
+  std::shared_ptr<Assignment> _assignment;
+  RandomProvider _random{123456789};
+  logging::Logger _logger{stderr, logging::Level::LVL_ERROR};
+
+  std::vector<SearchVar> vars;
+
+  // Models the CSP all_different(vars), where each variable has the domain
+  // 1..NUM_VARS:
+  void SetUp() override {
+    _solver = std::make_shared<propagation::Solver>();
+    _objective = std::make_shared<Objective>(*_solver,
+                                             fznparser::ProblemType::SATISFY);
+
+    _solver->open();
+    std::vector<propagation::VarViewId> inputs;
+    for (Int i = 0; i < NUM_VARS; ++i) {
+      inputs.emplace_back(_solver->makeIntVar(1, 1, NUM_VARS));
+      vars.emplace_back(inputs.back(), SearchDomain(1, NUM_VARS));
+    }
+    const propagation::VarViewId totalViolation =
+        _solver->makeIntVar(0, 0, NUM_VARS);
+    _solver->makeViolationInvariant<propagation::AllDifferent>(
+        *_solver, totalViolation, std::move(inputs));
+    const propagation::VarViewId objectiveVar = _solver->makeIntVar(0, 0, 0);
+    const propagation::VarViewId violation =
+        _objective->registerNode(totalViolation, objectiveVar);
+    _solver->close();
+
+    _assignment = std::make_shared<Assignment>(
+        *_solver, violation, objectiveVar,
+        propagation::ObjectiveDirection::NONE, 0);
+  }
+
+  bool solve(neighbourhoods::Neighbourhood& neighbourhood) {
+    bool foundSolution = false;
+    SearchController controller(
+        true, [&](const Assignment&) { foundSolution = true; }, [](bool) {},
+        std::optional<std::chrono::milliseconds>(
+            std::chrono::milliseconds(10000)));
+    auto schedule = AnnealerContainer::cooling(0.99, 4);
+    Annealer annealer(*_assignment, _random, *schedule);
+
+    TabuSearch search(_random, *_assignment, neighbourhood, *_objective);
+    search.run(controller, annealer, _logger);
+    return foundSolution;
+  }
+
+  void expectAllDifferent() {
+    std::unordered_set<Int> values;
+    for (const auto& var : vars) {
+      values.emplace(_assignment->value(var.solverId()));
+    }
+    EXPECT_EQ(values.size(), vars.size());
+  }
+};
+
+TEST_F(TabuSearchTest, solves_with_enumerated_single_variable_moves) {
+  neighbourhoods::RandomNeighbourhood neighbourhood{
+      std::vector<SearchVar>(vars)};
+
+  EXPECT_TRUE(solve(neighbourhood));
+  EXPECT_TRUE(_assignment->satisfiesConstraints());
+  expectAllDifferent();
+}
+
+TEST_F(TabuSearchTest, solves_with_enumerated_swaps) {
+  std::vector<Int> domain;
+  for (Int i = 1; i <= NUM_VARS; ++i) {
+    domain.emplace_back(i);
+  }
+  neighbourhoods::AllDifferentUniformNeighbourhood neighbourhood(
+      std::vector<SearchVar>(vars), std::move(domain));
+
+  EXPECT_TRUE(solve(neighbourhood));
+  expectAllDifferent();
+}
+
+TEST_F(TabuSearchTest, falls_back_to_random_moves) {
+  SamplingNeighbourhood neighbourhood{std::vector<SearchVar>(vars)};
+
+  EXPECT_TRUE(solve(neighbourhood));
+  EXPECT_GT(neighbourhood.numRandomMoves, 0);
+  expectAllDifferent();
+}
+
+// Exposes the steps of an iteration:
+class StepwiseTabuSearch : public TabuSearch {
+ public:
+  using TabuSearch::commitBestMove;
+  using TabuSearch::isTabu;
+  using TabuSearch::TabuSearch;
+
+  std::vector<CandidateMove>& moves() { return _moves; }
+
+  [[nodiscard]] size_t tabuListSize() const { return _tabuUntil.size(); }
+};
+
+class TabuListTest : public ::testing::Test {
+ public:
+  static constexpr size_t TENURE = 3;
+  static constexpr Int NO_LOWEST_COST = std::numeric_limits<Int>::max();
+
+  std::shared_ptr<propagation::Solver> _solver;
+  std::shared_ptr<Objective> _objective;
+  std::shared_ptr<Assignment> _assignment;
+  std::shared_ptr<neighbourhoods::RandomNeighbourhood> _neighbourhood;
+  RandomProvider _random{123456789};
+  propagation::VarViewId x{propagation::NULL_ID};
+
+  // Models a single variable x in 1..1000 with the violation x (and thus the
+  // cost x), where x is initially 5:
+  void SetUp() override {
+    _solver = std::make_shared<propagation::Solver>();
+    _objective = std::make_shared<Objective>(*_solver,
+                                             fznparser::ProblemType::SATISFY);
+
+    _solver->open();
+    x = _solver->makeIntVar(5, 1, 1000);
+    const propagation::VarViewId totalViolation =
+        _solver->makeIntVar(0, 0, 1000);
+    _solver->makeInvariant<propagation::Linear>(
+        *_solver, totalViolation, std::vector<propagation::VarViewId>{x});
+    const propagation::VarViewId objectiveVar = _solver->makeIntVar(0, 0, 0);
+    const propagation::VarViewId violation =
+        _objective->registerNode(totalViolation, objectiveVar);
+    _solver->close();
+
+    _assignment = std::make_shared<Assignment>(
+        *_solver, violation, objectiveVar,
+        propagation::ObjectiveDirection::NONE, 0);
+    _neighbourhood = std::make_shared<neighbourhoods::RandomNeighbourhood>(
+        std::vector<SearchVar>{SearchVar(x, SearchDomain(1, 1000))});
+  }
+
+  StepwiseTabuSearch makeSearch() {
+    return StepwiseTabuSearch(_random, *_assignment, *_neighbourhood,
+                              *_objective, TENURE);
+  }
+
+  [[nodiscard]] CandidateMove assignX(Int value) const {
+    return CandidateMove(std::array<propagation::VarViewId, 1>{x},
+                         std::array<Int, 1>{value});
+  }
+
+  bool commitBestMove(StepwiseTabuSearch& search, size_t iteration,
+                      Int lowestCost, const std::vector<Int>& values) {
+    search.moves().clear();
+    for (const Int value : values) {
+      search.moves().emplace_back(assignX(value));
+    }
+    return search.commitBestMove(iteration, lowestCost);
+  }
+};
+
+TEST_F(TabuListTest, reverting_a_move_is_tabu_for_tenure_iterations) {
+  auto search = makeSearch();
+
+  EXPECT_TRUE(commitBestMove(search, 1, NO_LOWEST_COST, {7, 3}));
+  EXPECT_EQ(_assignment->value(x), 3);
+
+  for (size_t iteration = 1; iteration <= 1 + TENURE; ++iteration) {
+    EXPECT_TRUE(search.isTabu(assignX(5), iteration));
+  }
+  EXPECT_FALSE(search.isTabu(assignX(5), 2 + TENURE));
+  // Only the value that x was changed from is tabu:
+  EXPECT_FALSE(search.isTabu(assignX(7), 2));
+}
+
+TEST_F(TabuListTest, tabu_moves_are_not_committed) {
+  auto search = makeSearch();
+  EXPECT_TRUE(commitBestMove(search, 1, NO_LOWEST_COST, {3}));
+
+  // Assigning x = 5 is tabu, and does not lower the lowest cost (3):
+  EXPECT_FALSE(commitBestMove(search, 2, 3, {5}));
+  EXPECT_EQ(_assignment->value(x), 3);
+
+  // The best move that is not tabu is committed instead:
+  EXPECT_TRUE(commitBestMove(search, 3, 3, {5, 9}));
+  EXPECT_EQ(_assignment->value(x), 9);
+
+  // After the tenure, the move is allowed again:
+  EXPECT_TRUE(commitBestMove(search, 2 + TENURE, 3, {5, 8}));
+  EXPECT_EQ(_assignment->value(x), 5);
+}
+
+TEST_F(TabuListTest, tabu_moves_to_a_new_lowest_cost_are_aspirated) {
+  auto search = makeSearch();
+  EXPECT_TRUE(commitBestMove(search, 1, NO_LOWEST_COST, {8}));
+
+  // Assigning x = 5 is tabu, but lowers the lowest cost (6):
+  EXPECT_TRUE(commitBestMove(search, 2, 6, {5, 7}));
+  EXPECT_EQ(_assignment->value(x), 5);
+}
+
+TEST_F(TabuListTest, expired_pairs_are_dropped) {
+  auto search = makeSearch();
+  for (size_t iteration = 1; iteration <= 100; ++iteration) {
+    // Every move assigns a new value, which adds a new pair:
+    EXPECT_TRUE(commitBestMove(search, iteration, NO_LOWEST_COST,
+                               {static_cast<Int>(iteration) + 10}));
+    EXPECT_LE(search.tabuListSize(), 2 * TENURE + 1);
+  }
+}
+
+}  // namespace atlantis::testing
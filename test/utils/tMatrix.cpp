@@ -0,0 +1,47 @@
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <vector>
+
+#include "atlantis/types.hpp"
+#include "atlantis/utils/matrix.hpp"
+
+namespace atlantis::testing {
+
+TEST(MatrixTest, RowMajorLayout) {
+  const Matrix<Int> matrix(2, 3, std::vector<Int>{0, 1, 2, 10, 11, 12});
+  EXPECT_EQ(matrix.numRows(), 2);
+  EXPECT_EQ(matrix.numCols(), 3);
+  EXPECT_EQ(matrix.size(), 6);
+  for (size_t r = 0; r < matrix.numRows(); ++r) {
+    for (size_t c = 0; c < matrix.numCols(); ++c) {
+      EXPECT_EQ(matrix(r, c), static_cast<Int>(10 * r + c));
+      EXPECT_EQ(matrix.at(r, c), matrix(r, c));
+      EXPECT_EQ(matrix.row(r)[c], matrix(r, c));
+    }
+  }
+  EXPECT_THROW(static_cast<void>(matrix.at(2, 0)), std::out_of_range);
+  EXPECT_THROW(static_cast<void>(matrix.at(0, 3)), std::out_of_range);
+
+  EXPECT_THROW(Matrix<Int>(2, 2, std::vector<Int>{0, 1, 2}),
+               std::invalid_argument);
+}
+
+TEST(MatrixTest, FromRows) {
+  const std::vector<std::vector<Int>> rows{{0, 1}, {10, 11}, {20, 21}};
+  const Matrix<Int> matrix(rows);
+  EXPECT_EQ(matrix.numRows(), rows.size());
+  EXPECT_EQ(matrix.numCols(), rows.front().size());
+  for (size_t r = 0; r < rows.size(); ++r) {
+    for (size_t c = 0; c < rows[r].size(); ++c) {
+      EXPECT_EQ(matrix(r, c), rows[r][c]);
+    }
+  }
+  EXPECT_EQ(matrix.data(), (std::vector<Int>{0, 1, 10, 11, 20, 21}));
+
+  EXPECT_TRUE(Matrix<Int>(std::vector<std::vector<Int>>{}).empty());
+  EXPECT_THROW(Matrix<Int>(std::vector<std::vector<Int>>{{0, 1}, {2}}),
+               std::invalid_argument);
+}
+
+}  // namespace atlantis::testing
@@ -0,0 +1,66 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include "atlantis/utils/stronglyConnectedComponents.hpp"
+
+namespace atlantis::testing {
+
+static std::vector<std::vector<size_t>> components(
+    const std::vector<std::vector<size_t>>& successors) {
+  std::vector<std::vector<size_t>> result = stronglyConnectedComponents(
+      successors.size(), [&](const size_t v, auto&& visit) {
+        for (const size_t w : successors[v]) {
+          visit(w);
+        }
+      });
+  for (auto& component : result) {
+    std::sort(component.begin(), component.end());
+  }
+  return result;
+}
+
+TEST(StronglyConnectedComponentsTest, Empty) {
+  EXPECT_TRUE(components({}).empty());
+}
+
+TEST(StronglyConnectedComponentsTest, ReverseTopologicalOrder) {
+  // 0 -> 1 -> 2 -> 3 and 1 -> 4:
+  const std::vector<std::vector<size_t>> result =
+      components({{1}, {2, 4}, {3}, {}, {}});
+  ASSERT_EQ(result.size(), 5);
+  std::vector<size_t> position(5);
+  for (size_t c = 0; c < result.size(); ++c) {
+    ASSERT_EQ(result[c].size(), 1);
+    position[result[c].front()] = c;
+  }
+  EXPECT_GT(position[0], position[1]);
+  EXPECT_GT(position[1], position[2]);
+  EXPECT_GT(position[2], position[3]);
+  EXPECT_GT(position[1], position[4]);
+}
+
+TEST(StronglyConnectedComponentsTest, Cycles) {
+  // The cycles 0 -> 1 -> 2 -> 0 and 3 -> 4 -> 3, where 2 -> 3, the self-loop
+  // 5 -> 5, and the isolated node 6:
+  const std::vector<std::vector<size_t>> result =
+      components({{1}, {2}, {0, 3}, {4}, {3}, {5}, {}});
+  EXPECT_EQ(result, (std::vector<std::vector<size_t>>{
+                        {3, 4}, {0, 1, 2}, {5}, {6}}));
+}
+
+TEST(StronglyConnectedComponentsTest, LongPath) {
+  // A cycle that is too long to be found by a recursive search:
+  const size_t n = 1000000;
+  std::vector<std::vector<size_t>> successors(n);
+  for (size_t i = 0; i < n; ++i) {
+    successors[i].emplace_back((i + 1) % n);
+  }
+  const std::vector<std::vector<size_t>> result = components(successors);
+  ASSERT_EQ(result.size(), 1);
+  EXPECT_EQ(result.front().size(), n);
+}
+
+}  // namespace atlantis::testing